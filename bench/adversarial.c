@@ -0,0 +1,247 @@
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <utf.h>
+#include <utf/string.h>
+
+#include "../include/url.h"
+
+/**
+ * Parse generated adversarial inputs of growing size and check that the time
+ * per byte stays flat, exiting with a failure if any input class is more than
+ * `max_ratio` times slower per byte at its largest size than at its smallest.
+ * Results are reported as JSON.
+ */
+
+static const double max_ratio = 4;
+
+static const size_t min_size = 1 << 12;
+static const size_t max_size = 1 << 20;
+
+static double
+now () {
+  struct timespec ts;
+  timespec_get(&ts, TIME_UTC);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+typedef struct {
+  const char *prefix;
+  const char *repeat;
+  const char *suffix;
+
+  /**
+   * Instead of repeating a string, fill with labels of distinct CJK
+   * ideographs, either as is or in their ACE form.
+   */
+  enum {
+    bench_repeat,
+    bench_ideographs,
+    bench_ace,
+  } fill;
+} bench_pattern_t;
+
+static const struct {
+  const char *name;
+  bench_pattern_t pattern;
+} inputs[] = {
+  {"at-signs", {"http://", "a@", "example.com/", bench_repeat}},
+  {"at-signs-password", {"http://user:", "a@", "example.com/", bench_repeat}},
+  {"double-dot-segments", {"http://example.com/", "a/../", "", bench_repeat}},
+  {"double-dot-parents", {"http://example.com/a/", "../", "", bench_repeat}},
+  {"percent-signs-path", {"http://example.com/", "%", "", bench_repeat}},
+  {"percent-signs-query", {"http://example.com/?", "%", "", bench_repeat}},
+  {"percent-signs-opaque-host", {"pear://", "%", "/", bench_repeat}},
+  {"ipv6-brackets", {"http://[", "0", "::]/", bench_repeat}},
+  {"ace-label", {"http://", "", ".com/", bench_ace}},
+  {"unicode-label", {"http://", "", ".com/", bench_ideographs}},
+  {"unicode-label-repeated", {"http://", "\xc3\xa9", ".com/", bench_repeat}},
+  {"dots", {"http://", ".", "example.com/", bench_repeat}},
+  {"slashes", {"http://example.com", "/", "", bench_repeat}},
+};
+
+/**
+ * Fill `result` with a label of up to `size` bytes of distinct CJK
+ * ideographs, in descending order so that every code point is inserted at the
+ * front when decoding the ACE form, and return its length.
+ */
+static size_t
+bench_ideograph_label (size_t size, uint32_t *code_points, size_t *code_points_len, char *result) {
+  size_t len = 0, n = 0;
+
+  for (uint32_t code_point = 0x9fff; len + 3 <= size && code_point >= 0x4e00; code_point--) {
+    code_points[n++] = code_point;
+
+    result[len++] = (char) (0xe0 | (code_point >> 12));
+    result[len++] = (char) (0x80 | ((code_point >> 6) & 0x3f));
+    result[len++] = (char) (0x80 | (code_point & 0x3f));
+  }
+
+  *code_points_len = n;
+
+  return len;
+}
+
+/**
+ * Fill `result` with an ACE label of up to `size` bytes, encoding distinct CJK
+ * ideographs, and return its length.
+ */
+static size_t
+bench_ace_label (size_t size, uint32_t *code_points, char *result) {
+  size_t n;
+
+  bench_ideograph_label(size, code_points, &n, result);
+
+  utf8_string_t ace;
+  utf8_string_init(&ace);
+
+  // Each ideograph takes a few bytes in the ACE form, so drop ideographs
+  // until the label fits.
+  for (;;) {
+    utf8_string_clear(&ace);
+
+    url__punycode_encode(code_points, n, &ace);
+
+    if (ace.len + 4 <= size || n == 0) break;
+
+    n = n * 7 / 8;
+  }
+
+  size_t len = 0;
+
+  if (ace.len + 4 <= size) {
+    memcpy(result, "xn--", 4);
+    memcpy(&result[4], ace.data, ace.len);
+    len = 4 + ace.len;
+  }
+
+  utf8_string_destroy(&ace);
+
+  return len;
+}
+
+/**
+ * Build the input of roughly `size` bytes for `pattern`.
+ */
+static size_t
+bench_generate (const bench_pattern_t *pattern, size_t size, char *result) {
+  static uint32_t code_points[1 << 16];
+
+  size_t len = 0;
+
+  size_t prefix_len = strlen(pattern->prefix);
+  size_t repeat_len = strlen(pattern->repeat);
+  size_t suffix_len = strlen(pattern->suffix);
+
+  memcpy(&result[len], pattern->prefix, prefix_len);
+  len += prefix_len;
+
+  size_t available = size - len - suffix_len;
+
+  if (pattern->fill == bench_repeat) {
+    while (repeat_len <= available) {
+      memcpy(&result[len], pattern->repeat, repeat_len);
+      len += repeat_len;
+
+      available -= repeat_len;
+    }
+  } else {
+    while (available > 1) {
+      size_t n, label_len;
+
+      if (pattern->fill == bench_ideographs) {
+        label_len = bench_ideograph_label(available - 1, code_points, &n, &result[len]);
+      } else {
+        label_len = bench_ace_label(available - 1, code_points, &result[len]);
+      }
+
+      if (label_len == 0) break;
+
+      len += label_len;
+      available -= label_len;
+
+      result[len++] = '.';
+      available--;
+    }
+
+    // Drop the last separator, as the suffix starts its own label.
+    if (result[len - 1] == '.') len--;
+  }
+
+  memcpy(&result[len], pattern->suffix, suffix_len);
+  len += suffix_len;
+
+  return len;
+}
+
+/**
+ * Time parsing the input, repeating it until enough time has passed to be
+ * measured reliably, and return the time per byte.
+ */
+static double
+bench_time (const char *input, size_t len, int *result) {
+  size_t rounds = 0;
+
+  double start = now(), elapsed;
+
+  do {
+    url_t url;
+    url_init(&url);
+    *result = url_parse(&url, (const utf8_t *) input, len, NULL);
+    url_destroy(&url);
+
+    rounds++;
+
+    elapsed = now() - start;
+  } while (elapsed < 2e7);
+
+  return elapsed / rounds / len;
+}
+
+int
+main () {
+  bool linear = true;
+
+  char *input = malloc(max_size);
+
+  printf("{\n  \"inputs\": [");
+
+  for (size_t i = 0, n = sizeof(inputs) / sizeof(inputs[0]); i < n; i++) {
+    printf(i == 0 ? "\n" : ",\n");
+    printf("    {\n");
+    printf("      \"name\": \"%s\",\n", inputs[i].name);
+    printf("      \"sizes\": [");
+
+    double first = 0, last = 0;
+
+    for (size_t size = min_size; size <= max_size; size *= 4) {
+      size_t len = bench_generate(&inputs[i].pattern, size, input);
+
+      int result;
+
+      last = bench_time(input, len, &result);
+
+      if (size == min_size) first = last;
+
+      printf(size == min_size ? "\n" : ",\n");
+      printf("        {\"bytes\": %zu, \"ns_per_byte\": %.3f, \"valid\": %s}", len, last, result == 0 ? "true" : "false");
+    }
+
+    double ratio = last / first;
+
+    if (ratio > max_ratio) linear = false;
+
+    printf("\n      ],\n");
+    printf("      \"ratio\": %.2f\n", ratio);
+    printf("    }");
+  }
+
+  printf("\n  ],\n  \"linear\": %s\n}\n", linear ? "true" : "false");
+
+  free(input);
+
+  return linear ? 0 : 1;
+}
@@ -0,0 +1,69 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <utf.h>
+#include <utf/string.h>
+
+#include "../include/url.h"
+#include "../include/url/corpus.h"
+
+static double
+now () {
+  struct timespec ts;
+  timespec_get(&ts, TIME_UTC);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+int
+main (int argc, char *argv[]) {
+  size_t n = 1000000;
+
+  const char *path = argc > 1 ? argv[1] : "bench-corpus.urlc";
+
+  url_corpus_builder_t *builder;
+  url_corpus_builder_init(&builder);
+
+  double start = now();
+
+  for (size_t i = 0; i < n; i++) {
+    char input[128];
+    int len = snprintf(input, 128, "https://www.site-%zu.example.com/articles/%zu/index.html?ref=%zu", i % 10000, i, i % 7);
+
+    url_corpus_builder_add_input(builder, (utf8_t *) input, len, NULL);
+  }
+
+  double build = now() - start;
+
+  url_corpus_builder_write(builder, path);
+  url_corpus_builder_destroy(builder);
+
+  start = now();
+
+  url_corpus_t *corpus;
+  url_corpus_open(path, &corpus);
+
+  double open = now() - start;
+
+  start = now();
+
+  size_t bytes = 0;
+
+  for (size_t i = 0, m = url_corpus_size(corpus); i < m; i++) {
+    url_t url;
+    url_corpus_get(corpus, i, &url);
+
+    bytes += url_get_host(&url).len;
+  }
+
+  double scan = now() - start;
+
+  url_corpus_close(corpus);
+
+  remove(path);
+
+  printf("urls              %zu\n", n);
+  printf("build ns/url      %.1f\n", build / n);
+  printf("open ns           %.1f\n", open);
+  printf("scan ns/url       %.1f\n", scan / n);
+  printf("host bytes        %zu\n", bytes);
+}
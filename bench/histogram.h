@@ -0,0 +1,89 @@
+// A log-linear histogram in the style of HdrHistogram: values below 2^S are
+// counted exactly, and every power of two above that is split into 2^S equal
+// sub-buckets, keeping the relative error of any recorded value below 2^-S.
+
+#include <stdint.h>
+#include <string.h>
+
+#define bench_histogram_sub_bits    5
+#define bench_histogram_sub_buckets (1 << bench_histogram_sub_bits)
+#define bench_histogram_buckets     ((65 - bench_histogram_sub_bits) * bench_histogram_sub_buckets)
+
+typedef struct {
+  uint64_t counts[bench_histogram_buckets];
+  uint64_t total;
+  uint64_t max;
+} bench_histogram_t;
+
+static inline void
+bench_histogram_init (bench_histogram_t *histogram) {
+  memset(histogram, 0, sizeof(bench_histogram_t));
+}
+
+static inline int
+bench_histogram__floor_log2 (uint64_t value) {
+  int exponent = 0;
+
+  while (value >>= 1) exponent++;
+
+  return exponent;
+}
+
+static inline size_t
+bench_histogram__index (uint64_t value) {
+  if (value < bench_histogram_sub_buckets) return (size_t) value;
+
+  int shift = bench_histogram__floor_log2(value) - bench_histogram_sub_bits;
+
+  return ((size_t) (shift + 1) << bench_histogram_sub_bits) + (size_t) ((value >> shift) - bench_histogram_sub_buckets);
+}
+
+/**
+ * The highest value counted by the bucket at `index`.
+ */
+static inline uint64_t
+bench_histogram__highest (size_t index) {
+  size_t bucket = index >> bench_histogram_sub_bits;
+  uint64_t sub = index & (bench_histogram_sub_buckets - 1);
+
+  if (bucket == 0) return sub;
+
+  int shift = (int) bucket - 1;
+
+  return ((sub + bench_histogram_sub_buckets + 1) << shift) - 1;
+}
+
+static inline void
+bench_histogram_record (bench_histogram_t *histogram, uint64_t value) {
+  histogram->counts[bench_histogram__index(value)]++;
+  histogram->total++;
+
+  if (value > histogram->max) histogram->max = value;
+}
+
+/**
+ * The value at or below which `percentile` percent of the recorded values
+ * fall, within the precision of the histogram.
+ */
+static inline uint64_t
+bench_histogram_percentile (const bench_histogram_t *histogram, double percentile) {
+  if (histogram->total == 0) return 0;
+
+  uint64_t rank = (uint64_t) (percentile / 100 * histogram->total + 0.5);
+
+  if (rank == 0) rank = 1;
+
+  uint64_t seen = 0;
+
+  for (size_t i = 0; i < bench_histogram_buckets; i++) {
+    seen += histogram->counts[i];
+
+    if (seen >= rank) {
+      uint64_t value = bench_histogram__highest(i);
+
+      return value < histogram->max ? value : histogram->max;
+    }
+  }
+
+  return histogram->max;
+}
@@ -0,0 +1,450 @@
+// Non-ASCII labels from the Public Suffix List, https://publicsuffix.org/list/
+
+static const char *idn_labels[] = {
+  "andøy",
+  "askøy",
+  "aurskog-høland",
+  "averøy",
+  "aéroport",
+  "balsan-südtirol",
+  "bearalváhki",
+  "berlevåg",
+  "bievát",
+  "bjarkøy",
+  "bodø",
+  "bozen-südtirol",
+  "brønnøy",
+  "brønnøysund",
+  "bulsan-südtirol",
+  "báhcavuotna",
+  "báhccavuotna",
+  "báidár",
+  "bájddar",
+  "bálát",
+  "bådåddjå",
+  "båtsfjord",
+  "bærum",
+  "bø",
+  "bømlo",
+  "cesena-forlì",
+  "cesenaforlì",
+  "comunicações",
+  "correios-e-telecomunicações",
+  "davvenjárga",
+  "drøbak",
+  "dyrøy",
+  "dønna",
+  "evenášši",
+  "finnøy",
+  "florø",
+  "flå",
+  "forlì-cesena",
+  "forlìcesena",
+  "fræna",
+  "frøya",
+  "førde",
+  "gildeskål",
+  "gjøvik",
+  "gáivuotna",
+  "gálsá",
+  "gáŋgaviika",
+  "günstigbestellen",
+  "günstigliefern",
+  "herøy",
+  "hobøl",
+  "holtålen",
+  "hábmer",
+  "hámmárfeasta",
+  "hápmir",
+  "häkkinen",
+  "hå",
+  "hægebostad",
+  "hønefoss",
+  "høyanger",
+  "høylandet",
+  "inderøy",
+  "jølster",
+  "jørpeland",
+  "karmøy",
+  "klæbu",
+  "kragerø",
+  "kråanghke",
+  "krødsherad",
+  "kvitsøy",
+  "kvæfjord",
+  "kvænangen",
+  "kárášjohka",
+  "kåfjord",
+  "langevåg",
+  "leaŋgaviika",
+  "lindås",
+  "loabát",
+  "lurøy",
+  "láhppi",
+  "läns",
+  "lærdal",
+  "lødingen",
+  "lørenskog",
+  "løten",
+  "meløy",
+  "meråker",
+  "mjøndalen",
+  "mosjøen",
+  "moåreke",
+  "muosát",
+  "málatvuopmi",
+  "mátta-várjjat",
+  "målselv",
+  "måsøy",
+  "møre-og-romsdal",
+  "māori",
+  "návuotna",
+  "nååmesjevuemie",
+  "nærøy",
+  "nøtterøy",
+  "oppegård",
+  "osterøy",
+  "osøyro",
+  "porsáŋgu",
+  "radøy",
+  "rennesøy",
+  "risør",
+  "ráhkkerávju",
+  "ráisa",
+  "råde",
+  "råholt",
+  "rælingen",
+  "rødøy",
+  "rømskog",
+  "røros",
+  "røst",
+  "røyken",
+  "røyrvik",
+  "sandnessjøen",
+  "sandøy",
+  "skiervá",
+  "skjervøy",
+  "skjåk",
+  "skánit",
+  "skånland",
+  "smøla",
+  "snåase",
+  "snåsa",
+  "stjørdal",
+  "stjørdalshalsen",
+  "sálat",
+  "sálát",
+  "søgne",
+  "sømna",
+  "søndre-land",
+  "sør-aurdal",
+  "sør-fron",
+  "sør-odal",
+  "sør-varanger",
+  "sørfold",
+  "sørreisa",
+  "sørum",
+  "südtirol",
+  "tjøme",
+  "tranøy",
+  "trentin-süd-tirol",
+  "trentin-südtirol",
+  "trentino-süd-tirol",
+  "trentino-südtirol",
+  "trentinosüd-tirol",
+  "trentinosüdtirol",
+  "trentinsüd-tirol",
+  "trentinsüdtirol",
+  "tromsø",
+  "træna",
+  "trøgstad",
+  "tysvær",
+  "tønsberg",
+  "unjárga",
+  "vadsø",
+  "vallée-aoste",
+  "vallée-d-aoste",
+  "valléeaoste",
+  "valléedaoste",
+  "vardø",
+  "vegårshei",
+  "vermögensberater",
+  "vermögensberatung",
+  "vestvågøy",
+  "várggát",
+  "vågan",
+  "vågsøy",
+  "vågå",
+  "våler",
+  "værøy",
+  "ákŋoluokta",
+  "álaheadju",
+  "áltá",
+  "åfjord",
+  "åkrehamn",
+  "ål",
+  "ålesund",
+  "ålgård",
+  "åmli",
+  "åmot",
+  "årdal",
+  "ås",
+  "åseral",
+  "åsnes",
+  "øksnes",
+  "ørland",
+  "ørskog",
+  "ørsta",
+  "østfold",
+  "østre-toten",
+  "øvre-eiker",
+  "øyer",
+  "øygarden",
+  "øystre-slidre",
+  "čáhcesuolo",
+  "ελ",
+  "ευ",
+  "ак",
+  "бг",
+  "бел",
+  "биз",
+  "дети",
+  "ею",
+  "иком",
+  "католик",
+  "ком",
+  "крым",
+  "мир",
+  "мкд",
+  "мон",
+  "москва",
+  "мск",
+  "обр",
+  "од",
+  "онлайн",
+  "орг",
+  "пр",
+  "рус",
+  "рф",
+  "сайт",
+  "самара",
+  "сочи",
+  "спб",
+  "срб",
+  "укр",
+  "упр",
+  "я",
+  "қаз",
+  "հայ",
+  "אקדמיה",
+  "ירושלים",
+  "ישוב",
+  "ישראל",
+  "ממשל",
+  "צהל",
+  "קום",
+  "ابوظبي",
+  "اتصالات",
+  "ارامكو",
+  "الاردن",
+  "البحرين",
+  "الجزائر",
+  "السعودية",
+  "السعوديه",
+  "السعودیة",
+  "السعودیۃ",
+  "العليان",
+  "المغرب",
+  "اليمن",
+  "امارات",
+  "ايران",
+  "ایران",
+  "بارت",
+  "بازار",
+  "بيتك",
+  "بھارت",
+  "تونس",
+  "سودان",
+  "سوريا",
+  "سورية",
+  "شبكة",
+  "عراق",
+  "عرب",
+  "عمان",
+  "فلسطين",
+  "قطر",
+  "كاثوليك",
+  "كوم",
+  "مصر",
+  "مليسيا",
+  "موريتانيا",
+  "موقع",
+  "همراه",
+  "پاكستان",
+  "پاکستان",
+  "ڀارت",
+  "कॉम",
+  "नेट",
+  "भारत",
+  "भारतम्",
+  "भारोत",
+  "संगठन",
+  "বাংলা",
+  "ভারত",
+  "ভাৰত",
+  "ਭਾਰਤ",
+  "ભારત",
+  "ଭାରତ",
+  "இந்தியா",
+  "இலங்கை",
+  "சிங்கப்பூர்",
+  "భారత్",
+  "ಭಾರತ",
+  "ഭാരതം",
+  "ලංකා",
+  "คอม",
+  "ทหาร",
+  "ธุรกิจ",
+  "รัฐบาล",
+  "ศึกษา",
+  "องค์กร",
+  "เน็ต",
+  "ไทย",
+  "ລາວ",
+  "გე",
+  "みんな",
+  "アマゾン",
+  "クラウド",
+  "グーグル",
+  "コム",
+  "ストア",
+  "セール",
+  "ファッション",
+  "ポイント",
+  "三重",
+  "世界",
+  "个人",
+  "中信",
+  "中国",
+  "中國",
+  "中文网",
+  "亚马逊",
+  "京都",
+  "企业",
+  "佐賀",
+  "佛山",
+  "信息",
+  "個人",
+  "健康",
+  "八卦",
+  "公司",
+  "公益",
+  "兵庫",
+  "北海道",
+  "千葉",
+  "台湾",
+  "台灣",
+  "和歌山",
+  "商城",
+  "商店",
+  "商标",
+  "商業",
+  "嘉里",
+  "嘉里大酒店",
+  "在线",
+  "埼玉",
+  "大分",
+  "大拿",
+  "大阪",
+  "天主教",
+  "奈良",
+  "娱乐",
+  "宮城",
+  "宮崎",
+  "家電",
+  "富山",
+  "山口",
+  "山形",
+  "山梨",
+  "岐阜",
+  "岡山",
+  "岩手",
+  "島根",
+  "广东",
+  "広島",
+  "微博",
+  "徳島",
+  "愛媛",
+  "愛知",
+  "慈善",
+  "我爱你",
+  "手机",
+  "招聘",
+  "政务",
+  "政府",
+  "敎育",
+  "教育",
+  "新加坡",
+  "新潟",
+  "新闻",
+  "时尚",
+  "書籍",
+  "机构",
+  "東京",
+  "栃木",
+  "沖縄",
+  "淡马锡",
+  "游戏",
+  "滋賀",
+  "澳門",
+  "澳门",
+  "点看",
+  "熊本",
+  "石川",
+  "神奈川",
+  "福井",
+  "福岡",
+  "福島",
+  "秋田",
+  "移动",
+  "箇人",
+  "組織",
+  "組织",
+  "網絡",
+  "網络",
+  "網路",
+  "组織",
+  "组织",
+  "组织机构",
+  "网址",
+  "网店",
+  "网站",
+  "网絡",
+  "网络",
+  "群馬",
+  "联通",
+  "臺灣",
+  "茨城",
+  "谷歌",
+  "购物",
+  "通販",
+  "長崎",
+  "長野",
+  "集团",
+  "電訊盈科",
+  "青森",
+  "静岡",
+  "飞利浦",
+  "食品",
+  "餐厅",
+  "香川",
+  "香格里拉",
+  "香港",
+  "高知",
+  "鳥取",
+  "鹿児島",
+  "닷넷",
+  "닷컴",
+  "삼성",
+  "한국",
+};
@@ -0,0 +1,72 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <utf.h>
+#include <utf/string.h>
+
+#include "../include/url.h"
+
+static double
+now () {
+  struct timespec ts;
+  timespec_get(&ts, TIME_UTC);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static const char *addresses[] = {
+  "2001:db8::ff00:42:8329",
+  "2001:0db8:0000:0000:0000:ff00:0042:8329",
+  "fe80::1ff:fe23:4567:890a",
+  "::1",
+  "::",
+  "2606:4700:4700::1111",
+  "2a00:1450:4001:82a::200e",
+  "FE80:0:0:0:202:B3FF:FE1E:8329",
+  "1:2:3:4:5:6:7:8",
+  "::ffff:192.0.2.128",
+};
+
+int
+main () {
+  size_t rounds = 1000000;
+
+  size_t len = sizeof(addresses) / sizeof(addresses[0]);
+
+  size_t bytes = 0;
+
+  for (size_t i = 0; i < len; i++) bytes += strlen(addresses[i]);
+
+  utf8_string_t output;
+  utf8_string_init(&output);
+
+  uint8_t result[16];
+
+  double start = now();
+
+  for (size_t r = 0; r < rounds; r++) {
+    for (size_t i = 0; i < len; i++) {
+      utf8_string_clear(&output);
+      url__parse_ipv6(utf8_string_view_init((utf8_t *) addresses[i], strlen(addresses[i])), result, &output);
+    }
+  }
+
+  double parse = now() - start;
+
+  uint16_t address[8] = {0x2001, 0xdb8, 0, 0, 0, 0xff00, 0x42, 0x8329};
+
+  start = now();
+
+  for (size_t r = 0; r < rounds * len; r++) {
+    utf8_string_clear(&output);
+    url__serialize_ipv6(address, &output);
+  }
+
+  double serialize = now() - start;
+
+  printf("addresses            %zu (%.1f bytes on average)\n", len, (double) bytes / len);
+  printf("parse ns/address     %.1f\n", parse / (rounds * len));
+  printf("serialize ns/address %.1f\n", serialize / (rounds * len));
+
+  utf8_string_destroy(&output);
+}
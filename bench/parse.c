@@ -1,12 +1,461 @@
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <utf.h>
+#include <utf/string.h>
+
 #include "../include/url.h"
+#include "../include/url/trace.h"
+#include "histogram.h"
+#include "perf.h"
 
-int
-main () {
-  url_t url;
+/**
+ * Parse benchmark over corpus files, reporting ns/URL, MB/s, allocations and
+ * the parse trace counters per URL for each corpus as JSON:
+ *
+ *   parse [--min-time <seconds>] [--perf] [--latency] [--batch <n>] <corpus>...
+ *
+ * A corpus holds one input per line, optionally followed by a tab and a base
+ * URL to parse the input against. Inputs are timed in rounds over the whole
+ * corpus until the minimum time has passed.
+ *
+ * With --perf, hardware counters are also read around the timed rounds and
+ * reported per URL and per byte, with null for counters that are unavailable.
+ *
+ * With --latency, inputs are also timed one at a time, in batches of repeated
+ * parses of the same input to amortize the cost of reading the clock, and the
+ * percentiles of the latencies are reported along with the slowest input.
+ */
+
+#if defined(__GLIBC__)
+#define bench_count_allocations 1
+
+extern void *
+__libc_malloc (size_t size);
+
+extern void *
+__libc_calloc (size_t count, size_t size);
+
+extern void *
+__libc_realloc (void *ptr, size_t size);
+
+extern void
+__libc_free (void *ptr);
+
+static uint64_t bench__allocations = 0;
+
+void *
+malloc (size_t size) {
+  bench__allocations++;
+  return __libc_malloc(size);
+}
+
+void *
+calloc (size_t count, size_t size) {
+  bench__allocations++;
+  return __libc_calloc(count, size);
+}
+
+void *
+realloc (void *ptr, size_t size) {
+  bench__allocations++;
+  return __libc_realloc(ptr, size);
+}
+
+void
+free (void *ptr) {
+  __libc_free(ptr);
+}
+#else
+#define bench_count_allocations 0
+#endif
+
+typedef struct {
+  utf8_string_view_t input;
+
+  /**
+   * The parsed base URL, or NULL if the input is absolute.
+   */
+  url_t *base;
+} bench_entry_t;
+
+typedef struct {
+  const char *path;
+
+  utf8_t *data;
+
+  bench_entry_t *entries;
+  size_t len;
+
+  size_t bytes;
+  size_t failures;
+} bench_corpus_t;
+
+static double
+now () {
+  struct timespec ts;
+  timespec_get(&ts, TIME_UTC);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static int
+bench_corpus_load (const char *path, bench_corpus_t *result) {
+  int err;
+
+  memset(result, 0, sizeof(bench_corpus_t));
+
+  result->path = path;
+
+  FILE *file = fopen(path, "rb");
+  if (file == NULL) return -1;
+
+  err = fseek(file, 0, SEEK_END);
+  if (err < 0) goto err;
+
+  long size = ftell(file);
+  if (size < 0) goto err;
+
+  rewind(file);
+
+  result->data = malloc(size + 1);
+  if (result->data == NULL) goto err;
+
+  if (fread(result->data, 1, size, file) != (size_t) size) goto err;
+
+  fclose(file);
+
+  file = NULL;
 
-  for (size_t i = 0; i < 10000000; i++) {
+  size_t capacity = 0;
+
+  for (long i = 0; i < size; i++) {
+    if (result->data[i] == '\n') capacity++;
+  }
+
+  result->entries = calloc(capacity + 1, sizeof(bench_entry_t));
+  if (result->entries == NULL) goto err;
+
+  utf8_t *line = result->data, *end = &result->data[size];
+
+  while (line < end) {
+    utf8_t *eol = memchr(line, '\n', end - line);
+    if (eol == NULL) eol = end;
+
+    size_t len = eol - line;
+
+    if (len > 0 && line[len - 1] == '\r') len--;
+
+    if (len > 0) {
+      bench_entry_t *entry = &result->entries[result->len++];
+
+      utf8_t *tab = memchr(line, '\t', len);
+
+      if (tab) {
+        entry->input = utf8_string_view_init(line, tab - line);
+
+        entry->base = malloc(sizeof(url_t));
+        if (entry->base == NULL) goto err;
+
+        url_init(entry->base);
+
+        err = url_parse(entry->base, tab + 1, len - (tab + 1 - line), NULL);
+        if (err < 0) goto err;
+      } else {
+        entry->input = utf8_string_view_init(line, len);
+      }
+
+      result->bytes += entry->input.len;
+    }
+
+    line = eol + 1;
+  }
+
+  return 0;
+
+err:
+  if (file) fclose(file);
+
+  return -1;
+}
+
+static void
+bench_corpus_destroy (bench_corpus_t *corpus) {
+  for (size_t i = 0; i < corpus->len; i++) {
+    url_t *base = corpus->entries[i].base;
+
+    if (base) {
+      url_destroy(base);
+      free(base);
+    }
+  }
+
+  free(corpus->entries);
+  free(corpus->data);
+}
+
+static size_t
+bench_corpus_parse (const bench_corpus_t *corpus, bool sample) {
+  size_t failures = 0;
+
+  for (size_t i = 0; i < corpus->len; i++) {
+    const bench_entry_t *entry = &corpus->entries[i];
+
+    url_t url;
     url_init(&url);
-    url_parse(&url, (utf8_t *) "https://example.com/hello/world?query=string#fragment", -1, NULL);
+
+    if (url_parse(&url, entry->input.data, entry->input.len, entry->base) < 0) failures++;
+
+#if !defined(URL_TRACE)
+    if (sample) url_trace_sample(&url);
+#endif
+
     url_destroy(&url);
   }
+
+  return failures;
+}
+
+/**
+ * Time each input in batches of `batch` parses until `min_time` has passed,
+ * recording the mean latency of each batch and the index of the slowest
+ * input.
+ */
+static void
+bench_corpus_latency (const bench_corpus_t *corpus, size_t batch, double min_time, bench_histogram_t *histogram, size_t *slowest) {
+  double start = now(), slowest_latency = 0;
+
+  do {
+    for (size_t i = 0; i < corpus->len; i++) {
+      const bench_entry_t *entry = &corpus->entries[i];
+
+      double batch_start = now();
+
+      for (size_t j = 0; j < batch; j++) {
+        url_t url;
+        url_init(&url);
+        url_parse(&url, entry->input.data, entry->input.len, entry->base);
+        url_destroy(&url);
+      }
+
+      double latency = (now() - batch_start) / batch;
+
+      bench_histogram_record(histogram, (uint64_t) (latency + 0.5));
+
+      if (latency > slowest_latency) {
+        slowest_latency = latency;
+        *slowest = i;
+      }
+    }
+  } while (now() - start < min_time);
+}
+
+static void
+bench_print_string (const char *data, size_t len) {
+  putchar('"');
+
+  for (size_t i = 0; i < len; i++) {
+    unsigned char c = data[i];
+
+    if (c == '"' || c == '\\') printf("\\%c", c);
+    else if (c < 0x20) printf("\\u%04x", c);
+    else putchar(c);
+  }
+
+  putchar('"');
+}
+
+/**
+ * Print the file name of the corpus at `path`, without its directory and
+ * extension, as a JSON string.
+ */
+static void
+bench_print_name (const char *path) {
+  const char *start = path, *end;
+
+  for (const char *c = path; *c; c++) {
+    if (*c == '/' || *c == '\\') start = c + 1;
+  }
+
+  end = strrchr(start, '.');
+  if (end == NULL || end == start) end = start + strlen(start);
+
+  bench_print_string(start, end - start);
+}
+
+int
+main (int argc, char *argv[]) {
+  int err;
+
+  double min_time = 1e9;
+
+  bool use_perf = false, use_latency = false;
+
+  size_t batch = 8;
+
+  int i = 1;
+
+  for (; i < argc; i++) {
+    if (i + 1 < argc && strcmp(argv[i], "--min-time") == 0) {
+      min_time = atof(argv[++i]) * 1e9;
+    } else if (strcmp(argv[i], "--perf") == 0) {
+      use_perf = true;
+    } else if (strcmp(argv[i], "--latency") == 0) {
+      use_latency = true;
+    } else if (i + 1 < argc && strcmp(argv[i], "--batch") == 0) {
+      batch = (size_t) atol(argv[++i]);
+
+      if (batch == 0) batch = 1;
+    } else {
+      break;
+    }
+  }
+
+  if (i == argc) {
+    fprintf(stderr, "usage: %s [--min-time <seconds>] [--perf] [--latency] [--batch <n>] <corpus>...\n", argv[0]);
+
+    return 1;
+  }
+
+  bench_perf_t perf;
+
+  if (use_perf && bench_perf_open(&perf) == 0) {
+    fprintf(stderr, "hardware counters are unavailable\n");
+  }
+
+  printf("{\n  \"corpora\": [");
+
+  for (int first = i; i < argc; i++) {
+    bench_corpus_t corpus;
+
+    err = bench_corpus_load(argv[i], &corpus);
+
+    if (err < 0 || corpus.len == 0) {
+      fprintf(stderr, "could not load corpus %s\n", argv[i]);
+
+      bench_corpus_destroy(&corpus);
+
+      return 1;
+    }
+
+    // Warm up, and count the allocations of a single round.
+#if bench_count_allocations
+    uint64_t allocations = bench__allocations;
+#endif
+
+    url_trace_reset();
+
+    corpus.failures = bench_corpus_parse(&corpus, true);
+
+    url_trace_t trace;
+    url_trace_get(&trace);
+
+#if bench_count_allocations
+    allocations = bench__allocations - allocations;
+#endif
+
+    size_t rounds = 0;
+
+    double counters[bench_perf_count];
+    bool available[bench_perf_count];
+
+    if (use_perf) bench_perf_start(&perf);
+
+    double start = now(), elapsed;
+
+    do {
+      bench_corpus_parse(&corpus, false);
+
+      rounds++;
+
+      elapsed = now() - start;
+    } while (elapsed < min_time);
+
+    if (use_perf) bench_perf_stop(&perf, counters, available);
+
+    static bench_histogram_t histogram;
+
+    size_t slowest = 0;
+
+    if (use_latency) {
+      bench_histogram_init(&histogram);
+
+      bench_corpus_latency(&corpus, batch, min_time, &histogram, &slowest);
+    }
+
+    size_t urls = rounds * corpus.len;
+
+    printf(i == first ? "\n" : ",\n");
+    printf("    {\n");
+    printf("      \"name\": ");
+    bench_print_name(corpus.path);
+    printf(",\n");
+    printf("      \"urls\": %zu,\n", corpus.len);
+    printf("      \"bytes\": %zu,\n", corpus.bytes);
+    printf("      \"failures\": %zu,\n", corpus.failures);
+    printf("      \"rounds\": %zu,\n", rounds);
+    printf("      \"ns_per_url\": %.2f,\n", elapsed / urls);
+    printf("      \"mb_per_s\": %.2f,\n", (double) rounds * corpus.bytes / elapsed * 1e3);
+#if bench_count_allocations
+    printf("      \"allocations_per_url\": %.2f,\n", (double) allocations / corpus.len);
+#else
+    printf("      \"allocations_per_url\": null,\n");
+#endif
+#if defined(URL_TRACE)
+    printf("      \"string_allocations_per_url\": %.2f,\n", (double) trace.allocations / corpus.len);
+    printf("      \"string_reallocations_per_url\": %.2f,\n", (double) trace.reallocations / corpus.len);
+    printf("      \"string_bytes_per_url\": %.2f,\n", (double) trace.bytes / corpus.len);
+#else
+    printf("      \"string_allocations_per_url\": null,\n");
+    printf("      \"string_reallocations_per_url\": null,\n");
+    printf("      \"string_bytes_per_url\": null,\n");
+#endif
+    printf("      \"href_slack_per_url\": %.2f", (double) trace.slack / corpus.len);
+
+    if (use_perf) {
+      for (int j = 0; j < bench_perf_count; j++) {
+        if (available[j]) {
+          printf(",\n      \"%s_per_url\": %.2f", bench_perf_names[j], counters[j] / urls);
+          printf(",\n      \"%s_per_byte\": %.3f", bench_perf_names[j], counters[j] / ((double) rounds * corpus.bytes));
+        } else {
+          printf(",\n      \"%s_per_url\": null", bench_perf_names[j]);
+          printf(",\n      \"%s_per_byte\": null", bench_perf_names[j]);
+        }
+      }
+    }
+
+    if (use_latency) {
+      static const struct {
+        const char *name;
+        double percentile;
+      } percentiles[] = {
+        {"p50", 50},
+        {"p90", 90},
+        {"p99", 99},
+        {"p99_9", 99.9},
+      };
+
+      printf(",\n      \"latency_batch\": %zu", batch);
+      printf(",\n      \"latency_samples\": %llu", (unsigned long long) histogram.total);
+
+      for (size_t j = 0; j < sizeof(percentiles) / sizeof(percentiles[0]); j++) {
+        printf(",\n      \"%s_ns\": %llu", percentiles[j].name, (unsigned long long) bench_histogram_percentile(&histogram, percentiles[j].percentile));
+      }
+
+      printf(",\n      \"max_ns\": %llu", (unsigned long long) histogram.max);
+      printf(",\n      \"slowest_input\": ");
+      bench_print_string((const char *) corpus.entries[slowest].input.data, corpus.entries[slowest].input.len);
+    }
+
+    printf("\n");
+    printf("    }");
+
+    bench_corpus_destroy(&corpus);
+  }
+
+  printf("\n  ]\n}\n");
+
+  if (use_perf) bench_perf_close(&perf);
 }
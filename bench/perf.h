@@ -0,0 +1,137 @@
+// Hardware performance counters around a benchmark run, read through
+// perf_event_open(2) on Linux. Counters that can't be opened, such as inside
+// containers without access to the PMU, are reported as unavailable.
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+enum {
+  bench_perf_cycles,
+  bench_perf_instructions,
+  bench_perf_branch_misses,
+  bench_perf_l1d_misses,
+  bench_perf_count,
+};
+
+static const char *bench_perf_names[bench_perf_count] = {
+  "cycles",
+  "instructions",
+  "branch_misses",
+  "l1d_misses",
+};
+
+typedef struct {
+  int fds[bench_perf_count];
+} bench_perf_t;
+
+/**
+ * Open the counters, returning the number that are available.
+ */
+static int
+bench_perf_open (bench_perf_t *perf) {
+  int available = 0;
+
+  for (int i = 0; i < bench_perf_count; i++) perf->fds[i] = -1;
+
+#if defined(__linux__)
+  static const struct {
+    uint32_t type;
+    uint64_t config;
+  } events[bench_perf_count] = {
+    [bench_perf_cycles] = {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+    [bench_perf_instructions] = {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+    [bench_perf_branch_misses] = {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+    [bench_perf_l1d_misses] = {PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16)},
+  };
+
+  for (int i = 0; i < bench_perf_count; i++) {
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+
+    attr.size = sizeof(attr);
+    attr.type = events[i].type;
+    attr.config = events[i].config;
+    attr.disabled = 1;
+
+    // Count user space only, which unprivileged processes are allowed to do
+    // with the default perf_event_paranoid setting.
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+
+    // Counters are opened separately rather than as a group, so report the
+    // time each was scheduled to scale for multiplexing.
+    attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+    int fd = (int) syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+
+    if (fd >= 0) {
+      perf->fds[i] = fd;
+      available++;
+    }
+  }
+#endif
+
+  return available;
+}
+
+static void
+bench_perf_close (bench_perf_t *perf) {
+#if defined(__linux__)
+  for (int i = 0; i < bench_perf_count; i++) {
+    if (perf->fds[i] >= 0) close(perf->fds[i]);
+  }
+#endif
+}
+
+static void
+bench_perf_start (bench_perf_t *perf) {
+#if defined(__linux__)
+  for (int i = 0; i < bench_perf_count; i++) {
+    if (perf->fds[i] < 0) continue;
+
+    ioctl(perf->fds[i], PERF_EVENT_IOC_RESET, 0);
+    ioctl(perf->fds[i], PERF_EVENT_IOC_ENABLE, 0);
+  }
+#endif
+}
+
+/**
+ * Stop the counters and read them into `result`, setting `available` for each
+ * counter that was read.
+ */
+static void
+bench_perf_stop (bench_perf_t *perf, double result[bench_perf_count], bool available[bench_perf_count]) {
+  for (int i = 0; i < bench_perf_count; i++) {
+    result[i] = 0;
+    available[i] = false;
+  }
+
+#if defined(__linux__)
+  for (int i = 0; i < bench_perf_count; i++) {
+    if (perf->fds[i] < 0) continue;
+
+    ioctl(perf->fds[i], PERF_EVENT_IOC_DISABLE, 0);
+  }
+
+  for (int i = 0; i < bench_perf_count; i++) {
+    if (perf->fds[i] < 0) continue;
+
+    uint64_t values[3]; // value, time enabled, time running
+
+    if (read(perf->fds[i], values, sizeof(values)) != sizeof(values)) continue;
+
+    if (values[2] == 0) continue;
+
+    result[i] = (double) values[0] * values[1] / values[2];
+    available[i] = true;
+  }
+#endif
+}
@@ -0,0 +1,95 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <utf.h>
+#include <utf/string.h>
+
+#include "../include/url.h"
+#include "../include/url/psl.h"
+
+static double
+now () {
+  struct timespec ts;
+  timespec_get(&ts, TIME_UTC);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static const char *hosts[] = {
+  "www.example.com",
+  "static.cdn.example.co.uk",
+  "user.github.io",
+  "a.b.c.kobe.jp",
+  "www.city.kobe.jp",
+  "news.bbc.co.uk",
+  "example.xn--fiqs8s",
+  "deep.sub.domain.example.unknowntld",
+};
+
+int
+main (int argc, char *argv[]) {
+  size_t n = 10000000;
+
+  const char *list = argc > 1 ? argv[1] : "/usr/share/publicsuffix/public_suffix_list.dat";
+  const char *path = argc > 2 ? argv[2] : "bench-psl.urlp";
+
+  url_psl_builder_t *builder;
+  url_psl_builder_init(&builder);
+
+  double start = now();
+
+  if (url_psl_builder_add_file(builder, list) < 0) {
+    fprintf(stderr, "failed to read %s\n", list);
+    return 1;
+  }
+
+  double build = now() - start;
+
+  if (url_psl_builder_write(builder, path) < 0) {
+    fprintf(stderr, "failed to write %s\n", path);
+    return 1;
+  }
+
+  url_psl_builder_destroy(builder);
+
+  start = now();
+
+  url_psl_t *psl;
+
+  if (url_psl_open(path, &psl) < 0) {
+    fprintf(stderr, "failed to open %s\n", path);
+    return 1;
+  }
+
+  double open = now() - start;
+
+  utf8_string_view_t views[sizeof(hosts) / sizeof(hosts[0])];
+
+  for (size_t i = 0; i < sizeof(hosts) / sizeof(hosts[0]); i++) {
+    views[i] = utf8_string_view_init((utf8_t *) hosts[i], strlen(hosts[i]));
+  }
+
+  start = now();
+
+  size_t bytes = 0;
+
+  for (size_t i = 0; i < n; i++) {
+    utf8_string_view_t suffix, registrable_domain;
+
+    url_psl_lookup(psl, views[i % (sizeof(hosts) / sizeof(hosts[0]))], &suffix, &registrable_domain);
+
+    bytes += registrable_domain.len;
+  }
+
+  double lookup = now() - start;
+
+  url_psl_close(psl);
+
+  remove(path);
+
+  printf("lookups           %zu\n", n);
+  printf("build ms          %.1f\n", build / 1e6);
+  printf("open ns           %.1f\n", open);
+  printf("lookup ns/host    %.1f\n", lookup / n);
+  printf("registrable bytes %zu\n", bytes);
+}
@@ -0,0 +1,81 @@
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <utf.h>
+#include <utf/string.h>
+
+#include "../include/url.h"
+#include "../include/url/punycode.h"
+#include "idn-labels.h"
+
+static double
+now () {
+  struct timespec ts;
+  timespec_get(&ts, TIME_UTC);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+int
+main () {
+  size_t rounds = 10000;
+
+  size_t len = sizeof(idn_labels) / sizeof(idn_labels[0]);
+
+  utf8_string_t encoded[sizeof(idn_labels) / sizeof(idn_labels[0])];
+
+  size_t bytes = 0;
+
+  for (size_t i = 0; i < len; i++) {
+    utf8_string_init(&encoded[i]);
+    url__utf8_to_punycode(utf8_string_view_init((utf8_t *) idn_labels[i], strlen(idn_labels[i])), &encoded[i]);
+
+    bytes += strlen(idn_labels[i]);
+  }
+
+  utf8_string_t output;
+  utf8_string_init(&output);
+
+  double start = now();
+
+  for (size_t r = 0; r < rounds; r++) {
+    for (size_t i = 0; i < len; i++) {
+      utf8_string_clear(&output);
+      url__utf8_to_punycode(utf8_string_view_init((utf8_t *) idn_labels[i], strlen(idn_labels[i])), &output);
+    }
+  }
+
+  double encode = now() - start;
+
+  start = now();
+
+  for (size_t r = 0; r < rounds; r++) {
+    for (size_t i = 0; i < len; i++) {
+      utf8_string_clear(&output);
+      url__punycode_to_utf8(utf8_string_view(&encoded[i]), &output);
+    }
+  }
+
+  double decode = now() - start;
+
+  const utf8_t ascii[] = "the-quick-brown-fox";
+
+  start = now();
+
+  for (size_t r = 0; r < rounds * len; r++) {
+    utf8_string_clear(&output);
+    url__utf8_to_punycode(utf8_string_view_init(ascii, sizeof(ascii) - 1), &output);
+  }
+
+  double basic = now() - start;
+
+  printf("labels            %zu (%.1f bytes on average)\n", len, (double) bytes / len);
+  printf("encode ns/label   %.1f\n", encode / (rounds * len));
+  printf("decode ns/label   %.1f\n", decode / (rounds * len));
+  printf("ascii ns/label    %.1f\n", basic / (rounds * len));
+
+  for (size_t i = 0; i < len; i++) {
+    utf8_string_destroy(&encoded[i]);
+  }
+
+  utf8_string_destroy(&output);
+}
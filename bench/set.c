@@ -0,0 +1,74 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <utf.h>
+#include <utf/string.h>
+
+#include "../include/url.h"
+#include "../include/url/set.h"
+
+static double
+now () {
+  struct timespec ts;
+  timespec_get(&ts, TIME_UTC);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+int
+main () {
+  size_t n = 2000000;
+
+  url_set_t *set;
+  url_set_init(&set);
+
+  url_t *urls = malloc(n * sizeof(url_t));
+
+  size_t href_bytes = 0;
+
+  for (size_t i = 0; i < n; i++) {
+    char input[128];
+
+    // Half of the inputs are duplicates of an earlier input.
+    size_t j = i % 2 ? (i / 2) & ~(size_t) 1 : i;
+
+    snprintf(input, 128, "https://www.site-%zu.example.com/articles/%zu/index.html?ref=%zu", j % 10000, j, j % 7);
+
+    url_init(&urls[i]);
+    url_parse(&urls[i], (utf8_t *) input, -1, NULL);
+
+    href_bytes += urls[i].href.len;
+  }
+
+  double start = now();
+
+  size_t inserted = 0;
+
+  for (size_t i = 0; i < n; i++) {
+    inserted += url_set_add(set, url_get_href(&urls[i]));
+  }
+
+  double elapsed = now() - start;
+
+  size_t size = url_set_size(set);
+  size_t memory = url_set_memory_usage(set);
+
+  size_t unique_bytes = 0;
+
+  for (size_t i = 0; i < n; i++) {
+    if (i % 2 == 0) unique_bytes += urls[i].href.len;
+
+    url_destroy(&urls[i]);
+  }
+
+  printf("inputs           %zu\n", n);
+  printf("unique           %zu\n", size);
+  printf("inserted         %zu\n", inserted);
+  printf("ns/insert        %.1f\n", elapsed / n);
+  printf("href bytes/url   %.1f\n", (double) unique_bytes / size);
+  printf("memory bytes/url %.1f\n", (double) memory / size);
+  printf("overhead/url     %.1f\n", (double) (memory - unique_bytes) / size);
+
+  url_set_destroy(set);
+
+  free(urls);
+}
@@ -0,0 +1,162 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <utf.h>
+#include <utf/string.h>
+
+#include "../include/url.h"
+#include "../include/url/store.h"
+
+static double
+now () {
+  struct timespec ts;
+  timespec_get(&ts, TIME_UTC);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static int
+compare (const void *a, const void *b) {
+  const url_t *x = a, *y = b;
+
+  size_t n = x->href.len < y->href.len ? x->href.len : y->href.len;
+
+  int result = memcmp(x->href.data, y->href.data, n);
+
+  if (result != 0) return result;
+
+  return x->href.len < y->href.len ? -1 : x->href.len > y->href.len;
+}
+
+static const char *sections[] = {"news", "sport", "articles", "blog", "products", "help", "users", "static/img"};
+
+/**
+ * Read URLs, one per line, from the file at `path`, or generate a crawl-like
+ * corpus of `n` URLs over a few thousand hosts if no path is given.
+ */
+static size_t
+load (const char *path, size_t n, url_t **result) {
+  url_t *urls = malloc(n * sizeof(url_t));
+
+  size_t len = 0;
+
+  FILE *file = path ? fopen(path, "r") : NULL;
+
+  char input[4096];
+
+  for (size_t i = 0; len < n; i++) {
+    if (file) {
+      if (fgets(input, sizeof(input), file) == NULL) break;
+
+      input[strcspn(input, "\r\n")] = '\0';
+    } else {
+      snprintf(
+        input,
+        sizeof(input),
+        "https://www.host-%zu.example.com/%s/%zu/%zu-some-article-title.html?utm_source=feed&id=%zu",
+        (i * 7919) % 5000,
+        sections[i % 8],
+        i % 97,
+        i,
+        i % 1000
+      );
+    }
+
+    url_init(&urls[len]);
+
+    if (url_parse(&urls[len], (utf8_t *) input, -1, NULL) == 0) len++;
+    else url_destroy(&urls[len]);
+  }
+
+  if (file) fclose(file);
+
+  *result = urls;
+
+  return len;
+}
+
+int
+main (int argc, char *argv[]) {
+  url_t *urls;
+
+  size_t n = load(argc > 1 ? argv[1] : NULL, 1000000, &urls);
+
+  qsort(urls, n, sizeof(url_t), compare);
+
+  size_t raw = 0;
+
+  double start = now();
+
+  url_store_builder_t *builder;
+  url_store_builder_init(&builder);
+
+  for (size_t i = 0; i < n; i++) {
+    raw += urls[i].href.len;
+
+    // Skip duplicates, which the store rejects.
+    url_store_builder_add(builder, &urls[i]);
+  }
+
+  url_store_t *store;
+  url_store_builder_finish(builder, &store);
+  url_store_builder_destroy(builder);
+
+  double build = now() - start;
+
+  size_t m = url_store_size(store);
+
+  start = now();
+
+  url_t url;
+  url_init(&url);
+
+  for (size_t i = 0; i < m; i++) {
+    url_store_get(store, (i * 2654435761u) % m, &url);
+  }
+
+  url_destroy(&url);
+
+  double get = now() - start;
+
+  start = now();
+
+  url_store_iterator_t iterator;
+  url_store_iterator_init(&iterator, store, 0, m);
+
+  size_t bytes = 0;
+
+  while (url_store_iterator_next(&iterator, &url) == 1) bytes += url.href.len;
+
+  url_store_iterator_destroy(&iterator);
+
+  double scan = now() - start;
+
+  start = now();
+
+  size_t found = 0;
+
+  for (size_t i = 0; i < m; i++) {
+    size_t ordinal;
+    found += url_store_find(store, url_get_href(&urls[(i * 2654435761u) % n]), &ordinal);
+  }
+
+  double find = now() - start;
+
+  size_t stored = url_store_memory_usage(store);
+
+  printf("urls              %zu (%zu unique)\n", n, m);
+  printf("raw bytes         %zu\n", raw);
+  printf("stored bytes      %zu\n", stored);
+  printf("ratio             %.2f\n", (double) raw / stored);
+  printf("build ns/url      %.1f\n", build / n);
+  printf("get ns/url        %.1f\n", get / m);
+  printf("find ns/url       %.1f\n", find / m);
+  printf("scan ns/url       %.1f\n", scan / m);
+  printf("scan MB/s         %.1f\n", bytes / (scan / 1e3));
+
+  url_store_destroy(store);
+
+  for (size_t i = 0; i < n; i++) url_destroy(&urls[i]);
+
+  free(urls);
+}
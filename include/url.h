@@ -6,6 +6,8 @@ extern "C" {
 #endif
 
 #include <stddef.h>
+#include <stdint.h>
+#include <string.h>
 #include <utf.h>
 #include <utf/string.h>
 
@@ -18,6 +20,11 @@ enum {
   url_has_opaque_path = 0x1,
 };
 
+enum {
+  url_decode_borrow = 0x1,
+  url_decode_validate = 0x2,
+};
+
 typedef enum {
   url_type_opaque,
   url_type_http,
@@ -28,11 +35,32 @@ typedef enum {
   url_type_file,
 } url_type_t;
 
+typedef enum {
+  url_host_type_empty,
+  url_host_type_domain,
+  url_host_type_ipv4,
+  url_host_type_ipv6,
+  url_host_type_opaque,
+} url_host_type_t;
+
 struct url_s {
   uint8_t flags;
 
   url_type_t type;
 
+  /**
+   * The type of the host. An empty host type covers both an empty host and
+   * no host at all.
+   */
+  url_host_type_t host_type;
+
+  /**
+   * The numeric address of an IPv4 or IPv6 host in network byte order, such
+   * that the first 4 or all 16 bytes, respectively, can be copied straight
+   * into an `in_addr` or `in6_addr`. All zeros for other host types.
+   */
+  uint8_t host_address[16];
+
   /**
    * The normalized serialization of the URL. This is used as the canonical
    * representation to both minimize memory allocation and also provide fast,
@@ -68,6 +96,9 @@ inline void
 url_init (url_t *url) {
   url->flags = 0;
   url->type = url_type_opaque;
+  url->host_type = url_host_type_empty;
+
+  memset(url->host_address, 0, sizeof(url->host_address));
 
   url->components.scheme_end = 0;
   url->components.username_end = 0;
@@ -131,13 +162,94 @@ url_get_fragment (const url_t *url) {
   return utf8_string_substring(&url->href, url->components.fragment_start, url->href.len);
 }
 
+inline url_host_type_t
+url_get_host_type (const url_t *url) {
+  return url->host_type;
+}
+
+/**
+ * Get the numeric address of an IPv4 or IPv6 host in network byte order, 4
+ * or 16 bytes long respectively, as recorded when the host was parsed.
+ */
+inline const uint8_t *
+url_get_host_address (const url_t *url) {
+  return url->host_address;
+}
+
 #include "url/parse.h"
 
+/**
+ * Get the port of the URL as a number, falling back to the default port of
+ * its scheme if the URL has no port of its own. Returns -1 if there is no
+ * port at all.
+ */
+inline int32_t
+url_get_port_number (const url_t *url) {
+  uint32_t port = url->components.port;
+
+  if (port == (uint32_t) -1) port = url__default_port(url->type);
+
+  return port == (uint32_t) -1 ? -1 : (int32_t) port;
+}
+
 inline int
 url_parse (url_t *url, const utf8_t *input, size_t len, const url_t *base) {
   if (len == (size_t) -1) len = strlen((char *) input);
 
-  return url__parse(url, utf8_string_view_init(input, len), base);
+  return url__parse(url, utf8_string_view_init(input, len), base, NULL);
+}
+
+/**
+ * Parse like `url_parse()`, looking up and storing the ASCII serialization of
+ * internationalized domains in `cache`.
+ */
+inline int
+url_parse_with_idna_cache (url_t *url, const utf8_t *input, size_t len, const url_t *base, url_idna_cache_t *cache) {
+  if (len == (size_t) -1) len = strlen((char *) input);
+
+  return url__parse(url, utf8_string_view_init(input, len), base, cache);
+}
+
+/**
+ * Convert `len` hosts, as returned by `url_get_host()`, to Unicode for
+ * display. The converted hosts are appended back to back to `arena` and
+ * `result` is set to point at each of them; the views stay valid until
+ * `arena` is next modified.
+ *
+ * Hosts without ACE labels, and hosts with ACE labels that fail any of the
+ * UTS #46 validity checks, are passed through unchanged.
+ */
+inline int
+url_domains_to_unicode (const utf8_string_view_t *hosts, size_t len, utf8_string_t *arena, utf8_string_view_t *result) {
+  return url__idna_to_unicode_batch(hosts, len, arena, result);
+}
+
+#include "url/binary.h"
+
+/**
+ * Append the versioned binary encoding of `url` to `result`. The encoding
+ * carries the href together with the type, flags, and components, such that
+ * decoding it doesn't require parsing the href again.
+ */
+inline int
+url_encode_binary (const url_t *url, utf8_string_t *result) {
+  return url__encode_binary(url, result);
+}
+
+/**
+ * Decode a URL previously encoded with `url_encode_binary()`. If `read` is
+ * not NULL, the number of bytes consumed from `input` is stored there.
+ *
+ * With `url_decode_borrow`, the href of the decoded URL points directly into
+ * `input` rather than being copied. Such a URL must not be modified or
+ * passed to `url_destroy()`, and must not outlive `input`.
+ *
+ * With `url_decode_validate`, the components are checked against the href
+ * before returning, which should be used for untrusted input.
+ */
+inline int
+url_decode_binary (url_t *url, const utf8_t *input, size_t len, int flags, size_t *read) {
+  return url__decode_binary(url, utf8_string_view_init(input, len), flags & url_decode_borrow, flags & url_decode_validate, read);
 }
 
 #ifdef __cplusplus
@@ -0,0 +1,230 @@
+#ifndef URL_BINARY_H
+#define URL_BINARY_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <utf.h>
+#include <utf/string.h>
+
+#include "../url.h"
+
+/**
+ * The binary encoding of a URL is laid out as follows:
+ *
+ *   u8      version
+ *   u8      type
+ *   u8      flags
+ *   varint  href length
+ *   varint  components (8x, each stored as value + 1 such that unset is 0)
+ *   u8[]    href
+ *
+ * Varints are unsigned LEB128. The href is stored last so that decoding is a
+ * short header read followed by a single copy, or no copy at all when the
+ * decoded URL borrows the input.
+ */
+#define url__binary_version 1
+
+static inline size_t
+url__varint_length (uint32_t value) {
+  size_t len = 1;
+
+  while (value >= 0x80) {
+    value >>= 7;
+    len++;
+  }
+
+  return len;
+}
+
+static inline utf8_t *
+url__varint_write (utf8_t *data, uint32_t value) {
+  while (value >= 0x80) {
+    *data++ = (utf8_t) (value | 0x80);
+    value >>= 7;
+  }
+
+  *data++ = (utf8_t) value;
+
+  return data;
+}
+
+static inline const utf8_t *
+url__varint_read (const utf8_t *data, const utf8_t *end, uint32_t *result) {
+  uint32_t value = 0;
+
+  for (int shift = 0; shift < 35; shift += 7) {
+    if (data == end) return NULL;
+
+    utf8_t byte = *data++;
+
+    if (shift == 28 && byte > 0x0f) return NULL;
+
+    value |= (uint32_t) (byte & 0x7f) << shift;
+
+    if ((byte & 0x80) == 0) {
+      *result = value;
+
+      return data;
+    }
+  }
+
+  return NULL;
+}
+
+static inline int
+url__encode_binary (const url_t *url, utf8_string_t *result) {
+  int err;
+
+  if (url->href.len > UINT32_MAX) return -1;
+
+  url_component_t components[8] = {
+    url->components.scheme_end,
+    url->components.username_end,
+    url->components.host_start,
+    url->components.host_end,
+    url->components.port,
+    url->components.path_start,
+    url->components.query_start,
+    url->components.fragment_start,
+  };
+
+  size_t len = 3 + url__varint_length((uint32_t) url->href.len) + url->href.len;
+
+  for (int i = 0; i < 8; i++) {
+    len += url__varint_length(components[i] + 1);
+  }
+
+  err = utf8_string_reserve(result, result->len + len);
+  if (err < 0) return err;
+
+  utf8_t *data = &result->data[result->len];
+
+  *data++ = url__binary_version;
+  *data++ = (utf8_t) url->type;
+  *data++ = url->flags;
+
+  data = url__varint_write(data, (uint32_t) url->href.len);
+
+  for (int i = 0; i < 8; i++) {
+    data = url__varint_write(data, components[i] + 1);
+  }
+
+  if (url->href.len) memcpy(data, url->href.data, url->href.len);
+
+  result->len += len;
+
+  return 0;
+}
+
+/**
+ * Check that the components of a decoded URL are consistent with its href,
+ * such that none of the `url_get_*()` accessors read out of bounds.
+ */
+static inline bool
+url__has_valid_components (const url_t *url) {
+  size_t len = url->href.len;
+
+  if (url->type > url_type_file) return false;
+
+  if (url->flags & ~url_has_opaque_path) return false;
+
+  uint32_t scheme_end = url->components.scheme_end;
+  uint32_t username_end = url->components.username_end;
+  uint32_t host_start = url->components.host_start;
+  uint32_t host_end = url->components.host_end;
+  uint32_t port = url->components.port;
+  uint32_t path_start = url->components.path_start;
+  uint32_t query_start = url->components.query_start;
+  uint32_t fragment_start = url->components.fragment_start;
+
+  if (scheme_end >= len || url->href.data[scheme_end] != ':') return false;
+
+  if (
+    username_end < scheme_end ||
+    host_start < username_end ||
+    host_end < host_start ||
+    path_start < host_end ||
+    path_start > len
+  ) {
+    return false;
+  }
+
+  if (port != (uint32_t) -1 && port > UINT16_MAX) return false;
+
+  if (query_start != (uint32_t) -1) {
+    if (query_start <= path_start || query_start > len + 1) return false;
+  }
+
+  if (fragment_start != (uint32_t) -1) {
+    if (fragment_start <= path_start || fragment_start > len + 1) return false;
+
+    // A fragment start past the end of the href denotes an absent fragment.
+    if (fragment_start <= len && url->href.data[fragment_start - 1] != '#') return false;
+
+    if (query_start != (uint32_t) -1 && query_start > fragment_start) return false;
+  }
+
+  return true;
+}
+
+static inline int
+url__decode_binary (url_t *url, const utf8_string_view_t input, bool borrow, bool validate, size_t *read) {
+  int err;
+
+  const utf8_t *data = input.data;
+  const utf8_t *end = &input.data[input.len];
+
+  if (input.len < 3 || data[0] != url__binary_version) return -1;
+
+  url->type = (url_type_t) data[1];
+  url->flags = data[2];
+
+  data += 3;
+
+  uint32_t len;
+
+  data = url__varint_read(data, end, &len);
+  if (data == NULL) return -1;
+
+  uint32_t components[8];
+
+  for (int i = 0; i < 8; i++) {
+    data = url__varint_read(data, end, &components[i]);
+    if (data == NULL) return -1;
+  }
+
+  url->components.scheme_end = components[0] - 1;
+  url->components.username_end = components[1] - 1;
+  url->components.host_start = components[2] - 1;
+  url->components.host_end = components[3] - 1;
+  url->components.port = components[4] - 1;
+  url->components.path_start = components[5] - 1;
+  url->components.query_start = components[6] - 1;
+  url->components.fragment_start = components[7] - 1;
+
+  if ((size_t) (end - data) < len) return -1;
+
+  if (borrow) {
+    utf8_string_init(&url->href);
+
+    url->href.data = (utf8_t *) data;
+    url->href.len = len;
+  } else {
+    utf8_string_clear(&url->href);
+
+    err = utf8_string_append_literal(&url->href, data, len);
+    if (err < 0) return err;
+  }
+
+  if (validate && !url__has_valid_components(url)) return -1;
+
+  url__restore_host(url);
+
+  if (read) *read = (size_t) (data - input.data) + len;
+
+  return 0;
+}
+
+#endif // URL_BINARY_H
@@ -0,0 +1,292 @@
+// Generated by scripts/generate-byte-classes.js. Do not edit.
+
+#ifndef URL_BYTE_CLASSES_H
+#define URL_BYTE_CLASSES_H
+
+#include <stdint.h>
+
+enum {
+  url__ascii_digit_character_set = 0x00000001,
+  url__ascii_hex_digit_character_set = 0x00000002,
+  url__ascii_alpha_character_set = 0x00000004,
+  url__ascii_alphanumeric_character_set = 0x00000008,
+  url__scheme_character_set = 0x00000010,
+  url__forbidden_host_character_set = 0x00000020,
+  url__forbidden_domain_character_set = 0x00000040,
+  url__c0_control_percent_encode_set = 0x00000080,
+  url__fragment_percent_encode_set = 0x00000100,
+  url__query_percent_encode_set = 0x00000200,
+  url__special_query_percent_encode_set = 0x00000400,
+  url__path_percent_encode_set = 0x00000800,
+  url__userinfo_percent_encode_set = 0x00001000,
+  url__byte_slash = 0x00002000,
+  url__byte_backslash = 0x00004000,
+  url__byte_question_mark = 0x00008000,
+  url__byte_number_sign = 0x00010000,
+  url__byte_at_sign = 0x00020000,
+  url__byte_colon = 0x00040000,
+  url__byte_left_bracket = 0x00080000,
+  url__byte_right_bracket = 0x00100000,
+};
+
+// The classes of every byte, as a bitmask of the classes above.
+static const uint32_t url__byte_classes[256] = {
+  0x00001fe0, // 0x00
+  0x00001fc0, // 0x01
+  0x00001fc0, // 0x02
+  0x00001fc0, // 0x03
+  0x00001fc0, // 0x04
+  0x00001fc0, // 0x05
+  0x00001fc0, // 0x06
+  0x00001fc0, // 0x07
+  0x00001fc0, // 0x08
+  0x00001fe0, // 0x09
+  0x00001fe0, // 0x0a
+  0x00001fc0, // 0x0b
+  0x00001fc0, // 0x0c
+  0x00001fe0, // 0x0d
+  0x00001fc0, // 0x0e
+  0x00001fc0, // 0x0f
+  0x00001fc0, // 0x10
+  0x00001fc0, // 0x11
+  0x00001fc0, // 0x12
+  0x00001fc0, // 0x13
+  0x00001fc0, // 0x14
+  0x00001fc0, // 0x15
+  0x00001fc0, // 0x16
+  0x00001fc0, // 0x17
+  0x00001fc0, // 0x18
+  0x00001fc0, // 0x19
+  0x00001fc0, // 0x1a
+  0x00001fc0, // 0x1b
+  0x00001fc0, // 0x1c
+  0x00001fc0, // 0x1d
+  0x00001fc0, // 0x1e
+  0x00001fc0, // 0x1f
+  0x00001f60, // 0x20
+  0x00000000, // 0x21 !
+  0x00001f00, // 0x22 "
+  0x00011e60, // 0x23 #
+  0x00000000, // 0x24 $
+  0x00000040, // 0x25 %
+  0x00000000, // 0x26 &
+  0x00000400, // 0x27 '
+  0x00000000, // 0x28 (
+  0x00000000, // 0x29 )
+  0x00000000, // 0x2a *
+  0x00000010, // 0x2b +
+  0x00000000, // 0x2c ,
+  0x00000010, // 0x2d -
+  0x00000010, // 0x2e .
+  0x00003060, // 0x2f /
+  0x0000001b, // 0x30 0
+  0x0000001b, // 0x31 1
+  0x0000001b, // 0x32 2
+  0x0000001b, // 0x33 3
+  0x0000001b, // 0x34 4
+  0x0000001b, // 0x35 5
+  0x0000001b, // 0x36 6
+  0x0000001b, // 0x37 7
+  0x0000001b, // 0x38 8
+  0x0000001b, // 0x39 9
+  0x00041060, // 0x3a :
+  0x00001000, // 0x3b ;
+  0x00001f60, // 0x3c <
+  0x00001000, // 0x3d =
+  0x00001f60, // 0x3e >
+  0x00009860, // 0x3f ?
+  0x00021060, // 0x40 @
+  0x0000001e, // 0x41 A
+  0x0000001e, // 0x42 B
+  0x0000001e, // 0x43 C
+  0x0000001e, // 0x44 D
+  0x0000001e, // 0x45 E
+  0x0000001e, // 0x46 F
+  0x0000001c, // 0x47 G
+  0x0000001c, // 0x48 H
+  0x0000001c, // 0x49 I
+  0x0000001c, // 0x4a J
+  0x0000001c, // 0x4b K
+  0x0000001c, // 0x4c L
+  0x0000001c, // 0x4d M
+  0x0000001c, // 0x4e N
+  0x0000001c, // 0x4f O
+  0x0000001c, // 0x50 P
+  0x0000001c, // 0x51 Q
+  0x0000001c, // 0x52 R
+  0x0000001c, // 0x53 S
+  0x0000001c, // 0x54 T
+  0x0000001c, // 0x55 U
+  0x0000001c, // 0x56 V
+  0x0000001c, // 0x57 W
+  0x0000001c, // 0x58 X
+  0x0000001c, // 0x59 Y
+  0x0000001c, // 0x5a Z
+  0x00081060, // 0x5b [
+  0x00005060, // 0x5c
+  0x00101060, // 0x5d ]
+  0x00001060, // 0x5e ^
+  0x00000000, // 0x5f _
+  0x00001900, // 0x60 `
+  0x0000001e, // 0x61 a
+  0x0000001e, // 0x62 b
+  0x0000001e, // 0x63 c
+  0x0000001e, // 0x64 d
+  0x0000001e, // 0x65 e
+  0x0000001e, // 0x66 f
+  0x0000001c, // 0x67 g
+  0x0000001c, // 0x68 h
+  0x0000001c, // 0x69 i
+  0x0000001c, // 0x6a j
+  0x0000001c, // 0x6b k
+  0x0000001c, // 0x6c l
+  0x0000001c, // 0x6d m
+  0x0000001c, // 0x6e n
+  0x0000001c, // 0x6f o
+  0x0000001c, // 0x70 p
+  0x0000001c, // 0x71 q
+  0x0000001c, // 0x72 r
+  0x0000001c, // 0x73 s
+  0x0000001c, // 0x74 t
+  0x0000001c, // 0x75 u
+  0x0000001c, // 0x76 v
+  0x0000001c, // 0x77 w
+  0x0000001c, // 0x78 x
+  0x0000001c, // 0x79 y
+  0x0000001c, // 0x7a z
+  0x00001800, // 0x7b {
+  0x00001060, // 0x7c |
+  0x00001800, // 0x7d }
+  0x00000000, // 0x7e ~
+  0x00001fc0, // 0x7f
+  0x00001f80, // 0x80
+  0x00001f80, // 0x81
+  0x00001f80, // 0x82
+  0x00001f80, // 0x83
+  0x00001f80, // 0x84
+  0x00001f80, // 0x85
+  0x00001f80, // 0x86
+  0x00001f80, // 0x87
+  0x00001f80, // 0x88
+  0x00001f80, // 0x89
+  0x00001f80, // 0x8a
+  0x00001f80, // 0x8b
+  0x00001f80, // 0x8c
+  0x00001f80, // 0x8d
+  0x00001f80, // 0x8e
+  0x00001f80, // 0x8f
+  0x00001f80, // 0x90
+  0x00001f80, // 0x91
+  0x00001f80, // 0x92
+  0x00001f80, // 0x93
+  0x00001f80, // 0x94
+  0x00001f80, // 0x95
+  0x00001f80, // 0x96
+  0x00001f80, // 0x97
+  0x00001f80, // 0x98
+  0x00001f80, // 0x99
+  0x00001f80, // 0x9a
+  0x00001f80, // 0x9b
+  0x00001f80, // 0x9c
+  0x00001f80, // 0x9d
+  0x00001f80, // 0x9e
+  0x00001f80, // 0x9f
+  0x00001f80, // 0xa0
+  0x00001f80, // 0xa1
+  0x00001f80, // 0xa2
+  0x00001f80, // 0xa3
+  0x00001f80, // 0xa4
+  0x00001f80, // 0xa5
+  0x00001f80, // 0xa6
+  0x00001f80, // 0xa7
+  0x00001f80, // 0xa8
+  0x00001f80, // 0xa9
+  0x00001f80, // 0xaa
+  0x00001f80, // 0xab
+  0x00001f80, // 0xac
+  0x00001f80, // 0xad
+  0x00001f80, // 0xae
+  0x00001f80, // 0xaf
+  0x00001f80, // 0xb0
+  0x00001f80, // 0xb1
+  0x00001f80, // 0xb2
+  0x00001f80, // 0xb3
+  0x00001f80, // 0xb4
+  0x00001f80, // 0xb5
+  0x00001f80, // 0xb6
+  0x00001f80, // 0xb7
+  0x00001f80, // 0xb8
+  0x00001f80, // 0xb9
+  0x00001f80, // 0xba
+  0x00001f80, // 0xbb
+  0x00001f80, // 0xbc
+  0x00001f80, // 0xbd
+  0x00001f80, // 0xbe
+  0x00001f80, // 0xbf
+  0x00001f80, // 0xc0
+  0x00001f80, // 0xc1
+  0x00001f80, // 0xc2
+  0x00001f80, // 0xc3
+  0x00001f80, // 0xc4
+  0x00001f80, // 0xc5
+  0x00001f80, // 0xc6
+  0x00001f80, // 0xc7
+  0x00001f80, // 0xc8
+  0x00001f80, // 0xc9
+  0x00001f80, // 0xca
+  0x00001f80, // 0xcb
+  0x00001f80, // 0xcc
+  0x00001f80, // 0xcd
+  0x00001f80, // 0xce
+  0x00001f80, // 0xcf
+  0x00001f80, // 0xd0
+  0x00001f80, // 0xd1
+  0x00001f80, // 0xd2
+  0x00001f80, // 0xd3
+  0x00001f80, // 0xd4
+  0x00001f80, // 0xd5
+  0x00001f80, // 0xd6
+  0x00001f80, // 0xd7
+  0x00001f80, // 0xd8
+  0x00001f80, // 0xd9
+  0x00001f80, // 0xda
+  0x00001f80, // 0xdb
+  0x00001f80, // 0xdc
+  0x00001f80, // 0xdd
+  0x00001f80, // 0xde
+  0x00001f80, // 0xdf
+  0x00001f80, // 0xe0
+  0x00001f80, // 0xe1
+  0x00001f80, // 0xe2
+  0x00001f80, // 0xe3
+  0x00001f80, // 0xe4
+  0x00001f80, // 0xe5
+  0x00001f80, // 0xe6
+  0x00001f80, // 0xe7
+  0x00001f80, // 0xe8
+  0x00001f80, // 0xe9
+  0x00001f80, // 0xea
+  0x00001f80, // 0xeb
+  0x00001f80, // 0xec
+  0x00001f80, // 0xed
+  0x00001f80, // 0xee
+  0x00001f80, // 0xef
+  0x00001f80, // 0xf0
+  0x00001f80, // 0xf1
+  0x00001f80, // 0xf2
+  0x00001f80, // 0xf3
+  0x00001f80, // 0xf4
+  0x00001f80, // 0xf5
+  0x00001f80, // 0xf6
+  0x00001f80, // 0xf7
+  0x00001f80, // 0xf8
+  0x00001f80, // 0xf9
+  0x00001f80, // 0xfa
+  0x00001f80, // 0xfb
+  0x00001f80, // 0xfc
+  0x00001f80, // 0xfd
+  0x00001f80, // 0xfe
+  0x00001f80, // 0xff
+};
+
+#endif // URL_BYTE_CLASSES_H
@@ -6,36 +6,38 @@
 #include <utf.h>
 #include <utf/string.h>
 
+#include "byte-classes.h"
+
 /**
- * A character set is stored as a 32 x 8 bit list with each bit
- * representing an ASCII byte. A given ASCII byte is in the character set
- * if its corresponding bit is set.
+ * A character set is one of the classes of `url__byte_classes`, which maps
+ * every byte to a bitmask of the classes it belongs to. A given byte is in the
+ * character set if its corresponding bit is set, which takes a single load.
  */
-typedef const uint8_t url_character_set_t[32];
+typedef uint32_t url_character_set_t;
 
 static inline bool
 url__is_in_character_set (url_character_set_t character_set, utf8_t character) {
-  return (character_set[character >> 3] & (1 << (character & 7))) != 0;
+  return (url__byte_classes[character] & character_set) != 0;
 }
 
 static inline bool
 url__contains_from_character_set (url_character_set_t character_set, utf8_string_view_t input) {
   size_t i = 0, n = input.len;
 
-  uint8_t accumulator = 0;
+  uint32_t accumulator = 0;
 
   for (; i + 4 <= n; i += 4) {
-    accumulator |= url__is_in_character_set(character_set, input.data[i]);
-    accumulator |= url__is_in_character_set(character_set, input.data[i + 1]);
-    accumulator |= url__is_in_character_set(character_set, input.data[i + 2]);
-    accumulator |= url__is_in_character_set(character_set, input.data[i + 3]);
+    accumulator |= url__byte_classes[input.data[i]];
+    accumulator |= url__byte_classes[input.data[i + 1]];
+    accumulator |= url__byte_classes[input.data[i + 2]];
+    accumulator |= url__byte_classes[input.data[i + 3]];
   }
 
   for (; i < n; i++) {
-    accumulator |= url__is_in_character_set(character_set, input.data[i]);
+    accumulator |= url__byte_classes[input.data[i]];
   }
 
-  return accumulator;
+  return (accumulator & character_set) != 0;
 }
 
 #endif // URL_CHARACTER_SET
@@ -0,0 +1,84 @@
+#ifndef URL_CORPUS_H
+#define URL_CORPUS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+#include <utf.h>
+#include <utf/string.h>
+
+#include "../url.h"
+
+/**
+ * An on-disk corpus of parsed URLs, laid out for memory mapping:
+ *
+ *   header   magic "URLC", u32 version, u64 count, u64 records offset,
+ *            u64 hrefs offset
+ *   records  count x 48 byte fixed-width records of u64 href offset,
+ *            u32 href length, u8 type, u8 flags, u16 reserved, and the
+ *            eight u32 components
+ *   hrefs    the normalized hrefs, back to back
+ *
+ * All integers are little-endian. Reading a URL touches only its record and
+ * its href, so a reader only faults in the pages it actually uses.
+ */
+typedef struct url_corpus_s url_corpus_t;
+typedef struct url_corpus_builder_s url_corpus_builder_t;
+
+int
+url_corpus_builder_init (url_corpus_builder_t **result);
+
+void
+url_corpus_builder_destroy (url_corpus_builder_t *builder);
+
+int
+url_corpus_builder_add (url_corpus_builder_t *builder, const url_t *url);
+
+/**
+ * Parse `input` against `base` and add the result. Returns -1 if the input
+ * fails to parse, in which case nothing is added.
+ */
+int
+url_corpus_builder_add_input (url_corpus_builder_t *builder, const utf8_t *input, size_t len, const url_t *base);
+
+int
+url_corpus_builder_serialize (url_corpus_builder_t *builder, utf8_string_t *result);
+
+int
+url_corpus_builder_write (url_corpus_builder_t *builder, const char *path);
+
+/**
+ * Open a corpus over `len` bytes at `data`, which must outlive the corpus.
+ */
+int
+url_corpus_init (const utf8_t *data, size_t len, url_corpus_t **result);
+
+/**
+ * Memory map the corpus file at `path`.
+ */
+int
+url_corpus_open (const char *path, url_corpus_t **result);
+
+void
+url_corpus_close (url_corpus_t *corpus);
+
+size_t
+url_corpus_size (const url_corpus_t *corpus);
+
+/**
+ * Get a borrowed view of the URL at `index`. The href of the view points
+ * directly into the corpus, so the view must not be modified or passed to
+ * `url_destroy()`, and must not outlive the corpus. Returns -1 if the index
+ * is out of range or the record is malformed.
+ */
+int
+url_corpus_get (const url_corpus_t *corpus, size_t index, url_t *result);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // URL_CORPUS_H
@@ -0,0 +1,85 @@
+#ifndef URL_ENCODING_H
+#define URL_ENCODING_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <utf.h>
+
+/**
+ * Decode `len` bytes of UTF-8 at `input` into code points, replacing invalid
+ * sequences with U+FFFD. The result is never longer than the input, so
+ * `result` must have room for `len` code points.
+ */
+// https://encoding.spec.whatwg.org/#utf-8-decode-without-bom
+static inline size_t
+url__utf8_decode (const utf8_t *input, size_t len, uint32_t *result) {
+  size_t n = 0;
+
+  for (size_t i = 0; i < len;) {
+    utf8_t c = input[i];
+
+    uint32_t code_point = 0;
+    size_t k;
+
+    if (c < 0x80) code_point = c, k = 1;
+    else if (c >= 0xc2 && c <= 0xdf) code_point = c & 0x1f, k = 2;
+    else if (c >= 0xe0 && c <= 0xef) code_point = c & 0x0f, k = 3;
+    else if (c >= 0xf0 && c <= 0xf4) code_point = c & 0x07, k = 4;
+    else k = 0;
+
+    size_t j = 1;
+
+    for (; j < k && i + j < len && (input[i + j] & 0xc0) == 0x80; j++) {
+      code_point = code_point << 6 | (input[i + j] & 0x3f);
+    }
+
+    if (
+      k == 0 ||
+      j < k ||
+      (k == 3 && (code_point < 0x800 || (code_point >= 0xd800 && code_point <= 0xdfff))) ||
+      (k == 4 && (code_point < 0x10000 || code_point > 0x10ffff))
+    ) {
+      result[n++] = 0xfffd;
+      i++;
+    } else {
+      result[n++] = code_point;
+      i += k;
+    }
+  }
+
+  return n;
+}
+
+/**
+ * Encode `len` code points at `input` as UTF-8 into `result`, which must have
+ * room for 4 bytes per code point. Returns the number of bytes written.
+ */
+// https://encoding.spec.whatwg.org/#utf-8-encoder
+static inline size_t
+url__utf8_encode (const uint32_t *input, size_t len, utf8_t *result) {
+  utf8_t *output = result;
+
+  for (size_t i = 0; i < len; i++) {
+    uint32_t code_point = input[i];
+
+    if (code_point < 0x80) {
+      *output++ = (utf8_t) code_point;
+    } else if (code_point < 0x800) {
+      *output++ = (utf8_t) (0xc0 | code_point >> 6);
+      *output++ = (utf8_t) (0x80 | (code_point & 0x3f));
+    } else if (code_point < 0x10000) {
+      *output++ = (utf8_t) (0xe0 | code_point >> 12);
+      *output++ = (utf8_t) (0x80 | ((code_point >> 6) & 0x3f));
+      *output++ = (utf8_t) (0x80 | (code_point & 0x3f));
+    } else {
+      *output++ = (utf8_t) (0xf0 | code_point >> 18);
+      *output++ = (utf8_t) (0x80 | ((code_point >> 12) & 0x3f));
+      *output++ = (utf8_t) (0x80 | ((code_point >> 6) & 0x3f));
+      *output++ = (utf8_t) (0x80 | (code_point & 0x3f));
+    }
+  }
+
+  return output - result;
+}
+
+#endif // URL_ENCODING_H
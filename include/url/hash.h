@@ -0,0 +1,72 @@
+#ifndef URL_HASH_H
+#define URL_HASH_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <utf.h>
+
+#define url__hash_prime_1 0x9e3779b185ebca87ULL
+#define url__hash_prime_2 0xc2b2ae3d27d4eb4fULL
+#define url__hash_prime_3 0x165667b19e3779f9ULL
+
+static inline uint64_t
+url__hash_rotate (uint64_t x, int r) {
+  return (x << r) | (x >> (64 - r));
+}
+
+static inline uint64_t
+url__hash_read_64 (const utf8_t *data) {
+  uint64_t x;
+  memcpy(&x, data, 8);
+  return x;
+}
+
+static inline uint32_t
+url__hash_read_32 (const utf8_t *data) {
+  uint32_t x;
+  memcpy(&x, data, 4);
+  return x;
+}
+
+/**
+ * A small, non-cryptographic 64-bit hash over a byte string, modelled on the
+ * single-lane form of xxHash64. The low and high halves of the result are
+ * independent enough to be used separately for bucket selection and
+ * fingerprinting.
+ */
+static inline uint64_t
+url__hash (const utf8_t *data, size_t len) {
+  uint64_t h = url__hash_prime_3 + len;
+
+  size_t i = 0;
+
+  for (; i + 8 <= len; i += 8) {
+    uint64_t k = url__hash_read_64(&data[i]) * url__hash_prime_2;
+
+    h ^= url__hash_rotate(k, 31) * url__hash_prime_1;
+    h = url__hash_rotate(h, 27) * url__hash_prime_1 + url__hash_prime_3;
+  }
+
+  if (i + 4 <= len) {
+    h ^= (uint64_t) url__hash_read_32(&data[i]) * url__hash_prime_1;
+    h = url__hash_rotate(h, 23) * url__hash_prime_2 + url__hash_prime_3;
+
+    i += 4;
+  }
+
+  for (; i < len; i++) {
+    h ^= data[i] * url__hash_prime_3;
+    h = url__hash_rotate(h, 11) * url__hash_prime_1;
+  }
+
+  h ^= h >> 33;
+  h *= url__hash_prime_2;
+  h ^= h >> 29;
+  h *= url__hash_prime_3;
+  h ^= h >> 32;
+
+  return h;
+}
+
+#endif // URL_HASH_H
@@ -0,0 +1,68 @@
+#ifndef URL_IDNA_CACHE_H
+#define URL_IDNA_CACHE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+#include <utf.h>
+#include <utf/string.h>
+
+/**
+ * A bounded cache of domain to ASCII results, mapping the raw bytes of a host
+ * to its ASCII serialization so that repeated internationalized hosts skip
+ * mapping, normalization and Punycode.
+ *
+ * The cache is split into independently locked shards, each holding a fixed
+ * number of entries in a chained hash table. When a shard is full, entries
+ * are evicted in CLOCK order: entries that were hit since the hand last
+ * passed them get a second chance, so hosts seen only once are the first to
+ * go.
+ *
+ * All functions other than `url_idna_cache_init()` and
+ * `url_idna_cache_destroy()` may be called concurrently from multiple
+ * threads.
+ */
+typedef struct url_idna_cache_s url_idna_cache_t;
+
+/**
+ * Create a cache holding at most `capacity` hosts, rounded up to a multiple
+ * of the number of shards.
+ */
+int
+url_idna_cache_init (size_t capacity, url_idna_cache_t **result);
+
+void
+url_idna_cache_destroy (url_idna_cache_t *cache);
+
+/**
+ * Look up `host` and append its ASCII serialization to `result`. Returns 1 on
+ * a hit, 0 on a miss, and -1 on allocation failure.
+ */
+int
+url_idna_cache_get (url_idna_cache_t *cache, const utf8_string_view_t host, utf8_string_t *result);
+
+/**
+ * Store the ASCII serialization of `host`, evicting another host if the
+ * shard is full. Returns 1 if the host was inserted, 0 if it was already
+ * present, and -1 on allocation failure.
+ */
+int
+url_idna_cache_put (url_idna_cache_t *cache, const utf8_string_view_t host, const utf8_string_view_t ascii);
+
+size_t
+url_idna_cache_size (url_idna_cache_t *cache);
+
+uint64_t
+url_idna_cache_hits (url_idna_cache_t *cache);
+
+uint64_t
+url_idna_cache_misses (url_idna_cache_t *cache);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // URL_IDNA_CACHE_H
@@ -1,14 +1,760 @@
 #ifndef URL_IDNA_H
 #define URL_IDNA_H
 
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
 #include <utf.h>
 #include <utf/string.h>
 
+#include "encoding.h"
+#include "punycode.h"
+#include "trace.h"
+#include "unicode.h"
+
+/**
+ * Lowercase the ASCII input at `input` into `output` 8 bytes at a time.
+ * Returns false as soon as a non-ASCII byte is found, in which case the
+ * contents of `output` are unspecified.
+ */
+static inline bool
+url__idna_ascii_lowercase (const utf8_t *input, size_t len, utf8_t *output) {
+  size_t i = 0;
+
+  for (; i + 8 <= len; i += 8) {
+    uint64_t word;
+    memcpy(&word, &input[i], 8);
+
+    if (word & 0x8080808080808080) return false;
+
+    // With the high bits clear, no byte carries into the next and the high bit
+    // of each sum tells if the byte is at least 'A' and at least '[',
+    // respectively.
+    uint64_t upper = ((word + 0x3f3f3f3f3f3f3f3f) ^ (word + 0x2525252525252525)) & 0x8080808080808080;
+
+    word |= upper >> 2;
+
+    memcpy(&output[i], &word, 8);
+  }
+
+  for (; i < len; i++) {
+    utf8_t c = input[i];
+
+    if (c >= 0x80) return false;
+
+    output[i] = c >= 0x41 && c <= 0x5a ? c | 0x20 : c;
+  }
+
+  return true;
+}
+
+/**
+ * Check if any label of the lowercase ASCII domain at `input` starts with the
+ * ACE prefix "xn--".
+ */
+static inline bool
+url__idna_has_ace_label (const utf8_t *input, size_t len) {
+  const utf8_t *label = input, *end = &input[len];
+
+  while (label < end) {
+    if (end - label >= 4 && memcmp(label, "xn--", 4) == 0) return true;
+
+    label = memchr(label, 0x2e, end - label);
+
+    if (label == NULL) break;
+
+    label++;
+  }
+
+  return false;
+}
+
+static inline uint64_t
+url__idna_hyphen_mask (const utf8_t *input) {
+  uint64_t word;
+  memcpy(&word, input, 8);
+
+  word ^= 0x2d2d2d2d2d2d2d2d;
+
+  // Set the high bit of every byte that was a hyphen, without the false
+  // positives of the shorter zero byte check.
+  return ~(((word & 0x7f7f7f7f7f7f7f7f) + 0x7f7f7f7f7f7f7f7f) | word | 0x7f7f7f7f7f7f7f7f);
+}
+
+/**
+ * Check if the domain at `input` may have an ACE label, which requires two
+ * consecutive hyphens somewhere. The hyphens of each word are compared with
+ * those of the word one byte further on, so that most domains are ruled out
+ * 8 bytes at a time.
+ */
+static inline bool
+url__idna_may_have_ace_label (const utf8_t *input, size_t len) {
+  size_t i = 0;
+
+  for (; i + 9 <= len; i += 8) {
+    if (url__idna_hyphen_mask(&input[i]) & url__idna_hyphen_mask(&input[i + 1])) return true;
+  }
+
+  for (; i + 1 < len; i++) {
+    if (input[i] == 0x2d && input[i + 1] == 0x2d) return true;
+  }
+
+  return false;
+}
+
+// https://www.unicode.org/reports/tr46/#ProcessingStepMap
+static inline int
+url__idna_map (const uint32_t *input, size_t len, uint32_t **result, size_t *result_len) {
+  const uint32_t *mapping;
+  size_t mapping_len;
+
+  size_t n = 0;
+
+  for (size_t i = 0; i < len; i++) {
+    switch (url__unicode_idna_status(input[i], &mapping, &mapping_len)) {
+    case url_idna_valid:
+    case url_idna_deviation:
+      n++;
+      break;
+    case url_idna_mapped:
+      n += mapping_len;
+      break;
+    case url_idna_ignored:
+      break;
+    case url_idna_disallowed:
+      return -1;
+    }
+  }
+
+  uint32_t *output = malloc(n ? n * sizeof(uint32_t) : 1);
+  if (output == NULL) return -1;
+
+  n = 0;
+
+  for (size_t i = 0; i < len; i++) {
+    switch (url__unicode_idna_status(input[i], &mapping, &mapping_len)) {
+    case url_idna_mapped:
+      memcpy(&output[n], mapping, mapping_len * sizeof(uint32_t));
+      n += mapping_len;
+      break;
+    case url_idna_ignored:
+      break;
+    default:
+      output[n++] = input[i];
+    }
+  }
+
+  *result = output;
+  *result_len = n;
+
+  return 0;
+}
+
+/**
+ * Stably sort a run of combining marks by their canonical combining class.
+ * Short runs are insertion sorted while long runs, which only occur in
+ * contrived input, are counting sorted to stay linear.
+ */
+static inline int
+url__idna_sort_marks (uint32_t *data, size_t len) {
+  if (len <= 16) {
+    uint8_t classes[16];
+
+    for (size_t i = 0; i < len; i++) {
+      uint32_t code_point = data[i];
+      uint8_t class = url__unicode_combining_class(code_point);
+
+      size_t j = i;
+
+      while (j > 0 && classes[j - 1] > class) {
+        data[j] = data[j - 1];
+        classes[j] = classes[j - 1];
+        j--;
+      }
+
+      data[j] = code_point;
+      classes[j] = class;
+    }
+
+    return 0;
+  }
+
+  uint32_t *sorted = malloc(len * sizeof(uint32_t));
+  if (sorted == NULL) return -1;
+
+  size_t offsets[256] = {0};
+
+  for (size_t i = 0; i < len; i++) {
+    offsets[url__unicode_combining_class(data[i])]++;
+  }
+
+  for (size_t i = 0, offset = 0; i < 256; i++) {
+    size_t count = offsets[i];
+
+    offsets[i] = offset;
+    offset += count;
+  }
+
+  for (size_t i = 0; i < len; i++) {
+    sorted[offsets[url__unicode_combining_class(data[i])]++] = data[i];
+  }
+
+  memcpy(data, sorted, len * sizeof(uint32_t));
+
+  free(sorted);
+
+  return 0;
+}
+
+/**
+ * Normalize the code points at `*data` to NFC, replacing `*data` with a new
+ * allocation if the decomposition is longer.
+ */
+// https://www.unicode.org/reports/tr15/#Description_Norm
+static inline int
+url__idna_normalize (uint32_t **data, size_t *len) {
+  int err;
+
+  uint32_t *input = *data;
+  size_t n = *len;
+
+  // Nothing below U+0300 decomposes into anything but itself under NFC, nor
+  // combines with a following character below U+0300.
+  size_t i = 0;
+
+  while (i < n && input[i] < 0x300) i++;
+
+  if (i == n) return 0;
+
+  uint32_t decomposition[4];
+
+  size_t decomposed_len = 0;
+
+  for (i = 0; i < n; i++) {
+    size_t d = url__unicode_decompose(input[i], decomposition);
+
+    decomposed_len += d ? d : 1;
+  }
+
+  uint32_t *output = malloc(decomposed_len * sizeof(uint32_t));
+  if (output == NULL) return -1;
+
+  size_t m = 0;
+
+  for (i = 0; i < n; i++) {
+    size_t d = url__unicode_decompose(input[i], &output[m]);
+
+    if (d == 0) output[m++] = input[i];
+    else m += d;
+  }
+
+  // https://www.unicode.org/versions/latest/core-spec/chapter-3/#G49591
+  for (i = 0; i < m;) {
+    if (url__unicode_combining_class(output[i]) == 0) {
+      i++;
+      continue;
+    }
+
+    size_t j = i + 1;
+
+    while (j < m && url__unicode_combining_class(output[j]) != 0) j++;
+
+    if (j - i > 1) {
+      err = url__idna_sort_marks(&output[i], j - i);
+
+      if (err < 0) {
+        free(output);
+
+        return err;
+      }
+    }
+
+    i = j;
+  }
+
+  // https://www.unicode.org/versions/latest/core-spec/chapter-3/#G50628
+  size_t starter = 0, composed = 1;
+
+  int last_class = url__unicode_combining_class(output[0]);
+
+  if (last_class != 0) last_class = 256;
+
+  for (i = 1; i < m; i++) {
+    uint32_t code_point = output[i];
+
+    int class = url__unicode_combining_class(code_point);
+
+    uint32_t composite = url__unicode_compose(output[starter], code_point);
+
+    if (composite != 0 && (last_class < class || last_class == 0)) {
+      output[starter] = composite;
+    } else {
+      if (class == 0) starter = composed;
+
+      last_class = class;
+
+      output[composed++] = code_point;
+    }
+  }
+
+  free(input);
+
+  *data = output;
+  *len = composed;
+
+  return 0;
+}
+
+// https://datatracker.ietf.org/doc/html/rfc5892#appendix-A.1
+static inline bool
+url__idna_is_valid_joiner (const uint32_t *label, size_t len, size_t i) {
+  if (i > 0 && url__unicode_combining_class(label[i - 1]) == 9) return true;
+
+  if (label[i] == 0x200d) return false;
+
+  size_t j = i;
+
+  while (j > 0 && url__unicode_joining_type(label[j - 1]) == url_joining_t) j--;
+
+  if (j == 0) return false;
+
+  url_joining_type_t before = url__unicode_joining_type(label[j - 1]);
+
+  if (before != url_joining_l && before != url_joining_d) return false;
+
+  size_t k = i + 1;
+
+  while (k < len && url__unicode_joining_type(label[k]) == url_joining_t) k++;
+
+  if (k == len) return false;
+
+  url_joining_type_t after = url__unicode_joining_type(label[k]);
+
+  return after == url_joining_r || after == url_joining_d;
+}
+
+// https://www.unicode.org/reports/tr46/#Validity_Criteria
+static inline bool
+url__idna_is_valid_label (const uint32_t *label, size_t len) {
+  const uint32_t *mapping;
+  size_t mapping_len;
+
+  if (len >= 4 && label[0] == 0x78 && label[1] == 0x6e && label[2] == 0x2d && label[3] == 0x2d) return false;
+
+  if (len > 0 && url__unicode_is_mark(label[0])) return false;
+
+  for (size_t i = 0; i < len; i++) {
+    uint32_t code_point = label[i];
+
+    if (code_point < 0x80) {
+      // Only the full stop is not valid in ASCII with UseSTD3ASCIIRules=false,
+      // and labels never contain it.
+      if (code_point >= 0x41 && code_point <= 0x5a) return false;
+
+      continue;
+    }
+
+    url_idna_status_t status = url__unicode_idna_status(code_point, &mapping, &mapping_len);
+
+    if (status != url_idna_valid && status != url_idna_deviation) return false;
+
+    if ((code_point == 0x200c || code_point == 0x200d) && !url__idna_is_valid_joiner(label, len, i)) return false;
+  }
+
+  return true;
+}
+
+// https://datatracker.ietf.org/doc/html/rfc5893#section-2
+static inline bool
+url__idna_is_valid_bidi_label (const uint32_t *label, size_t len) {
+  if (len == 0) return true;
+
+  url_bidi_class_t first = url__unicode_bidi_class(label[0]);
+
+  bool rtl;
+
+  if (first == url_bidi_r || first == url_bidi_al) rtl = true;
+  else if (first == url_bidi_l) rtl = false;
+  else return false;
+
+  bool has_en = false, has_an = false;
+
+  url_bidi_class_t last = first;
+
+  for (size_t i = 0; i < len; i++) {
+    url_bidi_class_t class = url__unicode_bidi_class(label[i]);
+
+    switch (class) {
+    case url_bidi_l:
+      if (rtl) return false;
+      break;
+    case url_bidi_r:
+    case url_bidi_al:
+      if (!rtl) return false;
+      break;
+    case url_bidi_an:
+      if (!rtl) return false;
+      has_an = true;
+      break;
+    case url_bidi_en:
+      has_en = true;
+      break;
+    case url_bidi_es:
+    case url_bidi_cs:
+    case url_bidi_et:
+    case url_bidi_on:
+    case url_bidi_bn:
+    case url_bidi_nsm:
+      break;
+    default:
+      return false;
+    }
+
+    if (class != url_bidi_nsm) last = class;
+  }
+
+  if (rtl) {
+    if (has_en && has_an) return false;
+
+    return last == url_bidi_r || last == url_bidi_al || last == url_bidi_en || last == url_bidi_an;
+  }
+
+  return last == url_bidi_l || last == url_bidi_en;
+}
+
+static inline bool
+url__idna_is_rtl_label (const uint32_t *label, size_t len) {
+  for (size_t i = 0; i < len; i++) {
+    if (label[i] < 0x80) continue;
+
+    url_bidi_class_t class = url__unicode_bidi_class(label[i]);
+
+    if (class == url_bidi_r || class == url_bidi_al || class == url_bidi_an) return true;
+  }
+
+  return false;
+}
+
+/**
+ * Decode and validate the ACE label at `label`, appending the decoded label
+ * to `result`, which must have room for `len` code points.
+ */
+// https://www.unicode.org/reports/tr46/#ProcessingStepPunycode
+static inline int
+url__idna_decode_label (const uint32_t *label, size_t len, uint32_t *result, size_t *result_len) {
+  int err;
+
+  if (!url__punycode_is_basic(label, len)) return -1;
+
+  utf8_t buffer[url__punycode_stack_len];
+
+  utf8_t *ascii = buffer;
+
+  if (len > url__punycode_stack_len) {
+    ascii = malloc(len);
+    if (ascii == NULL) return -1;
+  }
+
+  for (size_t i = 0; i < len; i++) {
+    ascii[i] = (utf8_t) label[i];
+  }
+
+  size_t n;
+
+  err = url__punycode_decode(&ascii[4], len - 4, result, &n);
+
+  if (ascii != buffer) free(ascii);
+
+  if (err < 0) return err;
+
+  if (url__punycode_is_basic(result, n)) return -1;
+
+  uint32_t *normalized = malloc(n * sizeof(uint32_t));
+  if (normalized == NULL) return -1;
+
+  memcpy(normalized, result, n * sizeof(uint32_t));
+
+  size_t normalized_len = n;
+
+  err = url__idna_normalize(&normalized, &normalized_len);
+
+  if (err < 0) {
+    free(normalized);
+
+    return err;
+  }
+
+  bool is_normalized = normalized_len == n && memcmp(normalized, result, n * sizeof(uint32_t)) == 0;
+
+  free(normalized);
+
+  if (!is_normalized) return -1;
+
+  *result_len = n;
+
+  return 0;
+}
+
+/**
+ * Convert the domain at `input` to ASCII as per UTS #46 with the options
+ * required by the URL Standard: CheckHyphens=false, CheckBidi=true,
+ * CheckJoiners=true, UseSTD3ASCIIRules=false, Transitional_Processing=false,
+ * VerifyDnsLength=false and IgnoreInvalidPunycode=false. Any error recorded
+ * during processing fails the conversion.
+ */
+// https://www.unicode.org/reports/tr46/#ToASCII
 static inline int
 url__idna_to_ascii (utf8_string_view_t input, utf8_string_t *result) {
-  // TODO
+  int err;
+
+  uint32_t *decoded = NULL, *data = NULL, *labels = NULL;
+
+  size_t len;
+
+  decoded = malloc(input.len ? input.len * sizeof(uint32_t) : 1);
+  if (decoded == NULL) goto err;
+
+  // The replacement character is disallowed by UTS #46, so invalid sequences
+  // fail the mapping step below.
+  len = url__utf8_decode(input.data, input.len, decoded);
+
+  err = url__idna_map(decoded, len, &data, &len);
+  if (err < 0) goto err;
+
+  free(decoded);
+  decoded = NULL;
+
+  err = url__idna_normalize(&data, &len);
+  if (err < 0) goto err;
+
+  // Decoded labels are shorter than their ACE form, so the labels fit in as
+  // many code points as the normalized domain.
+  labels = malloc(len ? len * sizeof(uint32_t) : 1);
+  if (labels == NULL) goto err;
+
+  size_t labels_len = 0;
+
+  bool is_bidi = false;
+
+  // https://www.unicode.org/reports/tr46/#ProcessingStepBreak
+  for (size_t start = 0, i = 0; i <= len; i++) {
+    if (i < len && data[i] != 0x2e) continue;
+
+    const uint32_t *label = &data[start];
+    size_t label_len = i - start;
+
+    uint32_t *output = &labels[labels_len];
+    size_t output_len;
+
+    if (label_len >= 4 && label[0] == 0x78 && label[1] == 0x6e && label[2] == 0x2d && label[3] == 0x2d) {
+      err = url__idna_decode_label(label, label_len, output, &output_len);
+      if (err < 0) goto err;
+    } else {
+      memcpy(output, label, label_len * sizeof(uint32_t));
+
+      output_len = label_len;
+    }
+
+    if (!url__idna_is_valid_label(output, output_len)) goto err;
+
+    is_bidi = is_bidi || url__idna_is_rtl_label(output, output_len);
+
+    labels_len += output_len;
+
+    if (i < len) labels[labels_len++] = 0x2e;
+
+    start = i + 1;
+  }
+
+  free(data);
+  data = NULL;
+
+  err = url__string_reserve(result, result->len + labels_len);
+  if (err < 0) goto err;
+
+  // https://www.unicode.org/reports/tr46/#ToASCII
+  for (size_t start = 0, i = 0; i <= labels_len; i++) {
+    if (i < labels_len && labels[i] != 0x2e) continue;
+
+    const uint32_t *label = &labels[start];
+    size_t label_len = i - start;
+
+    if (is_bidi && !url__idna_is_valid_bidi_label(label, label_len)) goto err;
+
+    if (url__punycode_is_basic(label, label_len)) {
+      for (size_t j = 0; j < label_len; j++) {
+        err = url__string_append_character(result, (utf8_t) label[j]);
+        if (err < 0) goto err;
+      }
+    } else {
+      err = url__string_append_literal(result, (utf8_t *) "xn--", 4);
+      if (err < 0) goto err;
+
+      err = url__punycode_encode(label, label_len, result);
+      if (err < 0) goto err;
+    }
+
+    if (i < labels_len) {
+      err = url__string_append_character(result, 0x2e);
+      if (err < 0) goto err;
+    }
+
+    start = i + 1;
+  }
+
+  free(labels);
+
+  return 0;
+
+err:
+  free(decoded);
+  free(data);
+  free(labels);
+
+  return -1;
+}
+
+/**
+ * Convert the ASCII domain at `input`, as serialized by the host parser, to
+ * Unicode for display and append it. ACE labels are decoded and checked
+ * against the same criteria as `url__idna_to_ascii()`, and if any check
+ * fails the domain is appended unchanged rather than partially decoded.
+ */
+// https://url.spec.whatwg.org/#concept-domain-to-unicode
+static inline int
+url__idna_to_unicode (utf8_string_view_t input, utf8_string_t *result) {
+  int err;
+
+  if (
+    !url__idna_may_have_ace_label(input.data, input.len) ||
+    !url__idna_has_ace_label(input.data, input.len) ||
+    !url__is_ascii_string(input.data, input.len)
+  ) {
+    return url__string_append_view(result, input);
+  }
+
+  uint32_t *data = NULL, *labels = NULL;
+
+  size_t len = input.len;
+
+  data = malloc(len * sizeof(uint32_t));
+  if (data == NULL) goto err;
+
+  labels = malloc(len * sizeof(uint32_t));
+  if (labels == NULL) goto err;
+
+  for (size_t i = 0; i < len; i++) {
+    data[i] = input.data[i];
+  }
+
+  size_t labels_len = 0;
+
+  bool is_bidi = false;
+
+  for (size_t start = 0, i = 0; i <= len; i++) {
+    if (i < len && data[i] != 0x2e) continue;
+
+    const uint32_t *label = &data[start];
+    size_t label_len = i - start;
+
+    uint32_t *output = &labels[labels_len];
+    size_t output_len;
+
+    if (label_len >= 4 && label[0] == 0x78 && label[1] == 0x6e && label[2] == 0x2d && label[3] == 0x2d) {
+      err = url__idna_decode_label(label, label_len, output, &output_len);
+      if (err < 0) goto unchanged;
+    } else {
+      memcpy(output, label, label_len * sizeof(uint32_t));
+
+      output_len = label_len;
+    }
+
+    if (!url__idna_is_valid_label(output, output_len)) goto unchanged;
+
+    is_bidi = is_bidi || url__idna_is_rtl_label(output, output_len);
+
+    labels_len += output_len;
+
+    if (i < len) labels[labels_len++] = 0x2e;
+
+    start = i + 1;
+  }
+
+  if (is_bidi) {
+    for (size_t start = 0, i = 0; i <= labels_len; i++) {
+      if (i < labels_len && labels[i] != 0x2e) continue;
+
+      if (!url__idna_is_valid_bidi_label(&labels[start], i - start)) goto unchanged;
+
+      start = i + 1;
+    }
+  }
+
+  err = url__string_reserve(result, result->len + labels_len * 4);
+  if (err < 0) goto err;
+
+  result->len += url__utf8_encode(labels, labels_len, &result->data[result->len]);
+
+  free(data);
+  free(labels);
+
+  return 0;
+
+unchanged:
+  free(data);
+  free(labels);
+
+  return url__string_append_view(result, input);
+
+err:
+  free(data);
+  free(labels);
 
   return -1;
 }
 
+/**
+ * Convert `len` domains at `input` to Unicode, appending them back to back to
+ * `arena` and pointing `result` at each of them. The views stay valid until
+ * `arena` is next modified.
+ */
+static inline int
+url__idna_to_unicode_batch (const utf8_string_view_t *input, size_t len, utf8_string_t *arena, utf8_string_view_t *result) {
+  int err;
+
+  // Most domains pass through unchanged, so size the arena for all of them
+  // up front.
+  size_t total = 0;
+
+  for (size_t i = 0; i < len; i++) {
+    total += input[i].len;
+  }
+
+  err = url__string_reserve(arena, arena->len + total);
+  if (err < 0) return err;
+
+  size_t start = arena->len;
+
+  for (size_t i = 0; i < len; i++) {
+    size_t offset = arena->len;
+
+    err = url__idna_to_unicode(input[i], arena);
+    if (err < 0) return err;
+
+    result[i].len = arena->len - offset;
+  }
+
+  // The arena may have moved while growing, so only point into it once all
+  // domains have been appended.
+  for (size_t i = 0; i < len; i++) {
+    result[i].data = &arena->data[start];
+
+    start += result[i].len;
+  }
+
+  return 0;
+}
+
 #endif // URL_IDNA_H
@@ -11,9 +11,12 @@
 
 #include "../url.h"
 #include "character-set.h"
+#include "idna-cache.h"
+#include "idna.h"
 #include "infra.h"
 #include "percent-encode.h"
 #include "serialize.h"
+#include "trace.h"
 #include "type.h"
 
 typedef enum {
@@ -40,113 +43,6 @@ typedef enum {
   url_state_fragment,
 } url_state_t;
 
-// https://url.spec.whatwg.org/#forbidden-host-code-point
-static url_character_set_t url__forbidden_host_character_set = {
-  // 00    01     02     03     04     05     06     07
-  0x01 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00,
-  // 08    09     0a     0b     0c     0d     0e     0f
-  0x00 | 0x02 | 0x04 | 0x00 | 0x00 | 0x20 | 0x00 | 0x00,
-  // 10    11     12     13     14     15     16     17
-  0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00,
-  // 18    19     1a     1b     1c     1d     1e     1f
-  0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00,
-  // 20    21     22     23     24     25     26     27
-  0x01 | 0x00 | 0x00 | 0x08 | 0x00 | 0x00 | 0x00 | 0x00,
-  // 28    29     2a     2b     2c     2d     2e     2f
-  0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x80,
-  // 30    31     32     33     34     35     36     37
-  0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00,
-  // 38    39     3a     3b     3c     3d     3e     3f
-  0x00 | 0x00 | 0x04 | 0x00 | 0x10 | 0x00 | 0x40 | 0x80,
-  // 40    41     42     43     44     45     46     47
-  0x01 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00,
-  // 48    49     4a     4b     4c     4d     4e     4f
-  0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00,
-  // 50    51     52     53     54     55     56     57
-  0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00,
-  // 58    59     5a     5b     5c     5d     5e     5f
-  0x00 | 0x00 | 0x00 | 0x08 | 0x10 | 0x20 | 0x40 | 0x00,
-  // 60    61     62     63     64     65     66     67
-  0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00,
-  // 68    69     6a     6b     6c     6d     6e     6f
-  0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00,
-  // 70    71     72     73     74     75     76     77
-  0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00,
-  // 78    79     7a     7b     7c
-  0x00 | 0x00 | 0x00 | 0x00 | 0x10,
-};
-
-// https://url.spec.whatwg.org/#forbidden-domain-code-point
-static url_character_set_t url__forbidden_domain_character_set = {
-  // 00    01     02     03     04     05     06     07
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // 08    09     0a     0b     0c     0d     0e     0f
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // 10    11     12     13     14     15     16     17
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // 18    19     1a     1b     1c     1d     1e     1f
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // 20    21     22     23     24     25     26     27
-  0x01 | 0x00 | 0x00 | 0x08 | 0x00 | 0x20 | 0x00 | 0x00,
-  // 28    29     2a     2b     2c     2d     2e     2f
-  0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x80,
-  // 30    31     32     33     34     35     36     37
-  0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00,
-  // 38    39     3a     3b     3c     3d     3e     3f
-  0x00 | 0x00 | 0x04 | 0x00 | 0x10 | 0x00 | 0x40 | 0x80,
-  // 40    41     42     43     44     45     46     47
-  0x01 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00,
-  // 48    49     4a     4b     4c     4d     4e     4f
-  0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00,
-  // 50    51     52     53     54     55     56     57
-  0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00,
-  // 58    59     5a     5b     5c     5d     5e     5f
-  0x00 | 0x00 | 0x00 | 0x08 | 0x10 | 0x20 | 0x40 | 0x00,
-  // 60    61     62     63     64     65     66     67
-  0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00,
-  // 68    69     6a     6b     6c     6d     6e     6f
-  0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00,
-  // 70    71     72     73     74     75     76     77
-  0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00,
-  // 78    79     7a     7b     7c
-  0x00 | 0x00 | 0x00 | 0x00 | 0x10,
-};
-
-static url_character_set_t url__scheme_character_set = {
-  // 00    01     02     03     04     05     06     07
-  0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00,
-  // 08    09     0a     0b     0c     0d     0e     0f
-  0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00,
-  // 10    11     12     13     14     15     16     17
-  0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00,
-  // 18    19     1a     1b     1c     1d     1e     1f
-  0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00,
-  // 20    21     22     23     24     25     26     27
-  0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00,
-  // 28    29     2a     2b     2c     2d     2e     2f
-  0x00 | 0x00 | 0x00 | 0x08 | 0x00 | 0x20 | 0x40 | 0x00,
-  // 30    31     32     33     34     35     36     37
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // 38    39     3a     3b     3c     3d     3e     3f
-  0x01 | 0x02 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00,
-  // 40    41     42     43     44     45     46     47
-  0x00 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // 48    49     4a     4b     4c     4d     4e     4f
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // 50    51     52     53     54     55     56     57
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // 58    59     5a     5b     5c     5d     5e     5f
-  0x01 | 0x02 | 0x04 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00,
-  // 60    61     62     63     64     65     66     67
-  0x00 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // 68    69     6a     6b     6c     6d     6e     6f
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // 70    71     72     73     74     75     76     77
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // 78    79     7a
-  0x01 | 0x02 | 0x04,
-};
-
 // https://url.spec.whatwg.org/#windows-drive-letter
 static inline bool
 url__is_windows_drive_letter (const utf8_string_view_t input) {
@@ -318,9 +214,31 @@ err:
   return (uint64_t) -1;
 }
 
+/**
+ * Store an IPv4 address in network byte order.
+ */
+static inline void
+url__write_ipv4_address (uint32_t address, uint8_t result[16]) {
+  result[0] = (uint8_t) (address >> 24);
+  result[1] = (uint8_t) (address >> 16);
+  result[2] = (uint8_t) (address >> 8);
+  result[3] = (uint8_t) address;
+}
+
+/**
+ * Store an IPv6 address in network byte order.
+ */
+static inline void
+url__write_ipv6_address (const uint16_t address[8], uint8_t result[16]) {
+  for (int i = 0; i < 8; i++) {
+    result[i * 2] = (uint8_t) (address[i] >> 8);
+    result[i * 2 + 1] = (uint8_t) address[i];
+  }
+}
+
 // https://url.spec.whatwg.org/#concept-ipv4-parser
 static inline int
-url__parse_ipv4 (utf8_string_view_t input, utf8_string_t *result) {
+url__parse_ipv4 (utf8_string_view_t input, uint8_t result_address[16], utf8_string_t *result) {
   uint32_t address = 0;
 
   uint8_t parts = 0;
@@ -336,7 +254,8 @@ url__parse_ipv4 (utf8_string_view_t input, utf8_string_t *result) {
 
     if (value == (uint64_t) -1) goto err;
 
-    if (i == (size_t) -1) {
+    // A trailing empty part is removed, making this the last part.
+    if (i == (size_t) -1 || utf8_string_view_empty(input)) {
       if (parts == 0) {
         if (value > UINT32_MAX) goto err;
 
@@ -359,20 +278,95 @@ url__parse_ipv4 (utf8_string_view_t input, utf8_string_t *result) {
     parts++;
   }
 
+  url__write_ipv4_address(address, result_address);
+
   return url__serialize_ipv4(address, result);
 
 err:
   return -1;
 }
 
-// https://url.spec.whatwg.org/#concept-ipv6-parser
+/**
+ * Read the dominant form of IPv4 host, four decimal parts without leading
+ * zeros such as "192.168.0.1", optionally followed by a trailing dot, in a
+ * single pass with no ends in a number check or splitting. Returns false if
+ * the input is in any other form.
+ */
+static inline bool
+url__read_ipv4_dotted_decimal (const utf8_string_view_t input, uint32_t *result) {
+  const utf8_t *data = input.data;
+
+  size_t len = input.len;
+
+  if (len < 7 || len > 16) return false;
+
+  // A trailing empty part is removed.
+  if (data[len - 1] == 0x2e) len--;
+
+  uint32_t address = 0;
+
+  size_t i = 0;
+
+  for (uint8_t part = 0; part < 4; part++) {
+    if (part > 0) {
+      if (data[i] != 0x2e) return false;
+
+      i++;
+    }
+
+    size_t start = i;
+
+    uint32_t value = 0;
+
+    while (i < len && i - start < 3 && url__is_ascii_digit(data[i])) {
+      value = value * 10 + (data[i++] - 0x30);
+    }
+
+    size_t digits = i - start;
+
+    if (digits == 0 || value > 255 || (digits > 1 && data[start] == 0x30)) return false;
+
+    if (i == len && part < 3) return false;
+
+    address = (address << 8) | value;
+  }
+
+  if (i != len) return false;
+
+  *result = address;
+
+  return true;
+}
+
+/**
+ * Parse an IPv4 host in the dotted-decimal form read by
+ * `url__read_ipv4_dotted_decimal()`. Such an address, less any trailing dot,
+ * is its own serialization, so it is copied as is. Returns 1 if the address
+ * was appended, 0 if the input needs the full IPv4 parser, which handles the
+ * hexadecimal, octal and shortened forms, and -1 on failure.
+ */
 static inline int
-url__parse_ipv6 (utf8_string_view_t input, utf8_string_t *result) {
-  int err;
+url__parse_ipv4_dotted_decimal (const utf8_string_view_t input, uint8_t result_address[16], utf8_string_t *result) {
+  uint32_t address;
 
-  if (utf8_string_view_empty(input)) goto err;
+  if (!url__read_ipv4_dotted_decimal(input, &address)) return 0;
 
-  uint16_t address[8] = {0};
+  size_t len = input.len;
+
+  if (input.data[len - 1] == 0x2e) len--;
+
+  int err = url__string_append_view(result, utf8_string_view_init(input.data, len));
+  if (err < 0) return err;
+
+  url__write_ipv4_address(address, result_address);
+
+  return 1;
+}
+
+// https://url.spec.whatwg.org/#concept-ipv6-parser
+static inline int
+url__parse_ipv6_address (utf8_string_view_t input, uint16_t address[8]) {
+  if (utf8_string_view_empty(input)) goto err;
 
   uint8_t piece_index = 0;
   uint8_t compress = (uint8_t) -1;
@@ -395,6 +389,7 @@ url__parse_ipv6 (utf8_string_view_t input, utf8_string_t *result) {
 
       pointer++;
       compress = ++piece_index;
+      continue;
     }
 
     uint16_t value = 0, length = 0;
@@ -456,7 +451,7 @@ url__parse_ipv6 (utf8_string_view_t input, utf8_string_t *result) {
       if (numbers_seen != 4) goto err;
 
       break;
-    } else if (*pointer == 0x3a) {
+    } else if (pointer != eof && *pointer == 0x3a) {
       pointer++;
 
       if (pointer == eof) goto err;
@@ -487,13 +482,135 @@ url__parse_ipv6 (utf8_string_view_t input, utf8_string_t *result) {
     goto err;
   }
 
-  err = utf8_string_append_character(result, '[');
+  return 0;
+
+err:
+  return -1;
+}
+
+static const uint8_t url__ipv6_class[256] = {
+  ['0'] = 0x20,
+  ['1'] = 0x21,
+  ['2'] = 0x22,
+  ['3'] = 0x23,
+  ['4'] = 0x24,
+  ['5'] = 0x25,
+  ['6'] = 0x26,
+  ['7'] = 0x27,
+  ['8'] = 0x28,
+  ['9'] = 0x29,
+  ['A'] = 0x2a,
+  ['a'] = 0x2a,
+  ['B'] = 0x2b,
+  ['b'] = 0x2b,
+  ['C'] = 0x2c,
+  ['c'] = 0x2c,
+  ['D'] = 0x2d,
+  ['d'] = 0x2d,
+  ['E'] = 0x2e,
+  ['e'] = 0x2e,
+  ['F'] = 0x2f,
+  ['f'] = 0x2f,
+  [':'] = 0x40,
+};
+
+#define url__ipv6_class_hex  0x20
+#define url__ipv6_class_colon 0x40
+
+/**
+ * Parse an address made only of hexadecimal pieces and colons, the common
+ * form, in a single pass that classifies and decodes each byte with one table
+ * lookup. Returns true if `address` was filled in, and false if the input
+ * needs the full IPv6 parser, either because it has an IPv4 part or because
+ * it is invalid.
+ */
+static inline bool
+url__parse_ipv6_hex_address (utf8_string_view_t input, uint16_t address[8]) {
+  const utf8_t *data = input.data;
+
+  size_t len = input.len, i = 0;
+
+  uint16_t pieces[8];
+
+  uint8_t piece_index = 0, compress = (uint8_t) -1;
+
+  if (len >= 2 && data[0] == 0x3a && data[1] == 0x3a) {
+    compress = 0;
+    i = 2;
+  }
+
+  while (i < len) {
+    // A compressed run takes up at least one piece.
+    if (piece_index == (compress == (uint8_t) -1 ? 8 : 7)) return false;
+
+    uint16_t value = 0;
+
+    size_t start = i;
+
+    uint8_t c;
+
+    while (i < len && i - start < 4 && ((c = url__ipv6_class[data[i]]) & url__ipv6_class_hex)) {
+      value = (value << 4) | (c & 0xf);
+      i++;
+    }
+
+    if (i == start) return false;
+
+    pieces[piece_index++] = value;
+
+    if (i == len) break;
+
+    if (data[i] != 0x3a || ++i == len) return false;
+
+    if (data[i] == 0x3a) {
+      if (compress != (uint8_t) -1 || piece_index == 8) return false;
+
+      compress = piece_index;
+
+      i++;
+    }
+  }
+
+  if (compress == (uint8_t) -1) {
+    if (piece_index != 8) return false;
+
+    memcpy(address, pieces, sizeof(pieces));
+
+    return true;
+  }
+
+  // Eight pieces leave no room for the compressed run.
+  if (piece_index == 8) return false;
+
+  uint8_t tail = piece_index - compress;
+
+  memset(address, 0, 8 * sizeof(uint16_t));
+  memcpy(address, pieces, compress * sizeof(uint16_t));
+  memcpy(&address[8 - tail], &pieces[compress], tail * sizeof(uint16_t));
+
+  return true;
+}
+
+static inline int
+url__parse_ipv6 (utf8_string_view_t input, uint8_t result_address[16], utf8_string_t *result) {
+  int err;
+
+  uint16_t address[8] = {0};
+
+  if (!url__parse_ipv6_hex_address(input, address)) {
+    err = url__parse_ipv6_address(input, address);
+    if (err < 0) goto err;
+  }
+
+  url__write_ipv6_address(address, result_address);
+
+  err = url__string_append_character(result, '[');
   if (err < 0) goto err;
 
   err = url__serialize_ipv6(address, result);
   if (err < 0) goto err;
 
-  err = utf8_string_append_character(result, ']');
+  err = url__string_append_character(result, ']');
   if (err < 0) goto err;
 
   return 0;
@@ -512,70 +629,273 @@ url__parse_opaque_host (const utf8_string_view_t input, utf8_string_t *result) {
   return url__percent_encode_string(input, url__c0_control_percent_encode_set, result);
 }
 
+/**
+ * Convert a domain that is pure ASCII and has no ACE labels, which makes
+ * domain to ASCII equivalent to ASCII lowercasing, in a single pass that
+ * lowercases into the spare capacity of `result` while checking for forbidden
+ * domain code points. Returns 1 if the domain, or the IPv4 address that it
+ * turned out to be, was appended, 0 if it needs the full UTS #46 processing,
+ * and -1 on failure.
+ */
+// https://url.spec.whatwg.org/#concept-domain-to-ascii
+static inline int
+url__parse_ascii_domain (const utf8_string_view_t input, url_host_type_t *type, uint8_t address[16], utf8_string_t *result) {
+  int err;
+
+  err = url__string_reserve(result, result->len + input.len);
+  if (err < 0) return err;
+
+  utf8_t *output = &result->data[result->len];
+
+  if (!url__idna_ascii_lowercase(input.data, input.len, output)) return 0;
+
+  utf8_string_view_t domain = utf8_string_view_init(output, input.len);
+
+  if (url__contains_from_character_set(url__forbidden_domain_character_set, domain)) {
+    // A percent sign may still decode into something valid.
+    return memchr(input.data, 0x25, input.len) == NULL ? -1 : 0;
+  }
+
+  if (url__idna_has_ace_label(output, input.len)) return 0;
+
+  if (url__ends_in_a_number(domain)) {
+    // The IPv4 parser is case-insensitive, so parse the input rather than the
+    // lowercased copy that the serialized address would overwrite.
+    err = url__parse_ipv4(input, address, result);
+    if (err < 0) return err;
+
+    *type = url_host_type_ipv4;
+
+    return 1;
+  }
+
+  result->len += input.len;
+
+  *type = url_host_type_domain;
+
+  return 1;
+}
+
+/**
+ * Parse the host at `input` and append its serialization to the href of
+ * `url`, recording the type of the host and, for an IPv4 or IPv6 host, its
+ * numeric address. If `cache` is not NULL, domains that need full domain to
+ * ASCII processing are looked up in and added to it, keyed by the raw input.
+ */
 // https://url.spec.whatwg.org/#concept-host-parser
 static inline int
-url__parse_host (const utf8_string_view_t input, bool is_opaque, utf8_string_t *result) {
+url__parse_host (const utf8_string_view_t input, bool is_opaque, url_idna_cache_t *cache, url_t *url) {
   int err;
 
+  utf8_string_t *result = &url->href;
+
+  uint8_t *address = url->host_address;
+
+  memset(address, 0, sizeof(url->host_address));
+
   if (input.len > 0 && input.data[0] == 0x5b) {
     if (input.data[input.len - 1] != 0x5d) return -1;
 
-    return url__parse_ipv6(utf8_string_view_substring(input, 1, input.len - 1), result);
+    url->host_type = url_host_type_ipv6;
+
+    return url__parse_ipv6(utf8_string_view_substring(input, 1, input.len - 1), address, result);
   }
 
-  if (is_opaque) return url__parse_opaque_host(input, result);
+  if (is_opaque) {
+    url->host_type = input.len == 0 ? url_host_type_empty : url_host_type_opaque;
+
+    return url__parse_opaque_host(input, result);
+  }
 
   assert(input.len != 0);
 
-  if (!url__contains_from_character_set(url__forbidden_domain_character_set, input)) {
-    err = utf8_string_append_view(result, input);
-    if (err < 0) return err;
+  if (url__is_ascii_digit(input.data[0])) {
+    err = url__parse_ipv4_dotted_decimal(input, address, result);
+
+    if (err != 0) {
+      url->host_type = url_host_type_ipv4;
+
+      return err < 0 ? err : 0;
+    }
+  }
+
+  err = url__parse_ascii_domain(input, &url->host_type, address, result);
+  if (err != 0) return err < 0 ? err : 0;
+
+  if (cache) {
+    // Only domains are added to the cache, see below.
+    url->host_type = url_host_type_domain;
 
-    return 0;
+    err = url_idna_cache_get(cache, input, result);
+    if (err != 0) return err < 0 ? err : 0;
   }
 
+  size_t start = result->len;
+
   utf8_string_t domain;
   utf8_string_init(&domain);
 
+  utf8_string_t ascii_domain;
+  utf8_string_init(&ascii_domain);
+
   err = url__percent_decode_string(input, &domain);
   if (err < 0) goto err;
 
-  // TODO Domain to ASCII
-
-  utf8_string_t ascii_domain = domain;
+  err = url__parse_ascii_domain(utf8_string_view(&domain), &url->host_type, address, result);
+  if (err < 0) goto err;
 
-  if (url__ends_in_a_number(utf8_string_view(&ascii_domain))) {
-    err = url__parse_ipv4(utf8_string_view(&ascii_domain), result);
-    if (err < 0) goto err;
-  } else {
-    err = utf8_string_append(result, &ascii_domain);
+  if (err == 0) {
+    err = url__idna_to_ascii(utf8_string_view(&domain), &ascii_domain);
     if (err < 0) goto err;
+
+    utf8_string_view_t view = utf8_string_view(&ascii_domain);
+
+    if (utf8_string_view_empty(view)) goto err;
+
+    if (url__contains_from_character_set(url__forbidden_domain_character_set, view)) goto err;
+
+    if (url__ends_in_a_number(view)) {
+      err = url__parse_ipv4(view, address, result);
+      if (err < 0) goto err;
+
+      url->host_type = url_host_type_ipv4;
+    } else {
+      err = url__string_append_view(result, view);
+      if (err < 0) goto err;
+
+      url->host_type = url_host_type_domain;
+    }
+  }
+
+  // IPv4 addresses are left out of the cache so that a hit is always a domain
+  // and the address doesn't need to be parsed back from the cached
+  // serialization.
+  if (cache && url->host_type == url_host_type_domain) {
+    // The cache is only an optimization, so failing to add to it doesn't fail
+    // the parse.
+    url_idna_cache_put(cache, input, utf8_string_view_init(&result->data[start], result->len - start));
   }
 
   utf8_string_destroy(&domain);
+  utf8_string_destroy(&ascii_domain);
 
   return 0;
 
 err:
   utf8_string_destroy(&domain);
+  utf8_string_destroy(&ascii_domain);
 
   return -1;
 }
 
+static inline void
+url__copy_host (url_t *url, const url_t *base) {
+  url->host_type = base->host_type;
+
+  memcpy(url->host_address, base->host_address, sizeof(url->host_address));
+}
+
+/**
+ * Recover the host type and address of `url` from its serialized host, for a
+ * URL that was decoded rather than parsed. The serialization is canonical, so
+ * this only needs the fast paths of the IPv4 and IPv6 parsers.
+ */
+static inline void
+url__restore_host (url_t *url) {
+  utf8_string_view_t host = url_get_host(url);
+
+  memset(url->host_address, 0, sizeof(url->host_address));
+
+  if (host.len == 0) {
+    url->host_type = url_host_type_empty;
+  } else if (host.data[0] == 0x5b) {
+    uint16_t address[8] = {0};
+
+    // The serializer only ever writes hex pieces and colons.
+    url__parse_ipv6_hex_address(utf8_string_view_init(&host.data[1], host.len >= 2 ? host.len - 2 : 0), address);
+
+    url->host_type = url_host_type_ipv6;
+
+    url__write_ipv6_address(address, url->host_address);
+  } else if (!url__is_special(url)) {
+    url->host_type = url_host_type_opaque;
+  } else {
+    uint32_t address;
+
+    if (url__is_ascii_digit(host.data[host.len - 1]) && url__read_ipv4_dotted_decimal(host, &address)) {
+      url->host_type = url_host_type_ipv4;
+
+      url__write_ipv4_address(address, url->host_address);
+    } else {
+      url->host_type = url_host_type_domain;
+    }
+  }
+}
+
+#define url__byte_delimiters (url__byte_slash | url__byte_question_mark | url__byte_number_sign)
+
+/**
+ * For the states that read their component a byte at a time, the classes of
+ * the bytes that they act on. Any other byte is simply part of the component
+ * being read. Backslashes are added for special URLs.
+ */
+static const url_character_set_t url__state_stops[] = {
+  [url_state_authority] = url__byte_delimiters | url__byte_at_sign,
+  [url_state_host] = url__byte_delimiters | url__byte_colon | url__byte_left_bracket | url__byte_right_bracket,
+  [url_state_hostname] = url__byte_delimiters | url__byte_colon | url__byte_left_bracket | url__byte_right_bracket,
+};
+
+/**
+ * Skip from `pointer` to the next byte in `stops`, or the end of the input,
+ * returning its position.
+ */
+static inline size_t
+url__skip_to_character_set (const utf8_string_view_t input, size_t pointer, url_character_set_t stops) {
+  while (pointer < input.len && !url__is_in_character_set(stops, input.data[pointer])) {
+    pointer++;
+  }
+
+  return pointer;
+}
+
+/**
+ * Skip from `pointer` past the bytes in `character_set`, returning the
+ * position of the first byte not in it or the end of the input.
+ */
+static inline size_t
+url__skip_character_set (const utf8_string_view_t input, size_t pointer, url_character_set_t character_set) {
+  while (pointer < input.len && url__is_in_character_set(character_set, input.data[pointer])) {
+    pointer++;
+  }
+
+  return pointer;
+}
+
 static inline int
-url__parse (url_t *url, const utf8_string_view_t input, const url_t *base) {
+url__parse (url_t *url, const utf8_string_view_t input, const url_t *base, url_idna_cache_t *cache) {
   int err;
 
+#if defined(URL_TRACE)
+  url_trace_t trace = *url__trace_counters();
+#endif
+
   url_state_t state = url_state_scheme_start;
 
   utf8_string_t buffer;
   utf8_string_init(&buffer);
 
-  err = utf8_string_reserve(&url->href, input.len);
+  err = url__string_reserve(&url->href, input.len);
   if (err < 0) goto err;
 
   bool at_sign_seen = false, inside_brackets = false, password_token_seen = false;
 
+  // The start of the path segment being written to `href`, if any.
+  size_t segment_start = (size_t) -1;
+
+  // The start in the input of the authority, host, or port being read, if
+  // any, which the states read straight from the input rather than the buffer.
+  size_t component_start = (size_t) -1;
+
   for (size_t pointer = 0, n = input.len; pointer <= n; pointer++) {
     int16_t c = pointer < n ? input.data[pointer] : -1;
 
@@ -599,15 +919,13 @@ url__parse (url_t *url, const utf8_string_view_t input, const url_t *base) {
       if (c == 0x3a) {
         url_type_t type = url__type(utf8_string_view_substring(input, 0, pointer));
 
-        err = utf8_string_append_view(&url->href, utf8_string_view_substring(input, 0, pointer + 1 /* : */));
+        err = url__string_append_view(&url->href, utf8_string_view_substring(input, 0, pointer + 1 /* : */));
         if (err < 0) goto err;
 
-        if (type == url_type_opaque) {
-          for (size_t i = 0, n = url->href.len - 1 /* : */; i < n; i++) {
-            url->href.data[i] = url__to_ascii_lowercase(url->href.data[i]);
-          }
-
-          type = url__type(utf8_string_substring(&url->href, 0, url->href.len - 1 /* : */));
+        // The type is classified ignoring case, so the scheme only needs
+        // lowercasing rather than classifying again.
+        for (size_t i = 0, n = url->href.len - 1 /* : */; i < n; i++) {
+          url->href.data[i] = url__to_ascii_lowercase(url->href.data[i]);
         }
 
         url->type = type;
@@ -617,7 +935,7 @@ url__parse (url_t *url, const utf8_string_view_t input, const url_t *base) {
         utf8_string_view_t scheme = url_get_scheme(url);
 
         if (url->type == url_type_file) {
-          err = utf8_string_append_literal(&url->href, (utf8_t *) "//", 2);
+          err = url__string_append_literal(&url->href, (utf8_t *) "//", 2);
           if (err < 0) goto err;
 
           url->components.username_end = url->href.len;
@@ -659,7 +977,7 @@ url__parse (url_t *url, const utf8_string_view_t input, const url_t *base) {
       if (base->flags & url_has_opaque_path) {
         if (c != 0x23) goto err;
 
-        err = utf8_string_append_view(&url->href, url_get_scheme(base));
+        err = url__string_append_view(&url->href, url_get_scheme(base));
         if (err < 0) goto err;
 
         url->type = base->type;
@@ -669,29 +987,29 @@ url__parse (url_t *url, const utf8_string_view_t input, const url_t *base) {
         url->components.host_end = url->href.len;
         url->components.username_end = url->href.len;
 
-        err = utf8_string_append_character(&url->href, ':');
+        err = url__string_append_character(&url->href, ':');
         if (err < 0) goto err;
 
         url->components.path_start = url->href.len;
 
-        err = utf8_string_append_view(&url->href, url_get_path(base));
+        err = url__string_append_view(&url->href, url_get_path(base));
         if (err < 0) goto err;
 
         utf8_string_view_t query = url_get_query(base);
 
         if (!utf8_string_view_empty(query)) {
-          err = utf8_string_append_character(&url->href, '?');
+          err = url__string_append_character(&url->href, '?');
           if (err < 0) goto err;
 
           url->components.query_start = url->href.len;
 
-          err = utf8_string_append_view(&url->href, query);
+          err = url__string_append_view(&url->href, query);
           if (err < 0) goto err;
         } else {
           url->components.query_start = url->href.len + 1;
         }
 
-        err = utf8_string_append_character(&url->href, '#');
+        err = url__string_append_character(&url->href, '#');
         if (err < 0) goto err;
 
         url->components.fragment_start = url->href.len;
@@ -701,14 +1019,14 @@ url__parse (url_t *url, const utf8_string_view_t input, const url_t *base) {
         state = url_state_relative;
         pointer--;
       } else {
-        err = utf8_string_append_literal(&url->href, (utf8_t *) "file", 4);
+        err = url__string_append_literal(&url->href, (utf8_t *) "file", 4);
         if (err < 0) goto err;
 
         url->type = url_type_file;
 
         url->components.scheme_end = url->href.len;
 
-        err = utf8_string_append_literal(&url->href, (utf8_t *) "://", 3);
+        err = url__string_append_literal(&url->href, (utf8_t *) "://", 3);
         if (err < 0) goto err;
 
         url->components.username_end = url->href.len;
@@ -721,7 +1039,7 @@ url__parse (url_t *url, const utf8_string_view_t input, const url_t *base) {
     // https://url.spec.whatwg.org/#special-relative-or-authority-state
     case url_state_special_relative_or_authority:
       if (c == 0x2f && pointer + 1 < input.len && input.data[pointer + 1] == 0x2f) {
-        err = utf8_string_append_literal(&url->href, (utf8_t *) "//", 2);
+        err = url__string_append_literal(&url->href, (utf8_t *) "//", 2);
         if (err < 0) goto err;
 
         url->components.username_end = url->href.len;
@@ -737,7 +1055,7 @@ url__parse (url_t *url, const utf8_string_view_t input, const url_t *base) {
     // https://url.spec.whatwg.org/#path-or-authority-state
     case url_state_path_or_authority:
       if (c == 0x2f) {
-        err = utf8_string_append_literal(&url->href, (utf8_t *) "//", 2);
+        err = url__string_append_literal(&url->href, (utf8_t *) "//", 2);
         if (err < 0) goto err;
 
         url->components.username_end = url->href.len;
@@ -759,20 +1077,20 @@ url__parse (url_t *url, const utf8_string_view_t input, const url_t *base) {
       assert(base->type != url_type_file);
 
       if (url->components.scheme_end == 0) {
-        err = utf8_string_append_view(&url->href, url_get_scheme(base));
+        err = url__string_append_view(&url->href, url_get_scheme(base));
         if (err < 0) goto err;
 
         url->type = base->type;
 
         url->components.scheme_end = url->href.len;
 
-        err = utf8_string_append_character(&url->href, ':');
+        err = url__string_append_character(&url->href, ':');
         if (err < 0) goto err;
       }
 
       if (c == 0x2f) {
         if (url->type != url_type_opaque) {
-          err = utf8_string_append_literal(&url->href, (utf8_t *) "//", 2);
+          err = url__string_append_literal(&url->href, (utf8_t *) "//", 2);
           if (err < 0) goto err;
         }
 
@@ -780,7 +1098,7 @@ url__parse (url_t *url, const utf8_string_view_t input, const url_t *base) {
 
         state = url_state_relative_slash;
       } else if (url__is_special(url) && c == 0x5c) {
-        err = utf8_string_append_literal(&url->href, (utf8_t *) "//", 2);
+        err = url__string_append_literal(&url->href, (utf8_t *) "//", 2);
         if (err < 0) goto err;
 
         url->components.username_end = url->href.len;
@@ -790,13 +1108,13 @@ url__parse (url_t *url, const utf8_string_view_t input, const url_t *base) {
         utf8_string_view_t host = url_get_host(base);
 
         if (!utf8_string_view_empty(host)) {
-          err = utf8_string_append_literal(&url->href, (utf8_t *) "//", 2);
+          err = url__string_append_literal(&url->href, (utf8_t *) "//", 2);
           if (err < 0) goto err;
 
           utf8_string_view_t username = url_get_username(base);
 
           if (!utf8_string_view_empty(username)) {
-            err = utf8_string_append_view(&url->href, username);
+            err = url__string_append_view(&url->href, username);
             if (err < 0) goto err;
 
             url->components.username_end = url->href.len;
@@ -804,14 +1122,14 @@ url__parse (url_t *url, const utf8_string_view_t input, const url_t *base) {
             utf8_string_view_t password = url_get_password(base);
 
             if (!utf8_string_view_empty(password)) {
-              err = utf8_string_append_character(&url->href, ':');
+              err = url__string_append_character(&url->href, ':');
               if (err < 0) goto err;
 
-              err = utf8_string_append_view(&url->href, password);
+              err = url__string_append_view(&url->href, password);
               if (err < 0) goto err;
             }
 
-            err = utf8_string_append_character(&url->href, '@');
+            err = url__string_append_character(&url->href, '@');
             if (err < 0) goto err;
           } else {
             url->components.username_end = url->href.len;
@@ -819,25 +1137,27 @@ url__parse (url_t *url, const utf8_string_view_t input, const url_t *base) {
 
           url->components.host_start = url->href.len;
 
-          err = utf8_string_append_view(&url->href, host);
+          err = url__string_append_view(&url->href, host);
           if (err < 0) goto err;
 
           url->components.host_end = url->href.len;
 
+          url__copy_host(url, base);
+
           utf8_string_view_t port = url_get_port(base);
 
           if (!utf8_string_view_empty(port)) {
-            err = utf8_string_append_character(&url->href, ':');
+            err = url__string_append_character(&url->href, ':');
             if (err < 0) goto err;
 
-            err = utf8_string_append_view(&url->href, port);
+            err = url__string_append_view(&url->href, port);
             if (err < 0) goto err;
 
             url->components.port = base->components.port;
           }
         } else {
           if (base->components.scheme_end + 3 /* :// */ == base->components.username_end) {
-            err = utf8_string_append_literal(&url->href, (utf8_t *) "//", 2);
+            err = url__string_append_literal(&url->href, (utf8_t *) "//", 2);
             if (err < 0) goto err;
           }
 
@@ -848,7 +1168,7 @@ url__parse (url_t *url, const utf8_string_view_t input, const url_t *base) {
 
         url->components.path_start = url->href.len;
 
-        err = utf8_string_append_view(&url->href, url_get_path(base));
+        err = url__string_append_view(&url->href, url_get_path(base));
         if (err < 0) goto err;
 
         if (c == 0x3f) {
@@ -856,7 +1176,7 @@ url__parse (url_t *url, const utf8_string_view_t input, const url_t *base) {
         } else if (c == 0x23) {
           url->components.query_start = url->href.len + 1;
 
-          err = utf8_string_append_character(&url->href, '#');
+          err = url__string_append_character(&url->href, '#');
           if (err < 0) goto err;
 
           url->components.fragment_start = url->href.len;
@@ -871,12 +1191,12 @@ url__parse (url_t *url, const utf8_string_view_t input, const url_t *base) {
           utf8_string_view_t query = url_get_query(base);
 
           if (!utf8_string_view_empty(query)) {
-            err = utf8_string_append_character(&url->href, '?');
+            err = url__string_append_character(&url->href, '?');
             if (err < 0) goto err;
 
             url->components.query_start = url->href.len;
 
-            err = utf8_string_append_view(&url->href, query);
+            err = url__string_append_view(&url->href, query);
             if (err < 0) goto err;
           } else {
             url->components.query_start = url->href.len + 1;
@@ -896,14 +1216,14 @@ url__parse (url_t *url, const utf8_string_view_t input, const url_t *base) {
 
         if (!utf8_string_view_empty(host)) {
           if (url->type == url_type_opaque) {
-            err = utf8_string_append_literal(&url->href, (utf8_t *) "//", 2);
+            err = url__string_append_literal(&url->href, (utf8_t *) "//", 2);
             if (err < 0) goto err;
           }
 
           utf8_string_view_t username = url_get_username(base);
 
           if (!utf8_string_view_empty(username)) {
-            err = utf8_string_append_view(&url->href, username);
+            err = url__string_append_view(&url->href, username);
             if (err < 0) goto err;
 
             url->components.username_end = url->href.len;
@@ -911,14 +1231,14 @@ url__parse (url_t *url, const utf8_string_view_t input, const url_t *base) {
             utf8_string_view_t password = url_get_password(base);
 
             if (!utf8_string_view_empty(password)) {
-              err = utf8_string_append_character(&url->href, ':');
+              err = url__string_append_character(&url->href, ':');
               if (err < 0) goto err;
 
-              err = utf8_string_append_view(&url->href, password);
+              err = url__string_append_view(&url->href, password);
               if (err < 0) goto err;
             }
 
-            err = utf8_string_append_character(&url->href, '@');
+            err = url__string_append_character(&url->href, '@');
             if (err < 0) goto err;
           } else {
             url->components.username_end = url->href.len;
@@ -926,23 +1246,27 @@ url__parse (url_t *url, const utf8_string_view_t input, const url_t *base) {
 
           url->components.host_start = url->href.len;
 
-          err = utf8_string_append_view(&url->href, host);
+          err = url__string_append_view(&url->href, host);
           if (err < 0) goto err;
 
           url->components.host_end = url->href.len;
 
+          url__copy_host(url, base);
+
           utf8_string_view_t port = url_get_port(base);
 
           if (!utf8_string_view_empty(port)) {
-            err = utf8_string_append_character(&url->href, ':');
+            err = url__string_append_character(&url->href, ':');
             if (err < 0) goto err;
 
-            err = utf8_string_append_view(&url->href, url_get_port(base));
+            err = url__string_append_view(&url->href, url_get_port(base));
             if (err < 0) goto err;
+
+            url->components.port = base->components.port;
           }
         } else {
           if (url->type == url_type_opaque && base->components.scheme_end + 3 /* :// */ == base->components.username_end) {
-            err = utf8_string_append_literal(&url->href, (utf8_t *) "//", 2);
+            err = url__string_append_literal(&url->href, (utf8_t *) "//", 2);
             if (err < 0) goto err;
           }
 
@@ -963,7 +1287,7 @@ url__parse (url_t *url, const utf8_string_view_t input, const url_t *base) {
       state = url_state_special_authority_ignore_slashes;
 
       if (c == 0x2f && pointer + 1 < input.len && input.data[pointer + 1] == 0x2f) {
-        err = utf8_string_append_literal(&url->href, (utf8_t *) "//", 2);
+        err = url__string_append_literal(&url->href, (utf8_t *) "//", 2);
         if (err < 0) goto err;
 
         url->components.username_end = url->href.len;
@@ -983,24 +1307,44 @@ url__parse (url_t *url, const utf8_string_view_t input, const url_t *base) {
       break;
 
     // https://url.spec.whatwg.org/#authority-state
-    case url_state_authority:
+    case url_state_authority: {
+      // Optimization: Rather than copying the authority to the buffer a byte
+      // at a time, skip to the next byte that the state acts on and read the
+      // bytes in between straight from the input.
+
+      if (component_start == (size_t) -1) component_start = pointer;
+
+      url_character_set_t stops = url__state_stops[url_state_authority];
+
+      if (url__is_special(url)) stops |= url__byte_backslash;
+
+      pointer = url__skip_to_character_set(input, pointer, stops);
+
+      c = pointer < n ? input.data[pointer] : -1;
+
       if (c == 0x40) {
+        // Rather than prepending "%40" to the buffer, which moves the whole
+        // buffer for every at sign, replace the at sign appended after the
+        // previous buffer with it, continuing the username or password that
+        // the buffer is about to be appended to.
         if (at_sign_seen) {
-          err = utf8_string_prepend_literal(&buffer, (utf8_t *) "%40", 3);
+          url->href.len--;
+
+          err = url__string_append_literal(&url->href, (utf8_t *) "%40", 3);
           if (err < 0) goto err;
         }
 
         at_sign_seen = true;
 
-        for (size_t i = 0, n = buffer.len; i < n; i++) {
-          utf8_t c = buffer.data[i];
+        for (size_t i = component_start; i < pointer; i++) {
+          utf8_t c = input.data[i];
 
           if (c == 0x3a && !password_token_seen) {
             password_token_seen = true;
 
             url->components.username_end = url->href.len;
 
-            err = utf8_string_append_character(&url->href, ':');
+            err = url__string_append_character(&url->href, ':');
             if (err < 0) goto err;
 
             continue;
@@ -1014,110 +1358,125 @@ url__parse (url_t *url, const utf8_string_view_t input, const url_t *base) {
           url->components.username_end = url->href.len;
         }
 
-        err = utf8_string_append_character(&url->href, '@');
+        err = url__string_append_character(&url->href, '@');
         if (err < 0) goto err;
 
-        utf8_string_clear(&buffer);
-      } else if (
-        (c == -1 || c == 0x2f || c == 0x3f || c == 0x23) ||
-        (url__is_special(url) && c == 0x5c)
-      ) {
-        if (at_sign_seen && utf8_string_empty(&buffer)) goto err;
+        component_start = pointer + 1;
+      } else {
+        if (at_sign_seen && pointer == component_start) goto err;
 
-        pointer -= buffer.len + 1;
+        pointer = component_start - 1;
 
-        utf8_string_clear(&buffer);
+        component_start = (size_t) -1;
 
         state = url_state_host;
-      } else {
-        err = utf8_string_append_character(&buffer, c);
-        if (err < 0) goto err;
       }
       break;
+    }
 
     // https://url.spec.whatwg.org/#host-state
     case url_state_host:
     // https://url.spec.whatwg.org/#hostname-state
-    case url_state_hostname:
-      if (c == 0x3a && !inside_brackets) {
-        if (utf8_string_empty(&buffer)) goto err;
+    case url_state_hostname: {
+      if (component_start == (size_t) -1) component_start = pointer;
+
+      url_character_set_t stops = url__state_stops[url_state_host];
+
+      if (url__is_special(url)) stops |= url__byte_backslash;
+
+      if (inside_brackets) stops &= ~url__byte_colon;
+
+      pointer = url__skip_to_character_set(input, pointer, stops);
+
+      c = pointer < n ? input.data[pointer] : -1;
+
+      utf8_string_view_t host = utf8_string_view_substring(input, component_start, pointer);
+
+      if (c == 0x5b) {
+        inside_brackets = true;
+      } else if (c == 0x5d) {
+        inside_brackets = false;
+      } else if (c == 0x3a) {
+        if (utf8_string_view_empty(host)) goto err;
 
         uint32_t host_start = url->href.len;
 
-        err = url__parse_host(utf8_string_view(&buffer), !url__is_special(url), &url->href);
+        err = url__parse_host(host, !url__is_special(url), cache, url);
         if (err < 0) goto err;
 
         url->components.host_start = host_start;
         url->components.host_end = url->href.len;
 
-        utf8_string_clear(&buffer);
+        component_start = (size_t) -1;
 
         state = url_state_port;
-      } else if (
-        (c == -1 || c == 0x2f || c == 0x3f || c == 0x23) ||
-        (url__is_special(url) && c == 0x5c)
-      ) {
+      } else {
         pointer--;
 
-        if (url__is_special(url) && utf8_string_empty(&buffer)) goto err;
+        if (url__is_special(url) && utf8_string_view_empty(host)) goto err;
 
         uint32_t host_start = url->href.len;
 
-        err = url__parse_host(utf8_string_view(&buffer), !url__is_special(url), &url->href);
+        err = url__parse_host(host, !url__is_special(url), cache, url);
         if (err < 0) goto err;
 
         url->components.host_start = host_start;
         url->components.host_end = url->href.len;
 
-        utf8_string_clear(&buffer);
+        component_start = (size_t) -1;
 
         url->components.path_start = url->href.len;
 
         state = url_state_path_start;
-      } else {
-        if (c == 0x5b) inside_brackets = true;
-        else if (c == 0x5d) inside_brackets = false;
-
-        err = utf8_string_append_character(&buffer, c);
-        if (err < 0) goto err;
       }
       break;
+    }
 
     // https://url.spec.whatwg.org/#port-state
-    case url_state_port:
-      if (url__is_ascii_digit(c)) {
-        err = utf8_string_append_character(&buffer, c);
-        if (err < 0) goto err;
-      } else if (
+    case url_state_port: {
+      if (component_start == (size_t) -1) component_start = pointer;
+
+      pointer = url__skip_character_set(input, pointer, url__ascii_digit_character_set);
+
+      c = pointer < n ? input.data[pointer] : -1;
+
+      if (
         (c == -1 || c == 0x2f || c == 0x3f || c == 0x23) ||
         (url__is_special(url) && c == 0x5c)
       ) {
-        if (!utf8_string_empty(&buffer)) {
+        if (pointer > component_start) {
           uint32_t port = 0;
 
-          for (size_t i = 0, n = buffer.len; i < n; i++) {
-            port = port * 10 + (buffer.data[i] - 0x30);
-          }
+          size_t i = component_start;
 
-          if (port > UINT16_MAX) goto err;
+          // Leading zeros are dropped when serializing the port.
+          while (i + 1 < pointer && input.data[i] == 0x30) i++;
+
+          utf8_string_view_t digits = utf8_string_view_substring(input, i, pointer);
+
+          for (; i < pointer; i++) {
+            port = port * 10 + (input.data[i] - 0x30);
+
+            if (port > UINT16_MAX) goto err;
+          }
 
           uint32_t default_port = url__default_port(url->type);
 
           if (port == default_port) {
             url->components.port = (uint32_t) -1;
           } else {
-            err = utf8_string_append_character(&url->href, ':');
+            err = url__string_append_character(&url->href, ':');
             if (err < 0) goto err;
 
-            err = utf8_string_append(&url->href, &buffer);
+            err = url__string_append_view(&url->href, digits);
             if (err < 0) goto err;
 
             url->components.port = port;
           }
-
-          utf8_string_clear(&buffer);
         }
 
+        component_start = (size_t) -1;
+
         url->components.path_start = url->href.len;
 
         state = url_state_path_start;
@@ -1126,6 +1485,7 @@ url__parse (url_t *url, const utf8_string_view_t input, const url_t *base) {
         goto err;
       }
       break;
+    }
 
     // https://url.spec.whatwg.org/#file-state
     case url_state_file:
@@ -1134,14 +1494,16 @@ url__parse (url_t *url, const utf8_string_view_t input, const url_t *base) {
       if (c == 0x2f || c == 0x5c) {
         state = url_state_file_slash;
       } else if (base != NULL && base->type == url_type_file) {
-        err = utf8_string_append_view(&url->href, url_get_host(base));
+        err = url__string_append_view(&url->href, url_get_host(base));
         if (err < 0) goto err;
 
         url->components.host_end = url->href.len;
 
+        url__copy_host(url, base);
+
         url->components.path_start = url->href.len;
 
-        err = utf8_string_append_view(&url->href, url_get_path(base));
+        err = url__string_append_view(&url->href, url_get_path(base));
         if (err < 0) goto err;
 
         if (c == 0x3f) {
@@ -1149,7 +1511,7 @@ url__parse (url_t *url, const utf8_string_view_t input, const url_t *base) {
         } else if (c == 0x23) {
           url->components.query_start = url->href.len + 1;
 
-          err = utf8_string_append_character(&url->href, '#');
+          err = url__string_append_character(&url->href, '#');
           if (err < 0) goto err;
 
           url->components.fragment_start = url->href.len;
@@ -1168,12 +1530,12 @@ url__parse (url_t *url, const utf8_string_view_t input, const url_t *base) {
           utf8_string_view_t query = url_get_query(base);
 
           if (!utf8_string_view_empty(query)) {
-            err = utf8_string_append_character(&url->href, '?');
+            err = url__string_append_character(&url->href, '?');
             if (err < 0) goto err;
 
             url->components.query_start = url->href.len;
 
-            err = utf8_string_append_view(&url->href, query);
+            err = url__string_append_view(&url->href, query);
             if (err < 0) goto err;
           } else {
             url->components.query_start = url->href.len + 1;
@@ -1194,11 +1556,13 @@ url__parse (url_t *url, const utf8_string_view_t input, const url_t *base) {
         state = url_state_file_host;
       } else {
         if (base != NULL && base->type == url_type_file) {
-          err = utf8_string_append_view(&url->href, url_get_host(base));
+          err = url__string_append_view(&url->href, url_get_host(base));
           if (err < 0) goto err;
 
           url->components.host_end = url->href.len;
 
+          url__copy_host(url, base);
+
           url->components.path_start = url->href.len;
 
           if (!url__starts_with_windows_drive_letter(utf8_string_view_substring(input, pointer, input.len))) {
@@ -1207,7 +1571,7 @@ url__parse (url_t *url, const utf8_string_view_t input, const url_t *base) {
             size_t i = utf8_string_view_index_of_character(path, 1, '/');
 
             if (i != (size_t) -1 && url__is_normalized_windows_drive_letter(utf8_string_view_substring(path, 1, i))) {
-              err = utf8_string_append_view(&url->href, utf8_string_view_substring(path, 0, i));
+              err = url__string_append_view(&url->href, utf8_string_view_substring(path, 0, i));
               if (err < 0) goto err;
             }
           }
@@ -1239,7 +1603,7 @@ url__parse (url_t *url, const utf8_string_view_t input, const url_t *base) {
           if (utf8_string_empty(&buffer)) {
             url->components.host_end = url->href.len;
           } else {
-            err = url__parse_host(utf8_string_view(&buffer), !url__is_special(url), &url->href);
+            err = url__parse_host(utf8_string_view(&buffer), !url__is_special(url), cache, url);
             if (err < 0) goto err;
 
             url->components.host_end = url->href.len;
@@ -1252,7 +1616,7 @@ url__parse (url_t *url, const utf8_string_view_t input, const url_t *base) {
           state = url_state_path_start;
         }
       } else {
-        err = utf8_string_append_character(&buffer, c);
+        err = url__string_append_character(&buffer, c);
         if (err < 0) goto err;
       }
       break;
@@ -1268,7 +1632,7 @@ url__parse (url_t *url, const utf8_string_view_t input, const url_t *base) {
       } else if (c == 0x23) {
         url->components.query_start = url->href.len + 1;
 
-        err = utf8_string_append_character(&url->href, '#');
+        err = url__string_append_character(&url->href, '#');
         if (err < 0) goto err;
 
         url->components.fragment_start = url->href.len;
@@ -1283,110 +1647,170 @@ url__parse (url_t *url, const utf8_string_view_t input, const url_t *base) {
 
     // https://url.spec.whatwg.org/#path-state
     case url_state_path:
+      // Optimization: Rather than building each segment in the buffer, write
+      // it straight to `href` and undo single and double dot segments once
+      // the end of the segment is reached.
+
+      if (segment_start == (size_t) -1) {
+        err = url__string_append_character(&url->href, '/');
+        if (err < 0) goto err;
+
+        segment_start = url->href.len;
+
+        // The file host state leaves a Windows drive letter in the buffer to
+        // start the first segment with.
+        if (!utf8_string_empty(&buffer)) {
+          err = url__string_append(&url->href, &buffer);
+          if (err < 0) goto err;
+
+          utf8_string_clear(&buffer);
+        }
+      }
+
       if (
         (c == -1 || c == 0x2f) ||
         (url__is_special(url) && c == 0x5c) ||
         (c == 0x3f || c == 0x23)
       ) {
-        utf8_string_view_t segment = utf8_string_view(&buffer);
+        utf8_string_view_t segment = utf8_string_substring(&url->href, segment_start, url->href.len);
+
+        // Only segments starting with a dot or a percent sign can be single or
+        // double dot segments, which spares checking any other.
+        bool dot = segment.len > 0 && (segment.data[0] == '.' || segment.data[0] == '%');
+
+        if (dot && url__is_double_dot_path_segment(segment)) {
+          url->href.len = segment_start - 1 /* / */;
 
-        if (url__is_double_dot_path_segment(segment)) {
           url__shorten_path(url);
 
           if (c != 0x2f && !(url__is_special(url) && c == 0x5c)) {
-            err = utf8_string_append_character(&url->href, '/');
+            err = url__string_append_character(&url->href, '/');
             if (err < 0) goto err;
           }
-        } else if (url__is_single_dot_path_segment(segment)) {
+        } else if (dot && url__is_single_dot_path_segment(segment)) {
+          url->href.len = segment_start - 1 /* / */;
+
           if (c != 0x2f && !(url__is_special(url) && c == 0x5c)) {
-            err = utf8_string_append_character(&url->href, '/');
+            err = url__string_append_character(&url->href, '/');
             if (err < 0) goto err;
           }
-        } else {
-          if (
-            url->type == url_type_file &&
-            utf8_string_view_empty(url_get_path(url)) &&
-            url__is_windows_drive_letter(segment)
-          ) {
-            buffer.data[1] = ':';
-          }
-
-          err = utf8_string_append_character(&url->href, '/');
-          if (err < 0) goto err;
-
-          err = utf8_string_append(&url->href, &buffer);
-          if (err < 0) goto err;
+        } else if (
+          url->type == url_type_file &&
+          segment_start - 1 /* / */ == url->components.path_start &&
+          url__is_windows_drive_letter(segment)
+        ) {
+          url->href.data[segment_start + 1] = ':';
         }
 
-        utf8_string_clear(&buffer);
+        segment_start = (size_t) -1;
 
         if (c == 0x3f) {
           state = url_state_query;
         } else if (c == 0x23) {
           url->components.query_start = url->href.len + 1;
 
-          err = utf8_string_append_character(&url->href, '#');
+          err = url__string_append_character(&url->href, '#');
           if (err < 0) goto err;
 
           url->components.fragment_start = url->href.len;
 
           state = url_state_fragment;
         }
+      } else if (url__is_in_character_set(url__path_percent_encode_set, c)) {
+        err = url__percent_encode_character(c, url__path_percent_encode_set, &url->href);
+        if (err < 0) goto err;
       } else {
-        err = url__percent_encode_character(c, url__path_percent_encode_set, &buffer);
+        // Copy the run of characters that need no encoding in bulk, up to the
+        // next one that does or that ends the segment.
+        size_t end = pointer + 1;
+
+        while (
+          end < n &&
+          input.data[end] != 0x2f &&
+          !(url__is_special(url) && input.data[end] == 0x5c) &&
+          !url__is_in_character_set(url__path_percent_encode_set, input.data[end])
+        ) {
+          end++;
+        }
+
+        err = url__string_append_view(&url->href, utf8_string_view_substring(input, pointer, end));
         if (err < 0) goto err;
+
+        pointer = end - 1;
       }
       break;
 
     // https://url.spec.whatwg.org/#cannot-be-a-base-url-path-state
-    case url_state_opaque_path:
+    case url_state_opaque_path: {
+      // Optimization: The opaque path is everything from the current position
+      // until the next question mark or number sign or the end of the string,
+      // so find its end and percent-encode it in bulk, which copies it as is
+      // when nothing needs encoding.
+
+      const utf8_t *end = memchr(&input.data[pointer], 0x23, n - pointer);
+
+      size_t path_end = end ? (size_t) (end - input.data) : n;
+
+      end = memchr(&input.data[pointer], 0x3f, path_end - pointer);
+
+      if (end) path_end = (size_t) (end - input.data);
+
+      err = url__percent_encode_string(utf8_string_view_substring(input, pointer, path_end), url__c0_control_percent_encode_set, &url->href);
+      if (err < 0) goto err;
+
+      pointer = path_end;
+
+      c = pointer < n ? input.data[pointer] : -1;
+
       if (c == 0x3f) {
         state = url_state_query;
       } else if (c == 0x23) {
         url->components.query_start = url->href.len + 1;
 
-        err = utf8_string_append_character(&url->href, '#');
+        err = url__string_append_character(&url->href, '#');
         if (err < 0) goto err;
 
         url->components.fragment_start = url->href.len;
 
         state = url_state_fragment;
-      } else if (c != -1) {
-        err = url__percent_encode_character(c, url__c0_control_percent_encode_set, &url->href);
-        if (err < 0) goto err;
       }
       break;
+    }
 
     // https://url.spec.whatwg.org/#query-state
-    case url_state_query:
-      if (c == 0x23 || c == -1) {
-        err = utf8_string_append_character(&url->href, '?');
-        if (err < 0) goto err;
+    case url_state_query: {
+      // Optimization: The query is everything from the current position until
+      // the next number sign or the end of the string, so find its end and
+      // percent-encode it straight into `href`.
 
-        url_character_set_t *query_percent_encode_set = url__is_special(url)
-                                                          ? &url__special_query_percent_encode_set
-                                                          : &url__query_percent_encode_set;
+      const utf8_t *end = memchr(&input.data[pointer], 0x23, n - pointer);
 
-        url->components.query_start = url->href.len;
+      size_t query_end = end ? (size_t) (end - input.data) : n;
 
-        err = url__percent_encode_string(utf8_string_view(&buffer), *query_percent_encode_set, &url->href);
-        if (err < 0) goto err;
+      err = url__string_append_character(&url->href, '?');
+      if (err < 0) goto err;
 
-        utf8_string_clear(&buffer);
+      url_character_set_t query_percent_encode_set = url__is_special(url)
+                                                       ? url__special_query_percent_encode_set
+                                                       : url__query_percent_encode_set;
 
-        url->components.fragment_start = url->href.len + 1;
+      url->components.query_start = url->href.len;
 
-        if (c == 0x23) {
-          err = utf8_string_append_character(&url->href, '#');
-          if (err < 0) goto err;
+      err = url__percent_encode_string(utf8_string_view_substring(input, pointer, query_end), query_percent_encode_set, &url->href);
+      if (err < 0) goto err;
 
-          state = url_state_fragment;
-        }
-      } else if (c != -1) {
-        err = utf8_string_append_character(&buffer, c);
-        if (err < 0) goto err;
-      }
+      url->components.fragment_start = url->href.len + 1;
+
+      if (end == NULL) goto done;
+
+      err = url__string_append_character(&url->href, '#');
+      if (err < 0) goto err;
+
+      state = url_state_fragment;
+
+      pointer = query_end;
       break;
+    }
 
     // https://url.spec.whatwg.org/#fragment-state
     case url_state_fragment:
@@ -1403,6 +1827,10 @@ url__parse (url_t *url, const utf8_string_view_t input, const url_t *base) {
 done:
   utf8_string_destroy(&buffer);
 
+#if defined(URL_TRACE)
+  url__trace_parse(url, &trace);
+#endif
+
   return 0;
 
 err:
@@ -8,6 +8,7 @@
 
 #include "character-set.h"
 #include "infra.h"
+#include "trace.h"
 
 // https://url.spec.whatwg.org/#percent-encode
 static const utf8_t url__hex_encoded[768] =
@@ -75,9 +76,9 @@ url__percent_encode_character (utf8_t character, url_character_set_t percent_enc
   int err;
 
   if (url__is_in_character_set(percent_encode_set, character)) {
-    err = utf8_string_append_literal(result, &url__hex_encoded[(character << 1) + character], 3);
+    err = url__string_append_literal(result, &url__hex_encoded[(character << 1) + character], 3);
   } else {
-    err = utf8_string_append_character(result, character);
+    err = url__string_append_character(result, character);
   }
 
   return err;
@@ -95,12 +96,12 @@ url__percent_encode_string (const utf8_string_view_t view, url_character_set_t p
     }
   }
 
-  if (i == view.len) return utf8_string_append_view(result, view);
+  if (i == view.len) return url__string_append_view(result, view);
 
-  err = utf8_string_reserve(result, result->len + view.len);
+  err = url__string_reserve(result, result->len + view.len);
   if (err < 0) return err;
 
-  err = utf8_string_append_view(result, utf8_string_view_substring(view, 0, i));
+  err = url__string_append_view(result, utf8_string_view_substring(view, 0, i));
   if (err < 0) return err;
 
   for (size_t n = view.len; i < n; i++) {
@@ -113,7 +114,7 @@ url__percent_encode_string (const utf8_string_view_t view, url_character_set_t p
 
 static inline int
 url__percent_decode_character (const utf8_t *character, utf8_string_t *result) {
-  return utf8_string_append_character(result, url__hex_decoded[character[0]] * 0x10 + url__hex_decoded[character[1]]);
+  return url__string_append_character(result, url__hex_decoded[character[0]] * 0x10 + url__hex_decoded[character[1]]);
 }
 
 static inline int
@@ -128,10 +129,10 @@ url__percent_decode_string (const utf8_string_view_t view, utf8_string_t *result
     }
   }
 
-  err = utf8_string_reserve(result, result->len + view.len);
+  err = url__string_reserve(result, result->len + view.len);
   if (err < 0) return err;
 
-  err = utf8_string_append_view(result, utf8_string_view_substring(view, 0, i));
+  err = url__string_append_view(result, utf8_string_view_substring(view, 0, i));
   if (err < 0) return err;
 
   for (size_t n = view.len; i < n; i++) {
@@ -140,15 +141,15 @@ url__percent_decode_string (const utf8_string_view_t view, utf8_string_t *result
     if (
       c == 0x25 &&
       i + 2 < n &&
-      url__is_ascii_alphanumeric(view.data[i + 1]) &&
-      url__is_ascii_alphanumeric(view.data[i + 2])
+      url__is_ascii_hex_digit(view.data[i + 1]) &&
+      url__is_ascii_hex_digit(view.data[i + 2])
     ) {
       err = url__percent_decode_character(&view.data[i + 1], result);
       if (err < 0) return err;
 
       i += 2;
     } else {
-      err = utf8_string_append_character(result, c);
+      err = url__string_append_character(result, c);
       if (err < 0) return err;
     }
   }
@@ -156,412 +157,4 @@ url__percent_decode_string (const utf8_string_view_t view, utf8_string_t *result
   return 0;
 }
 
-// https://url.spec.whatwg.org/#c0-control-percent-encode-set
-static url_character_set_t url__c0_control_percent_encode_set = {
-  // 00    01     02     03     04     05     06     07
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // 08    09     0a     0b     0c     0d     0e     0f
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // 10    11     12     13     14     15     16     17
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // 18    19     1a     1b     1c     1d     1e     1f
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // 20    21     22     23     24     25     26     27
-  0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00,
-  // 28    29     2a     2b     2c     2d     2e     2f
-  0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00,
-  // 30    31     32     33     34     35     36     37
-  0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00,
-  // 38    39     3a     3b     3c     3d     3e     3f
-  0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00,
-  // 40    41     42     43     44     45     46     47
-  0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00,
-  // 48    49     4a     4b     4c     4d     4e     4f
-  0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00,
-  // 50    51     52     53     54     55     56     57
-  0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00,
-  // 58    59     5a     5b     5c     5d     5e     5f
-  0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00,
-  // 60    61     62     63     64     65     66     67
-  0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00,
-  // 68    69     6a     6b     6c     6d     6e     6f
-  0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00,
-  // 70    71     72     73     74     75     76     77
-  0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00,
-  // 78    79     7a     7b     7c     7d     7e     7f
-  0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x80,
-  // 80    81     82     83     84     85     86     87
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // 88    89     8a     8b     8c     8d     8e     8f
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // 90    91     92     93     94     95     96     97
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // 98    99     9a     9b     9c     9d     9e     9f
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // a0    a1     a2     a3     a4     a5     a6     a7
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // a8    a9     aa     ab     ac     ad     ae     af
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // b0    b1     b2     b3     b4     b5     b6     b7
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // b8    b9     ba     bb     bc     bd     be     bf
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // c0    c1     c2     c3     c4     c5     c6     c7
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // c8    c9     ca     cb     cc     cd     ce     cf
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // d0    d1     d2     d3     d4     d5     d6     d7
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // d8    d9     da     db     dc     dd     de     df
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // e0    e1     e2     e3     e4     e5     e6     e7
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // e8    e9     ea     eb     ec     ed     ee     ef
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // f0    f1     f2     f3     f4     f5     f6     f7
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // f8    f9     fa     fb     fc     fd     fe     ff
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-};
-
-// https://url.spec.whatwg.org/#query-percent-encode-set
-static url_character_set_t url__query_percent_encode_set = {
-  // 00    01     02     03     04     05     06     07
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // 08    09     0a     0b     0c     0d     0e     0f
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // 10    11     12     13     14     15     16     17
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // 18    19     1a     1b     1c     1d     1e     1f
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // 20    21     22     23     24     25     26     27
-  0x01 | 0x00 | 0x04 | 0x08 | 0x00 | 0x00 | 0x00 | 0x00,
-  // 28    29     2a     2b     2c     2d     2e     2f
-  0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00,
-  // 30    31     32     33     34     35     36     37
-  0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00,
-  // 38    39     3a     3b     3c     3d     3e     3f
-  0x00 | 0x00 | 0x00 | 0x00 | 0x10 | 0x00 | 0x40 | 0x00,
-  // 40    41     42     43     44     45     46     47
-  0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00,
-  // 48    49     4a     4b     4c     4d     4e     4f
-  0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00,
-  // 50    51     52     53     54     55     56     57
-  0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00,
-  // 58    59     5a     5b     5c     5d     5e     5f
-  0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00,
-  // 60    61     62     63     64     65     66     67
-  0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00,
-  // 68    69     6a     6b     6c     6d     6e     6f
-  0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00,
-  // 70    71     72     73     74     75     76     77
-  0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00,
-  // 78    79     7a     7b     7c     7d     7e     7f
-  0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x80,
-  // 80    81     82     83     84     85     86     87
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // 88    89     8a     8b     8c     8d     8e     8f
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // 90    91     92     93     94     95     96     97
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // 98    99     9a     9b     9c     9d     9e     9f
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // a0    a1     a2     a3     a4     a5     a6     a7
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // a8    a9     aa     ab     ac     ad     ae     af
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // b0    b1     b2     b3     b4     b5     b6     b7
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // b8    b9     ba     bb     bc     bd     be     bf
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // c0    c1     c2     c3     c4     c5     c6     c7
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // c8    c9     ca     cb     cc     cd     ce     cf
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // d0    d1     d2     d3     d4     d5     d6     d7
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // d8    d9     da     db     dc     dd     de     df
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // e0    e1     e2     e3     e4     e5     e6     e7
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // e8    e9     ea     eb     ec     ed     ee     ef
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // f0    f1     f2     f3     f4     f5     f6     f7
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // f8    f9     fa     fb     fc     fd     fe     ff
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-};
-
-// https://url.spec.whatwg.org/#special-query-percent-encode-set
-static url_character_set_t url__special_query_percent_encode_set = {
-  // 00    01     02     03     04     05     06     07
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // 08    09     0a     0b     0c     0d     0e     0f
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // 10    11     12     13     14     15     16     17
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // 18    19     1a     1b     1c     1d     1e     1f
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // 20    21     22     23     24     25     26     27
-  0x01 | 0x00 | 0x04 | 0x08 | 0x00 | 0x00 | 0x00 | 0x80,
-  // 28    29     2a     2b     2c     2d     2e     2f
-  0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00,
-  // 30    31     32     33     34     35     36     37
-  0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00,
-  // 38    39     3a     3b     3c     3d     3e     3f
-  0x00 | 0x00 | 0x00 | 0x00 | 0x10 | 0x00 | 0x40 | 0x00,
-  // 40    41     42     43     44     45     46     47
-  0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00,
-  // 48    49     4a     4b     4c     4d     4e     4f
-  0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00,
-  // 50    51     52     53     54     55     56     57
-  0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00,
-  // 58    59     5a     5b     5c     5d     5e     5f
-  0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00,
-  // 60    61     62     63     64     65     66     67
-  0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00,
-  // 68    69     6a     6b     6c     6d     6e     6f
-  0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00,
-  // 70    71     72     73     74     75     76     77
-  0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00,
-  // 78    79     7a     7b     7c     7d     7e     7f
-  0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x80,
-  // 80    81     82     83     84     85     86     87
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // 88    89     8a     8b     8c     8d     8e     8f
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // 90    91     92     93     94     95     96     97
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // 98    99     9a     9b     9c     9d     9e     9f
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // a0    a1     a2     a3     a4     a5     a6     a7
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // a8    a9     aa     ab     ac     ad     ae     af
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // b0    b1     b2     b3     b4     b5     b6     b7
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // b8    b9     ba     bb     bc     bd     be     bf
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // c0    c1     c2     c3     c4     c5     c6     c7
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // c8    c9     ca     cb     cc     cd     ce     cf
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // d0    d1     d2     d3     d4     d5     d6     d7
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // d8    d9     da     db     dc     dd     de     df
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // e0    e1     e2     e3     e4     e5     e6     e7
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // e8    e9     ea     eb     ec     ed     ee     ef
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // f0    f1     f2     f3     f4     f5     f6     f7
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // f8    f9     fa     fb     fc     fd     fe     ff
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-};
-
-// https://url.spec.whatwg.org/#fragment-percent-encode-set
-static url_character_set_t url__fragment_percent_encode_set = {
-  // 00    01     02     03     04     05     06     07
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // 08    09     0a     0b     0c     0d     0e     0f
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // 10    11     12     13     14     15     16     17
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // 18    19     1a     1b     1c     1d     1e     1f
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // 20    21     22     23     24     25     26     27
-  0x01 | 0x00 | 0x04 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00,
-  // 28    29     2a     2b     2c     2d     2e     2f
-  0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00,
-  // 30    31     32     33     34     35     36     37
-  0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00,
-  // 38    39     3a     3b     3c     3d     3e     3f
-  0x00 | 0x00 | 0x00 | 0x00 | 0x10 | 0x00 | 0x40 | 0x00,
-  // 40    41     42     43     44     45     46     47
-  0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00,
-  // 48    49     4a     4b     4c     4d     4e     4f
-  0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00,
-  // 50    51     52     53     54     55     56     57
-  0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00,
-  // 58    59     5a     5b     5c     5d     5e     5f
-  0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00,
-  // 60    61     62     63     64     65     66     67
-  0x01 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00,
-  // 68    69     6a     6b     6c     6d     6e     6f
-  0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00,
-  // 70    71     72     73     74     75     76     77
-  0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00,
-  // 78    79     7a     7b     7c     7d     7e     7f
-  0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x80,
-  // 80    81     82     83     84     85     86     87
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // 88    89     8a     8b     8c     8d     8e     8f
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // 90    91     92     93     94     95     96     97
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // 98    99     9a     9b     9c     9d     9e     9f
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // a0    a1     a2     a3     a4     a5     a6     a7
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // a8    a9     aa     ab     ac     ad     ae     af
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // b0    b1     b2     b3     b4     b5     b6     b7
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // b8    b9     ba     bb     bc     bd     be     bf
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // c0    c1     c2     c3     c4     c5     c6     c7
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // c8    c9     ca     cb     cc     cd     ce     cf
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // d0    d1     d2     d3     d4     d5     d6     d7
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // d8    d9     da     db     dc     dd     de     df
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // e0    e1     e2     e3     e4     e5     e6     e7
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // e8    e9     ea     eb     ec     ed     ee     ef
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // f0    f1     f2     f3     f4     f5     f6     f7
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // f8    f9     fa     fb     fc     fd     fe     ff
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-};
-
-// https://url.spec.whatwg.org/#userinfo-percent-encode-set
-static url_character_set_t url__userinfo_percent_encode_set = {
-  // 00    01     02     03     04     05     06     07
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // 08    09     0a     0b     0c     0d     0e     0f
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // 10    11     12     13     14     15     16     17
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // 18    19     1a     1b     1c     1d     1e     1f
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // 20    21     22     23     24     25     26     27
-  0x01 | 0x00 | 0x04 | 0x08 | 0x00 | 0x00 | 0x00 | 0x00,
-  // 28    29     2a     2b     2c     2d     2e     2f
-  0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x80,
-  // 30    31     32     33     34     35     36     37
-  0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00,
-  // 38    39     3a     3b     3c     3d     3e     3f
-  0x00 | 0x00 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // 40    41     42     43     44     45     46     47
-  0x01 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00,
-  // 48    49     4a     4b     4c     4d     4e     4f
-  0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00,
-  // 50    51     52     53     54     55     56     57
-  0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00,
-  // 58    59     5a     5b     5c     5d     5e     5f
-  0x00 | 0x00 | 0x00 | 0x08 | 0x10 | 0x20 | 0x40 | 0x00,
-  // 60    61     62     63     64     65     66     67
-  0x01 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00,
-  // 68    69     6a     6b     6c     6d     6e     6f
-  0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00,
-  // 70    71     72     73     74     75     76     77
-  0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00,
-  // 78    79     7a     7b     7c     7d     7e     7f
-  0x00 | 0x00 | 0x00 | 0x08 | 0x10 | 0x20 | 0x00 | 0x80,
-  // 80    81     82     83     84     85     86     87
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // 88    89     8a     8b     8c     8d     8e     8f
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // 90    91     92     93     94     95     96     97
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // 98    99     9a     9b     9c     9d     9e     9f
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // a0    a1     a2     a3     a4     a5     a6     a7
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // a8    a9     aa     ab     ac     ad     ae     af
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // b0    b1     b2     b3     b4     b5     b6     b7
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // b8    b9     ba     bb     bc     bd     be     bf
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // c0    c1     c2     c3     c4     c5     c6     c7
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // c8    c9     ca     cb     cc     cd     ce     cf
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // d0    d1     d2     d3     d4     d5     d6     d7
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // d8    d9     da     db     dc     dd     de     df
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // e0    e1     e2     e3     e4     e5     e6     e7
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // e8    e9     ea     eb     ec     ed     ee     ef
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // f0    f1     f2     f3     f4     f5     f6     f7
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // f8    f9     fa     fb     fc     fd     fe     ff
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-};
-
-// https://url.spec.whatwg.org/#path-percent-encode-set
-static url_character_set_t url__path_percent_encode_set = {
-  // 00    01     02     03     04     05     06     07
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // 08    09     0a     0b     0c     0d     0e     0f
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // 10    11     12     13     14     15     16     17
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // 18    19     1a     1b     1c     1d     1e     1f
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // 20    21     22     23     24     25     26     27
-  0x01 | 0x00 | 0x04 | 0x08 | 0x00 | 0x00 | 0x00 | 0x00,
-  // 28    29     2a     2b     2c     2d     2e     2f
-  0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00,
-  // 30    31     32     33     34     35     36     37
-  0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00,
-  // 38    39     3a     3b     3c     3d     3e     3f
-  0x00 | 0x00 | 0x00 | 0x00 | 0x10 | 0x00 | 0x40 | 0x80,
-  // 40    41     42     43     44     45     46     47
-  0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00,
-  // 48    49     4a     4b     4c     4d     4e     4f
-  0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00,
-  // 50    51     52     53     54     55     56     57
-  0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00,
-  // 58    59     5a     5b     5c     5d     5e     5f
-  0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00,
-  // 60    61     62     63     64     65     66     67
-  0x01 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00,
-  // 68    69     6a     6b     6c     6d     6e     6f
-  0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00,
-  // 70    71     72     73     74     75     76     77
-  0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00 | 0x00,
-  // 78    79     7a     7b     7c     7d     7e     7f
-  0x00 | 0x00 | 0x00 | 0x08 | 0x00 | 0x20 | 0x00 | 0x80,
-  // 80    81     82     83     84     85     86     87
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // 88    89     8a     8b     8c     8d     8e     8f
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // 90    91     92     93     94     95     96     97
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // 98    99     9a     9b     9c     9d     9e     9f
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // a0    a1     a2     a3     a4     a5     a6     a7
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // a8    a9     aa     ab     ac     ad     ae     af
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // b0    b1     b2     b3     b4     b5     b6     b7
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // b8    b9     ba     bb     bc     bd     be     bf
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // c0    c1     c2     c3     c4     c5     c6     c7
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // c8    c9     ca     cb     cc     cd     ce     cf
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // d0    d1     d2     d3     d4     d5     d6     d7
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // d8    d9     da     db     dc     dd     de     df
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // e0    e1     e2     e3     e4     e5     e6     e7
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // e8    e9     ea     eb     ec     ed     ee     ef
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // f0    f1     f2     f3     f4     f5     f6     f7
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-  // f8    f9     fa     fb     fc     fd     fe     ff
-  0x01 | 0x02 | 0x04 | 0x08 | 0x10 | 0x20 | 0x40 | 0x80,
-};
-
 #endif // URL_PERCENT_ENCODE
@@ -0,0 +1,98 @@
+#ifndef URL_PSL_H
+#define URL_PSL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+#include <utf.h>
+#include <utf/string.h>
+
+/**
+ * A compiled Public Suffix List, laid out for memory mapping as a trie of
+ * reversed domain labels:
+ *
+ *   header   magic "URLP", u32 version, u64 node count, u64 nodes offset,
+ *            u64 labels offset
+ *   nodes    count x 12 byte fixed-width nodes of u32 label offset, u32
+ *            first child, u16 child count, u8 label length and u8 flags,
+ *            with the root first and the children of each node stored
+ *            consecutively and sorted by label
+ *   labels   the ASCII labels, back to back
+ *
+ * All integers are little-endian. A node is flagged if a rule ends at it, if
+ * a wildcard rule covers its children, or if an exception rule ends at it.
+ *
+ * https://publicsuffix.org/list/
+ */
+typedef struct url_psl_s url_psl_t;
+typedef struct url_psl_builder_s url_psl_builder_t;
+
+int
+url_psl_builder_init (url_psl_builder_t **result);
+
+void
+url_psl_builder_destroy (url_psl_builder_t *builder);
+
+/**
+ * Add a single rule, such as "com", "*.ck" or "!www.ck". Internationalized
+ * rules are converted to ASCII. Returns -1 if the rule is invalid.
+ */
+int
+url_psl_builder_add_rule (url_psl_builder_t *builder, const utf8_t *rule, size_t len);
+
+/**
+ * Add the rules of a list in the format of public_suffix_list.dat, skipping
+ * comments and blank lines.
+ */
+int
+url_psl_builder_add_list (url_psl_builder_t *builder, const utf8_t *input, size_t len);
+
+/**
+ * Read the list file at `path` and add its rules.
+ */
+int
+url_psl_builder_add_file (url_psl_builder_t *builder, const char *path);
+
+int
+url_psl_builder_serialize (url_psl_builder_t *builder, utf8_string_t *result);
+
+int
+url_psl_builder_write (url_psl_builder_t *builder, const char *path);
+
+/**
+ * Open a compiled list over `len` bytes at `data`, which must outlive the
+ * list.
+ */
+int
+url_psl_init (const utf8_t *data, size_t len, url_psl_t **result);
+
+/**
+ * Memory map the compiled list file at `path`.
+ */
+int
+url_psl_open (const char *path, url_psl_t **result);
+
+void
+url_psl_close (url_psl_t *psl);
+
+/**
+ * Find the public suffix and registrable domain of `host`, as serialized by
+ * the host parser, such as a view returned by `url_get_host()`. Both results
+ * are views into `host`. If the host is itself a public suffix, the
+ * registrable domain is empty. Returns -1 if the host is not a domain.
+ *
+ * The lookup walks the labels of the host from right to left and doesn't
+ * allocate.
+ */
+// https://url.spec.whatwg.org/#host-public-suffix
+int
+url_psl_lookup (const url_psl_t *psl, const utf8_string_view_t host, utf8_string_view_t *suffix, utf8_string_view_t *registrable_domain);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // URL_PSL_H
@@ -1,21 +1,526 @@
 #ifndef URL_PUNYCODE_H
 #define URL_PUNYCODE_H
 
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
 #include <utf.h>
 #include <utf/string.h>
 
+#include "encoding.h"
+#include "infra.h"
+#include "trace.h"
+
+// https://datatracker.ietf.org/doc/html/rfc3492#section-5
+#define url__punycode_base         36
+#define url__punycode_tmin         1
+#define url__punycode_tmax         26
+#define url__punycode_skew         38
+#define url__punycode_damp         700
+#define url__punycode_initial_bias 72
+#define url__punycode_initial_n    0x80
+
+// Every digit of a delta but the last divides it by at least base - tmax, so
+// a 32-bit delta never takes more than 11 digits.
+#define url__punycode_max_digits 11
+
+// Labels up to this many code points are converted without a heap allocation.
+#define url__punycode_stack_len 64
+
+// Labels longer than this are converted in O(n log n) rather than with the
+// quadratic loops of RFC 3492, which are faster for short labels.
+#define url__punycode_tree_len 256
+
+// https://datatracker.ietf.org/doc/html/rfc3492#section-6.1
+static inline uint32_t
+url__punycode_adapt (uint32_t delta, uint32_t points, bool first_time) {
+  delta = first_time ? delta / url__punycode_damp : delta / 2;
+  delta += delta / points;
+
+  uint32_t k = 0;
+
+  while (delta > ((url__punycode_base - url__punycode_tmin) * url__punycode_tmax) / 2) {
+    delta /= url__punycode_base - url__punycode_tmin;
+    k += url__punycode_base;
+  }
+
+  return k + (url__punycode_base - url__punycode_tmin + 1) * delta / (delta + url__punycode_skew);
+}
+
+static inline uint32_t
+url__punycode_threshold (uint32_t k, uint32_t bias) {
+  if (k <= bias) return url__punycode_tmin;
+  if (k >= bias + url__punycode_tmax) return url__punycode_tmax;
+  return k - bias;
+}
+
+static inline uint32_t
+url__punycode_decode_digit (utf8_t c) {
+  if (c >= 0x30 && c <= 0x39) return c - 0x30 + 26;
+  if (c >= 0x41 && c <= 0x5a) return c - 0x41;
+  if (c >= 0x61 && c <= 0x7a) return c - 0x61;
+  return url__punycode_base;
+}
+
+static inline utf8_t
+url__punycode_encode_digit (uint32_t d) {
+  return (utf8_t) (d < 26 ? d + 0x61 : d - 26 + 0x30);
+}
+
+static inline bool
+url__punycode_is_basic (const uint32_t *input, size_t len) {
+  uint32_t accumulator = 0;
+
+  for (size_t i = 0; i < len; i++) {
+    accumulator |= input[i];
+  }
+
+  return accumulator < 0x80;
+}
+
+/**
+ * A Fenwick tree of counts over `len` positions, stored in `len + 1` entries
+ * with the first unused, for the O(n log n) conversion of long labels.
+ */
+static inline void
+url__punycode_tree_add (uint32_t *tree, size_t len, size_t i, uint32_t delta) {
+  for (i++; i <= len; i += i & -i) tree[i] += delta;
+}
+
+/**
+ * The sum of the counts at the positions before `i`.
+ */
+static inline uint32_t
+url__punycode_tree_prefix (const uint32_t *tree, size_t i) {
+  uint32_t sum = 0;
+
+  for (; i > 0; i -= i & -i) sum += tree[i];
+
+  return sum;
+}
+
+/**
+ * The position of the `k`th count, starting from 0, where all counts are 0 or
+ * 1.
+ */
+static inline size_t
+url__punycode_tree_select (const uint32_t *tree, size_t len, uint32_t k) {
+  size_t i = 0, step = 1;
+
+  while (step * 2 <= len) step *= 2;
+
+  for (; step > 0; step /= 2) {
+    if (i + step <= len && tree[i + step] <= k) {
+      i += step;
+      k -= tree[i];
+    }
+  }
+
+  return i;
+}
+
+/**
+ * Move the code points at `result`, which were decoded in the order they were
+ * inserted, to their final positions. The code point inserted `t`th went in
+ * at `positions[t]`, so walking the insertions backwards, it takes the free
+ * position with that index.
+ */
 static inline int
-url__punycode_to_utf8 (utf8_string_view_t input, utf8_string_t *result) {
-  // TODO
+url__punycode_place (uint32_t *result, const uint32_t *positions, size_t len) {
+  uint32_t *inserted = malloc(len * sizeof(uint32_t));
+  if (inserted == NULL) return -1;
+
+  uint32_t *tree = malloc((len + 1) * sizeof(uint32_t));
+
+  if (tree == NULL) {
+    free(inserted);
+
+    return -1;
+  }
+
+  memcpy(inserted, result, len * sizeof(uint32_t));
+
+  // Every position starts out free.
+  for (size_t i = 1; i <= len; i++) tree[i] = (uint32_t) (i & -i);
+
+  for (size_t t = len; t-- > 0;) {
+    size_t i = url__punycode_tree_select(tree, len, positions[t]);
+
+    result[i] = inserted[t];
+
+    url__punycode_tree_add(tree, len, i, (uint32_t) -1);
+  }
+
+  free(inserted);
+  free(tree);
+
+  return 0;
+}
+
+/**
+ * Decode the ASCII label at `input` into code points. The decoded label is
+ * never longer than the input, so `result` must have room for `len` code
+ * points.
+ *
+ * Each code point is inserted at a position computed from the previous
+ * deltas alone. Short labels insert in place, while long labels record the
+ * positions and place every code point at the end to avoid quadratic time.
+ */
+// https://datatracker.ietf.org/doc/html/rfc3492#section-6.2
+static inline int
+url__punycode_decode (const utf8_t *input, size_t len, uint32_t *result, size_t *result_len) {
+  int err;
+
+  uint32_t n = url__punycode_initial_n;
+  uint32_t i = 0;
+  uint32_t bias = url__punycode_initial_bias;
+
+  size_t b = 0;
+
+  for (size_t j = 0; j < len; j++) {
+    if (input[j] == 0x2d) b = j;
+  }
+
+  uint32_t *positions = NULL;
+
+  if (len > url__punycode_tree_len) {
+    positions = malloc(len * sizeof(uint32_t));
+    if (positions == NULL) return -1;
+  }
+
+  size_t out = 0;
+
+  for (size_t j = 0; j < b; j++) {
+    if (input[j] >= 0x80) goto err;
+
+    if (positions) positions[out] = (uint32_t) out;
+
+    result[out++] = input[j];
+  }
+
+  for (size_t in = b > 0 ? b + 1 : 0; in < len;) {
+    uint32_t old_i = i, w = 1;
+
+    for (uint32_t k = url__punycode_base;; k += url__punycode_base) {
+      if (in >= len) goto err;
+
+      uint32_t digit = url__punycode_decode_digit(input[in++]);
+
+      if (digit >= url__punycode_base) goto err;
+
+      if (digit > (UINT32_MAX - i) / w) goto err;
+
+      i += digit * w;
+
+      uint32_t t = url__punycode_threshold(k, bias);
+
+      if (digit < t) break;
+
+      if (w > UINT32_MAX / (url__punycode_base - t)) goto err;
+
+      w *= url__punycode_base - t;
+    }
+
+    bias = url__punycode_adapt(i - old_i, (uint32_t) out + 1, old_i == 0);
+
+    if (i / (out + 1) > UINT32_MAX - n) goto err;
+
+    n += i / (out + 1);
+    i %= out + 1;
+
+    if (n < url__punycode_initial_n || n > 0x10ffff) goto err;
+
+    if (positions) {
+      positions[out] = i;
+      result[out] = n;
+    } else {
+      memmove(&result[i + 1], &result[i], (out - i) * sizeof(uint32_t));
+
+      result[i] = n;
+    }
+
+    i++;
+    out++;
+  }
+
+  if (positions) {
+    err = url__punycode_place(result, positions, out);
+    if (err < 0) goto err;
+
+    free(positions);
+  }
+
+  *result_len = out;
+
+  return 0;
+
+err:
+  free(positions);
 
   return -1;
 }
 
+/**
+ * Write the digits of `delta` to `output`, returning the end of the digits.
+ */
+static inline utf8_t *
+url__punycode_encode_delta (uint32_t delta, uint32_t bias, utf8_t *output) {
+  uint32_t q = delta;
+
+  for (uint32_t k = url__punycode_base;; k += url__punycode_base) {
+    uint32_t t = url__punycode_threshold(k, bias);
+
+    if (q < t) break;
+
+    *output++ = url__punycode_encode_digit(t + (q - t) % (url__punycode_base - t));
+
+    q = (q - t) / (url__punycode_base - t);
+  }
+
+  *output++ = url__punycode_encode_digit(q);
+
+  return output;
+}
+
+static inline int
+url__punycode_compare_keys (const void *a, const void *b) {
+  uint64_t x = *(const uint64_t *) a, y = *(const uint64_t *) b;
+
+  return x < y ? -1 : x > y;
+}
+
+/**
+ * Encode the deltas of a long label with `b` basic code points in O(n log n).
+ * Rather than scanning the whole label for every distinct code point, the
+ * occurrences of each code point are visited in order, with a Fenwick tree
+ * counting the code points already handled between them.
+ */
+static inline int
+url__punycode_encode_sorted (const uint32_t *input, size_t len, size_t b, utf8_t **result) {
+  int err = -1;
+
+  size_t count = len - b;
+
+  uint64_t *keys = malloc(count * sizeof(uint64_t));
+  uint32_t *tree = calloc(len + 1, sizeof(uint32_t));
+
+  if (keys == NULL || tree == NULL) goto done;
+
+  for (size_t j = 0, k = 0; j < len; j++) {
+    if (input[j] < 0x80) url__punycode_tree_add(tree, len, j, 1);
+    else keys[k++] = (uint64_t) input[j] << 32 | j;
+  }
+
+  qsort(keys, count, sizeof(uint64_t), url__punycode_compare_keys);
+
+  utf8_t *output = *result;
+
+  uint32_t n = url__punycode_initial_n;
+  uint32_t delta = 0;
+  uint32_t bias = url__punycode_initial_bias;
+
+  size_t h = b;
+
+  for (size_t k = 0; k < count;) {
+    uint32_t m = (uint32_t) (keys[k] >> 32);
+
+    if (m - n > (UINT32_MAX - delta) / (h + 1)) goto done;
+
+    delta += (m - n) * (uint32_t) (h + 1);
+    n = m;
+
+    size_t start = k, next = 0;
+
+    for (; k < count && (uint32_t) (keys[k] >> 32) == m; k++) {
+      size_t j = (size_t) (keys[k] & 0xffffffff);
+
+      uint64_t sum = (uint64_t) delta + url__punycode_tree_prefix(tree, j) - url__punycode_tree_prefix(tree, next);
+
+      if (sum > UINT32_MAX) goto done;
+
+      output = url__punycode_encode_delta((uint32_t) sum, bias, output);
+
+      bias = url__punycode_adapt((uint32_t) sum, (uint32_t) h + 1, h == b);
+      delta = 0;
+      h++;
+
+      next = j + 1;
+    }
+
+    uint64_t sum = (uint64_t) delta + url__punycode_tree_prefix(tree, len) - url__punycode_tree_prefix(tree, next);
+
+    if (sum > UINT32_MAX) goto done;
+
+    delta = (uint32_t) sum;
+
+    for (size_t i = start; i < k; i++) {
+      url__punycode_tree_add(tree, len, (size_t) (keys[i] & 0xffffffff), 1);
+    }
+
+    delta++;
+    n++;
+  }
+
+  *result = output;
+
+  err = 0;
+
+done:
+  free(keys);
+  free(tree);
+
+  return err;
+}
+
+/**
+ * Encode the label of `len` code points at `input` and append the result. The
+ * output is sized up front from the number of basic and non-basic code
+ * points, so at most one allocation is made.
+ */
+// https://datatracker.ietf.org/doc/html/rfc3492#section-6.3
+static inline int
+url__punycode_encode (const uint32_t *input, size_t len, utf8_string_t *result) {
+  int err;
+
+  size_t b = 0;
+
+  for (size_t j = 0; j < len; j++) {
+    if (input[j] < 0x80) b++;
+  }
+
+  err = url__string_reserve(result, result->len + b + 1 + (len - b) * url__punycode_max_digits);
+  if (err < 0) return err;
+
+  utf8_t *output = &result->data[result->len];
+
+  for (size_t j = 0; j < len; j++) {
+    if (input[j] < 0x80) *output++ = (utf8_t) input[j];
+  }
+
+  if (b > 0) *output++ = 0x2d;
+
+  if (len > url__punycode_tree_len && len > b) {
+    err = url__punycode_encode_sorted(input, len, b, &output);
+    if (err < 0) return err;
+
+    result->len = output - result->data;
+
+    return 0;
+  }
+
+  uint32_t n = url__punycode_initial_n;
+  uint32_t delta = 0;
+  uint32_t bias = url__punycode_initial_bias;
+
+  for (size_t h = b; h < len;) {
+    uint32_t m = UINT32_MAX;
+
+    for (size_t j = 0; j < len; j++) {
+      if (input[j] >= n && input[j] < m) m = input[j];
+    }
+
+    if (m - n > (UINT32_MAX - delta) / (h + 1)) return -1;
+
+    delta += (m - n) * (uint32_t) (h + 1);
+    n = m;
+
+    for (size_t j = 0; j < len; j++) {
+      uint32_t c = input[j];
+
+      if (c < n && ++delta == 0) return -1;
+
+      if (c != n) continue;
+
+      output = url__punycode_encode_delta(delta, bias, output);
+
+      bias = url__punycode_adapt(delta, (uint32_t) h + 1, h == b);
+      delta = 0;
+      h++;
+    }
+
+    delta++;
+    n++;
+  }
+
+  result->len = output - result->data;
+
+  return 0;
+}
+
+/**
+ * Decode the Punycode label at `input`, without the ACE prefix, and append it
+ * as UTF-8.
+ */
+static inline int
+url__punycode_to_utf8 (utf8_string_view_t input, utf8_string_t *result) {
+  int err;
+
+  if (!url__is_ascii_string(input.data, input.len)) return -1;
+
+  uint32_t buffer[url__punycode_stack_len];
+
+  uint32_t *code_points = buffer;
+
+  if (input.len > url__punycode_stack_len) {
+    code_points = malloc(input.len * sizeof(uint32_t));
+    if (code_points == NULL) return -1;
+  }
+
+  size_t len;
+
+  err = url__punycode_decode(input.data, input.len, code_points, &len);
+  if (err < 0) goto done;
+
+  err = url__string_reserve(result, result->len + len * 4);
+  if (err < 0) goto done;
+
+  result->len += url__utf8_encode(code_points, len, &result->data[result->len]);
+
+done:
+  if (code_points != buffer) free(code_points);
+
+  return err;
+}
+
+/**
+ * Encode the UTF-8 label at `input` as Punycode, without the ACE prefix, and
+ * append it. A label that is already all ASCII encodes as itself followed by
+ * the delimiter, which is appended directly.
+ */
 static inline int
 url__utf8_to_punycode (utf8_string_view_t input, utf8_string_t *result) {
-  // TODO
+  int err;
 
-  return -1;
+  if (url__is_ascii_string(input.data, input.len)) {
+    err = url__string_reserve(result, result->len + input.len + 1);
+    if (err < 0) return err;
+
+    err = url__string_append_view(result, input);
+    if (err < 0) return err;
+
+    if (input.len > 0) return url__string_append_character(result, 0x2d);
+
+    return 0;
+  }
+
+  uint32_t buffer[url__punycode_stack_len];
+
+  uint32_t *code_points = buffer;
+
+  if (input.len > url__punycode_stack_len) {
+    code_points = malloc(input.len * sizeof(uint32_t));
+    if (code_points == NULL) return -1;
+  }
+
+  size_t len = url__utf8_decode(input.data, input.len, code_points);
+
+  err = url__punycode_encode(code_points, len, result);
+
+  if (code_points != buffer) free(code_points);
+
+  return err;
 }
 
 #endif // URL_PUNYCODE_H
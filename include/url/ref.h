@@ -0,0 +1,83 @@
+#ifndef URL_REF_H
+#define URL_REF_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include <utf.h>
+#include <utf/string.h>
+
+typedef struct url_s url_t;
+
+/**
+ * An immutable, reference counted URL that can be shared between threads
+ * without copying.
+ *
+ * The URL and its href live in a single allocation of exactly the size
+ * needed: the href bytes come first and the header follows them, such that
+ * a URL whose references are all gone but one can hand its href back to a
+ * mutable `url_t` without copying it.
+ *
+ * All functions may be called concurrently from multiple threads, as long as
+ * every thread holds its own reference.
+ */
+typedef struct url_ref_s url_ref_t;
+
+/**
+ * Create a reference to a copy of `url`.
+ */
+int
+url_ref_init (const url_t *url, url_ref_t **result);
+
+/**
+ * Create a reference from `url`, taking over its href storage and resizing it
+ * to fit rather than copying it. On success, `url` is left empty and need not
+ * be destroyed. The href must be owned by `url`, so URLs decoded with
+ * `url_decode_borrow` must use `url_ref_init()` instead.
+ */
+int
+url_ref_move (url_t *url, url_ref_t **result);
+
+/**
+ * Take another reference, which costs a single atomic increment.
+ */
+url_ref_t *
+url_ref_retain (url_ref_t *ref);
+
+/**
+ * Drop a reference, freeing the URL when it was the last.
+ */
+void
+url_ref_release (url_ref_t *ref);
+
+/**
+ * Get the URL. It must not be modified or passed to `url_destroy()`, and
+ * stays valid for as long as the reference is held.
+ */
+const url_t *
+url_ref_get (const url_ref_t *ref);
+
+size_t
+url_ref_count (const url_ref_t *ref);
+
+/**
+ * Copy the URL to `result`, allocating exactly the size of its href.
+ */
+int
+url_ref_clone (const url_ref_t *ref, url_t *result);
+
+/**
+ * Drop a reference in exchange for a mutable copy of the URL in `result`. If
+ * it was the last reference, the href storage is handed over without copying;
+ * otherwise the URL is cloned.
+ */
+int
+url_ref_unshare (url_ref_t *ref, url_t *result);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // URL_REF_H
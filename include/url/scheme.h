@@ -0,0 +1,84 @@
+#ifndef URL_SCHEME_H
+#define URL_SCHEME_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+#include <utf.h>
+#include <utf/string.h>
+
+#include "../url.h"
+
+typedef struct url_scheme_s url_scheme_t;
+typedef struct url_scheme_registry_s url_scheme_registry_t;
+
+struct url_scheme_s {
+  /**
+   * The lowercase name of the scheme, without the trailing colon.
+   */
+  const utf8_t *name;
+  size_t len;
+
+  /**
+   * The type of URL the scheme parses to, which is `url_type_opaque` for all
+   * but the special schemes.
+   */
+  url_type_t type;
+
+  /**
+   * The default port of the scheme, or -1 if it has none.
+   */
+  int32_t default_port;
+
+  /**
+   * Application data attached when the scheme was registered.
+   */
+  void *data;
+};
+
+/**
+ * A registry of scheme metadata, holding the special schemes and any schemes
+ * registered by the application.
+ *
+ * The special schemes are classified by the same compile-time perfect hash
+ * that the parser uses. Registered schemes are kept in a minimal perfect hash
+ * that is rebuilt on every registration. Lookups therefore take a single
+ * probe into either table, however many schemes are registered.
+ *
+ * Registration isn't synchronized and is meant to happen at startup. Lookups
+ * may be done concurrently from multiple threads once registration is done.
+ */
+int
+url_scheme_registry_init (url_scheme_registry_t **result);
+
+void
+url_scheme_registry_destroy (url_scheme_registry_t *registry);
+
+/**
+ * Register the scheme `name` with a default port, or -1 for none, and
+ * optional application data. The name is matched ignoring ASCII case. Returns
+ * -1 if the name isn't a valid scheme, names a special scheme, or is already
+ * registered.
+ */
+int
+url_scheme_registry_add (url_scheme_registry_t *registry, const utf8_t *name, size_t len, int32_t default_port, void *data);
+
+/**
+ * Look up the scheme `scheme`, such as a view returned by `url_get_scheme()`,
+ * ignoring ASCII case. Returns NULL if the scheme is neither special nor
+ * registered.
+ */
+const url_scheme_t *
+url_scheme_registry_lookup (const url_scheme_registry_t *registry, const utf8_string_view_t scheme);
+
+size_t
+url_scheme_registry_size (const url_scheme_registry_t *registry);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // URL_SCHEME_H
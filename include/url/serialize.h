@@ -1,35 +1,92 @@
 #ifndef URL_SERIALIZE_H
 #define URL_SERIALIZE_H
 
+#include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
-#include <stdio.h>
+#include <string.h>
 #include <utf.h>
 #include <utf/string.h>
 
+#include "trace.h"
+
+static const char url__decimal_pairs[] =
+  "00010203040506070809"
+  "10111213141516171819"
+  "20212223242526272829"
+  "30313233343536373839"
+  "40414243444546474849"
+  "50515253545556575859"
+  "60616263646566676869"
+  "70717273747576777879"
+  "80818283848586878889"
+  "90919293949596979899";
+
+/**
+ * Write the decimal digits of `n` to `output`, returning the number of digits
+ * written.
+ */
+static inline size_t
+url__serialize_decimal_byte (uint8_t n, utf8_t *output) {
+  if (n >= 100) {
+    output[0] = 0x30 + n / 100;
+    memcpy(&output[1], &url__decimal_pairs[(n % 100) * 2], 2);
+
+    return 3;
+  }
+
+  if (n >= 10) {
+    memcpy(output, &url__decimal_pairs[n * 2], 2);
+
+    return 2;
+  }
+
+  output[0] = 0x30 + n;
+
+  return 1;
+}
+
 // https://url.spec.whatwg.org/#concept-ipv4-serializer
 static inline int
 url__serialize_ipv4 (uint32_t address, utf8_string_t *result) {
   int err;
 
-  uint32_t n = address;
+  // At most four parts of three digits each, separated by dots.
+  err = url__string_reserve(result, result->len + 15);
+  if (err < 0) return err;
 
-  for (uint8_t i = 3; i <= 3; i--) {
-    char number[4];
-    err = snprintf(number, 4, "%d", (address >> (i * 8)) & 0xff);
-    assert(err > 0);
+  utf8_t *output = &result->data[result->len];
 
-    err = utf8_string_append_literal(result, (utf8_t *) number, err);
-    if (err < 0) return err;
+  size_t len = 0;
 
-    if (i != 0) {
-      err = utf8_string_append_character(result, '.');
-      if (err < 0) return err;
-    }
+  for (uint8_t i = 3; i <= 3; i--) {
+    len += url__serialize_decimal_byte((address >> (i * 8)) & 0xff, &output[len]);
+
+    if (i != 0) output[len++] = '.';
   }
 
+  result->len += len;
+
   return 0;
 }
 
+static const char url__lower_hex_digits[] = "0123456789abcdef";
+
+/**
+ * Write the shortest lowercase hexadecimal digits of `n` to `output`,
+ * returning the number of digits written.
+ */
+static inline size_t
+url__serialize_hex_piece (uint16_t n, utf8_t *output) {
+  size_t len = n >= 0x1000 ? 4 : n >= 0x100 ? 3 : n >= 0x10 ? 2 : 1;
+
+  for (size_t i = len; i-- > 0; n >>= 4) {
+    output[i] = url__lower_hex_digits[n & 0xf];
+  }
+
+  return len;
+}
+
 // https://url.spec.whatwg.org/#concept-ipv6-serializer
 static inline int
 url__serialize_ipv6 (uint16_t address[8], utf8_string_t *result) {
@@ -57,6 +114,14 @@ url__serialize_ipv6 (uint16_t address[8], utf8_string_t *result) {
     }
   }
 
+  // At most eight pieces of four digits each, separated by colons.
+  err = url__string_reserve(result, result->len + 39);
+  if (err < 0) return err;
+
+  utf8_t *output = &result->data[result->len];
+
+  size_t len = 0;
+
   bool ignore_0 = false;
 
   for (uint8_t piece_index = 0; piece_index < 8; piece_index++) {
@@ -65,26 +130,21 @@ url__serialize_ipv6 (uint16_t address[8], utf8_string_t *result) {
     ignore_0 = false;
 
     if (compress == piece_index) {
-      err = utf8_string_append_literal(result, (utf8_t *) "::", piece_index == 0 ? 2 : 1);
-      if (err < 0) return err;
+      output[len++] = ':';
+
+      if (piece_index == 0) output[len++] = ':';
 
       ignore_0 = true;
       continue;
     }
 
-    char number[5];
-    err = snprintf(number, 5, "%x", address[piece_index]);
-    assert(err > 0);
+    len += url__serialize_hex_piece(address[piece_index], &output[len]);
 
-    err = utf8_string_append_literal(result, (utf8_t *) number, err);
-    if (err < 0) return err;
-
-    if (piece_index != 7) {
-      err = utf8_string_append_character(result, ':');
-      if (err < 0) return err;
-    }
+    if (piece_index != 7) output[len++] = ':';
   }
 
+  result->len += len;
+
   return 0;
 }
 
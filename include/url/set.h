@@ -0,0 +1,57 @@
+#ifndef URL_SET_H
+#define URL_SET_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <utf.h>
+#include <utf/string.h>
+
+/**
+ * A deduplicating set of serialized URLs, intended for canonical `href`s.
+ *
+ * The set is split into independently locked shards, each an open addressing
+ * table of 16 byte slots holding a 32-bit fingerprint, the length, and a
+ * pointer into an append-only arena of href bytes. Lookups reject most
+ * mismatches on the fingerprint alone and only compare bytes on a match.
+ *
+ * All functions other than `url_set_init()` and `url_set_destroy()` may be
+ * called concurrently from multiple threads.
+ */
+typedef struct url_set_s url_set_t;
+
+int
+url_set_init (url_set_t **result);
+
+void
+url_set_destroy (url_set_t *set);
+
+/**
+ * Add `href` to the set, copying it into the set's arena. Returns 1 if the
+ * href was inserted, 0 if it was already present, and -1 on allocation
+ * failure.
+ */
+int
+url_set_add (url_set_t *set, const utf8_string_view_t href);
+
+bool
+url_set_has (url_set_t *set, const utf8_string_view_t href);
+
+size_t
+url_set_size (url_set_t *set);
+
+/**
+ * The total number of bytes allocated by the set, including slots, arena
+ * blocks, and bookkeeping.
+ */
+size_t
+url_set_memory_usage (url_set_t *set);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // URL_SET_H
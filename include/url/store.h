@@ -0,0 +1,114 @@
+#ifndef URL_STORE_H
+#define URL_STORE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <utf.h>
+#include <utf/string.h>
+
+#include "../url.h"
+
+/**
+ * A read-only store of parsed URLs sorted by href, compressed with front
+ * coding. URLs are grouped into blocks of a fixed number of entries; each
+ * entry stores the length of the prefix it shares with the previous href in
+ * the block, the remaining suffix, the type and flags, and those components
+ * of the URL that differ from the previous entry as varints. The first entry
+ * of every block shares nothing, so the block index doubles as a sparse index
+ * of full hrefs for binary search.
+ */
+typedef struct url_store_s url_store_t;
+typedef struct url_store_builder_s url_store_builder_t;
+typedef struct url_store_iterator_s url_store_iterator_t;
+
+struct url_store_iterator_s {
+  const url_store_t *store;
+
+  size_t ordinal;
+  size_t end;
+
+  const utf8_t *position;
+
+  utf8_string_t href;
+  url_t url;
+};
+
+int
+url_store_builder_init (url_store_builder_t **result);
+
+void
+url_store_builder_destroy (url_store_builder_t *builder);
+
+/**
+ * Append a URL to the store being built. URLs must be added in strictly
+ * increasing byte order of their hrefs; -1 is returned otherwise.
+ */
+int
+url_store_builder_add (url_store_builder_t *builder, const url_t *url);
+
+/**
+ * Finish building and hand the store to `result`. The builder must still be
+ * destroyed afterwards, but may not be added to again.
+ */
+int
+url_store_builder_finish (url_store_builder_t *builder, url_store_t **result);
+
+void
+url_store_destroy (url_store_t *store);
+
+size_t
+url_store_size (const url_store_t *store);
+
+/**
+ * The number of bytes used by the store, for computing compression ratios.
+ */
+size_t
+url_store_memory_usage (const url_store_t *store);
+
+/**
+ * Decode the URL at `ordinal` into `result`, which must have been
+ * initialized with `url_init()`.
+ */
+int
+url_store_get (const url_store_t *store, size_t ordinal, url_t *result);
+
+/**
+ * Find the ordinal of the first URL whose href is not less than `href`.
+ * Returns 1 if that URL has exactly the given href and 0 otherwise.
+ */
+int
+url_store_find (const url_store_t *store, const utf8_string_view_t href, size_t *ordinal);
+
+/**
+ * Find the half-open range of ordinals of the URLs whose hrefs start with
+ * `prefix`, such as all URLs under `https://example.com/dir/`.
+ */
+void
+url_store_prefix_range (const url_store_t *store, const utf8_string_view_t prefix, size_t *start, size_t *end);
+
+/**
+ * Iterate the URLs in the half-open range of ordinals from `start` to `end`.
+ * Sequential iteration decodes each entry only once.
+ */
+void
+url_store_iterator_init (url_store_iterator_t *iterator, const url_store_t *store, size_t start, size_t end);
+
+void
+url_store_iterator_destroy (url_store_iterator_t *iterator);
+
+/**
+ * Get a borrowed view of the next URL, valid until the next call. Returns 1
+ * if a URL was read, 0 at the end of the range, and -1 on error.
+ */
+int
+url_store_iterator_next (url_store_iterator_t *iterator, url_t *result);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // URL_STORE_H
@@ -0,0 +1,141 @@
+#ifndef URL_TRACE_H
+#define URL_TRACE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+#include <utf.h>
+#include <utf/string.h>
+
+typedef struct url_s url_t;
+
+/**
+ * Counters of the string allocations made while parsing, kept per thread.
+ *
+ * Allocations and reallocations are only counted in builds with `URL_TRACE`
+ * defined, where every string growth in the parser is checked. Other builds
+ * only count what `url_trace_sample()` records, which is cheap enough to call
+ * on a fraction of the URLs parsed in production.
+ */
+typedef struct {
+  uint64_t parses;
+
+  /**
+   * Strings allocated from empty, and strings grown in place or moved.
+   */
+  uint64_t allocations;
+  uint64_t reallocations;
+
+  /**
+   * The bytes requested by allocations and reallocations.
+   */
+  uint64_t bytes;
+
+  /**
+   * The capacity left unused in `href` at the end of each parse.
+   */
+  uint64_t slack;
+} url_trace_t;
+
+/**
+ * Called on the parsing thread at the end of every parse in builds with
+ * `URL_TRACE` defined, with the counters of that parse alone.
+ */
+typedef void (*url_trace_cb)(const url_t *url, const url_trace_t *trace, void *data);
+
+/**
+ * Copy the counters of the calling thread to `result`.
+ */
+void
+url_trace_get (url_trace_t *result);
+
+void
+url_trace_reset (void);
+
+/**
+ * Set the parse callback of the calling thread, or clear it if `cb` is NULL.
+ */
+void
+url_trace_on_parse (url_trace_cb cb, void *data);
+
+/**
+ * Count `url` as parsed and record the slack of its `href`. Builds with
+ * `URL_TRACE` defined already record this for every parse.
+ */
+void
+url_trace_sample (const url_t *url);
+
+url_trace_t *
+url__trace_counters (void);
+
+void
+url__trace_parse (const url_t *url, const url_trace_t *start);
+
+/**
+ * String growth used by the parser, counting allocations when tracing.
+ */
+
+#if defined(URL_TRACE)
+static inline void
+url__trace_grow (const utf8_t *data, size_t capacity, const utf8_string_t *string) {
+  if (string->cap == capacity) return;
+
+  url_trace_t *trace = url__trace_counters();
+
+  if (data == NULL) trace->allocations++;
+  else trace->reallocations++;
+
+  trace->bytes += string->cap;
+}
+
+#define url__trace_string(string, call) \
+  const utf8_t *data = (string)->data; \
+  size_t capacity = (string)->cap; \
+  int err = call; \
+  url__trace_grow(data, capacity, string); \
+  return err;
+#else
+#define url__trace_string(string, call) \
+  return call;
+#endif
+
+static inline int
+url__string_reserve (utf8_string_t *string, size_t len) {
+  url__trace_string(string, utf8_string_reserve(string, len));
+}
+
+static inline int
+url__string_append (utf8_string_t *string, const utf8_string_t *other) {
+  url__trace_string(string, utf8_string_append(string, other));
+}
+
+static inline int
+url__string_append_view (utf8_string_t *string, const utf8_string_view_t view) {
+  url__trace_string(string, utf8_string_append_view(string, view));
+}
+
+static inline int
+url__string_append_literal (utf8_string_t *string, const utf8_t *literal, size_t len) {
+  url__trace_string(string, utf8_string_append_literal(string, literal, len));
+}
+
+static inline int
+url__string_prepend_literal (utf8_string_t *string, const utf8_t *literal, size_t len) {
+  url__trace_string(string, utf8_string_prepend_literal(string, literal, len));
+}
+
+static inline int
+url__string_append_character (utf8_string_t *string, utf8_t c) {
+  url__trace_string(string, utf8_string_append_character(string, c));
+}
+
+#undef url__trace_string
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // URL_TRACE_H
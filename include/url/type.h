@@ -1,38 +1,58 @@
 #ifndef URL_TYPE_H
 #define URL_TYPE_H
 
+#include <stddef.h>
+#include <stdint.h>
 #include <utf.h>
 #include <utf/string.h>
 
 #include "../url.h"
 
+/**
+ * The special schemes, laid out such that `url__special_scheme_slot()` is a
+ * minimal perfect hash of them: the first byte and the length of each scheme
+ * are enough to tell them apart.
+ */
+static const struct {
+  char name[6];
+  uint8_t len;
+  url_type_t type;
+} url__special_schemes[6] = {
+  {"file", 4, url_type_file},
+  {"ws", 2, url_type_ws},
+  {"http", 4, url_type_http},
+  {"https", 5, url_type_https},
+  {"wss", 3, url_type_wss},
+  {"ftp", 3, url_type_ftp},
+};
+
+static inline size_t
+url__special_scheme_slot (utf8_t first, size_t len) {
+  return (((first | 0x20) + len * 55) & 0xff) % 6;
+}
+
+/**
+ * Classify a scheme with a single probe into the special schemes, ignoring
+ * ASCII case.
+ */
 static inline url_type_t
 url__type (const utf8_string_view_t scheme) {
   size_t len = scheme.len;
   const utf8_t *data = scheme.data;
 
-  // ftp | file
-  if (len >= 3 && data[0] == 'f') {
-    if (len == 3 && data[1] == 't' && data[2] == 'p') return url_type_ftp;
-    if (len == 4 && data[1] == 'i' && data[2] == 'l' && data[3] == 'e') return url_type_file;
-    return url_type_opaque;
-  }
+  if (len < 2 || len > 5) return url_type_opaque;
 
-  // http(s)
-  if (len >= 4 && data[0] == 'h' && data[1] == 't' && data[2] == 't' && data[3] == 'p') {
-    if (len == 4) return url_type_http;
-    if (len == 5 && data[4] == 's') return url_type_https;
-    return url_type_opaque;
-  }
+  size_t slot = url__special_scheme_slot(data[0], len);
+
+  if (url__special_schemes[slot].len != len) return url_type_opaque;
+
+  const char *name = url__special_schemes[slot].name;
 
-  // ws(s)
-  if (len >= 2 && data[0] == 'w' && data[1] == 's') {
-    if (len == 2) return url_type_ws;
-    if (len == 3 && data[2] == 's') return url_type_wss;
-    return url_type_opaque;
+  for (size_t i = 0; i < len; i++) {
+    if ((data[i] | 0x20) != (utf8_t) name[i]) return url_type_opaque;
   }
 
-  return url_type_opaque;
+  return url__special_schemes[slot].type;
 }
 
 // https://url.spec.whatwg.org/#default-port
@@ -0,0 +1,85 @@
+#ifndef URL_UNICODE_H
+#define URL_UNICODE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * Lookups of the Unicode character properties needed for UTS #46 processing.
+ * The tables behind them are generated from the Unicode data in data/unicode
+ * by scripts/generate-unicode-tables.js and live in src/unicode.c.
+ */
+
+// https://www.unicode.org/reports/tr46/#Table_Data_File_Fields
+typedef enum {
+  url_idna_valid,
+  url_idna_mapped,
+  url_idna_deviation,
+  url_idna_ignored,
+  url_idna_disallowed,
+} url_idna_status_t;
+
+// https://www.unicode.org/reports/tr9/#Bidirectional_Character_Types
+typedef enum {
+  url_bidi_l,
+  url_bidi_r,
+  url_bidi_al,
+  url_bidi_an,
+  url_bidi_en,
+  url_bidi_es,
+  url_bidi_cs,
+  url_bidi_et,
+  url_bidi_on,
+  url_bidi_bn,
+  url_bidi_nsm,
+  url_bidi_other,
+} url_bidi_class_t;
+
+// https://www.unicode.org/versions/latest/core-spec/chapter-9/#G36341
+typedef enum {
+  url_joining_u,
+  url_joining_d,
+  url_joining_l,
+  url_joining_r,
+  url_joining_t,
+  url_joining_c,
+} url_joining_type_t;
+
+/**
+ * Get the UTS #46 status of a code point with UseSTD3ASCIIRules=false. For
+ * mapped code points, `mapping` and `len` are set to the mapping.
+ */
+url_idna_status_t
+url__unicode_idna_status (uint32_t code_point, const uint32_t **mapping, size_t *len);
+
+uint8_t
+url__unicode_combining_class (uint32_t code_point);
+
+url_bidi_class_t
+url__unicode_bidi_class (uint32_t code_point);
+
+url_joining_type_t
+url__unicode_joining_type (uint32_t code_point);
+
+/**
+ * Check if a code point has General_Category=Mark.
+ */
+bool
+url__unicode_is_mark (uint32_t code_point);
+
+/**
+ * Get the full canonical decomposition of a code point, including Hangul
+ * syllables, into `result`, which must have room for 4 code points. Returns
+ * the length of the decomposition, or 0 if the code point has none.
+ */
+size_t
+url__unicode_decompose (uint32_t code_point, uint32_t result[4]);
+
+/**
+ * Get the primary composite of a pair of code points, or 0 if there is none.
+ */
+uint32_t
+url__unicode_compose (uint32_t first, uint32_t second);
+
+#endif // URL_UNICODE_H
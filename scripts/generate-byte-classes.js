@@ -0,0 +1,129 @@
+#!/usr/bin/env node
+
+// Generate include/url/byte-classes.h, classifying every byte by the character
+// sets of the URL standard and the delimiters the parser acts on.
+//
+//   node scripts/generate-byte-classes.js
+
+const fs = require('fs')
+const path = require('path')
+
+const root = path.join(__dirname, '..')
+
+const range = (from, to) => {
+  const bytes = []
+  for (let b = from; b <= to; b++) bytes.push(b)
+  return bytes
+}
+
+const chars = (string) => [...string].map((c) => c.charCodeAt(0))
+
+const union = (...sets) => new Set(sets.flatMap((set) => [...set]))
+
+// https://infra.spec.whatwg.org/#ascii-digit
+const asciiDigit = new Set(range(0x30, 0x39))
+
+// https://infra.spec.whatwg.org/#ascii-hex-digit
+const asciiHexDigit = union(asciiDigit, range(0x41, 0x46), range(0x61, 0x66))
+
+// https://infra.spec.whatwg.org/#ascii-alpha
+const asciiAlpha = new Set([...range(0x41, 0x5a), ...range(0x61, 0x7a)])
+
+// https://infra.spec.whatwg.org/#ascii-alphanumeric
+const asciiAlphanumeric = union(asciiDigit, asciiAlpha)
+
+// https://url.spec.whatwg.org/#scheme-state
+const scheme = union(asciiAlphanumeric, chars('+-.'))
+
+// https://url.spec.whatwg.org/#forbidden-host-code-point
+const forbiddenHost = new Set([0x00, 0x09, 0x0a, 0x0d, ...chars(' #/:<>?@[\\]^|')])
+
+// https://url.spec.whatwg.org/#forbidden-domain-code-point
+const forbiddenDomain = union(forbiddenHost, range(0x00, 0x1f), chars('%'), [0x7f])
+
+// https://url.spec.whatwg.org/#c0-control-percent-encode-set
+const c0ControlPercentEncode = new Set([...range(0x00, 0x1f), ...range(0x7f, 0xff)])
+
+// https://url.spec.whatwg.org/#fragment-percent-encode-set
+const fragmentPercentEncode = union(c0ControlPercentEncode, chars(' "<>`'))
+
+// https://url.spec.whatwg.org/#query-percent-encode-set
+const queryPercentEncode = union(c0ControlPercentEncode, chars(' "#<>'))
+
+// https://url.spec.whatwg.org/#special-query-percent-encode-set
+const specialQueryPercentEncode = union(queryPercentEncode, chars("'"))
+
+// https://url.spec.whatwg.org/#path-percent-encode-set
+const pathPercentEncode = union(queryPercentEncode, chars('?`{}'))
+
+// https://url.spec.whatwg.org/#userinfo-percent-encode-set
+const userinfoPercentEncode = union(pathPercentEncode, chars('/:;=@[\\]^|'))
+
+const classes = [
+  ['url__ascii_digit_character_set', asciiDigit],
+  ['url__ascii_hex_digit_character_set', asciiHexDigit],
+  ['url__ascii_alpha_character_set', asciiAlpha],
+  ['url__ascii_alphanumeric_character_set', asciiAlphanumeric],
+  ['url__scheme_character_set', scheme],
+  ['url__forbidden_host_character_set', forbiddenHost],
+  ['url__forbidden_domain_character_set', forbiddenDomain],
+  ['url__c0_control_percent_encode_set', c0ControlPercentEncode],
+  ['url__fragment_percent_encode_set', fragmentPercentEncode],
+  ['url__query_percent_encode_set', queryPercentEncode],
+  ['url__special_query_percent_encode_set', specialQueryPercentEncode],
+  ['url__path_percent_encode_set', pathPercentEncode],
+  ['url__userinfo_percent_encode_set', userinfoPercentEncode],
+  ['url__byte_slash', new Set(chars('/'))],
+  ['url__byte_backslash', new Set(chars('\\'))],
+  ['url__byte_question_mark', new Set(chars('?'))],
+  ['url__byte_number_sign', new Set(chars('#'))],
+  ['url__byte_at_sign', new Set(chars('@'))],
+  ['url__byte_colon', new Set(chars(':'))],
+  ['url__byte_left_bracket', new Set(chars('['))],
+  ['url__byte_right_bracket', new Set(chars(']'))]
+]
+
+if (classes.length > 32) throw new Error('Too many classes for 32 bits')
+
+const hex = (n, width) => '0x' + n.toString(16).padStart(width, '0')
+
+const out = []
+
+out.push('// Generated by scripts/generate-byte-classes.js. Do not edit.')
+out.push('')
+out.push('#ifndef URL_BYTE_CLASSES_H')
+out.push('#define URL_BYTE_CLASSES_H')
+out.push('')
+out.push('#include <stdint.h>')
+out.push('')
+out.push('enum {')
+
+for (let i = 0; i < classes.length; i++) {
+  out.push(`  ${classes[i][0]} = ${hex(1 << i >>> 0, 8)},`)
+}
+
+out.push('};')
+out.push('')
+out.push('// The classes of every byte, as a bitmask of the classes above.')
+out.push('static const uint32_t url__byte_classes[256] = {')
+
+for (let b = 0; b < 256; b++) {
+  let mask = 0
+
+  for (let i = 0; i < classes.length; i++) {
+    if (classes[i][1].has(b)) mask |= 1 << i
+  }
+
+  // A backslash at the end of the comment would continue it onto the next
+  // line.
+  const printable = b > 0x20 && b < 0x7f && b !== 0x5c ? ' ' + String.fromCharCode(b) : ''
+
+  out.push(`  ${hex(mask >>> 0, 8)}, // ${hex(b, 2)}${printable}`)
+}
+
+out.push('};')
+out.push('')
+out.push('#endif // URL_BYTE_CLASSES_H')
+out.push('')
+
+fs.writeFileSync(path.join(root, 'include', 'url', 'byte-classes.h'), out.join('\n'))
@@ -0,0 +1,429 @@
+#!/usr/bin/env node
+
+// Generate src/unicode-tables.h from the Unicode data files in data/unicode.
+//
+//   node scripts/generate-unicode-tables.js
+
+const fs = require('fs')
+const path = require('path')
+
+const root = path.join(__dirname, '..')
+const data = path.join(root, 'data', 'unicode')
+
+const version = '15.1.0'
+
+const idnaStatus = {
+  valid: 0,
+  mapped: 1,
+  deviation: 2,
+  ignored: 3,
+  disallowed: 4
+}
+
+const bidiClass = {
+  L: 0,
+  R: 1,
+  AL: 2,
+  AN: 3,
+  EN: 4,
+  ES: 5,
+  CS: 6,
+  ET: 7,
+  ON: 8,
+  BN: 9,
+  NSM: 10
+}
+
+const bidiOther = 11
+
+const joiningType = {
+  U: 0,
+  D: 1,
+  L: 2,
+  R: 3,
+  T: 4,
+  C: 5
+}
+
+const hex = (n, width = 4) => '0x' + n.toString(16).padStart(width, '0')
+
+function * lines(file) {
+  const text = fs.readFileSync(path.join(data, file), 'utf8')
+
+  for (let line of text.split('\n')) {
+    const i = line.indexOf('#')
+    if (i !== -1) line = line.slice(0, i)
+
+    line = line.trim()
+    if (line === '') continue
+
+    yield line.split(';').map((field) => field.trim())
+  }
+}
+
+function parseRange(field) {
+  const [start, end = start] = field.split('..')
+
+  return [parseInt(start, 16), parseInt(end, 16)]
+}
+
+function parseCodePoints(field) {
+  return field === '' ? [] : field.split(/\s+/).map((cp) => parseInt(cp, 16))
+}
+
+// Properties of every code point, filled from the derived property files.
+const size = 0x110000
+
+const combiningClass = new Uint8Array(size)
+const bidi = new Uint8Array(size).fill(bidiClass.L)
+const joining = new Uint8Array(size).fill(joiningType.U)
+const mark = new Uint8Array(size)
+
+for (const [range, value] of lines('DerivedCombiningClass.txt')) {
+  const [start, end] = parseRange(range)
+
+  combiningClass.fill(parseInt(value, 10), start, end + 1)
+}
+
+for (const [range, value] of lines('DerivedBidiClass.txt')) {
+  const [start, end] = parseRange(range)
+
+  bidi.fill(value in bidiClass ? bidiClass[value] : bidiOther, start, end + 1)
+}
+
+for (const [range, value] of lines('DerivedJoiningType.txt')) {
+  const [start, end] = parseRange(range)
+
+  joining.fill(joiningType[value], start, end + 1)
+}
+
+for (const [range, value] of lines('DerivedGeneralCategory.txt')) {
+  const [start, end] = parseRange(range)
+
+  if (value[0] === 'M') mark.fill(1, start, end + 1)
+}
+
+// UTS #46 statuses, with UseSTD3ASCIIRules=false as required by the URL
+// Standard, which makes the STD3 statuses behave as their plain counterparts.
+const idna = []
+
+for (const [range, status, mapping = ''] of lines('IdnaMappingTable.txt')) {
+  const [start, end] = parseRange(range)
+
+  let value
+
+  switch (status) {
+    case 'valid':
+    case 'disallowed_STD3_valid':
+      value = { status: idnaStatus.valid, mapping: [] }
+      break
+    case 'mapped':
+    case 'disallowed_STD3_mapped':
+      value = { status: idnaStatus.mapped, mapping: parseCodePoints(mapping) }
+      break
+    case 'deviation':
+      value = { status: idnaStatus.deviation, mapping: [] }
+      break
+    case 'ignored':
+      value = { status: idnaStatus.ignored, mapping: [] }
+      break
+    case 'disallowed':
+      value = { status: idnaStatus.disallowed, mapping: [] }
+      break
+    default:
+      throw new Error('Unknown IDNA status ' + status)
+  }
+
+  const previous = idna[idna.length - 1]
+
+  // Collapsing the STD3 statuses leaves adjacent ranges that can be merged.
+  if (previous && previous.status === value.status && previous.mapping.length === 0 && value.mapping.length === 0) {
+    previous.end = end
+  } else {
+    idna.push({ start, end, ...value })
+  }
+}
+
+// Canonical decompositions, fully expanded, and the primary composites.
+const decomposition = new Map()
+
+for (const [cp, , , , , mapping] of lines('UnicodeData.txt')) {
+  if (mapping === '' || mapping[0] === '<') continue
+
+  decomposition.set(parseInt(cp, 16), parseCodePoints(mapping))
+}
+
+const exclusions = new Set()
+
+for (const [cp] of lines('CompositionExclusions.txt')) {
+  exclusions.add(parseInt(cp, 16))
+}
+
+function decompose(cp) {
+  const mapping = decomposition.get(cp)
+
+  return mapping === undefined ? [cp] : mapping.flatMap(decompose)
+}
+
+const decompositions = []
+const compositions = []
+
+for (const [cp, mapping] of decomposition) {
+  const full = decompose(cp)
+
+  if (full.length > 4) throw new Error('Decomposition of ' + hex(cp) + ' is too long')
+
+  decompositions.push([cp, full])
+
+  // Full_Composition_Exclusion also covers singletons and non-starter
+  // decompositions, which are derived rather than listed.
+  if (
+    mapping.length === 2 &&
+    !exclusions.has(cp) &&
+    combiningClass[cp] === 0 &&
+    combiningClass[mapping[0]] === 0
+  ) {
+    compositions.push([mapping[0], mapping[1], cp])
+  }
+}
+
+decompositions.sort((a, b) => a[0] - b[0])
+compositions.sort((a, b) => a[0] - b[0] || a[1] - b[1])
+
+// Two-stage lookup tables. The code points below the limit are split into
+// blocks of 1 << shift code points and identical blocks are stored once in
+// stage 2, with stage 1 holding the stage 2 index of each block. Values may
+// carry an offset into a data table, which is stored relative to the smallest
+// offset in its block so that blocks differing only in where their data lives
+// are still shared. That base offset sits next to the stage 2 index in stage
+// 1, so a lookup reads exactly one entry from each stage.
+//
+// Above the limit only the tag characters, variation selectors and private
+// use planes break up the unassigned code points, so those are kept as ranges.
+const limit = (() => {
+  let longest = idna[0]
+
+  for (const range of idna) {
+    if (range.end - range.start > longest.end - longest.start) longest = range
+  }
+
+  return (longest.start + 0x3ff) & ~0x3ff
+})()
+
+function trie(entry, offsetShift) {
+  let best = null
+
+  for (let shift = 4; shift <= 8; shift++) {
+    const blockSize = 1 << shift
+    const blocks = new Map()
+    const stage1 = []
+    const stage2 = []
+
+    for (let start = 0; start < limit; start += blockSize) {
+      const entries = []
+
+      for (let cp = start; cp < start + blockSize; cp++) entries.push(entry(cp))
+
+      let base = Infinity
+
+      for (const [value, offset] of entries) {
+        if (offset === -1) continue
+
+        if (value + offset * 2 ** offsetShift >= 2 ** 32) throw new Error('Offset does not fit the value')
+
+        if (offset < base) base = offset
+      }
+
+      if (base === Infinity) base = 0
+
+      const values = entries.map(([value, offset]) => {
+        return offset === -1 ? value : value + (offset - base) * 2 ** offsetShift
+      })
+
+      const key = values.join()
+
+      if (!blocks.has(key)) {
+        blocks.set(key, stage2.length)
+        stage2.push(...values)
+      }
+
+      if (stage2.length >= 0x10000 + blockSize || base >= 0x10000) throw new Error('Stage 1 entry out of range')
+
+      stage1.push(blocks.get(key) | base << 16)
+    }
+
+    const width = stage2.every((value) => value < 0x10000) ? 16 : 32
+    const bytes = stage1.length * 4 + stage2.length * width / 8
+
+    if (best === null || bytes < best.bytes) best = { shift, stage1, stage2, width, bytes }
+  }
+
+  const high = []
+
+  for (let cp = limit, previous = -1; cp < size; cp++) {
+    const [value, offset] = entry(cp)
+
+    const result = offset === -1 ? value : value + offset * 2 ** offsetShift
+
+    if (result === previous) continue
+
+    high.push([cp, result])
+
+    previous = result
+  }
+
+  best.high = high
+  best.bytes += high.length * 8
+
+  return best
+}
+
+// Primary composites in an open addressing hash table keyed by the pair, with
+// linear probing. Each slot packs the first and second code point and the
+// composite into 63 bits, and an empty slot is 0.
+function compositionHash(first, second, bits) {
+  let hash = Math.imul(first, 0x9e3779b1) ^ second
+
+  hash = Math.imul(hash ^ hash >>> 15, 0x85ebca6b)
+
+  return (hash ^ hash >>> 13) >>> (32 - bits)
+}
+
+// The table is grown until no lookup probes more than two cache lines of slots.
+function compositionTable() {
+  for (let bits = Math.ceil(Math.log2(compositions.length * 2)); ; bits++) {
+    const slots = new Array(1 << bits).fill(0n)
+
+    let probes = 0
+
+    for (const [first, second, composite] of compositions) {
+      let i = compositionHash(first, second, bits)
+      let n = 1
+
+      while (slots[i] !== 0n) i = (i + 1) & ((1 << bits) - 1), n++
+
+      slots[i] = BigInt(first) << 42n | BigInt(second) << 21n | BigInt(composite)
+
+      if (n > probes) probes = n
+    }
+
+    if (probes <= 16) return { bits, slots, probes, bytes: slots.length * 8 }
+  }
+}
+
+const mappings = []
+
+for (const range of idna) {
+  range.offset = mappings.length
+  mappings.push(...range.mapping)
+}
+
+const idnaValue = new Array(size)
+
+for (const range of idna) {
+  const value = range.mapping.length === 0
+    ? [range.status, -1]
+    : [range.status | range.mapping.length << 3, range.offset]
+
+  idnaValue.fill(value, range.start, range.end + 1)
+}
+
+const decompositionData = []
+const decompositionOffsets = new Map()
+
+for (const [cp, mapping] of decompositions) {
+  decompositionOffsets.set(cp, [mapping.length, decompositionData.length])
+  decompositionData.push(...mapping)
+}
+
+const idnaTrie = trie((cp) => idnaValue[cp], 8)
+
+const propertyTrie = trie((cp) => {
+  const value = combiningClass[cp] | bidi[cp] << 8 | joining[cp] << 12 | mark[cp] << 15
+
+  const decomposition = decompositionOffsets.get(cp)
+
+  if (decomposition === undefined) return [value, -1]
+
+  return [value | decomposition[0] << 16, decomposition[1]]
+}, 19)
+
+const compositionSlots = compositionTable()
+
+// Emit the tables.
+const out = []
+
+const table = (declaration, rows, perLine) => {
+  out.push(declaration + ' = {')
+
+  for (let i = 0; i < rows.length; i += perLine) {
+    out.push('  ' + rows.slice(i, i + perLine).join(', ') + ',')
+  }
+
+  out.push('};', '')
+}
+
+const kib = (bytes) => (bytes / 1024).toFixed(1) + ' KiB'
+
+const idnaBytes = idnaTrie.bytes + mappings.length * 4
+const propertyBytes = propertyTrie.bytes + decompositionData.length * 4
+
+out.push(
+  '// Generated by scripts/generate-unicode-tables.js from the Unicode ' + version + ' data',
+  '// in data/unicode. Do not edit.',
+  '//',
+  `//   UTS #46 statuses and mappings: ${kib(idnaBytes)}, blocks of ${1 << idnaTrie.shift}`,
+  `//   Properties and decompositions: ${kib(propertyBytes)}, blocks of ${1 << propertyTrie.shift}`,
+  `//   Compositions: ${kib(compositionSlots.bytes)}, at most ${compositionSlots.probes} probes`,
+  '',
+  '#define url__unicode_version "' + version + '"',
+  '',
+  '// Code points from here on are looked up in the range tables.',
+  '#define url__unicode_trie_limit ' + hex(limit, 6),
+  '',
+  '#define url__idna_trie_shift ' + idnaTrie.shift,
+  '#define url__unicode_property_trie_shift ' + propertyTrie.shift,
+  '#define url__unicode_composition_bits ' + compositionSlots.bits,
+  ''
+)
+
+const trieTables = (name, trie) => {
+  table(`static const uint32_t ${name}_trie_stage1[]`, trie.stage1.map((value) => hex(value >>> 0, 8)), 8)
+  table(`static const uint${trie.width}_t ${name}_trie_stage2[]`, trie.stage2.map((value) => hex(value, trie.width / 4)), 8)
+  table(`static const uint32_t ${name}_trie_high[][2]`, trie.high.map(([cp, value]) => `{${hex(cp, 6)}, ${hex(value, 8)}}`), 4)
+}
+
+out.push(
+  '// UTS #46 statuses, as the status, mapping length << 3 and mapping offset',
+  '// << 8. Stage 1 entries are the stage 2 index of the block and the base',
+  '// mapping offset of the block << 16.'
+)
+
+trieTables('url__idna', idnaTrie)
+
+table('static const uint32_t url__idna_mappings[]', mappings.map((cp) => hex(cp, 6)), 8)
+
+out.push(
+  '// Properties used by the UTS #46 validity criteria and normalization, as the',
+  '// canonical combining class, bidi class << 8, joining type << 12, mark << 15,',
+  '// decomposition length << 16 and decomposition offset << 19. Stage 1 entries',
+  '// are the stage 2 index of the block and the base decomposition offset of the',
+  '// block << 16.'
+)
+
+trieTables('url__unicode_property', propertyTrie)
+
+out.push(
+  '// Full canonical decompositions, excluding Hangul syllables.'
+)
+
+table('static const uint32_t url__unicode_decompositions[]', decompositionData.map((cp) => hex(cp, 6)), 8)
+
+out.push(
+  '// Primary composites, excluding Hangul syllables, as the first code point',
+  '// << 42, the second code point << 21 and the composite.'
+)
+
+table('static const uint64_t url__unicode_compositions[]', compositionSlots.slots.map((slot) => '0x' + slot.toString(16).padStart(16, '0')), 4)
+
+fs.writeFileSync(path.join(root, 'src', 'unicode-tables.h'), out.join('\n'))
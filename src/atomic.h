@@ -0,0 +1,62 @@
+#ifndef URL_ATOMIC_H
+#define URL_ATOMIC_H
+
+#if defined(_WIN32)
+#include <windows.h>
+
+typedef volatile LONG url__atomic_t;
+
+static inline void
+url__atomic_init (url__atomic_t *atomic, long value) {
+  *atomic = value;
+}
+
+static inline long
+url__atomic_load (url__atomic_t *atomic) {
+  return InterlockedCompareExchange(atomic, 0, 0);
+}
+
+static inline long
+url__atomic_increment (url__atomic_t *atomic) {
+  return InterlockedIncrement(atomic);
+}
+
+static inline long
+url__atomic_decrement (url__atomic_t *atomic) {
+  return InterlockedDecrement(atomic);
+}
+#else
+#include <stdatomic.h>
+
+typedef atomic_long url__atomic_t;
+
+static inline void
+url__atomic_init (url__atomic_t *atomic, long value) {
+  atomic_init(atomic, value);
+}
+
+static inline long
+url__atomic_load (url__atomic_t *atomic) {
+  return atomic_load_explicit(atomic, memory_order_acquire);
+}
+
+/**
+ * Increment and return the new value. Taking another reference needs no
+ * ordering, as the caller already holds one.
+ */
+static inline long
+url__atomic_increment (url__atomic_t *atomic) {
+  return atomic_fetch_add_explicit(atomic, 1, memory_order_relaxed) + 1;
+}
+
+/**
+ * Decrement and return the new value, ordering all prior accesses before the
+ * decrement such that whoever sees zero may safely free.
+ */
+static inline long
+url__atomic_decrement (url__atomic_t *atomic) {
+  return atomic_fetch_sub_explicit(atomic, 1, memory_order_acq_rel) - 1;
+}
+#endif
+
+#endif // URL_ATOMIC_H
@@ -0,0 +1,304 @@
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <utf.h>
+#include <utf/string.h>
+
+#include "../include/url.h"
+#include "../include/url/corpus.h"
+#include "mmap.h"
+
+#define url_corpus__version 1
+
+#define url_corpus__header_length 32
+#define url_corpus__record_length 48
+
+struct url_corpus_builder_s {
+  size_t count;
+
+  utf8_string_t records;
+  utf8_string_t hrefs;
+};
+
+struct url_corpus_s {
+  bool mapped;
+  url__mmap_t map;
+
+  size_t count;
+
+  const utf8_t *records;
+
+  const utf8_t *hrefs;
+  size_t hrefs_len;
+};
+
+static inline void
+url_corpus__write_16 (utf8_t *data, uint16_t value) {
+  data[0] = (utf8_t) value;
+  data[1] = (utf8_t) (value >> 8);
+}
+
+static inline void
+url_corpus__write_32 (utf8_t *data, uint32_t value) {
+  url_corpus__write_16(data, (uint16_t) value);
+  url_corpus__write_16(data + 2, (uint16_t) (value >> 16));
+}
+
+static inline void
+url_corpus__write_64 (utf8_t *data, uint64_t value) {
+  url_corpus__write_32(data, (uint32_t) value);
+  url_corpus__write_32(data + 4, (uint32_t) (value >> 32));
+}
+
+static inline uint32_t
+url_corpus__read_32 (const utf8_t *data) {
+  return (uint32_t) data[0] | (uint32_t) data[1] << 8 | (uint32_t) data[2] << 16 | (uint32_t) data[3] << 24;
+}
+
+static inline uint64_t
+url_corpus__read_64 (const utf8_t *data) {
+  return (uint64_t) url_corpus__read_32(data) | (uint64_t) url_corpus__read_32(data + 4) << 32;
+}
+
+static inline void
+url_corpus__write_header (url_corpus_builder_t *builder, utf8_t *data) {
+  memcpy(data, "URLC", 4);
+
+  url_corpus__write_32(data + 4, url_corpus__version);
+  url_corpus__write_64(data + 8, builder->count);
+  url_corpus__write_64(data + 16, url_corpus__header_length);
+  url_corpus__write_64(data + 24, url_corpus__header_length + builder->records.len);
+}
+
+int
+url_corpus_builder_init (url_corpus_builder_t **result) {
+  url_corpus_builder_t *builder = malloc(sizeof(url_corpus_builder_t));
+  if (builder == NULL) return -1;
+
+  builder->count = 0;
+
+  utf8_string_init(&builder->records);
+  utf8_string_init(&builder->hrefs);
+
+  *result = builder;
+
+  return 0;
+}
+
+void
+url_corpus_builder_destroy (url_corpus_builder_t *builder) {
+  utf8_string_destroy(&builder->records);
+  utf8_string_destroy(&builder->hrefs);
+
+  free(builder);
+}
+
+int
+url_corpus_builder_add (url_corpus_builder_t *builder, const url_t *url) {
+  int err;
+
+  if (url->href.len > UINT32_MAX) return -1;
+
+  err = utf8_string_reserve(&builder->records, builder->records.len + url_corpus__record_length);
+  if (err < 0) return err;
+
+  utf8_t *record = &builder->records.data[builder->records.len];
+
+  url_corpus__write_64(record, builder->hrefs.len);
+  url_corpus__write_32(record + 8, (uint32_t) url->href.len);
+
+  record[12] = (utf8_t) url->type;
+  record[13] = url->flags;
+
+  url_corpus__write_16(record + 14, 0);
+
+  url_corpus__write_32(record + 16, url->components.scheme_end);
+  url_corpus__write_32(record + 20, url->components.username_end);
+  url_corpus__write_32(record + 24, url->components.host_start);
+  url_corpus__write_32(record + 28, url->components.host_end);
+  url_corpus__write_32(record + 32, url->components.port);
+  url_corpus__write_32(record + 36, url->components.path_start);
+  url_corpus__write_32(record + 40, url->components.query_start);
+  url_corpus__write_32(record + 44, url->components.fragment_start);
+
+  err = utf8_string_append(&builder->hrefs, &url->href);
+  if (err < 0) return err;
+
+  builder->records.len += url_corpus__record_length;
+  builder->count++;
+
+  return 0;
+}
+
+int
+url_corpus_builder_add_input (url_corpus_builder_t *builder, const utf8_t *input, size_t len, const url_t *base) {
+  int err;
+
+  url_t url;
+  url_init(&url);
+
+  err = url_parse(&url, input, len, base);
+  if (err < 0) goto done;
+
+  err = url_corpus_builder_add(builder, &url);
+
+done:
+  url_destroy(&url);
+
+  return err;
+}
+
+int
+url_corpus_builder_serialize (url_corpus_builder_t *builder, utf8_string_t *result) {
+  int err;
+
+  err = utf8_string_reserve(result, result->len + url_corpus__header_length + builder->records.len + builder->hrefs.len);
+  if (err < 0) return err;
+
+  url_corpus__write_header(builder, &result->data[result->len]);
+
+  result->len += url_corpus__header_length;
+
+  err = utf8_string_append(result, &builder->records);
+  if (err < 0) return err;
+
+  return utf8_string_append(result, &builder->hrefs);
+}
+
+int
+url_corpus_builder_write (url_corpus_builder_t *builder, const char *path) {
+  FILE *file = fopen(path, "wb");
+  if (file == NULL) return -1;
+
+  utf8_t header[url_corpus__header_length];
+
+  url_corpus__write_header(builder, header);
+
+  if (
+    fwrite(header, 1, url_corpus__header_length, file) != url_corpus__header_length ||
+    fwrite(builder->records.data, 1, builder->records.len, file) != builder->records.len ||
+    fwrite(builder->hrefs.data, 1, builder->hrefs.len, file) != builder->hrefs.len
+  ) {
+    fclose(file);
+
+    return -1;
+  }
+
+  return fclose(file) == 0 ? 0 : -1;
+}
+
+static int
+url_corpus__init (url_corpus_t *corpus, const utf8_t *data, size_t len) {
+  if (len < url_corpus__header_length) return -1;
+
+  if (memcmp(data, "URLC", 4) != 0) return -1;
+
+  if (url_corpus__read_32(data + 4) != url_corpus__version) return -1;
+
+  uint64_t count = url_corpus__read_64(data + 8);
+  uint64_t records = url_corpus__read_64(data + 16);
+  uint64_t hrefs = url_corpus__read_64(data + 24);
+
+  if (records > len || count > (len - records) / url_corpus__record_length) return -1;
+
+  if (hrefs < records + count * url_corpus__record_length || hrefs > len) return -1;
+
+  corpus->count = (size_t) count;
+  corpus->records = data + records;
+  corpus->hrefs = data + hrefs;
+  corpus->hrefs_len = len - (size_t) hrefs;
+
+  return 0;
+}
+
+int
+url_corpus_init (const utf8_t *data, size_t len, url_corpus_t **result) {
+  url_corpus_t *corpus = malloc(sizeof(url_corpus_t));
+  if (corpus == NULL) return -1;
+
+  corpus->mapped = false;
+
+  if (url_corpus__init(corpus, data, len) < 0) {
+    free(corpus);
+
+    return -1;
+  }
+
+  *result = corpus;
+
+  return 0;
+}
+
+int
+url_corpus_open (const char *path, url_corpus_t **result) {
+  url_corpus_t *corpus = malloc(sizeof(url_corpus_t));
+  if (corpus == NULL) return -1;
+
+  if (url__mmap_open(path, &corpus->map) < 0) {
+    free(corpus);
+
+    return -1;
+  }
+
+  corpus->mapped = true;
+
+  if (url_corpus__init(corpus, corpus->map.data, corpus->map.len) < 0) {
+    url_corpus_close(corpus);
+
+    return -1;
+  }
+
+  *result = corpus;
+
+  return 0;
+}
+
+void
+url_corpus_close (url_corpus_t *corpus) {
+  if (corpus->mapped) url__mmap_close(&corpus->map);
+
+  free(corpus);
+}
+
+size_t
+url_corpus_size (const url_corpus_t *corpus) {
+  return corpus->count;
+}
+
+int
+url_corpus_get (const url_corpus_t *corpus, size_t index, url_t *result) {
+  if (index >= corpus->count) return -1;
+
+  const utf8_t *record = &corpus->records[index * url_corpus__record_length];
+
+  uint64_t offset = url_corpus__read_64(record);
+  uint32_t len = url_corpus__read_32(record + 8);
+
+  if (offset > corpus->hrefs_len || len > corpus->hrefs_len - offset) return -1;
+
+  result->type = (url_type_t) record[12];
+  result->flags = record[13];
+
+  result->components.scheme_end = url_corpus__read_32(record + 16);
+  result->components.username_end = url_corpus__read_32(record + 20);
+  result->components.host_start = url_corpus__read_32(record + 24);
+  result->components.host_end = url_corpus__read_32(record + 28);
+  result->components.port = url_corpus__read_32(record + 32);
+  result->components.path_start = url_corpus__read_32(record + 36);
+  result->components.query_start = url_corpus__read_32(record + 40);
+  result->components.fragment_start = url_corpus__read_32(record + 44);
+
+  utf8_string_init(&result->href);
+
+  result->href.data = (utf8_t *) &corpus->hrefs[offset];
+  result->href.len = len;
+
+  if (!url__has_valid_components(result)) return -1;
+
+  url__restore_host(result);
+
+  return 0;
+}
@@ -0,0 +1,318 @@
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <utf.h>
+#include <utf/string.h>
+
+#include "../include/url/hash.h"
+#include "../include/url/idna-cache.h"
+#include "mutex.h"
+#include "shard.h"
+
+#define url_idna_cache__shard_bits 4
+#define url_idna_cache__shard_count (1 << url_idna_cache__shard_bits)
+
+#define url_idna_cache__none UINT32_MAX
+
+typedef struct url_idna_cache__entry_s url_idna_cache__entry_t;
+typedef struct url_idna_cache__shard_s url_idna_cache__shard_t;
+
+struct url_idna_cache__entry_s {
+  /**
+   * The host followed by its ASCII serialization.
+   */
+  utf8_t *data;
+
+  uint32_t host_len;
+  uint32_t ascii_len;
+
+  /**
+   * The hash bits above the shard bits, which pick the bucket.
+   */
+  uint32_t hash;
+
+  /**
+   * The next entry in the same bucket, or `url_idna_cache__none`.
+   */
+  uint32_t next;
+
+  bool referenced;
+};
+
+struct url_idna_cache__shard_s {
+  url__mutex_t lock;
+
+  url_idna_cache__entry_t *entries;
+
+  size_t len;
+  size_t capacity;
+
+  uint32_t *buckets;
+  size_t bucket_mask;
+
+  size_t hand;
+
+  uint64_t hits;
+  uint64_t misses;
+};
+
+struct url_idna_cache_s {
+  url__aligned_shard(url_idna_cache__shard_t) shards[url_idna_cache__shard_count];
+};
+
+static inline url_idna_cache__shard_t *
+url_idna_cache__shard (url_idna_cache_t *cache, uint64_t hash) {
+  return &cache->shards[hash & (url_idna_cache__shard_count - 1)].shard;
+}
+
+static inline uint32_t
+url_idna_cache__hash (uint64_t hash) {
+  return (uint32_t) (hash >> url_idna_cache__shard_bits);
+}
+
+static inline uint32_t *
+url_idna_cache__bucket (url_idna_cache__shard_t *shard, uint32_t hash) {
+  return &shard->buckets[hash & shard->bucket_mask];
+}
+
+static url_idna_cache__entry_t *
+url_idna_cache__find (url_idna_cache__shard_t *shard, uint32_t hash, const utf8_string_view_t host) {
+  for (uint32_t i = *url_idna_cache__bucket(shard, hash); i != url_idna_cache__none;) {
+    url_idna_cache__entry_t *entry = &shard->entries[i];
+
+    if (entry->hash == hash && entry->host_len == host.len && memcmp(entry->data, host.data, host.len) == 0) {
+      return entry;
+    }
+
+    i = entry->next;
+  }
+
+  return NULL;
+}
+
+/**
+ * Pick the entry to overwrite, advancing the CLOCK hand past referenced
+ * entries, and unlink it from its bucket.
+ */
+static uint32_t
+url_idna_cache__evict (url_idna_cache__shard_t *shard) {
+  url_idna_cache__entry_t *entry;
+
+  for (;;) {
+    entry = &shard->entries[shard->hand];
+
+    if (!entry->referenced) break;
+
+    entry->referenced = false;
+
+    shard->hand = (shard->hand + 1) % shard->capacity;
+  }
+
+  uint32_t victim = (uint32_t) shard->hand;
+
+  shard->hand = (shard->hand + 1) % shard->capacity;
+
+  uint32_t *link = url_idna_cache__bucket(shard, entry->hash);
+
+  while (*link != victim) link = &shard->entries[*link].next;
+
+  *link = entry->next;
+
+  free(entry->data);
+
+  entry->data = NULL;
+
+  return victim;
+}
+
+int
+url_idna_cache_init (size_t capacity, url_idna_cache_t **result) {
+  url_idna_cache_t *cache = url__shards_alloc(sizeof(url_idna_cache_t));
+  if (cache == NULL) return -1;
+
+  size_t per_shard = (capacity + url_idna_cache__shard_count - 1) / url_idna_cache__shard_count;
+
+  if (per_shard == 0) per_shard = 1;
+
+  if (per_shard >= url_idna_cache__none) goto err;
+
+  size_t buckets = 1;
+
+  while (buckets < per_shard) buckets <<= 1;
+
+  for (size_t i = 0; i < url_idna_cache__shard_count; i++) {
+    url_idna_cache__shard_t *shard = &cache->shards[i].shard;
+
+    url__mutex_init(&shard->lock);
+
+    shard->capacity = per_shard;
+    shard->bucket_mask = buckets - 1;
+
+    shard->entries = calloc(per_shard, sizeof(url_idna_cache__entry_t));
+    shard->buckets = malloc(buckets * sizeof(uint32_t));
+
+    if (shard->entries == NULL || shard->buckets == NULL) goto err;
+
+    memset(shard->buckets, 0xff, buckets * sizeof(uint32_t));
+  }
+
+  *result = cache;
+
+  return 0;
+
+err:
+  url_idna_cache_destroy(cache);
+
+  return -1;
+}
+
+void
+url_idna_cache_destroy (url_idna_cache_t *cache) {
+  for (size_t i = 0; i < url_idna_cache__shard_count; i++) {
+    url_idna_cache__shard_t *shard = &cache->shards[i].shard;
+
+    if (shard->capacity == 0) continue;
+
+    if (shard->entries) {
+      for (size_t j = 0; j < shard->len; j++) {
+        free(shard->entries[j].data);
+      }
+    }
+
+    free(shard->entries);
+    free(shard->buckets);
+
+    url__mutex_destroy(&shard->lock);
+  }
+
+  url__shards_free(cache);
+}
+
+int
+url_idna_cache_get (url_idna_cache_t *cache, const utf8_string_view_t host, utf8_string_t *result) {
+  int err;
+
+  uint64_t hash = url__hash(host.data, host.len);
+
+  url_idna_cache__shard_t *shard = url_idna_cache__shard(cache, hash);
+
+  url__mutex_lock(&shard->lock);
+
+  url_idna_cache__entry_t *entry = url_idna_cache__find(shard, url_idna_cache__hash(hash), host);
+
+  if (entry == NULL) {
+    shard->misses++;
+
+    url__mutex_unlock(&shard->lock);
+
+    return 0;
+  }
+
+  shard->hits++;
+
+  entry->referenced = true;
+
+  // Copy while still holding the lock, as the entry may be evicted as soon
+  // as it is released.
+  err = utf8_string_append_view(result, utf8_string_view_init(&entry->data[entry->host_len], entry->ascii_len));
+
+  url__mutex_unlock(&shard->lock);
+
+  return err < 0 ? err : 1;
+}
+
+int
+url_idna_cache_put (url_idna_cache_t *cache, const utf8_string_view_t host, const utf8_string_view_t ascii) {
+  if (host.len > UINT32_MAX || ascii.len > UINT32_MAX) return -1;
+
+  uint64_t hash = url__hash(host.data, host.len);
+
+  url_idna_cache__shard_t *shard = url_idna_cache__shard(cache, hash);
+
+  uint32_t entry_hash = url_idna_cache__hash(hash);
+
+  utf8_t *data = malloc(host.len + ascii.len);
+  if (data == NULL) return -1;
+
+  memcpy(data, host.data, host.len);
+  memcpy(&data[host.len], ascii.data, ascii.len);
+
+  url__mutex_lock(&shard->lock);
+
+  if (url_idna_cache__find(shard, entry_hash, host)) {
+    url__mutex_unlock(&shard->lock);
+
+    free(data);
+
+    return 0;
+  }
+
+  uint32_t i;
+
+  if (shard->len < shard->capacity) i = (uint32_t) shard->len++;
+  else i = url_idna_cache__evict(shard);
+
+  url_idna_cache__entry_t *entry = &shard->entries[i];
+
+  uint32_t *bucket = url_idna_cache__bucket(shard, entry_hash);
+
+  entry->data = data;
+  entry->host_len = (uint32_t) host.len;
+  entry->ascii_len = (uint32_t) ascii.len;
+  entry->hash = entry_hash;
+  entry->next = *bucket;
+  entry->referenced = false;
+
+  *bucket = i;
+
+  url__mutex_unlock(&shard->lock);
+
+  return 1;
+}
+
+size_t
+url_idna_cache_size (url_idna_cache_t *cache) {
+  size_t size = 0;
+
+  for (size_t i = 0; i < url_idna_cache__shard_count; i++) {
+    url_idna_cache__shard_t *shard = &cache->shards[i].shard;
+
+    url__mutex_lock(&shard->lock);
+    size += shard->len;
+    url__mutex_unlock(&shard->lock);
+  }
+
+  return size;
+}
+
+uint64_t
+url_idna_cache_hits (url_idna_cache_t *cache) {
+  uint64_t hits = 0;
+
+  for (size_t i = 0; i < url_idna_cache__shard_count; i++) {
+    url_idna_cache__shard_t *shard = &cache->shards[i].shard;
+
+    url__mutex_lock(&shard->lock);
+    hits += shard->hits;
+    url__mutex_unlock(&shard->lock);
+  }
+
+  return hits;
+}
+
+uint64_t
+url_idna_cache_misses (url_idna_cache_t *cache) {
+  uint64_t misses = 0;
+
+  for (size_t i = 0; i < url_idna_cache__shard_count; i++) {
+    url_idna_cache__shard_t *shard = &cache->shards[i].shard;
+
+    url__mutex_lock(&shard->lock);
+    misses += shard->misses;
+    url__mutex_unlock(&shard->lock);
+  }
+
+  return misses;
+}
@@ -0,0 +1,108 @@
+#ifndef URL_MMAP_H
+#define URL_MMAP_H
+
+#include <stddef.h>
+#include <utf.h>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+typedef struct {
+  const utf8_t *data;
+  size_t len;
+
+#if defined(_WIN32)
+  HANDLE file;
+  HANDLE mapping;
+#endif
+} url__mmap_t;
+
+static inline int
+url__mmap_open (const char *path, url__mmap_t *result) {
+  result->data = NULL;
+  result->len = 0;
+
+#if defined(_WIN32)
+  HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+  if (file == INVALID_HANDLE_VALUE) return -1;
+
+  LARGE_INTEGER size;
+
+  if (!GetFileSizeEx(file, &size)) goto err;
+
+  result->file = file;
+  result->mapping = NULL;
+
+  if (size.QuadPart == 0) return 0;
+
+  HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+  if (mapping == NULL) goto err;
+
+  const utf8_t *data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+
+  if (data == NULL) {
+    CloseHandle(mapping);
+    goto err;
+  }
+
+  result->mapping = mapping;
+  result->data = data;
+  result->len = (size_t) size.QuadPart;
+
+  return 0;
+
+err:
+  CloseHandle(file);
+
+  return -1;
+#else
+  int fd = open(path, O_RDONLY);
+  if (fd == -1) return -1;
+
+  struct stat st;
+
+  if (fstat(fd, &st) == -1) goto err;
+
+  if (st.st_size == 0) {
+    close(fd);
+
+    return 0;
+  }
+
+  void *data = mmap(NULL, (size_t) st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+  if (data == MAP_FAILED) goto err;
+
+  // The mapping stays valid after the descriptor is closed.
+  close(fd);
+
+  result->data = data;
+  result->len = (size_t) st.st_size;
+
+  return 0;
+
+err:
+  close(fd);
+
+  return -1;
+#endif
+}
+
+static inline void
+url__mmap_close (url__mmap_t *map) {
+#if defined(_WIN32)
+  if (map->data) UnmapViewOfFile(map->data);
+  if (map->mapping) CloseHandle(map->mapping);
+
+  CloseHandle(map->file);
+#else
+  if (map->data) munmap((void *) map->data, map->len);
+#endif
+}
+
+#endif // URL_MMAP_H
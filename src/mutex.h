@@ -0,0 +1,52 @@
+#ifndef URL_MUTEX_H
+#define URL_MUTEX_H
+
+#if defined(_WIN32)
+#include <windows.h>
+
+typedef SRWLOCK url__mutex_t;
+
+static inline void
+url__mutex_init (url__mutex_t *mutex) {
+  InitializeSRWLock(mutex);
+}
+
+static inline void
+url__mutex_destroy (url__mutex_t *mutex) {}
+
+static inline void
+url__mutex_lock (url__mutex_t *mutex) {
+  AcquireSRWLockExclusive(mutex);
+}
+
+static inline void
+url__mutex_unlock (url__mutex_t *mutex) {
+  ReleaseSRWLockExclusive(mutex);
+}
+#else
+#include <pthread.h>
+
+typedef pthread_mutex_t url__mutex_t;
+
+static inline void
+url__mutex_init (url__mutex_t *mutex) {
+  pthread_mutex_init(mutex, NULL);
+}
+
+static inline void
+url__mutex_destroy (url__mutex_t *mutex) {
+  pthread_mutex_destroy(mutex);
+}
+
+static inline void
+url__mutex_lock (url__mutex_t *mutex) {
+  pthread_mutex_lock(mutex);
+}
+
+static inline void
+url__mutex_unlock (url__mutex_t *mutex) {
+  pthread_mutex_unlock(mutex);
+}
+#endif
+
+#endif // URL_MUTEX_H
@@ -0,0 +1,604 @@
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <utf.h>
+#include <utf/string.h>
+
+#include "../include/url.h"
+#include "../include/url/idna.h"
+#include "../include/url/psl.h"
+#include "mmap.h"
+
+#define url_psl__version 1
+
+#define url_psl__header_length 32
+#define url_psl__node_length   12
+
+enum {
+  url_psl__rule = 0x1,
+  url_psl__wildcard = 0x2,
+  url_psl__exception = 0x4,
+};
+
+typedef struct url_psl__entry_s url_psl__entry_t;
+
+struct url_psl__entry_s {
+  utf8_t *label;
+  size_t len;
+
+  uint8_t flags;
+
+  url_psl__entry_t **children;
+  size_t children_len;
+  size_t children_capacity;
+};
+
+struct url_psl_builder_s {
+  url_psl__entry_t root;
+
+  size_t count;
+  size_t labels_len;
+};
+
+struct url_psl_s {
+  bool mapped;
+  url__mmap_t map;
+
+  size_t count;
+
+  const utf8_t *nodes;
+
+  const utf8_t *labels;
+  size_t labels_len;
+};
+
+static inline void
+url_psl__write_16 (utf8_t *data, uint16_t value) {
+  data[0] = (utf8_t) value;
+  data[1] = (utf8_t) (value >> 8);
+}
+
+static inline void
+url_psl__write_32 (utf8_t *data, uint32_t value) {
+  url_psl__write_16(data, (uint16_t) value);
+  url_psl__write_16(data + 2, (uint16_t) (value >> 16));
+}
+
+static inline void
+url_psl__write_64 (utf8_t *data, uint64_t value) {
+  url_psl__write_32(data, (uint32_t) value);
+  url_psl__write_32(data + 4, (uint32_t) (value >> 32));
+}
+
+static inline uint16_t
+url_psl__read_16 (const utf8_t *data) {
+  return (uint16_t) (data[0] | data[1] << 8);
+}
+
+static inline uint32_t
+url_psl__read_32 (const utf8_t *data) {
+  return (uint32_t) data[0] | (uint32_t) data[1] << 8 | (uint32_t) data[2] << 16 | (uint32_t) data[3] << 24;
+}
+
+static inline uint64_t
+url_psl__read_64 (const utf8_t *data) {
+  return (uint64_t) url_psl__read_32(data) | (uint64_t) url_psl__read_32(data + 4) << 32;
+}
+
+static inline int
+url_psl__compare (const utf8_t *a, size_t a_len, const utf8_t *b, size_t b_len) {
+  int order = memcmp(a, b, a_len < b_len ? a_len : b_len);
+
+  if (order != 0) return order;
+
+  return a_len < b_len ? -1 : a_len > b_len ? 1 : 0;
+}
+
+static void
+url_psl__entry_destroy (url_psl__entry_t *entry) {
+  for (size_t i = 0; i < entry->children_len; i++) {
+    url_psl__entry_destroy(entry->children[i]);
+
+    free(entry->children[i]);
+  }
+
+  free(entry->children);
+  free(entry->label);
+}
+
+/**
+ * Find the child of `entry` labelled `label`, inserting it in sorted order if
+ * there is none.
+ */
+static url_psl__entry_t *
+url_psl__entry_child (url_psl_builder_t *builder, url_psl__entry_t *entry, const utf8_t *label, size_t len) {
+  size_t low = 0, high = entry->children_len;
+
+  while (low < high) {
+    size_t mid = low + (high - low) / 2;
+
+    url_psl__entry_t *child = entry->children[mid];
+
+    int order = url_psl__compare(child->label, child->len, label, len);
+
+    if (order == 0) return child;
+
+    if (order < 0) low = mid + 1;
+    else high = mid;
+  }
+
+  if (entry->children_len == UINT16_MAX) return NULL;
+
+  if (entry->children_len == entry->children_capacity) {
+    size_t capacity = entry->children_capacity == 0 ? 4 : entry->children_capacity * 2;
+
+    url_psl__entry_t **children = realloc(entry->children, capacity * sizeof(url_psl__entry_t *));
+    if (children == NULL) return NULL;
+
+    entry->children = children;
+    entry->children_capacity = capacity;
+  }
+
+  url_psl__entry_t *child = calloc(1, sizeof(url_psl__entry_t));
+  if (child == NULL) return NULL;
+
+  child->label = malloc(len);
+
+  if (child->label == NULL) {
+    free(child);
+
+    return NULL;
+  }
+
+  memcpy(child->label, label, len);
+
+  child->len = len;
+
+  memmove(&entry->children[low + 1], &entry->children[low], (entry->children_len - low) * sizeof(url_psl__entry_t *));
+
+  entry->children[low] = child;
+  entry->children_len++;
+
+  builder->count++;
+  builder->labels_len += len;
+
+  return child;
+}
+
+int
+url_psl_builder_init (url_psl_builder_t **result) {
+  url_psl_builder_t *builder = calloc(1, sizeof(url_psl_builder_t));
+  if (builder == NULL) return -1;
+
+  builder->count = 1;
+
+  *result = builder;
+
+  return 0;
+}
+
+void
+url_psl_builder_destroy (url_psl_builder_t *builder) {
+  url_psl__entry_destroy(&builder->root);
+
+  free(builder);
+}
+
+// https://github.com/publicsuffix/list/wiki/Format#definitions
+int
+url_psl_builder_add_rule (url_psl_builder_t *builder, const utf8_t *rule, size_t len) {
+  int err;
+
+  uint8_t flag = url_psl__rule;
+
+  if (len > 0 && rule[0] == 0x21) {
+    flag = url_psl__exception;
+
+    rule++;
+    len--;
+  } else if (len > 0 && rule[0] == 0x2a) {
+    flag = url_psl__wildcard;
+
+    rule++;
+    len--;
+
+    if (len > 0) {
+      if (rule[0] != 0x2e) return -1;
+
+      rule++;
+      len--;
+    }
+  }
+
+  if (len == 0 && flag != url_psl__wildcard) return -1;
+
+  utf8_string_t domain;
+  utf8_string_init(&domain);
+
+  err = utf8_string_reserve(&domain, len);
+  if (err < 0) goto err;
+
+  if (url__idna_ascii_lowercase(rule, len, domain.data)) {
+    domain.len = len;
+  } else {
+    err = url__idna_to_ascii(utf8_string_view_init(rule, len), &domain);
+    if (err < 0) goto err;
+  }
+
+  url_psl__entry_t *entry = &builder->root;
+
+  for (size_t end = domain.len; end > 0;) {
+    size_t start = end;
+
+    while (start > 0 && domain.data[start - 1] != 0x2e) start--;
+
+    size_t label_len = end - start;
+
+    if (label_len == 0 || label_len > UINT8_MAX) goto err;
+
+    entry = url_psl__entry_child(builder, entry, &domain.data[start], label_len);
+    if (entry == NULL) goto err;
+
+    if (start == 0) break;
+
+    end = start - 1;
+
+    if (end == 0) goto err;
+  }
+
+  entry->flags |= flag;
+
+  utf8_string_destroy(&domain);
+
+  return 0;
+
+err:
+  utf8_string_destroy(&domain);
+
+  return -1;
+}
+
+int
+url_psl_builder_add_list (url_psl_builder_t *builder, const utf8_t *input, size_t len) {
+  int err;
+
+  for (size_t i = 0; i < len;) {
+    size_t end = i;
+
+    while (end < len && input[end] != 0xa) end++;
+
+    size_t start = i;
+
+    while (start < end && (input[start] == 0x20 || input[start] == 0x9)) start++;
+
+    size_t rule_end = start;
+
+    while (rule_end < end && input[rule_end] != 0x20 && input[rule_end] != 0x9 && input[rule_end] != 0xd) rule_end++;
+
+    bool is_comment = rule_end - start >= 2 && input[start] == 0x2f && input[start + 1] == 0x2f;
+
+    if (rule_end > start && !is_comment) {
+      err = url_psl_builder_add_rule(builder, &input[start], rule_end - start);
+      if (err < 0) return err;
+    }
+
+    i = end + 1;
+  }
+
+  return 0;
+}
+
+int
+url_psl_builder_add_file (url_psl_builder_t *builder, const char *path) {
+  int err;
+
+  url__mmap_t map;
+
+  err = url__mmap_open(path, &map);
+  if (err < 0) return err;
+
+  err = url_psl_builder_add_list(builder, map.data, map.len);
+
+  url__mmap_close(&map);
+
+  return err;
+}
+
+static inline size_t
+url_psl__length (url_psl_builder_t *builder) {
+  return url_psl__header_length + builder->count * url_psl__node_length + builder->labels_len;
+}
+
+/**
+ * Write the compiled list to `data`, which must have room for
+ * `url_psl__length()` bytes. Nodes are numbered breadth first, which keeps
+ * the children of each node consecutive.
+ */
+static int
+url_psl__write (url_psl_builder_t *builder, utf8_t *data) {
+  if (builder->count > UINT32_MAX || builder->labels_len > UINT32_MAX) return -1;
+
+  url_psl__entry_t **queue = malloc(builder->count * sizeof(url_psl__entry_t *));
+  if (queue == NULL) return -1;
+
+  size_t nodes = url_psl__header_length;
+  size_t labels = nodes + builder->count * url_psl__node_length;
+
+  memcpy(data, "URLP", 4);
+
+  url_psl__write_32(data + 4, url_psl__version);
+  url_psl__write_64(data + 8, builder->count);
+  url_psl__write_64(data + 16, nodes);
+  url_psl__write_64(data + 24, labels);
+
+  size_t tail = 0, label_offset = 0;
+
+  queue[tail++] = &builder->root;
+
+  for (size_t i = 0; i < tail; i++) {
+    url_psl__entry_t *entry = queue[i];
+
+    utf8_t *node = &data[nodes + i * url_psl__node_length];
+
+    url_psl__write_32(node, (uint32_t) label_offset);
+    url_psl__write_32(node + 4, (uint32_t) tail);
+    url_psl__write_16(node + 8, (uint16_t) entry->children_len);
+
+    node[10] = (utf8_t) entry->len;
+    node[11] = entry->flags;
+
+    if (entry->len > 0) memcpy(&data[labels + label_offset], entry->label, entry->len);
+
+    label_offset += entry->len;
+
+    for (size_t j = 0; j < entry->children_len; j++) {
+      queue[tail++] = entry->children[j];
+    }
+  }
+
+  free(queue);
+
+  return 0;
+}
+
+int
+url_psl_builder_serialize (url_psl_builder_t *builder, utf8_string_t *result) {
+  int err;
+
+  size_t len = url_psl__length(builder);
+
+  err = utf8_string_reserve(result, result->len + len);
+  if (err < 0) return err;
+
+  err = url_psl__write(builder, &result->data[result->len]);
+  if (err < 0) return err;
+
+  result->len += len;
+
+  return 0;
+}
+
+int
+url_psl_builder_write (url_psl_builder_t *builder, const char *path) {
+  int err;
+
+  utf8_string_t data;
+  utf8_string_init(&data);
+
+  err = url_psl_builder_serialize(builder, &data);
+  if (err < 0) goto done;
+
+  FILE *file = fopen(path, "wb");
+
+  if (file == NULL) {
+    err = -1;
+    goto done;
+  }
+
+  if (fwrite(data.data, 1, data.len, file) != data.len) {
+    fclose(file);
+
+    err = -1;
+    goto done;
+  }
+
+  err = fclose(file) == 0 ? 0 : -1;
+
+done:
+  utf8_string_destroy(&data);
+
+  return err;
+}
+
+static int
+url_psl__init (url_psl_t *psl, const utf8_t *data, size_t len) {
+  if (len < url_psl__header_length) return -1;
+
+  if (memcmp(data, "URLP", 4) != 0) return -1;
+
+  if (url_psl__read_32(data + 4) != url_psl__version) return -1;
+
+  uint64_t count = url_psl__read_64(data + 8);
+  uint64_t nodes = url_psl__read_64(data + 16);
+  uint64_t labels = url_psl__read_64(data + 24);
+
+  if (nodes > len || count == 0 || count > (len - nodes) / url_psl__node_length) return -1;
+
+  if (labels < nodes + count * url_psl__node_length || labels > len) return -1;
+
+  psl->count = (size_t) count;
+  psl->nodes = data + nodes;
+  psl->labels = data + labels;
+  psl->labels_len = len - (size_t) labels;
+
+  // Check every node once up front so that lookups can trust the offsets.
+  // Children always follow their parent, which rules out cycles.
+  for (size_t i = 0; i < psl->count; i++) {
+    const utf8_t *node = &psl->nodes[i * url_psl__node_length];
+
+    uint32_t label_offset = url_psl__read_32(node);
+    uint32_t first_child = url_psl__read_32(node + 4);
+    uint16_t children = url_psl__read_16(node + 8);
+
+    if (label_offset > psl->labels_len || node[10] > psl->labels_len - label_offset) return -1;
+
+    if (children > 0 && (first_child <= i || children > psl->count || first_child > psl->count - children)) return -1;
+  }
+
+  return 0;
+}
+
+int
+url_psl_init (const utf8_t *data, size_t len, url_psl_t **result) {
+  url_psl_t *psl = malloc(sizeof(url_psl_t));
+  if (psl == NULL) return -1;
+
+  psl->mapped = false;
+
+  if (url_psl__init(psl, data, len) < 0) {
+    free(psl);
+
+    return -1;
+  }
+
+  *result = psl;
+
+  return 0;
+}
+
+int
+url_psl_open (const char *path, url_psl_t **result) {
+  url_psl_t *psl = malloc(sizeof(url_psl_t));
+  if (psl == NULL) return -1;
+
+  if (url__mmap_open(path, &psl->map) < 0) {
+    free(psl);
+
+    return -1;
+  }
+
+  psl->mapped = true;
+
+  if (url_psl__init(psl, psl->map.data, psl->map.len) < 0) {
+    url_psl_close(psl);
+
+    return -1;
+  }
+
+  *result = psl;
+
+  return 0;
+}
+
+void
+url_psl_close (url_psl_t *psl) {
+  if (psl->mapped) url__mmap_close(&psl->map);
+
+  free(psl);
+}
+
+static inline const utf8_t *
+url_psl__child (const url_psl_t *psl, const utf8_t *node, const utf8_t *label, size_t len) {
+  size_t low = url_psl__read_32(node + 4);
+  size_t high = low + url_psl__read_16(node + 8);
+
+  while (low < high) {
+    size_t mid = low + (high - low) / 2;
+
+    const utf8_t *child = &psl->nodes[mid * url_psl__node_length];
+
+    int order = url_psl__compare(&psl->labels[url_psl__read_32(child)], child[10], label, len);
+
+    if (order == 0) return child;
+
+    if (order < 0) low = mid + 1;
+    else high = mid;
+  }
+
+  return NULL;
+}
+
+// https://github.com/publicsuffix/list/wiki/Format#algorithm
+int
+url_psl_lookup (const url_psl_t *psl, const utf8_string_view_t host, utf8_string_view_t *suffix, utf8_string_view_t *registrable_domain) {
+  if (host.len == 0 || host.data[0] == 0x5b) return -1;
+
+  // A trailing dot is kept in the results but not matched against the rules.
+  size_t end = host.len;
+
+  if (host.data[end - 1] == 0x2e) end--;
+
+  if (end == 0) return -1;
+
+  const utf8_t *node = psl->nodes;
+
+  // Start from the implicit "*" rule, which makes the last label the suffix.
+  // The host is serialized, so it is an IPv4 address rather than a domain if
+  // that label is a number.
+  size_t start = end;
+
+  bool is_decimal = true;
+
+  while (start > 0 && host.data[start - 1] != 0x2e) {
+    utf8_t c = host.data[--start];
+
+    if (!url__is_ascii_digit(c)) is_decimal = false;
+  }
+
+  if (is_decimal) return -1;
+
+  if (end - start >= 2 && host.data[start] == 0x30 && (host.data[start + 1] | 0x20) == 0x78) {
+    bool is_hex_number = true;
+
+    for (size_t i = start + 2; i < end; i++) {
+      if (!url__is_ascii_hex_digit(host.data[i])) is_hex_number = false;
+    }
+
+    if (is_hex_number) return -1;
+  }
+
+  size_t suffix_start = start;
+
+  for (size_t label_end = end;;) {
+    size_t label_start = label_end;
+
+    while (label_start > 0 && host.data[label_start - 1] != 0x2e) label_start--;
+
+    if (node[11] & url_psl__wildcard) suffix_start = label_start;
+
+    const utf8_t *child = url_psl__child(psl, node, &host.data[label_start], label_end - label_start);
+
+    if (child == NULL) break;
+
+    // Exception rules take priority over all others, and make the suffix the
+    // rule without its leftmost label.
+    if ((child[11] & url_psl__exception) && label_end < end) {
+      suffix_start = label_end + 1;
+      break;
+    }
+
+    if (child[11] & url_psl__rule) suffix_start = label_start;
+
+    if (label_start == 0) break;
+
+    node = child;
+    label_end = label_start - 1;
+  }
+
+  *suffix = utf8_string_view_substring(host, suffix_start, host.len);
+
+  if (suffix_start < 2) {
+    *registrable_domain = utf8_string_view_substring(host, host.len, host.len);
+  } else {
+    size_t registrable_start = suffix_start - 1;
+
+    while (registrable_start > 0 && host.data[registrable_start - 1] != 0x2e) registrable_start--;
+
+    *registrable_domain = utf8_string_view_substring(host, registrable_start, host.len);
+  }
+
+  return 0;
+}
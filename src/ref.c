@@ -0,0 +1,140 @@
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <utf.h>
+#include <utf/string.h>
+
+#include "../include/url.h"
+#include "../include/url/ref.h"
+#include "atomic.h"
+
+struct url_ref_s {
+  url__atomic_t refs;
+
+  /**
+   * The URL, with an href pointing at the start of the allocation.
+   */
+  url_t url;
+};
+
+/**
+ * The offset of the header from the start of an allocation holding an href
+ * of `len` bytes and its NULL terminator.
+ */
+static inline size_t
+url_ref__offset (size_t len) {
+  size_t align = _Alignof(url_ref_t);
+
+  return (len + 1 + align - 1) & ~(align - 1);
+}
+
+static inline url_ref_t *
+url_ref__init (const url_t *url, utf8_t *data) {
+  size_t len = url->href.len;
+
+  data[len] = 0;
+
+  url_ref_t *ref = (url_ref_t *) &data[url_ref__offset(len)];
+
+  url__atomic_init(&ref->refs, 1);
+
+  ref->url = *url;
+  ref->url.href.data = data;
+  ref->url.href.len = len;
+  ref->url.href.cap = len + 1;
+
+  return ref;
+}
+
+int
+url_ref_init (const url_t *url, url_ref_t **result) {
+  size_t len = url->href.len;
+
+  utf8_t *data = malloc(url_ref__offset(len) + sizeof(url_ref_t));
+  if (data == NULL) return -1;
+
+  if (len) memcpy(data, url->href.data, len);
+
+  *result = url_ref__init(url, data);
+
+  return 0;
+}
+
+int
+url_ref_move (url_t *url, url_ref_t **result) {
+  size_t len = url->href.len;
+
+  // Shrinking or slightly growing the href is usually done in place.
+  utf8_t *data = realloc(url->href.data, url_ref__offset(len) + sizeof(url_ref_t));
+  if (data == NULL) return -1;
+
+  *result = url_ref__init(url, data);
+
+  url_init(url);
+
+  return 0;
+}
+
+url_ref_t *
+url_ref_retain (url_ref_t *ref) {
+  url__atomic_increment(&ref->refs);
+
+  return ref;
+}
+
+void
+url_ref_release (url_ref_t *ref) {
+  if (url__atomic_decrement(&ref->refs) == 0) free(ref->url.href.data);
+}
+
+const url_t *
+url_ref_get (const url_ref_t *ref) {
+  return &ref->url;
+}
+
+size_t
+url_ref_count (const url_ref_t *ref) {
+  return (size_t) url__atomic_load((url__atomic_t *) &ref->refs);
+}
+
+int
+url_ref_clone (const url_ref_t *ref, url_t *result) {
+  size_t len = ref->url.href.len;
+
+  utf8_t *data = malloc(len + 1);
+  if (data == NULL) return -1;
+
+  memcpy(data, ref->url.href.data, len + 1);
+
+  *result = ref->url;
+
+  result->href.data = data;
+  result->href.len = len;
+  result->href.cap = len + 1;
+
+  return 0;
+}
+
+int
+url_ref_unshare (url_ref_t *ref, url_t *result) {
+  int err;
+
+  // Holding the only reference, no other thread can take another, so the
+  // href can be handed over as is, header and all.
+  if (url__atomic_load(&ref->refs) == 1) {
+    size_t cap = url_ref__offset(ref->url.href.len) + sizeof(url_ref_t);
+
+    *result = ref->url;
+
+    result->href.cap = cap;
+
+    return 0;
+  }
+
+  err = url_ref_clone(ref, result);
+  if (err < 0) return err;
+
+  url_ref_release(ref);
+
+  return 0;
+}
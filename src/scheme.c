@@ -0,0 +1,285 @@
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <utf.h>
+#include <utf/string.h>
+
+#include "../include/url.h"
+#include "../include/url/scheme.h"
+
+#define url_scheme__max_displacement (1 << 20)
+
+struct url_scheme_registry_s {
+  url_scheme_t **schemes;
+  size_t len;
+  size_t capacity;
+
+  /**
+   * A minimal perfect hash over the registered schemes: the hash of a scheme
+   * picks a bucket, and the displacement of the bucket picks the slot.
+   */
+  uint32_t *displacements;
+  size_t buckets;
+
+  url_scheme_t **slots;
+};
+
+// https://url.spec.whatwg.org/#special-scheme
+static const url_scheme_t url_scheme__special[] = {
+  [url_type_http] = {(const utf8_t *) "http", 4, url_type_http, 80, NULL},
+  [url_type_https] = {(const utf8_t *) "https", 5, url_type_https, 443, NULL},
+  [url_type_ws] = {(const utf8_t *) "ws", 2, url_type_ws, 80, NULL},
+  [url_type_wss] = {(const utf8_t *) "wss", 3, url_type_wss, 443, NULL},
+  [url_type_ftp] = {(const utf8_t *) "ftp", 3, url_type_ftp, 21, NULL},
+  [url_type_file] = {(const utf8_t *) "file", 4, url_type_file, -1, NULL},
+};
+
+static inline utf8_t
+url_scheme__lowercase (utf8_t c) {
+  return url__is_ascii_upper_alpha(c) ? c | 0x20 : c;
+}
+
+static inline uint32_t
+url_scheme__hash (const utf8_t *data, size_t len) {
+  uint32_t h = 0x811c9dc5;
+
+  for (size_t i = 0; i < len; i++) {
+    h = (h ^ url_scheme__lowercase(data[i])) * 0x01000193;
+  }
+
+  return h;
+}
+
+static inline uint32_t
+url_scheme__mix (uint32_t h, uint32_t seed) {
+  h ^= seed * 0x9e3779b9;
+
+  h ^= h >> 16;
+  h *= 0x85ebca6b;
+  h ^= h >> 13;
+  h *= 0xc2b2ae35;
+  h ^= h >> 16;
+
+  return h;
+}
+
+static inline bool
+url_scheme__equal (const url_scheme_t *scheme, const utf8_t *data, size_t len) {
+  if (scheme->len != len) return false;
+
+  for (size_t i = 0; i < len; i++) {
+    if (scheme->name[i] != url_scheme__lowercase(data[i])) return false;
+  }
+
+  return true;
+}
+
+// https://url.spec.whatwg.org/#url-scheme-string
+static inline bool
+url_scheme__is_valid (const utf8_t *data, size_t len) {
+  if (len == 0 || !url__is_ascii_alpha(data[0])) return false;
+
+  for (size_t i = 1; i < len; i++) {
+    utf8_t c = data[i];
+
+    if (!url__is_ascii_alphanumeric(c) && c != 0x2b && c != 0x2d && c != 0x2e) return false;
+  }
+
+  return true;
+}
+
+/**
+ * Rebuild the minimal perfect hash over the registered schemes using hash and
+ * displace: buckets are placed largest first, each trying displacements until
+ * all of its schemes land in free slots.
+ */
+static int
+url_scheme__build (url_scheme_registry_t *registry) {
+  size_t len = registry->len;
+  size_t buckets = len / 2 + 1;
+
+  uint32_t *displacements = calloc(buckets, sizeof(uint32_t));
+  url_scheme_t **slots = calloc(len, sizeof(url_scheme_t *));
+
+  uint32_t *hashes = malloc(len * sizeof(uint32_t));
+  size_t *starts = calloc(buckets + 1, sizeof(size_t));
+  size_t *members = malloc(len * sizeof(size_t));
+  size_t *placed = malloc(len * sizeof(size_t));
+
+  if (!displacements || !slots || !hashes || !starts || !members || !placed) goto err;
+
+  // Group the schemes by bucket, with the schemes of bucket `i` at
+  // `members[starts[i]]` through `members[starts[i + 1] - 1]`.
+  for (size_t i = 0; i < len; i++) {
+    url_scheme_t *scheme = registry->schemes[i];
+
+    hashes[i] = url_scheme__hash(scheme->name, scheme->len);
+
+    starts[url_scheme__mix(hashes[i], 0) % buckets + 1]++;
+  }
+
+  size_t max_size = 0;
+
+  for (size_t i = 0; i < buckets; i++) {
+    if (starts[i + 1] > max_size) max_size = starts[i + 1];
+
+    starts[i + 1] += starts[i];
+  }
+
+  for (size_t i = 0; i < len; i++) {
+    members[starts[url_scheme__mix(hashes[i], 0) % buckets]++] = i;
+  }
+
+  for (size_t i = buckets; i > 0; i--) starts[i] = starts[i - 1];
+
+  starts[0] = 0;
+
+  for (size_t size = max_size; size > 0; size--) {
+    for (size_t bucket = 0; bucket < buckets; bucket++) {
+      if (starts[bucket + 1] - starts[bucket] != size) continue;
+
+      const size_t *bucket_members = &members[starts[bucket]];
+
+      uint32_t displacement = 1;
+
+      for (; displacement < url_scheme__max_displacement; displacement++) {
+        size_t k = 0;
+
+        for (; k < size; k++) {
+          size_t slot = url_scheme__mix(hashes[bucket_members[k]], displacement) % len;
+
+          if (slots[slot]) break;
+
+          slots[slot] = registry->schemes[bucket_members[k]];
+          placed[k] = slot;
+        }
+
+        if (k == size) break;
+
+        while (k > 0) slots[placed[--k]] = NULL;
+      }
+
+      if (displacement == url_scheme__max_displacement) goto err;
+
+      displacements[bucket] = displacement;
+    }
+  }
+
+  free(registry->displacements);
+  free(registry->slots);
+
+  registry->displacements = displacements;
+  registry->buckets = buckets;
+  registry->slots = slots;
+
+  free(hashes);
+  free(starts);
+  free(members);
+  free(placed);
+
+  return 0;
+
+err:
+  free(displacements);
+  free(slots);
+  free(hashes);
+  free(starts);
+  free(members);
+  free(placed);
+
+  return -1;
+}
+
+int
+url_scheme_registry_init (url_scheme_registry_t **result) {
+  url_scheme_registry_t *registry = calloc(1, sizeof(url_scheme_registry_t));
+  if (registry == NULL) return -1;
+
+  *result = registry;
+
+  return 0;
+}
+
+void
+url_scheme_registry_destroy (url_scheme_registry_t *registry) {
+  for (size_t i = 0; i < registry->len; i++) {
+    free(registry->schemes[i]);
+  }
+
+  free(registry->schemes);
+  free(registry->displacements);
+  free(registry->slots);
+  free(registry);
+}
+
+int
+url_scheme_registry_add (url_scheme_registry_t *registry, const utf8_t *name, size_t len, int32_t default_port, void *data) {
+  if (!url_scheme__is_valid(name, len)) return -1;
+
+  if (default_port < -1 || default_port > UINT16_MAX) return -1;
+
+  if (url_scheme_registry_lookup(registry, utf8_string_view_init(name, len))) return -1;
+
+  if (registry->len == registry->capacity) {
+    size_t capacity = registry->capacity == 0 ? 8 : registry->capacity * 2;
+
+    url_scheme_t **schemes = realloc(registry->schemes, capacity * sizeof(url_scheme_t *));
+    if (schemes == NULL) return -1;
+
+    registry->schemes = schemes;
+    registry->capacity = capacity;
+  }
+
+  // The name is stored right after the scheme, so that pointers to schemes
+  // returned by lookups stay valid as more schemes are registered.
+  url_scheme_t *scheme = malloc(sizeof(url_scheme_t) + len);
+  if (scheme == NULL) return -1;
+
+  utf8_t *copy = (utf8_t *) &scheme[1];
+
+  for (size_t i = 0; i < len; i++) {
+    copy[i] = url_scheme__lowercase(name[i]);
+  }
+
+  scheme->name = copy;
+  scheme->len = len;
+  scheme->type = url_type_opaque;
+  scheme->default_port = default_port;
+  scheme->data = data;
+
+  registry->schemes[registry->len++] = scheme;
+
+  if (url_scheme__build(registry) < 0) {
+    registry->len--;
+
+    free(scheme);
+
+    return -1;
+  }
+
+  return 0;
+}
+
+const url_scheme_t *
+url_scheme_registry_lookup (const url_scheme_registry_t *registry, const utf8_string_view_t scheme) {
+  url_type_t type = url__type(scheme);
+
+  if (type != url_type_opaque) return &url_scheme__special[type];
+
+  if (registry->len == 0) return NULL;
+
+  uint32_t hash = url_scheme__hash(scheme.data, scheme.len);
+
+  uint32_t displacement = registry->displacements[url_scheme__mix(hash, 0) % registry->buckets];
+
+  const url_scheme_t *candidate = registry->slots[url_scheme__mix(hash, displacement) % registry->len];
+
+  return url_scheme__equal(candidate, scheme.data, scheme.len) ? candidate : NULL;
+}
+
+size_t
+url_scheme_registry_size (const url_scheme_registry_t *registry) {
+  return registry->len;
+}
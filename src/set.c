@@ -0,0 +1,304 @@
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <utf.h>
+#include <utf/string.h>
+
+#include "../include/url/hash.h"
+#include "../include/url/set.h"
+#include "mutex.h"
+#include "shard.h"
+
+#define url_set__shard_bits 6
+#define url_set__shard_count (1 << url_set__shard_bits)
+
+#define url_set__min_capacity   16
+#define url_set__min_block_size 4096
+#define url_set__max_block_size 1048576
+
+typedef struct url_set__slot_s url_set__slot_t;
+typedef struct url_set__block_s url_set__block_t;
+typedef struct url_set__shard_s url_set__shard_t;
+
+struct url_set__slot_s {
+  const utf8_t *data;
+  uint32_t len;
+
+  /**
+   * The high half of the hash with the low bit forced on, such that a zero
+   * fingerprint marks an empty slot.
+   */
+  uint32_t fingerprint;
+};
+
+struct url_set__block_s {
+  url_set__block_t *next;
+
+  size_t len;
+  size_t capacity;
+
+  utf8_t data[];
+};
+
+struct url_set__shard_s {
+  url__mutex_t lock;
+
+  url_set__slot_t *slots;
+
+  size_t len;
+  size_t capacity;
+
+  url_set__block_t *blocks;
+  size_t block_bytes;
+};
+
+struct url_set_s {
+  url__aligned_shard(url_set__shard_t) shards[url_set__shard_count];
+};
+
+static inline url_set__shard_t *
+url_set__shard (url_set_t *set, uint64_t hash) {
+  return &set->shards[hash & (url_set__shard_count - 1)].shard;
+}
+
+static inline size_t
+url_set__index (uint64_t hash, size_t capacity) {
+  return (size_t) (hash >> url_set__shard_bits) & (capacity - 1);
+}
+
+static inline uint32_t
+url_set__fingerprint (uint64_t hash) {
+  return (uint32_t) (hash >> 32) | 1;
+}
+
+static inline bool
+url_set__matches (const url_set__slot_t *slot, uint32_t fingerprint, const utf8_string_view_t href) {
+  return slot->fingerprint == fingerprint && slot->len == href.len && memcmp(slot->data, href.data, href.len) == 0;
+}
+
+static int
+url_set__grow (url_set__shard_t *shard) {
+  size_t capacity = shard->capacity == 0 ? url_set__min_capacity : shard->capacity * 2;
+
+  url_set__slot_t *slots = calloc(capacity, sizeof(url_set__slot_t));
+  if (slots == NULL) return -1;
+
+  for (size_t i = 0, n = shard->capacity; i < n; i++) {
+    url_set__slot_t *slot = &shard->slots[i];
+
+    if (slot->fingerprint == 0) continue;
+
+    size_t j = url_set__index(url__hash(slot->data, slot->len), capacity);
+
+    while (slots[j].fingerprint != 0) {
+      j = (j + 1) & (capacity - 1);
+    }
+
+    slots[j] = *slot;
+  }
+
+  free(shard->slots);
+
+  shard->slots = slots;
+  shard->capacity = capacity;
+
+  return 0;
+}
+
+static const utf8_t *
+url_set__copy (url_set__shard_t *shard, const utf8_string_view_t href) {
+  url_set__block_t *block = shard->blocks;
+
+  if (block == NULL || block->len + href.len > block->capacity) {
+    // Grow blocks geometrically with the arena so that small sets stay small
+    // while large sets amortize the per-block header.
+    size_t capacity = shard->block_bytes;
+
+    if (capacity < url_set__min_block_size) capacity = url_set__min_block_size;
+    if (capacity > url_set__max_block_size) capacity = url_set__max_block_size;
+    if (capacity < href.len) capacity = href.len;
+
+    block = malloc(sizeof(url_set__block_t) + capacity);
+    if (block == NULL) return NULL;
+
+    block->next = shard->blocks;
+    block->len = 0;
+    block->capacity = capacity;
+
+    shard->blocks = block;
+    shard->block_bytes += sizeof(url_set__block_t) + capacity;
+  }
+
+  utf8_t *data = &block->data[block->len];
+
+  memcpy(data, href.data, href.len);
+
+  block->len += href.len;
+
+  return data;
+}
+
+int
+url_set_init (url_set_t **result) {
+  url_set_t *set = url__shards_alloc(sizeof(url_set_t));
+  if (set == NULL) return -1;
+
+  for (size_t i = 0; i < url_set__shard_count; i++) {
+    url__mutex_init(&set->shards[i].shard.lock);
+  }
+
+  *result = set;
+
+  return 0;
+}
+
+void
+url_set_destroy (url_set_t *set) {
+  for (size_t i = 0; i < url_set__shard_count; i++) {
+    url_set__shard_t *shard = &set->shards[i].shard;
+
+    url_set__block_t *block = shard->blocks;
+
+    while (block) {
+      url_set__block_t *next = block->next;
+      free(block);
+      block = next;
+    }
+
+    free(shard->slots);
+
+    url__mutex_destroy(&shard->lock);
+  }
+
+  url__shards_free(set);
+}
+
+int
+url_set_add (url_set_t *set, const utf8_string_view_t href) {
+  int err;
+
+  if (href.len > UINT32_MAX) return -1;
+
+  uint64_t hash = url__hash(href.data, href.len);
+  uint32_t fingerprint = url_set__fingerprint(hash);
+
+  url_set__shard_t *shard = url_set__shard(set, hash);
+
+  url__mutex_lock(&shard->lock);
+
+  size_t i = 0;
+
+  // Look for the href before growing, such that adding an href that is
+  // already present never allocates.
+  if (shard->capacity != 0) {
+    size_t mask = shard->capacity - 1;
+
+    i = url_set__index(hash, shard->capacity);
+
+    while (shard->slots[i].fingerprint != 0) {
+      if (url_set__matches(&shard->slots[i], fingerprint, href)) {
+        url__mutex_unlock(&shard->lock);
+
+        return 0;
+      }
+
+      i = (i + 1) & mask;
+    }
+  }
+
+  // Keep the load factor at or below 3/4 to bound probe lengths.
+  if ((shard->len + 1) * 4 > shard->capacity * 3) {
+    err = url_set__grow(shard);
+    if (err < 0) goto err;
+
+    size_t mask = shard->capacity - 1;
+
+    i = url_set__index(hash, shard->capacity);
+
+    while (shard->slots[i].fingerprint != 0) {
+      i = (i + 1) & mask;
+    }
+  }
+
+  const utf8_t *data = url_set__copy(shard, href);
+  if (data == NULL) goto err;
+
+  shard->slots[i].data = data;
+  shard->slots[i].len = (uint32_t) href.len;
+  shard->slots[i].fingerprint = fingerprint;
+
+  shard->len++;
+
+  url__mutex_unlock(&shard->lock);
+
+  return 1;
+
+err:
+  url__mutex_unlock(&shard->lock);
+
+  return -1;
+}
+
+bool
+url_set_has (url_set_t *set, const utf8_string_view_t href) {
+  if (href.len > UINT32_MAX) return false;
+
+  uint64_t hash = url__hash(href.data, href.len);
+  uint32_t fingerprint = url_set__fingerprint(hash);
+
+  url_set__shard_t *shard = url_set__shard(set, hash);
+
+  bool found = false;
+
+  url__mutex_lock(&shard->lock);
+
+  if (shard->capacity != 0) {
+    size_t mask = shard->capacity - 1;
+    size_t i = url_set__index(hash, shard->capacity);
+
+    while (shard->slots[i].fingerprint != 0) {
+      if (url_set__matches(&shard->slots[i], fingerprint, href)) {
+        found = true;
+        break;
+      }
+
+      i = (i + 1) & mask;
+    }
+  }
+
+  url__mutex_unlock(&shard->lock);
+
+  return found;
+}
+
+size_t
+url_set_size (url_set_t *set) {
+  size_t size = 0;
+
+  for (size_t i = 0; i < url_set__shard_count; i++) {
+    url_set__shard_t *shard = &set->shards[i].shard;
+
+    url__mutex_lock(&shard->lock);
+    size += shard->len;
+    url__mutex_unlock(&shard->lock);
+  }
+
+  return size;
+}
+
+size_t
+url_set_memory_usage (url_set_t *set) {
+  size_t bytes = sizeof(url_set_t);
+
+  for (size_t i = 0; i < url_set__shard_count; i++) {
+    url_set__shard_t *shard = &set->shards[i].shard;
+
+    url__mutex_lock(&shard->lock);
+    bytes += shard->capacity * sizeof(url_set__slot_t) + shard->block_bytes;
+    url__mutex_unlock(&shard->lock);
+  }
+
+  return bytes;
+}
@@ -0,0 +1,56 @@
+#ifndef URL_SHARD_H
+#define URL_SHARD_H
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(_WIN32)
+#include <malloc.h>
+#endif
+
+// Shards are aligned to a pair of cache lines, as some processors prefetch
+// lines in pairs, so that threads working on neighbouring shards never share
+// a line and don't suffer from false sharing.
+#define url__shard_alignment 128
+
+/**
+ * Declare a shard of `type` that is aligned, and so also padded, to the shard
+ * alignment. Structures holding these must be allocated with
+ * `url__shards_alloc()` for the alignment to hold.
+ */
+#define url__aligned_shard(type) \
+  struct { \
+    _Alignas(url__shard_alignment) type shard; \
+  }
+
+/**
+ * Allocate `size` zeroed bytes aligned to the shard alignment, which must be
+ * freed with `url__shards_free()`.
+ */
+static inline void *
+url__shards_alloc (size_t size) {
+  void *ptr;
+
+#if defined(_WIN32)
+  ptr = _aligned_malloc(size, url__shard_alignment);
+  if (ptr == NULL) return NULL;
+#else
+  if (posix_memalign(&ptr, url__shard_alignment, size) != 0) return NULL;
+#endif
+
+  memset(ptr, 0, size);
+
+  return ptr;
+}
+
+static inline void
+url__shards_free (void *ptr) {
+#if defined(_WIN32)
+  _aligned_free(ptr);
+#else
+  free(ptr);
+#endif
+}
+
+#endif // URL_SHARD_H
@@ -0,0 +1,481 @@
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <utf.h>
+#include <utf/string.h>
+
+#include "../include/url.h"
+#include "../include/url/binary.h"
+#include "../include/url/store.h"
+
+#define url_store__block_entries 16
+
+struct url_store_builder_s {
+  size_t count;
+
+  bool finished;
+
+  utf8_string_t data;
+
+  size_t *blocks;
+  size_t blocks_len;
+  size_t blocks_capacity;
+
+  utf8_string_t previous;
+  url_component_t previous_components[8];
+};
+
+struct url_store_s {
+  size_t count;
+
+  utf8_t *data;
+  size_t len;
+
+  size_t *blocks;
+  size_t blocks_len;
+};
+
+static inline int
+url_store__compare (const utf8_string_view_t a, const utf8_string_view_t b) {
+  size_t n = a.len < b.len ? a.len : b.len;
+
+  int result = n == 0 ? 0 : memcmp(a.data, b.data, n);
+
+  if (result != 0) return result;
+
+  return a.len < b.len ? -1 : a.len > b.len ? 1 : 0;
+}
+
+static inline int
+url_store__append_varint (utf8_string_t *data, uint32_t value) {
+  int err;
+
+  err = utf8_string_reserve(data, data->len + 5);
+  if (err < 0) return err;
+
+  utf8_t *end = url__varint_write(&data->data[data->len], value);
+
+  data->len = end - data->data;
+
+  return 0;
+}
+
+static inline void
+url_store__get_components (const url_t *url, url_component_t components[8]) {
+  components[0] = url->components.scheme_end;
+  components[1] = url->components.username_end;
+  components[2] = url->components.host_start;
+  components[3] = url->components.host_end;
+  components[4] = url->components.port;
+  components[5] = url->components.path_start;
+  components[6] = url->components.query_start;
+  components[7] = url->components.fragment_start;
+}
+
+static inline void
+url_store__set_components (url_t *url, const url_component_t components[8]) {
+  url->components.scheme_end = components[0];
+  url->components.username_end = components[1];
+  url->components.host_start = components[2];
+  url->components.host_end = components[3];
+  url->components.port = components[4];
+  url->components.path_start = components[5];
+  url->components.query_start = components[6];
+  url->components.fragment_start = components[7];
+}
+
+/**
+ * Decode the entry at `data`, updating `href` and the components of `url` in
+ * place from the previous entry.
+ */
+static const utf8_t *
+url_store__read_entry (const url_store_t *store, const utf8_t *data, utf8_string_t *href, url_t *url) {
+  int err;
+
+  const utf8_t *end = &store->data[store->len];
+
+  uint32_t shared, len;
+
+  data = url__varint_read(data, end, &shared);
+  data = url__varint_read(data, end, &len);
+
+  href->len = shared;
+
+  err = utf8_string_append_literal(href, data, len);
+  if (err < 0) return NULL;
+
+  data += len;
+
+  utf8_t mask = *data++;
+  utf8_t type = *data++;
+
+  url->type = (url_type_t) (type & 0xf);
+  url->flags = type >> 4;
+
+  url_component_t components[8];
+
+  url_store__get_components(url, components);
+
+  for (int i = 0; i < 8; i++) {
+    if ((mask & (1 << i)) == 0) continue;
+
+    data = url__varint_read(data, end, &components[i]);
+
+    components[i]--;
+  }
+
+  url_store__set_components(url, components);
+
+  return data;
+}
+
+/**
+ * The first entry of a block shares no prefix, so its href can be read in
+ * place without decoding.
+ */
+static inline utf8_string_view_t
+url_store__block_key (const url_store_t *store, size_t block) {
+  const utf8_t *data = &store->data[store->blocks[block]];
+  const utf8_t *end = &store->data[store->len];
+
+  uint32_t shared, len;
+
+  data = url__varint_read(data, end, &shared);
+  data = url__varint_read(data, end, &len);
+
+  return utf8_string_view_init(data, len);
+}
+
+int
+url_store_builder_init (url_store_builder_t **result) {
+  url_store_builder_t *builder = malloc(sizeof(url_store_builder_t));
+  if (builder == NULL) return -1;
+
+  builder->count = 0;
+  builder->finished = false;
+
+  builder->blocks = NULL;
+  builder->blocks_len = 0;
+  builder->blocks_capacity = 0;
+
+  utf8_string_init(&builder->data);
+  utf8_string_init(&builder->previous);
+
+  *result = builder;
+
+  return 0;
+}
+
+void
+url_store_builder_destroy (url_store_builder_t *builder) {
+  utf8_string_destroy(&builder->data);
+  utf8_string_destroy(&builder->previous);
+
+  free(builder->blocks);
+  free(builder);
+}
+
+int
+url_store_builder_add (url_store_builder_t *builder, const url_t *url) {
+  int err;
+
+  if (builder->finished || url->href.len > UINT32_MAX) return -1;
+
+  if (url->type > 0xf || url->flags > 0xf) return -1;
+
+  utf8_string_view_t href = url_get_href(url);
+  utf8_string_view_t previous = utf8_string_view(&builder->previous);
+
+  if (builder->count > 0 && url_store__compare(previous, href) >= 0) return -1;
+
+  bool block_start = builder->count % url_store__block_entries == 0;
+
+  size_t shared = 0;
+
+  if (block_start) {
+    if (builder->blocks_len == builder->blocks_capacity) {
+      size_t capacity = builder->blocks_capacity ? builder->blocks_capacity * 2 : 64;
+
+      size_t *blocks = realloc(builder->blocks, capacity * sizeof(size_t));
+      if (blocks == NULL) return -1;
+
+      builder->blocks = blocks;
+      builder->blocks_capacity = capacity;
+    }
+
+    builder->blocks[builder->blocks_len++] = builder->data.len;
+  } else {
+    size_t n = previous.len < href.len ? previous.len : href.len;
+
+    while (shared < n && previous.data[shared] == href.data[shared]) shared++;
+  }
+
+  err = url_store__append_varint(&builder->data, (uint32_t) shared);
+  if (err < 0) return err;
+
+  err = url_store__append_varint(&builder->data, (uint32_t) (href.len - shared));
+  if (err < 0) return err;
+
+  err = utf8_string_append_view(&builder->data, utf8_string_view_substring(href, shared, href.len));
+  if (err < 0) return err;
+
+  url_component_t components[8];
+
+  url_store__get_components(url, components);
+
+  // Only components that differ from the previous entry in the block are
+  // stored, which for URLs sharing an origin leaves little more than the
+  // query and fragment offsets. The first entry of a block stores them all.
+  utf8_t mask = 0;
+
+  for (int i = 0; i < 8; i++) {
+    if (block_start) mask |= 1 << i;
+    else if (components[i] != builder->previous_components[i]) mask |= 1 << i;
+  }
+
+  err = utf8_string_append_character(&builder->data, mask);
+  if (err < 0) return err;
+
+  err = utf8_string_append_character(&builder->data, (utf8_t) (url->type | url->flags << 4));
+  if (err < 0) return err;
+
+  for (int i = 0; i < 8; i++) {
+    if ((mask & (1 << i)) == 0) continue;
+
+    err = url_store__append_varint(&builder->data, components[i] + 1);
+    if (err < 0) return err;
+
+    builder->previous_components[i] = components[i];
+  }
+
+  utf8_string_clear(&builder->previous);
+
+  err = utf8_string_append_view(&builder->previous, href);
+  if (err < 0) return err;
+
+  builder->count++;
+
+  return 0;
+}
+
+int
+url_store_builder_finish (url_store_builder_t *builder, url_store_t **result) {
+  if (builder->finished) return -1;
+
+  url_store_t *store = malloc(sizeof(url_store_t));
+  if (store == NULL) return -1;
+
+  size_t len = builder->data.len;
+
+  // Copy into exactly sized allocations so that no slack is retained.
+  store->data = malloc(len ? len : 1);
+  store->blocks = malloc(builder->blocks_len ? builder->blocks_len * sizeof(size_t) : 1);
+
+  if (store->data == NULL || store->blocks == NULL) {
+    free(store->data);
+    free(store->blocks);
+    free(store);
+
+    return -1;
+  }
+
+  if (len) memcpy(store->data, builder->data.data, len);
+
+  if (builder->blocks_len) memcpy(store->blocks, builder->blocks, builder->blocks_len * sizeof(size_t));
+
+  store->count = builder->count;
+  store->len = len;
+  store->blocks_len = builder->blocks_len;
+
+  builder->finished = true;
+
+  *result = store;
+
+  return 0;
+}
+
+void
+url_store_destroy (url_store_t *store) {
+  free(store->data);
+  free(store->blocks);
+  free(store);
+}
+
+size_t
+url_store_size (const url_store_t *store) {
+  return store->count;
+}
+
+size_t
+url_store_memory_usage (const url_store_t *store) {
+  return sizeof(url_store_t) + store->len + store->blocks_len * sizeof(size_t);
+}
+
+int
+url_store_get (const url_store_t *store, size_t ordinal, url_t *result) {
+  if (ordinal >= store->count) return -1;
+
+  size_t block = ordinal / url_store__block_entries;
+
+  const utf8_t *data = &store->data[store->blocks[block]];
+
+  for (size_t i = block * url_store__block_entries; i <= ordinal; i++) {
+    data = url_store__read_entry(store, data, &result->href, result);
+    if (data == NULL) return -1;
+  }
+
+  url__restore_host(result);
+
+  return 0;
+}
+
+int
+url_store_find (const url_store_t *store, const utf8_string_view_t href, size_t *ordinal) {
+  size_t low = 0, high = store->blocks_len;
+
+  while (low < high) {
+    size_t mid = low + (high - low) / 2;
+
+    if (url_store__compare(url_store__block_key(store, mid), href) <= 0) low = mid + 1;
+    else high = mid;
+  }
+
+  if (low == 0) {
+    *ordinal = 0;
+
+    return 0;
+  }
+
+  size_t block = low - 1;
+
+  size_t start = block * url_store__block_entries;
+  size_t end = start + url_store__block_entries;
+
+  if (end > store->count) end = store->count;
+
+  utf8_string_t key;
+  utf8_string_init(&key);
+
+  // Decoding an entry reads the components of the previous one, even at the
+  // start of a block where they are all replaced.
+  url_t url;
+  url_init(&url);
+
+  const utf8_t *data = &store->data[store->blocks[block]];
+
+  int found = 0;
+
+  size_t i = start;
+
+  for (; i < end; i++) {
+    data = url_store__read_entry(store, data, &key, &url);
+
+    if (data == NULL) {
+      found = -1;
+      break;
+    }
+
+    int result = url_store__compare(utf8_string_view(&key), href);
+
+    if (result >= 0) {
+      found = result == 0;
+      break;
+    }
+  }
+
+  utf8_string_destroy(&key);
+
+  url_destroy(&url);
+
+  *ordinal = i;
+
+  return found;
+}
+
+void
+url_store_prefix_range (const url_store_t *store, const utf8_string_view_t prefix, size_t *start, size_t *end) {
+  url_store_find(store, prefix, start);
+
+  // The end of the range is the first href not less than the smallest string
+  // greater than every string with the prefix, which is the prefix with any
+  // trailing 0xff bytes removed and its last byte incremented.
+  size_t len = prefix.len;
+
+  while (len > 0 && prefix.data[len - 1] == 0xff) len--;
+
+  if (len == 0) {
+    *end = store->count;
+
+    return;
+  }
+
+  utf8_string_t successor;
+  utf8_string_init(&successor);
+
+  if (utf8_string_append_view(&successor, utf8_string_view_substring(prefix, 0, len)) < 0) {
+    *end = store->count;
+  } else {
+    successor.data[len - 1]++;
+
+    url_store_find(store, utf8_string_view(&successor), end);
+  }
+
+  utf8_string_destroy(&successor);
+}
+
+void
+url_store_iterator_init (url_store_iterator_t *iterator, const url_store_t *store, size_t start, size_t end) {
+  iterator->store = store;
+  iterator->ordinal = start;
+  iterator->end = end < store->count ? end : store->count;
+  iterator->position = NULL;
+
+  utf8_string_init(&iterator->href);
+
+  url_init(&iterator->url);
+}
+
+void
+url_store_iterator_destroy (url_store_iterator_t *iterator) {
+  utf8_string_destroy(&iterator->href);
+
+  url_destroy(&iterator->url);
+}
+
+int
+url_store_iterator_next (url_store_iterator_t *iterator, url_t *result) {
+  const url_store_t *store = iterator->store;
+
+  if (iterator->ordinal >= iterator->end) return 0;
+
+  if (iterator->position == NULL) {
+    size_t block = iterator->ordinal / url_store__block_entries;
+
+    iterator->position = &store->data[store->blocks[block]];
+
+    for (size_t i = block * url_store__block_entries; i < iterator->ordinal; i++) {
+      iterator->position = url_store__read_entry(store, iterator->position, &iterator->href, &iterator->url);
+      if (iterator->position == NULL) return -1;
+    }
+  }
+
+  // Blocks are laid out back to back and the first entry of a block shares
+  // no prefix, so decoding simply continues across block boundaries.
+  iterator->position = url_store__read_entry(store, iterator->position, &iterator->href, &iterator->url);
+  if (iterator->position == NULL) return -1;
+
+  *result = iterator->url;
+
+  utf8_string_init(&result->href);
+
+  result->href.data = iterator->href.data;
+  result->href.len = iterator->href.len;
+
+  url__restore_host(result);
+
+  iterator->ordinal++;
+
+  return 1;
+}
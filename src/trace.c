@@ -0,0 +1,76 @@
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <utf.h>
+#include <utf/string.h>
+
+#include "../include/url.h"
+#include "../include/url/trace.h"
+
+#if defined(_MSC_VER)
+#define url_trace__thread_local __declspec(thread)
+#else
+#define url_trace__thread_local _Thread_local
+#endif
+
+static url_trace__thread_local url_trace_t url_trace__counters;
+
+static url_trace__thread_local url_trace_cb url_trace__cb;
+static url_trace__thread_local void *url_trace__data;
+
+static inline uint64_t
+url_trace__slack (const url_t *url) {
+  const utf8_string_t *href = &url->href;
+
+  // The capacity includes space for the NULL terminator.
+  return href->cap > href->len ? href->cap - href->len - 1 : 0;
+}
+
+void
+url_trace_get (url_trace_t *result) {
+  *result = url_trace__counters;
+}
+
+void
+url_trace_reset (void) {
+  memset(&url_trace__counters, 0, sizeof(url_trace_t));
+}
+
+void
+url_trace_on_parse (url_trace_cb cb, void *data) {
+  url_trace__cb = cb;
+  url_trace__data = data;
+}
+
+void
+url_trace_sample (const url_t *url) {
+  url_trace__counters.parses++;
+  url_trace__counters.slack += url_trace__slack(url);
+}
+
+url_trace_t *
+url__trace_counters (void) {
+  return &url_trace__counters;
+}
+
+void
+url__trace_parse (const url_t *url, const url_trace_t *start) {
+  url_trace_t *counters = &url_trace__counters;
+
+  uint64_t slack = url_trace__slack(url);
+
+  counters->parses++;
+  counters->slack += slack;
+
+  if (url_trace__cb == NULL) return;
+
+  url_trace_t trace = {
+    .parses = 1,
+    .allocations = counters->allocations - start->allocations,
+    .reallocations = counters->reallocations - start->reallocations,
+    .bytes = counters->bytes - start->bytes,
+    .slack = slack,
+  };
+
+  url_trace__cb(url, &trace, url_trace__data);
+}
@@ -0,0 +1,6987 @@
+// Generated by scripts/generate-unicode-tables.js from the Unicode 15.1.0 data
+// in data/unicode. Do not edit.
+//
+//   UTS #46 statuses and mappings: 82.0 KiB, blocks of 32
+//   Properties and decompositions: 92.2 KiB, blocks of 32
+//   Compositions: 16.0 KiB, at most 10 probes
+
+#define url__unicode_version "15.1.0"
+
+// Code points from here on are looked up in the range tables.
+#define url__unicode_trie_limit 0x032400
+
+#define url__idna_trie_shift 5
+#define url__unicode_property_trie_shift 5
+#define url__unicode_composition_bits 11
+
+// UTS #46 statuses, as the status, mapping length << 3 and mapping offset
+// << 8. Stage 1 entries are the stage 2 index of the block and the base
+// mapping offset of the block << 16.
+static const uint32_t url__idna_trie_stage1[] = {
+  0x00000000, 0x00000000, 0x00000020, 0x00000000, 0x00000040, 0x001a0060, 0x00320080, 0x00000000,
+  0x005000a0, 0x006000c0, 0x007100e0, 0x00840100, 0x00950120, 0x00a90140, 0x00b90160, 0x00c80180,
+  0x00d900a0, 0x00e901a0, 0x00f701c0, 0x00000000, 0x00000000, 0x010001e0, 0x01090200, 0x01150220,
+  0x00000000, 0x00000000, 0x011a0240, 0x01200260, 0x01280280, 0x014402a0, 0x014f02c0, 0x015b02e0,
+  0x016e0300, 0x018e0320, 0x00000000, 0x019e00a0, 0x01ae0340, 0x01ba00a0, 0x01ca0360, 0x01d900a0,
+  0x01e900a0, 0x01f90380, 0x021003a0, 0x00000000, 0x022703c0, 0x00000000, 0x000003e0, 0x00000400,
+  0x00000420, 0x00000000, 0x00000000, 0x02290440, 0x00000000, 0x00000000, 0x00000460, 0x00000000,
+  0x00000480, 0x00000000, 0x000004a0, 0x00000000, 0x00000000, 0x000004c0, 0x00000000, 0x000004e0,
+  0x00000000, 0x00000500, 0x00000520, 0x00000540, 0x00000560, 0x00000000, 0x00000000, 0x00000580,
+  0x00000000, 0x00000000, 0x023105a0, 0x00000000, 0x000005c0, 0x000005e0, 0x02410600, 0x00000620,
+  0x00000640, 0x02470660, 0x024b0680, 0x000006a0, 0x000006c0, 0x000006e0, 0x00000700, 0x00000720,
+  0x00000740, 0x000006e0, 0x02530760, 0x00000780, 0x000007a0, 0x000007c0, 0x000007e0, 0x00000800,
+  0x00000820, 0x00000840, 0x00000860, 0x00000880, 0x00000820, 0x000008a0, 0x000008c0, 0x000008e0,
+  0x00000820, 0x00000000, 0x00000900, 0x00000920, 0x00000940, 0x00000960, 0x00000980, 0x000009a0,
+  0x000009c0, 0x025709e0, 0x00000a00, 0x00000040, 0x00000a20, 0x02590a40, 0x025b0a60, 0x00000040,
+  0x025f0a80, 0x00000000, 0x02600aa0, 0x026a0ac0, 0x027a0ae0, 0x02800b00, 0x00000b20, 0x00000040,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000040, 0x02880b40, 0x028a0b60,
+  0x00000000, 0x00000000, 0x00000b80, 0x000009c0, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000ba0, 0x00000000, 0x00000bc0, 0x00000be0, 0x00000c00, 0x00000000,
+  0x00000c20, 0x00000000, 0x000004e0, 0x00000c40, 0x00000c60, 0x00000000, 0x00000000, 0x028b0c80,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000ca0, 0x00000000, 0x00000000, 0x00000cc0,
+  0x00000ce0, 0x00000d00, 0x00000d20, 0x00000d40, 0x00000000, 0x00000d60, 0x00000d80, 0x00000da0,
+  0x00000dc0, 0x00000000, 0x00000000, 0x00000cc0, 0x00000000, 0x00000540, 0x00000000, 0x00000de0,
+  0x00000b80, 0x00000e00, 0x00000e20, 0x00000e40, 0x00000000, 0x00000e60, 0x00000e80, 0x00000000,
+  0x00000ea0, 0x00000000, 0x00000b80, 0x00000ec0, 0x00000da0, 0x00000480, 0x00000ee0, 0x00000040,
+  0x00000000, 0x00000000, 0x00000f00, 0x00000b80, 0x00000000, 0x00000000, 0x00000000, 0x00000f20,
+  0x00000000, 0x00000f40, 0x00000f60, 0x00000000, 0x02910f80, 0x02a90fa0, 0x000003e0, 0x00000fc0,
+  0x00000000, 0x02c70fe0, 0x02d91000, 0x02f81020, 0x03041040, 0x03090300, 0x00000000, 0x00000000,
+  0x032900a0, 0x033900a0, 0x034900a0, 0x035900a0, 0x03691060, 0x037800a0, 0x038800a0, 0x039800a0,
+  0x03a81080, 0x03b610a0, 0x03c610c0, 0x03d010e0, 0x03df1100, 0x041f1120, 0x04521140, 0x047c1160,
+  0x049b1180, 0x049f11a0, 0x04ae11c0, 0x04b911e0, 0x04c71200, 0x04e31220, 0x00001240, 0x00001260,
+  0x04e51280, 0x050212a0, 0x051f12c0, 0x055412e0, 0x05901300, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x05931320, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x059d1340, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00001360, 0x00001380, 0x059f13a0, 0x05e513c0, 0x061113e0, 0x065d0300, 0x067d1400,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x06881420, 0x00000000, 0x00000000, 0x068c1440, 0x00000000, 0x00000000, 0x06941460, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000d60, 0x00001480, 0x00000000, 0x00000000, 0x00000000,
+  0x06960300, 0x06b60320, 0x00000000, 0x06c614a0, 0x06d700a0, 0x06e700a0, 0x06f700a0, 0x070714c0,
+  0x00000000, 0x000014e0, 0x00000000, 0x070c1500, 0x00000d00, 0x00001520, 0x00001520, 0x00000000,
+  0x00000000, 0x00000000, 0x00000d80, 0x00000040, 0x070d1540, 0x00000000, 0x00000000, 0x070e1560,
+  0x070f0300, 0x072f0300, 0x074f0300, 0x076f0300, 0x078f0300, 0x07af0300, 0x07cf1580, 0x00000040,
+  0x07e515a0, 0x07e715c0, 0x000009c0, 0x00000000, 0x07eb15e0, 0x00000000, 0x00000000, 0x07f11600,
+  0x00001620, 0x07f31640, 0x08020300, 0x08221660, 0x08411680, 0x00000000, 0x00000000, 0x000016a0,
+  0x085e16c0, 0x08bd16e0, 0x091d1700, 0x094e1720, 0x096f0300, 0x098f1740, 0x09be1760, 0x09f31780,
+  0x0a1417a0, 0x0a8a17c0, 0x0af217e0, 0x0b521800, 0x0ba71820, 0x0bef1840, 0x0c421860, 0x0c841880,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000f00, 0x00000000, 0x000018a0, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x000018c0, 0x0cdb00a0, 0x0ceb18e0, 0x0cf21900, 0x00000000, 0x00000000, 0x00001920,
+  0x00000000, 0x0d021940, 0x0d1000a0, 0x0d201960, 0x0d2d1980, 0x0d3a19a0, 0x0d4e19c0, 0x0d5819e0,
+  0x00000000, 0x00001a00, 0x00000000, 0x00001920, 0x00000000, 0x00000000, 0x00001a20, 0x00000000,
+  0x00000000, 0x00000000, 0x00001a40, 0x00000c40, 0x00000000, 0x00000000, 0x00001a60, 0x00000b80,
+  0x00000000, 0x00000d00, 0x00001a80, 0x00000000, 0x00000000, 0x00000000, 0x00001aa0, 0x00000d00,
+  0x00001ac0, 0x00001ae0, 0x0d5e1b00, 0x0d621b20, 0x0d730300, 0x0d930300, 0x00000000, 0x00001b40,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000016a0, 0x00001b60, 0x00000a00,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x0db31b80, 0x0dd20300, 0x0df20300, 0x0e120300, 0x0e320300, 0x0e520300, 0x0e720300, 0x0e920300,
+  0x0eb21ba0, 0x0ecc1bc0, 0x0ee61be0, 0x0f051c00, 0x0f230300, 0x0f430300, 0x0f631c20, 0x00000040,
+  0x0f7d1c40, 0x0f991c60, 0x0fcb1c80, 0x0feb1ca0, 0x0ff31cc0, 0x0fff1ce0, 0x10051d00, 0x100c1d20,
+  0x10211100, 0x10611100, 0x10a11d40, 0x10e31d60, 0x11271100, 0x11671100, 0x11a71100, 0x11e71d80,
+  0x122a1100, 0x126a1da0, 0x12a41dc0, 0x12cb1de0, 0x13101e00, 0x135b16e0, 0x13bb1e20, 0x13d31e40,
+  0x14161e60, 0x141e1e80, 0x142c1ea0, 0x14441ec0, 0x146b1ee0, 0x14761f00, 0x14801f20, 0x14881f40,
+  0x14971f60, 0x14b60300, 0x14d60300, 0x14f60300, 0x15160300, 0x15361f80, 0x15541fa0, 0x15691fc0,
+  0x00001fe0, 0x00002000, 0x00002020, 0x00000040, 0x00000000, 0x00000000, 0x00000000, 0x00000fc0,
+  0x00002040, 0x00002060, 0x00000000, 0x00000000, 0x00002080, 0x000020a0, 0x000020c0, 0x00000d80,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000c40, 0x00000000, 0x00001260, 0x00000a00,
+  0x00000000, 0x000020e0, 0x00000540, 0x00000fc0, 0x00002100, 0x00000000, 0x00002120, 0x00000040,
+  0x15780300, 0x15982140, 0x00000000, 0x00000000, 0x00000d80, 0x15a02160, 0x15b02180, 0x00000a00,
+  0x00000000, 0x000003e0, 0x00000000, 0x15c421a0, 0x15d321c0, 0x000021e0, 0x00000040, 0x00000040,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000d00, 0x00000de0, 0x00002200, 0x15e72220, 0x16052240, 0x00000040, 0x00000040,
+  0x00002260, 0x00002280, 0x00001480, 0x00000000, 0x00000b80, 0x000022a0, 0x00000040, 0x000022c0,
+  0x000022e0, 0x00002300, 0x00000040, 0x00000040, 0x00000000, 0x00002320, 0x00002340, 0x00000000,
+  0x00002360, 0x00002380, 0x000023a0, 0x00000000, 0x00000000, 0x00000040, 0x00000000, 0x000023c0,
+  0x00000000, 0x000023e0, 0x00002400, 0x00002420, 0x00002440, 0x00002460, 0x00000040, 0x00000040,
+  0x00000000, 0x00000000, 0x00002480, 0x00000040, 0x161f0300, 0x163f24a0, 0x00000000, 0x000024c0,
+  0x00000000, 0x000024e0, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000b80, 0x00000000, 0x00002500, 0x00000040, 0x00002520,
+  0x00000000, 0x000003e0, 0x00000c60, 0x000020c0, 0x00002540, 0x000020c0, 0x000018c0, 0x00000d00,
+  0x00000000, 0x00000000, 0x00002560, 0x00000ce0, 0x00000000, 0x00000460, 0x00002580, 0x000025a0,
+  0x00000000, 0x000025c0, 0x000003e0, 0x00000d00, 0x00000000, 0x00000000, 0x00000000, 0x000025e0,
+  0x00002600, 0x00000000, 0x00002620, 0x00000040, 0x00002640, 0x00002660, 0x00000000, 0x00002680,
+  0x000005c0, 0x000026a0, 0x000026c0, 0x000026e0, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000000, 0x00000000, 0x00002700, 0x00002620, 0x00000000, 0x00000000, 0x000024e0, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000000, 0x00002400, 0x00000d80, 0x00000040,
+  0x00000000, 0x00000000, 0x00002720, 0x00002740, 0x00000000, 0x00000c60, 0x00002540, 0x00000040,
+  0x000004e0, 0x00000e60, 0x00001360, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000000, 0x00000a00, 0x00000040, 0x00000040, 0x00000040, 0x16520300, 0x00000000, 0x00002760,
+  0x00002780, 0x000027a0, 0x000027c0, 0x00000040, 0x00000040, 0x000027e0, 0x00002800, 0x00002820,
+  0x00000000, 0x00000000, 0x000003e0, 0x00000000, 0x00000000, 0x00002580, 0x00000000, 0x00000cc0,
+  0x00002540, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00002840, 0x00002860, 0x00002880, 0x00000f00, 0x00002340, 0x000028a0, 0x00000040, 0x00000040,
+  0x000028c0, 0x000028e0, 0x000024e0, 0x00002900, 0x00002920, 0x00002540, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000cc0,
+  0x00002940, 0x00002960, 0x00000c60, 0x00000040, 0x00000040, 0x00002980, 0x00000000, 0x000029a0,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000c60, 0x00000040, 0x00000040, 0x00000040,
+  0x00000000, 0x00000000, 0x00000000, 0x000029c0, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x000029e0, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x000020c0, 0x00000000, 0x00000000, 0x00002a00,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00002a20, 0x00000de0, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00001360, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000cc0, 0x00000b80, 0x00002a40, 0x00000000, 0x00000b80, 0x00002660, 0x00002a60,
+  0x00000000, 0x00000000, 0x00002a80, 0x00002aa0, 0x00002a20, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x16720300, 0x00000000, 0x00000fc0, 0x00000040, 0x00000040, 0x00000040,
+  0x00000000, 0x00000000, 0x00002ac0, 0x00000000, 0x00002ae0, 0x00000040, 0x00000040, 0x00002b00,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00001920,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000de0, 0x00000040,
+  0x00002480, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00002b20,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00002b40, 0x00002b60, 0x00002b80, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000a00,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000000, 0x00000000, 0x00000000, 0x00002ba0, 0x00002bc0, 0x00002be0, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000000, 0x00000480, 0x000018a0, 0x00000000, 0x00000000, 0x00000000, 0x000029e0, 0x00000040,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000de0,
+  0x00000000, 0x00002c00, 0x16922c20, 0x16962c40, 0x00000000, 0x16a52c60, 0x16b22c80, 0x00001380,
+  0x00000000, 0x00000000, 0x00002ca0, 0x00000040, 0x00000040, 0x00000040, 0x00000d20, 0x00000d20,
+  0x00000000, 0x00000000, 0x00000d00, 0x00000cc0, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x16b50300, 0x16d50300, 0x16f52cc0, 0x17140300, 0x17342ce0, 0x17532d00, 0x176a1660, 0x17890300,
+  0x17a92d20, 0x17c42d40, 0x17e22d60, 0x17fd0300, 0x181d0300, 0x183d0300, 0x185d0300, 0x187d0300,
+  0x189d0300, 0x18bd0300, 0x18dd0300, 0x18fd0300, 0x191d0300, 0x193d2d80, 0x195b2da0, 0x197a0300,
+  0x199a2dc0, 0x19b90300, 0x19d91b80, 0x19f80300, 0x1a182de0, 0x1a372e00, 0x1a562e20, 0x1a730300,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00002e40, 0x00002e60, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000b80, 0x00002e80, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00002ea0, 0x1a932ec0, 0x1aa30300, 0x1ac32ee0, 0x00002f00, 0x00000040, 0x00000040, 0x00000040,
+  0x00000000, 0x00002f20, 0x00002f40, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x000020c0, 0x00000ee0, 0x00000000, 0x00002300,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x000020c0, 0x00000c60,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00002f60,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00002f80, 0x00000040,
+  0x1ad10300, 0x1af12fa0, 0x00002fc0, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00002fe0, 0x00000000, 0x00003000, 0x00000040, 0x00000040,
+  0x000009c0, 0x00000d80, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x1af31660, 0x1b123020, 0x1b263040, 0x1b353060, 0x1b4c3080, 0x1b6730a0, 0x00000040, 0x000030c0,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000000, 0x00000e60, 0x00000000, 0x00000000, 0x00000d20, 0x000030e0, 0x00003100, 0x00000de0,
+  0x1b803120, 0x1bc43140, 0x1bfb3160, 0x1c123180, 0x1c1831a0, 0x000031c0, 0x00000040, 0x000031e0,
+  0x1c1a3200, 0x1c2f3220, 0x1c4b3240, 0x00002ca0, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00002320, 0x00003260,
+  0x00000000, 0x00000000, 0x00000000, 0x00003280, 0x00000000, 0x00000000, 0x00000c60, 0x000032a0,
+  0x00000e60, 0x00000000, 0x000024e0, 0x00000000, 0x000003e0, 0x000032c0, 0x00000040, 0x00000040,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000d20, 0x000032e0, 0x00003300, 0x00002100, 0x00003320, 0x000023a0,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00003340, 0x00000000, 0x00001380, 0x1c683360,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000040,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000c60, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000d80, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00003380, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00001240,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000d80, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x1c720300, 0x1c9233a0, 0x1cb033c0, 0x1ccf33e0, 0x1cec3400, 0x1d0a0300, 0x1d2a0300, 0x1d4a0300,
+  0x1d6a3420, 0x1d893440, 0x1da83460, 0x1dc50300, 0x1de50300, 0x1e053420, 0x1e240300, 0x1e443480,
+  0x1e6334a0, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000540, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00002a20, 0x00000040, 0x00000040,
+};
+
+static const uint16_t url__idna_trie_stage2[] = {
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0609,
+  0x0709, 0x0809, 0x0909, 0x0a09, 0x0b09, 0x0c09, 0x0d09, 0x0e09,
+  0x0f09, 0x1009, 0x1109, 0x1209, 0x1309, 0x1409, 0x1509, 0x1609,
+  0x1709, 0x1809, 0x1909, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0111, 0x0000, 0x0309, 0x0000, 0x0000, 0x0003, 0x0000, 0x0411,
+  0x0000, 0x0000, 0x0609, 0x0709, 0x0811, 0x0a09, 0x0000, 0x0000,
+  0x0b11, 0x0d09, 0x0e09, 0x0000, 0x0f19, 0x1219, 0x1519, 0x0000,
+  0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0609, 0x0709,
+  0x0809, 0x0909, 0x0a09, 0x0b09, 0x0c09, 0x0d09, 0x0e09, 0x0f09,
+  0x1009, 0x1109, 0x1209, 0x1309, 0x1409, 0x1509, 0x1609, 0x0000,
+  0x1709, 0x1809, 0x1909, 0x1a09, 0x1b09, 0x1c09, 0x1d09, 0x0002,
+  0x0009, 0x0000, 0x0109, 0x0000, 0x0209, 0x0000, 0x0309, 0x0000,
+  0x0409, 0x0000, 0x0509, 0x0000, 0x0609, 0x0000, 0x0709, 0x0000,
+  0x0809, 0x0000, 0x0909, 0x0000, 0x0a09, 0x0000, 0x0b09, 0x0000,
+  0x0c09, 0x0000, 0x0d09, 0x0000, 0x0e09, 0x0000, 0x0f09, 0x0000,
+  0x0009, 0x0000, 0x0109, 0x0000, 0x0209, 0x0000, 0x0309, 0x0000,
+  0x0409, 0x0000, 0x0509, 0x0000, 0x0609, 0x0000, 0x0709, 0x0000,
+  0x0811, 0x0000, 0x0a11, 0x0a11, 0x0c09, 0x0000, 0x0d09, 0x0000,
+  0x0000, 0x0e09, 0x0000, 0x0f09, 0x0000, 0x1009, 0x0000, 0x1111,
+  0x0011, 0x0209, 0x0000, 0x0309, 0x0000, 0x0409, 0x0000, 0x0509,
+  0x0000, 0x0611, 0x0809, 0x0000, 0x0909, 0x0000, 0x0a09, 0x0000,
+  0x0b09, 0x0000, 0x0c09, 0x0000, 0x0d09, 0x0000, 0x0e09, 0x0000,
+  0x0f09, 0x0000, 0x1009, 0x0000, 0x1109, 0x0000, 0x1209, 0x0000,
+  0x0009, 0x0000, 0x0109, 0x0000, 0x0209, 0x0000, 0x0309, 0x0000,
+  0x0409, 0x0000, 0x0509, 0x0000, 0x0609, 0x0000, 0x0709, 0x0000,
+  0x0809, 0x0000, 0x0909, 0x0000, 0x0a09, 0x0000, 0x0b09, 0x0000,
+  0x0c09, 0x0d09, 0x0000, 0x0e09, 0x0000, 0x0f09, 0x0000, 0x1009,
+  0x0000, 0x0009, 0x0109, 0x0000, 0x0209, 0x0000, 0x0309, 0x0409,
+  0x0000, 0x0509, 0x0609, 0x0709, 0x0000, 0x0000, 0x0809, 0x0909,
+  0x0a09, 0x0b09, 0x0000, 0x0c09, 0x0d09, 0x0000, 0x0e09, 0x0f09,
+  0x1009, 0x0000, 0x0000, 0x0000, 0x1109, 0x1209, 0x0000, 0x1309,
+  0x0009, 0x0000, 0x0109, 0x0000, 0x0209, 0x0000, 0x0309, 0x0409,
+  0x0000, 0x0509, 0x0000, 0x0000, 0x0609, 0x0000, 0x0709, 0x0809,
+  0x0000, 0x0909, 0x0a09, 0x0b09, 0x0000, 0x0c09, 0x0000, 0x0d09,
+  0x0e09, 0x0000, 0x0000, 0x0000, 0x0f09, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0011, 0x0011, 0x0011, 0x0211,
+  0x0211, 0x0211, 0x0411, 0x0411, 0x0411, 0x0609, 0x0000, 0x0709,
+  0x0000, 0x0809, 0x0000, 0x0909, 0x0000, 0x0a09, 0x0000, 0x0b09,
+  0x0000, 0x0c09, 0x0000, 0x0d09, 0x0000, 0x0000, 0x0e09, 0x0000,
+  0x0009, 0x0000, 0x0109, 0x0000, 0x0209, 0x0000, 0x0309, 0x0000,
+  0x0409, 0x0000, 0x0509, 0x0000, 0x0609, 0x0000, 0x0709, 0x0000,
+  0x0000, 0x0811, 0x0811, 0x0811, 0x0a09, 0x0000, 0x0b09, 0x0c09,
+  0x0d09, 0x0000, 0x0e09, 0x0000, 0x0f09, 0x0000, 0x1009, 0x0000,
+  0x0009, 0x0000, 0x0109, 0x0000, 0x0209, 0x0000, 0x0309, 0x0000,
+  0x0409, 0x0000, 0x0509, 0x0000, 0x0609, 0x0000, 0x0709, 0x0000,
+  0x0809, 0x0000, 0x0909, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0a09, 0x0b09, 0x0000, 0x0c09, 0x0d09, 0x0000,
+  0x0000, 0x0009, 0x0000, 0x0109, 0x0209, 0x0309, 0x0409, 0x0000,
+  0x0509, 0x0000, 0x0609, 0x0000, 0x0709, 0x0000, 0x0809, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0609, 0x0709,
+  0x0809, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0011, 0x0211, 0x0411, 0x0611, 0x0811, 0x0a11, 0x0000, 0x0000,
+  0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0009, 0x0109, 0x0000, 0x0209, 0x0311, 0x0509, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0003,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0009, 0x0000, 0x0109, 0x0000, 0x0209, 0x0000, 0x0309, 0x0000,
+  0x0004, 0x0004, 0x0411, 0x0000, 0x0000, 0x0000, 0x0609, 0x0709,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0011, 0x0219, 0x0509, 0x0609,
+  0x0709, 0x0809, 0x0909, 0x0004, 0x0a09, 0x0004, 0x0b09, 0x0c09,
+  0x0000, 0x0d09, 0x0e09, 0x0f09, 0x1009, 0x1109, 0x1209, 0x1309,
+  0x1409, 0x1509, 0x1609, 0x1709, 0x1809, 0x1909, 0x1a09, 0x1b09,
+  0x0009, 0x0109, 0x0004, 0x0209, 0x0309, 0x0409, 0x0509, 0x0609,
+  0x0709, 0x0809, 0x0909, 0x0a09, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0009,
+  0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0609, 0x0709, 0x0000,
+  0x0809, 0x0000, 0x0909, 0x0000, 0x0a09, 0x0000, 0x0b09, 0x0000,
+  0x0009, 0x0000, 0x0109, 0x0000, 0x0209, 0x0000, 0x0309, 0x0000,
+  0x0409, 0x0000, 0x0509, 0x0000, 0x0609, 0x0000, 0x0709, 0x0000,
+  0x0809, 0x0909, 0x0a09, 0x0000, 0x0b09, 0x0c09, 0x0000, 0x0d09,
+  0x0000, 0x0e09, 0x0f09, 0x0000, 0x0000, 0x1009, 0x1109, 0x1209,
+  0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0609, 0x0709,
+  0x0809, 0x0909, 0x0a09, 0x0b09, 0x0c09, 0x0d09, 0x0e09, 0x0f09,
+  0x1009, 0x1109, 0x1209, 0x1309, 0x1409, 0x1509, 0x1609, 0x1709,
+  0x1809, 0x1909, 0x1a09, 0x1b09, 0x1c09, 0x1d09, 0x1e09, 0x1f09,
+  0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0609, 0x0709,
+  0x0809, 0x0909, 0x0a09, 0x0b09, 0x0c09, 0x0d09, 0x0e09, 0x0f09,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0109, 0x0000, 0x0209, 0x0000, 0x0309, 0x0000,
+  0x0409, 0x0000, 0x0509, 0x0000, 0x0609, 0x0000, 0x0709, 0x0000,
+  0x0809, 0x0000, 0x0909, 0x0000, 0x0a09, 0x0000, 0x0b09, 0x0000,
+  0x0004, 0x0009, 0x0000, 0x0109, 0x0000, 0x0209, 0x0000, 0x0309,
+  0x0000, 0x0409, 0x0000, 0x0509, 0x0000, 0x0609, 0x0000, 0x0000,
+  0x0709, 0x0000, 0x0809, 0x0000, 0x0909, 0x0000, 0x0a09, 0x0000,
+  0x0b09, 0x0000, 0x0c09, 0x0000, 0x0d09, 0x0000, 0x0e09, 0x0000,
+  0x0009, 0x0000, 0x0109, 0x0000, 0x0209, 0x0000, 0x0309, 0x0000,
+  0x0409, 0x0000, 0x0509, 0x0000, 0x0609, 0x0000, 0x0709, 0x0000,
+  0x0004, 0x0809, 0x0909, 0x0a09, 0x0b09, 0x0c09, 0x0d09, 0x0e09,
+  0x0f09, 0x1009, 0x1109, 0x1209, 0x1309, 0x1409, 0x1509, 0x1609,
+  0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0609, 0x0709,
+  0x0809, 0x0909, 0x0a09, 0x0b09, 0x0c09, 0x0d09, 0x0e09, 0x0f09,
+  0x1009, 0x1109, 0x1209, 0x1309, 0x1409, 0x1509, 0x1609, 0x0004,
+  0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0011,
+  0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0000, 0x0000, 0x0000,
+  0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0004, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0011, 0x0211, 0x0411,
+  0x0611, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0000, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0011, 0x0211, 0x0411, 0x0611, 0x0811, 0x0a11, 0x0c11, 0x0e11,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0000,
+  0x0000, 0x0004, 0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0004, 0x0000, 0x0004, 0x0004, 0x0004, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0004, 0x0004, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0000,
+  0x0000, 0x0004, 0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0000,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0011, 0x0211, 0x0004, 0x0411,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004,
+  0x0004, 0x0000, 0x0000, 0x0000, 0x0004, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0004, 0x0000,
+  0x0000, 0x0004, 0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0004, 0x0000, 0x0011, 0x0004, 0x0000, 0x0211, 0x0004,
+  0x0000, 0x0000, 0x0004, 0x0004, 0x0000, 0x0004, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0004, 0x0000,
+  0x0000, 0x0004, 0x0004, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004,
+  0x0004, 0x0000, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0011, 0x0211, 0x0411, 0x0000, 0x0004, 0x0611, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0000, 0x0000, 0x0000, 0x0004, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0000,
+  0x0000, 0x0000, 0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0004, 0x0000, 0x0000, 0x0004, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0004, 0x0004, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0000,
+  0x0000, 0x0000, 0x0004, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004,
+  0x0000, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0004, 0x0000, 0x0000, 0x0000, 0x0004, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0000,
+  0x0000, 0x0004, 0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0000,
+  0x0000, 0x0004, 0x0004, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0000, 0x0000, 0x0000,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0011, 0x0211, 0x0004, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0000, 0x0000, 0x0004, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0000, 0x0000,
+  0x0000, 0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004,
+  0x0004, 0x0000, 0x0000, 0x0004, 0x0000, 0x0004, 0x0000, 0x0000,
+  0x0004, 0x0004, 0x0004, 0x0000, 0x0000, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0004, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0000, 0x0000,
+  0x0000, 0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004,
+  0x0000, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0000,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0000, 0x0000,
+  0x0000, 0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0004, 0x0004, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0000, 0x0000,
+  0x0000, 0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0000, 0x0000, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0000, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0004, 0x0004, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0000, 0x0000,
+  0x0000, 0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0000, 0x0000, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0000, 0x0000, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0004, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0000, 0x0000,
+  0x0000, 0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0004, 0x0000, 0x0000, 0x0000, 0x0004, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004,
+  0x0004, 0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0000, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004,
+  0x0004, 0x0004, 0x0000, 0x0004, 0x0004, 0x0004, 0x0004, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0000, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0004, 0x0004, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0011, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0004, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0000, 0x0000, 0x0004, 0x0000, 0x0004, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0004, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0000, 0x0004, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0011, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0000, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0004, 0x0004, 0x0011, 0x0211, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0011, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0211, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0411, 0x0000, 0x0000, 0x0000, 0x0000, 0x0611,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0811, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0011, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0000, 0x0000, 0x0211, 0x0000, 0x0411, 0x0611, 0x0819,
+  0x0b11, 0x0d19, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0011, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0211, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0411, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0011, 0x0000, 0x0000, 0x0000, 0x0000, 0x0211,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0411, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0611, 0x0000, 0x0000, 0x0000, 0x0004, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0009,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0109, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004,
+  0x0000, 0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004,
+  0x0000, 0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004,
+  0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0004, 0x0004,
+  0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0000, 0x0000,
+  0x0000, 0x0004, 0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0003, 0x0003, 0x0003, 0x0004, 0x0003,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0004, 0x0004, 0x0004, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0004, 0x0004, 0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0409, 0x0509, 0x0609,
+  0x0709, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0809, 0x0909, 0x0a09, 0x0b09, 0x0c09, 0x0d09, 0x0e09, 0x0f09,
+  0x1009, 0x1109, 0x1209, 0x1309, 0x1409, 0x1509, 0x1609, 0x1709,
+  0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0609, 0x0709,
+  0x0809, 0x0909, 0x0a09, 0x0b09, 0x0c09, 0x0d09, 0x0e09, 0x0f09,
+  0x1009, 0x1109, 0x1209, 0x1309, 0x1409, 0x1509, 0x1609, 0x1709,
+  0x1809, 0x1909, 0x1a09, 0x0004, 0x0004, 0x1b09, 0x1c09, 0x1d09,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x0109, 0x0209, 0x0000,
+  0x0309, 0x0409, 0x0509, 0x0609, 0x0709, 0x0809, 0x0909, 0x0a09,
+  0x0b09, 0x0c09, 0x0d09, 0x0000, 0x0e09, 0x0f09, 0x1009, 0x1109,
+  0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0609, 0x0709,
+  0x0809, 0x0909, 0x0a09, 0x0b09, 0x0c09, 0x0d09, 0x0000, 0x0e09,
+  0x0f09, 0x1009, 0x1109, 0x1209, 0x1309, 0x1409, 0x1509, 0x1609,
+  0x1709, 0x1809, 0x1909, 0x1a09, 0x1b09, 0x1c09, 0x1d09, 0x1e09,
+  0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0609, 0x0709,
+  0x0809, 0x0909, 0x0a09, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0b09, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0009, 0x0109, 0x0209, 0x0309, 0x0409,
+  0x0009, 0x0000, 0x0109, 0x0000, 0x0209, 0x0000, 0x0309, 0x0000,
+  0x0409, 0x0000, 0x0509, 0x0000, 0x0609, 0x0000, 0x0709, 0x0000,
+  0x0809, 0x0000, 0x0909, 0x0000, 0x0a09, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0b11, 0x0d09, 0x0000, 0x0000, 0x0e09, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0609, 0x0709,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004,
+  0x0809, 0x0909, 0x0a09, 0x0b09, 0x0c09, 0x0d09, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0609, 0x0709,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0809, 0x0909, 0x0a09, 0x0b09, 0x0c09, 0x0d09, 0x0e09, 0x0f09,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004,
+  0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0004, 0x0609, 0x0004, 0x0709, 0x0004, 0x0809, 0x0004, 0x0909,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0609, 0x0709,
+  0x0000, 0x0809, 0x0000, 0x0909, 0x0000, 0x0a09, 0x0000, 0x0b09,
+  0x0000, 0x0c09, 0x0000, 0x0d09, 0x0000, 0x0e09, 0x0004, 0x0004,
+  0x0011, 0x0211, 0x0411, 0x0611, 0x0811, 0x0a11, 0x0c11, 0x0e11,
+  0x1011, 0x1211, 0x1411, 0x1611, 0x1811, 0x1a11, 0x1c11, 0x1e11,
+  0x2011, 0x2211, 0x2411, 0x2611, 0x2811, 0x2a11, 0x2c11, 0x2e11,
+  0x3011, 0x3211, 0x3411, 0x3611, 0x3811, 0x3a11, 0x3c11, 0x3e11,
+  0x0011, 0x0211, 0x0411, 0x0611, 0x0811, 0x0a11, 0x0c11, 0x0e11,
+  0x1011, 0x1211, 0x1411, 0x1611, 0x1811, 0x1a11, 0x1c11, 0x1e11,
+  0x0000, 0x0000, 0x2011, 0x2211, 0x2411, 0x0004, 0x0000, 0x2611,
+  0x2809, 0x2909, 0x2a09, 0x2b09, 0x2c11, 0x2e11, 0x3009, 0x3111,
+  0x0011, 0x0219, 0x0511, 0x0711, 0x0911, 0x0004, 0x0000, 0x0b11,
+  0x0d09, 0x0e09, 0x0f09, 0x1009, 0x1111, 0x1319, 0x1619, 0x1919,
+  0x0000, 0x0000, 0x0000, 0x1c09, 0x0004, 0x0004, 0x0000, 0x0000,
+  0x1d09, 0x1e09, 0x1f09, 0x2009, 0x0004, 0x2119, 0x2419, 0x2719,
+  0x0000, 0x0000, 0x0000, 0x0009, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0619, 0x0919, 0x0c09,
+  0x0004, 0x0004, 0x0d11, 0x0f11, 0x1111, 0x0004, 0x0000, 0x1311,
+  0x1509, 0x1609, 0x1709, 0x1809, 0x1911, 0x1b11, 0x1d11, 0x0004,
+  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
+  0x0009, 0x0009, 0x0009, 0x0003, 0x0002, 0x0002, 0x0004, 0x0004,
+  0x0000, 0x0109, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0211,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0000,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0009,
+  0x0000, 0x0000, 0x0000, 0x0111, 0x0319, 0x0000, 0x0611, 0x0819,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0b11, 0x0000, 0x0d11, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0011,
+  0x0211, 0x0411, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0621,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0a09,
+  0x0003, 0x0004, 0x0004, 0x0004, 0x0003, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0009, 0x0109, 0x0004, 0x0004, 0x0209, 0x0309, 0x0409, 0x0509,
+  0x0609, 0x0709, 0x0809, 0x0909, 0x0a09, 0x0b09, 0x0c09, 0x0d09,
+  0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0609, 0x0709,
+  0x0809, 0x0909, 0x0a09, 0x0b09, 0x0c09, 0x0d09, 0x0e09, 0x0004,
+  0x0f09, 0x1009, 0x1109, 0x1209, 0x1309, 0x1409, 0x1509, 0x1609,
+  0x1709, 0x1809, 0x1909, 0x1a09, 0x1b09, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0011, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0019, 0x0319, 0x0609, 0x0711, 0x0000, 0x0919, 0x0c19, 0x0f09,
+  0x0000, 0x1011, 0x1209, 0x1309, 0x1309, 0x1309, 0x1309, 0x1409,
+  0x1509, 0x1509, 0x1609, 0x1609, 0x0000, 0x1709, 0x1811, 0x0000,
+  0x0000, 0x1a09, 0x1b09, 0x1c09, 0x1c09, 0x1c09, 0x0000, 0x0000,
+  0x0011, 0x0219, 0x0511, 0x0000, 0x0709, 0x0000, 0x0809, 0x0000,
+  0x0909, 0x0000, 0x0a09, 0x0b09, 0x0c09, 0x0d09, 0x0000, 0x0e09,
+  0x0e09, 0x0f09, 0x0004, 0x1009, 0x1109, 0x1209, 0x1309, 0x1409,
+  0x1509, 0x1609, 0x0000, 0x1719, 0x1a09, 0x1b09, 0x1b09, 0x1c09,
+  0x0009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0109, 0x0109, 0x0209,
+  0x0309, 0x0409, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0519, 0x0819, 0x0b21, 0x0f19, 0x1219, 0x1519, 0x1819, 0x1b19,
+  0x1e19, 0x2119, 0x2419, 0x2719, 0x2a19, 0x2d19, 0x3019, 0x3311,
+  0x0009, 0x0111, 0x0319, 0x0611, 0x0809, 0x0911, 0x0b19, 0x0e21,
+  0x1211, 0x1409, 0x1511, 0x1719, 0x1a09, 0x1b09, 0x1c09, 0x1d09,
+  0x1e09, 0x1f11, 0x2119, 0x2411, 0x2609, 0x2711, 0x2919, 0x2c21,
+  0x3011, 0x3209, 0x3311, 0x3519, 0x3809, 0x3909, 0x3a09, 0x3b09,
+  0x0000, 0x0000, 0x0000, 0x0004, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0019, 0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0011, 0x0219, 0x0000, 0x0511,
+  0x0719, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0009, 0x0109, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0609, 0x0709,
+  0x0809, 0x0911, 0x0b11, 0x0d11, 0x0f11, 0x1111, 0x1311, 0x1511,
+  0x1711, 0x1911, 0x1b11, 0x1d11, 0x1f19, 0x2219, 0x2519, 0x2819,
+  0x2b19, 0x2e19, 0x3119, 0x3419, 0x3719, 0x3a21, 0x3e21, 0x4221,
+  0x0021, 0x0421, 0x0821, 0x0c21, 0x1021, 0x1421, 0x1821, 0x1c21,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x2019, 0x2319, 0x2619, 0x2919,
+  0x0019, 0x0319, 0x0619, 0x0919, 0x0c19, 0x0f19, 0x1219, 0x1519,
+  0x1819, 0x1b19, 0x1e19, 0x2119, 0x2419, 0x2719, 0x2a19, 0x2d19,
+  0x3019, 0x3319, 0x3619, 0x3919, 0x3c19, 0x3f19, 0x4209, 0x4309,
+  0x4409, 0x4509, 0x4609, 0x4709, 0x4809, 0x4909, 0x4a09, 0x4b09,
+  0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0609, 0x0709,
+  0x0809, 0x0909, 0x0a09, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0019, 0x0311, 0x0519, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0011, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0009, 0x0000, 0x0109, 0x0209, 0x0309, 0x0000, 0x0000, 0x0409,
+  0x0000, 0x0509, 0x0000, 0x0609, 0x0000, 0x0709, 0x0809, 0x0909,
+  0x0a09, 0x0000, 0x0b09, 0x0000, 0x0000, 0x0c09, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0d09, 0x0e09, 0x0f09, 0x1009,
+  0x0009, 0x0000, 0x0109, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0209, 0x0000, 0x0309, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0409, 0x0000, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0000,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0000, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0009,
+  0x0000, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0009,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0009, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0609, 0x0709,
+  0x0809, 0x0909, 0x0a09, 0x0b09, 0x0c09, 0x0d09, 0x0e09, 0x0f09,
+  0x1009, 0x1109, 0x1209, 0x1309, 0x1409, 0x1509, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0009, 0x0000, 0x0109, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x0000,
+  0x0109, 0x0209, 0x0309, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004,
+  0x0004, 0x0000, 0x0000, 0x0011, 0x0211, 0x0000, 0x0000, 0x0411,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0011,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0004, 0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0609,
+  0x0709, 0x0809, 0x0909, 0x0a09, 0x0b09, 0x0c09, 0x0d09, 0x0e09,
+  0x0009, 0x0109, 0x0209, 0x0309, 0x0004, 0x0409, 0x0509, 0x0609,
+  0x0709, 0x0809, 0x0909, 0x0a09, 0x0b09, 0x0c09, 0x0d09, 0x0e09,
+  0x0f09, 0x1009, 0x1109, 0x1209, 0x1309, 0x1409, 0x1509, 0x1609,
+  0x1709, 0x1809, 0x1909, 0x1a09, 0x1b09, 0x1c09, 0x1d09, 0x1e09,
+  0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0609, 0x0709,
+  0x0809, 0x0909, 0x0a09, 0x0b09, 0x0c09, 0x0d09, 0x0e09, 0x0004,
+  0x0000, 0x0000, 0x0f09, 0x1009, 0x1109, 0x1209, 0x1309, 0x1409,
+  0x1509, 0x1609, 0x1709, 0x1809, 0x1909, 0x1a09, 0x1b09, 0x1c09,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0019, 0x0319, 0x0619, 0x0919, 0x0c19, 0x0f19, 0x1219, 0x1519,
+  0x1819, 0x1b19, 0x1e19, 0x2119, 0x2419, 0x2719, 0x2a19, 0x2d19,
+  0x3019, 0x3319, 0x3619, 0x3919, 0x3c19, 0x3f19, 0x4219, 0x4519,
+  0x4819, 0x4b19, 0x4e19, 0x5119, 0x5419, 0x5721, 0x5b21, 0x0004,
+  0x0019, 0x0319, 0x0619, 0x0919, 0x0c19, 0x0f19, 0x1219, 0x1519,
+  0x1819, 0x1b19, 0x1e19, 0x2119, 0x2419, 0x2719, 0x2a19, 0x2d19,
+  0x3019, 0x3319, 0x3619, 0x3919, 0x3c19, 0x3f19, 0x4219, 0x4519,
+  0x4819, 0x4b19, 0x4e19, 0x5119, 0x5419, 0x5719, 0x5a19, 0x5d19,
+  0x0019, 0x0319, 0x0619, 0x0919, 0x0c09, 0x0d09, 0x0e09, 0x0f09,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x1019, 0x1311, 0x1511, 0x1711, 0x1911, 0x1b11, 0x1d11, 0x1f11,
+  0x2111, 0x2311, 0x2511, 0x2711, 0x2911, 0x2b11, 0x2d11, 0x2f11,
+  0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0609, 0x0709,
+  0x0809, 0x0909, 0x0a09, 0x0b09, 0x0c09, 0x0d09, 0x0e09, 0x0f09,
+  0x1009, 0x1109, 0x1209, 0x1309, 0x1409, 0x1509, 0x1609, 0x1709,
+  0x1809, 0x1909, 0x1a09, 0x1b09, 0x1c11, 0x1e11, 0x2009, 0x0000,
+  0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0609, 0x0709,
+  0x0809, 0x0909, 0x0a09, 0x0b09, 0x0c09, 0x0d09, 0x0e09, 0x0f09,
+  0x1009, 0x1111, 0x1311, 0x1511, 0x1711, 0x1911, 0x1b11, 0x1d11,
+  0x1f11, 0x2111, 0x2311, 0x2511, 0x2711, 0x2911, 0x2b11, 0x2d11,
+  0x0011, 0x0211, 0x0411, 0x0611, 0x0811, 0x0a11, 0x0c11, 0x0e11,
+  0x1011, 0x1219, 0x1519, 0x1819, 0x1b11, 0x1d19, 0x2011, 0x2219,
+  0x2509, 0x2609, 0x2709, 0x2809, 0x2909, 0x2a09, 0x2b09, 0x2c09,
+  0x2d09, 0x2e09, 0x2f09, 0x3009, 0x3109, 0x3209, 0x3309, 0x3409,
+  0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0609, 0x0709,
+  0x0809, 0x0909, 0x0a09, 0x0b09, 0x0c09, 0x0d09, 0x0e09, 0x0f09,
+  0x1009, 0x1109, 0x1209, 0x1309, 0x1409, 0x1509, 0x1609, 0x1709,
+  0x1809, 0x1909, 0x1a09, 0x1b09, 0x1c09, 0x1d09, 0x1e09, 0x1f11,
+  0x0021, 0x0421, 0x0821, 0x0c19, 0x0f21, 0x1319, 0x1619, 0x1929,
+  0x1e21, 0x2219, 0x2519, 0x2819, 0x2b21, 0x2f21, 0x3319, 0x3619,
+  0x3911, 0x3b19, 0x3e21, 0x4221, 0x4611, 0x4829, 0x4d31, 0x5329,
+  0x5819, 0x5b29, 0x6029, 0x6521, 0x6919, 0x6c19, 0x6f19, 0x7221,
+  0x0029, 0x0521, 0x0919, 0x0c19, 0x0f19, 0x1211, 0x1411, 0x1611,
+  0x1811, 0x1a19, 0x1d19, 0x2029, 0x2519, 0x2821, 0x2c29, 0x3119,
+  0x3411, 0x3611, 0x3829, 0x3d21, 0x4129, 0x4619, 0x4929, 0x4e11,
+  0x5019, 0x5319, 0x5619, 0x5919, 0x5c19, 0x5f21, 0x6319, 0x6611,
+  0x0019, 0x0319, 0x0619, 0x0921, 0x0d19, 0x1019, 0x1319, 0x1629,
+  0x1b21, 0x1f11, 0x2129, 0x2611, 0x2821, 0x2c21, 0x3019, 0x3319,
+  0x3619, 0x3921, 0x3d11, 0x3f19, 0x4221, 0x4611, 0x4829, 0x4d19,
+  0x5011, 0x5211, 0x5411, 0x5611, 0x5811, 0x5a11, 0x5c11, 0x5e11,
+  0x0011, 0x0211, 0x0419, 0x0719, 0x0a19, 0x0d19, 0x1019, 0x1319,
+  0x1619, 0x1919, 0x1c19, 0x1f19, 0x2219, 0x2519, 0x2819, 0x2b19,
+  0x2e19, 0x3119, 0x3411, 0x3611, 0x3819, 0x3b11, 0x3d11, 0x3f11,
+  0x4119, 0x4419, 0x4711, 0x4911, 0x4b11, 0x4d11, 0x4f11, 0x5121,
+  0x0011, 0x0211, 0x0411, 0x0611, 0x0811, 0x0a11, 0x0c11, 0x0e11,
+  0x1019, 0x1321, 0x1711, 0x1911, 0x1b11, 0x1d11, 0x1f11, 0x2111,
+  0x2311, 0x2519, 0x2819, 0x2b19, 0x2e19, 0x3111, 0x3311, 0x3511,
+  0x3711, 0x3911, 0x3b11, 0x3d11, 0x3f11, 0x4111, 0x4311, 0x4519,
+  0x0019, 0x0311, 0x0519, 0x0819, 0x0b19, 0x0e11, 0x1019, 0x1319,
+  0x1621, 0x1a11, 0x1c19, 0x1f19, 0x2219, 0x2519, 0x2829, 0x2d31,
+  0x3311, 0x3511, 0x3711, 0x3911, 0x3b11, 0x3d11, 0x3f11, 0x4111,
+  0x4311, 0x4511, 0x4711, 0x4911, 0x4b11, 0x4d11, 0x4f11, 0x5111,
+  0x0011, 0x0211, 0x0004, 0x0411, 0x0611, 0x0811, 0x0a21, 0x0004,
+  0x0e11, 0x1011, 0x1211, 0x1411, 0x1611, 0x1811, 0x1a11, 0x1c11,
+  0x1e11, 0x2011, 0x2219, 0x2511, 0x2711, 0x2919, 0x2c19, 0x2f11,
+  0x0004, 0x3119, 0x3411, 0x3611, 0x3811, 0x3a11, 0x3c19, 0x3f19,
+  0x0011, 0x0211, 0x0411, 0x0611, 0x0811, 0x0a11, 0x0c11, 0x0e11,
+  0x1011, 0x1219, 0x1519, 0x1819, 0x1b19, 0x1e19, 0x2119, 0x2419,
+  0x2719, 0x2a19, 0x2d19, 0x3019, 0x3319, 0x3619, 0x3919, 0x3c19,
+  0x3f19, 0x4219, 0x4519, 0x4819, 0x4b19, 0x4e19, 0x5119, 0x5419,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0009, 0x0000, 0x0109, 0x0000, 0x0209, 0x0000, 0x0309, 0x0000,
+  0x0409, 0x0000, 0x0509, 0x0000, 0x0609, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0009, 0x0000, 0x0109, 0x0000, 0x0209, 0x0000, 0x0309, 0x0000,
+  0x0409, 0x0000, 0x0509, 0x0000, 0x0609, 0x0000, 0x0709, 0x0000,
+  0x0809, 0x0000, 0x0909, 0x0000, 0x0a09, 0x0000, 0x0b09, 0x0000,
+  0x0c09, 0x0000, 0x0d09, 0x0000, 0x0e09, 0x0f09, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0009, 0x0000, 0x0109, 0x0000, 0x0209, 0x0000,
+  0x0309, 0x0000, 0x0409, 0x0000, 0x0509, 0x0000, 0x0609, 0x0000,
+  0x0000, 0x0000, 0x0709, 0x0000, 0x0809, 0x0000, 0x0909, 0x0000,
+  0x0a09, 0x0000, 0x0b09, 0x0000, 0x0c09, 0x0000, 0x0d09, 0x0000,
+  0x0009, 0x0000, 0x0109, 0x0000, 0x0209, 0x0000, 0x0309, 0x0000,
+  0x0409, 0x0000, 0x0509, 0x0000, 0x0609, 0x0000, 0x0709, 0x0000,
+  0x0809, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0909, 0x0000, 0x0a09, 0x0000, 0x0b09, 0x0c09, 0x0000,
+  0x0009, 0x0000, 0x0109, 0x0000, 0x0209, 0x0000, 0x0309, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0409, 0x0000, 0x0509, 0x0000, 0x0000,
+  0x0609, 0x0000, 0x0709, 0x0000, 0x0000, 0x0000, 0x0809, 0x0000,
+  0x0909, 0x0000, 0x0a09, 0x0000, 0x0b09, 0x0000, 0x0c09, 0x0000,
+  0x0009, 0x0000, 0x0109, 0x0000, 0x0209, 0x0000, 0x0309, 0x0000,
+  0x0409, 0x0000, 0x0509, 0x0609, 0x0709, 0x0809, 0x0909, 0x0000,
+  0x0a09, 0x0b09, 0x0c09, 0x0d09, 0x0e09, 0x0000, 0x0f09, 0x0000,
+  0x1009, 0x0000, 0x1109, 0x0000, 0x1209, 0x0000, 0x1309, 0x0000,
+  0x0009, 0x0000, 0x0109, 0x0000, 0x0209, 0x0309, 0x0409, 0x0509,
+  0x0000, 0x0609, 0x0000, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0709, 0x0000, 0x0004, 0x0000, 0x0004, 0x0000, 0x0809, 0x0000,
+  0x0909, 0x0000, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0009, 0x0109, 0x0209, 0x0309, 0x0000, 0x0000,
+  0x0409, 0x0509, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0004, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0004, 0x0004, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004,
+  0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004,
+  0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x0109, 0x0209, 0x0309,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0009, 0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0609, 0x0709, 0x0809,
+  0x0909, 0x0a09, 0x0b09, 0x0c09, 0x0d09, 0x0e09, 0x0f09, 0x1009,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0609, 0x0709,
+  0x0709, 0x0809, 0x0909, 0x0a09, 0x0b09, 0x0c09, 0x0d09, 0x0e09,
+  0x0f09, 0x1009, 0x1109, 0x1209, 0x1309, 0x1409, 0x1509, 0x1609,
+  0x1709, 0x1809, 0x1909, 0x1a09, 0x1b09, 0x1c09, 0x1d09, 0x1e09,
+  0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0609, 0x0709,
+  0x0809, 0x0909, 0x0a09, 0x0b09, 0x0c09, 0x0d09, 0x0000, 0x0000,
+  0x0e09, 0x0000, 0x0f09, 0x0000, 0x0000, 0x1009, 0x1109, 0x1209,
+  0x1309, 0x1409, 0x1509, 0x1609, 0x1709, 0x1809, 0x1909, 0x0000,
+  0x0009, 0x0000, 0x0109, 0x0000, 0x0000, 0x0209, 0x0309, 0x0000,
+  0x0000, 0x0000, 0x0409, 0x0509, 0x0609, 0x0709, 0x0809, 0x0909,
+  0x0a09, 0x0b09, 0x0c09, 0x0d09, 0x0e09, 0x0f09, 0x1009, 0x1109,
+  0x1209, 0x1309, 0x1409, 0x1509, 0x1609, 0x1709, 0x1809, 0x1909,
+  0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0609, 0x0709,
+  0x0809, 0x0909, 0x0a09, 0x0b09, 0x0c09, 0x0d09, 0x0e09, 0x0f09,
+  0x1009, 0x1109, 0x1209, 0x1309, 0x1409, 0x1509, 0x1609, 0x1709,
+  0x1809, 0x1909, 0x1a09, 0x1b09, 0x1c09, 0x1d09, 0x1d09, 0x1e09,
+  0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0609, 0x0709,
+  0x0809, 0x0909, 0x0a09, 0x0b09, 0x0c09, 0x0d09, 0x0004, 0x0004,
+  0x0e09, 0x0f09, 0x1009, 0x1109, 0x1209, 0x1309, 0x1409, 0x1509,
+  0x1609, 0x1709, 0x1809, 0x1909, 0x1a09, 0x1b09, 0x1c09, 0x1d09,
+  0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0609, 0x0709,
+  0x0809, 0x0909, 0x0a09, 0x0b09, 0x0c09, 0x0d09, 0x0e09, 0x0f09,
+  0x1009, 0x1109, 0x1209, 0x1309, 0x1409, 0x1509, 0x1609, 0x1709,
+  0x1809, 0x1909, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0011, 0x0211, 0x0411, 0x0619, 0x0919, 0x0c11, 0x0c11, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0e11, 0x1011, 0x1211, 0x1411, 0x1611,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x1811, 0x0000, 0x1a11,
+  0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0609, 0x0709,
+  0x0809, 0x0909, 0x0a11, 0x0c11, 0x0e19, 0x1119, 0x1411, 0x1611,
+  0x1811, 0x1a11, 0x1c11, 0x1e11, 0x2011, 0x2211, 0x2411, 0x0004,
+  0x2611, 0x2811, 0x2a11, 0x2c11, 0x2e11, 0x0004, 0x3011, 0x0004,
+  0x0011, 0x0211, 0x0004, 0x0411, 0x0611, 0x0004, 0x0811, 0x0a11,
+  0x0c11, 0x0e11, 0x1011, 0x1211, 0x1411, 0x1611, 0x1811, 0x1a11,
+  0x1c09, 0x1c09, 0x1d09, 0x1d09, 0x1d09, 0x1d09, 0x1e09, 0x1e09,
+  0x1e09, 0x1e09, 0x1f09, 0x1f09, 0x1f09, 0x1f09, 0x2009, 0x2009,
+  0x0009, 0x0009, 0x0109, 0x0109, 0x0109, 0x0109, 0x0209, 0x0209,
+  0x0209, 0x0209, 0x0309, 0x0309, 0x0309, 0x0309, 0x0409, 0x0409,
+  0x0409, 0x0409, 0x0509, 0x0509, 0x0509, 0x0509, 0x0609, 0x0609,
+  0x0609, 0x0609, 0x0709, 0x0709, 0x0709, 0x0709, 0x0809, 0x0809,
+  0x0009, 0x0009, 0x0109, 0x0109, 0x0209, 0x0209, 0x0309, 0x0309,
+  0x0409, 0x0409, 0x0509, 0x0509, 0x0609, 0x0609, 0x0709, 0x0709,
+  0x0709, 0x0709, 0x0809, 0x0809, 0x0809, 0x0809, 0x0909, 0x0909,
+  0x0909, 0x0909, 0x0a09, 0x0a09, 0x0a09, 0x0a09, 0x0b09, 0x0b09,
+  0x0009, 0x0009, 0x0009, 0x0009, 0x0109, 0x0109, 0x0209, 0x0209,
+  0x0209, 0x0209, 0x0309, 0x0309, 0x0309, 0x0309, 0x0409, 0x0409,
+  0x0509, 0x0509, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0009, 0x0009, 0x0009, 0x0009, 0x0109,
+  0x0109, 0x0209, 0x0209, 0x0309, 0x0309, 0x0411, 0x0609, 0x0609,
+  0x0009, 0x0009, 0x0109, 0x0109, 0x0209, 0x0209, 0x0209, 0x0209,
+  0x0309, 0x0309, 0x0411, 0x0411, 0x0611, 0x0611, 0x0811, 0x0811,
+  0x0a11, 0x0a11, 0x0c11, 0x0c11, 0x0e11, 0x0e11, 0x1011, 0x1011,
+  0x1011, 0x1211, 0x1211, 0x1211, 0x1409, 0x1409, 0x1409, 0x1409,
+  0x0011, 0x0211, 0x0411, 0x0611, 0x0811, 0x0a11, 0x0c11, 0x0e11,
+  0x1011, 0x1211, 0x1411, 0x1611, 0x1811, 0x1a11, 0x1c11, 0x1e11,
+  0x2011, 0x2211, 0x2411, 0x2611, 0x2811, 0x2a11, 0x2c11, 0x2e11,
+  0x3011, 0x3211, 0x3411, 0x3611, 0x3811, 0x3a11, 0x3c19, 0x3f19,
+  0x0019, 0x0319, 0x0619, 0x0919, 0x0c11, 0x0e11, 0x1011, 0x1211,
+  0x1411, 0x1611, 0x1811, 0x1a11, 0x1c11, 0x1e11, 0x2011, 0x2211,
+  0x2411, 0x2611, 0x2811, 0x2a11, 0x2c11, 0x2e11, 0x3011, 0x3211,
+  0x3411, 0x3611, 0x3811, 0x3a11, 0x3c11, 0x3e11, 0x4011, 0x4211,
+  0x0011, 0x0211, 0x0411, 0x0611, 0x0811, 0x0a11, 0x0c11, 0x0e11,
+  0x1011, 0x1211, 0x1411, 0x1611, 0x1811, 0x1a11, 0x1c11, 0x1e11,
+  0x2011, 0x2211, 0x2419, 0x2719, 0x2a19, 0x2d11, 0x2f11, 0x3111,
+  0x3311, 0x3511, 0x3711, 0x3911, 0x3b11, 0x3d11, 0x3f11, 0x4111,
+  0x0011, 0x0211, 0x0411, 0x0611, 0x0811, 0x0a11, 0x0c11, 0x0e11,
+  0x1011, 0x1211, 0x1411, 0x1611, 0x1811, 0x1a11, 0x1c11, 0x1e11,
+  0x2011, 0x2211, 0x2411, 0x2611, 0x2811, 0x2a11, 0x2c11, 0x2e11,
+  0x3011, 0x3211, 0x3411, 0x3611, 0x3811, 0x3811, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0019, 0x0319, 0x0319, 0x0619, 0x0919, 0x0c19, 0x0f19, 0x1219,
+  0x1519, 0x1519, 0x1819, 0x1b19, 0x1e19, 0x2119, 0x2419, 0x2719,
+  0x0019, 0x0319, 0x0619, 0x0619, 0x0919, 0x0919, 0x0c19, 0x0f19,
+  0x0f19, 0x1219, 0x1519, 0x1519, 0x1819, 0x1819, 0x1b19, 0x1e19,
+  0x1e19, 0x2119, 0x2119, 0x2419, 0x2719, 0x2a19, 0x2d19, 0x2d19,
+  0x3019, 0x3319, 0x3619, 0x3919, 0x3c19, 0x3c19, 0x3f19, 0x4219,
+  0x0019, 0x0319, 0x0619, 0x0919, 0x0919, 0x0c19, 0x0c19, 0x0f19,
+  0x0f19, 0x1219, 0x1519, 0x1819, 0x1b19, 0x1e19, 0x2119, 0x2419,
+  0x0004, 0x0004, 0x2719, 0x2a19, 0x2d19, 0x3019, 0x3319, 0x3619,
+  0x3619, 0x3919, 0x3c19, 0x3f19, 0x4219, 0x4219, 0x4519, 0x4819,
+  0x0019, 0x0319, 0x0619, 0x0919, 0x0c19, 0x0f19, 0x1219, 0x1519,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0000,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0019, 0x0319, 0x0621, 0x0a21, 0x0e21, 0x1221, 0x1621, 0x1a21,
+  0x1e21, 0x2219, 0x2591, 0x3741, 0x3f21, 0x0000, 0x0000, 0x0000,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0009, 0x0109, 0x0004, 0x0209, 0x0309, 0x0409, 0x0509, 0x0609,
+  0x0709, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0004, 0x0009, 0x0109, 0x0209, 0x0209, 0x0309, 0x0409, 0x0509,
+  0x0609, 0x0709, 0x0809, 0x0909, 0x0a09, 0x0b09, 0x0c09, 0x0d09,
+  0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0000, 0x0000, 0x0509,
+  0x0609, 0x0711, 0x0711, 0x0711, 0x0711, 0x0909, 0x0909, 0x0909,
+  0x0a09, 0x0b09, 0x0004, 0x0004, 0x0c09, 0x0d09, 0x0e09, 0x0f09,
+  0x1009, 0x1109, 0x1209, 0x1309, 0x1409, 0x1509, 0x1609, 0x1709,
+  0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0609, 0x0004,
+  0x0709, 0x0809, 0x0909, 0x0a09, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0b11, 0x0d11, 0x0f11, 0x0000, 0x1111, 0x0004, 0x1311, 0x1511,
+  0x1711, 0x1911, 0x1b11, 0x1d11, 0x1f11, 0x2111, 0x2311, 0x2511,
+  0x0009, 0x0109, 0x0109, 0x0209, 0x0209, 0x0309, 0x0309, 0x0409,
+  0x0409, 0x0509, 0x0509, 0x0509, 0x0509, 0x0609, 0x0609, 0x0709,
+  0x0709, 0x0709, 0x0709, 0x0809, 0x0809, 0x0909, 0x0909, 0x0909,
+  0x0909, 0x0a09, 0x0a09, 0x0a09, 0x0a09, 0x0b09, 0x0b09, 0x0b09,
+  0x0009, 0x0109, 0x0109, 0x0109, 0x0109, 0x0209, 0x0209, 0x0209,
+  0x0209, 0x0309, 0x0309, 0x0409, 0x0409, 0x0509, 0x0509, 0x0609,
+  0x0609, 0x0709, 0x0709, 0x0709, 0x0709, 0x0809, 0x0809, 0x0809,
+  0x0809, 0x0909, 0x0909, 0x0909, 0x0909, 0x0a09, 0x0a09, 0x0a09,
+  0x0009, 0x0109, 0x0109, 0x0109, 0x0109, 0x0209, 0x0209, 0x0209,
+  0x0209, 0x0309, 0x0309, 0x0309, 0x0309, 0x0409, 0x0409, 0x0409,
+  0x0409, 0x0509, 0x0509, 0x0509, 0x0509, 0x0609, 0x0609, 0x0609,
+  0x0609, 0x0709, 0x0709, 0x0709, 0x0709, 0x0809, 0x0809, 0x0809,
+  0x0009, 0x0109, 0x0109, 0x0109, 0x0109, 0x0209, 0x0209, 0x0209,
+  0x0209, 0x0309, 0x0309, 0x0309, 0x0309, 0x0409, 0x0409, 0x0509,
+  0x0509, 0x0609, 0x0609, 0x0609, 0x0609, 0x0711, 0x0711, 0x0911,
+  0x0911, 0x0b11, 0x0b11, 0x0d11, 0x0d11, 0x0004, 0x0004, 0x0003,
+  0x0004, 0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0609,
+  0x0709, 0x0809, 0x0909, 0x0a09, 0x0b09, 0x0c09, 0x0d09, 0x0e09,
+  0x0f09, 0x1009, 0x1109, 0x1209, 0x1309, 0x1409, 0x1509, 0x1609,
+  0x1709, 0x1809, 0x1909, 0x1a09, 0x1b09, 0x1c09, 0x1d09, 0x1e09,
+  0x0004, 0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0609,
+  0x0709, 0x0809, 0x0909, 0x0a09, 0x0b09, 0x0c09, 0x0d09, 0x0e09,
+  0x0f09, 0x1009, 0x1109, 0x1209, 0x1309, 0x1409, 0x1509, 0x1609,
+  0x1709, 0x1809, 0x1909, 0x1a09, 0x1b09, 0x1c09, 0x1d09, 0x0004,
+  0x0004, 0x0004, 0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0509,
+  0x0004, 0x0004, 0x0609, 0x0709, 0x0809, 0x0909, 0x0a09, 0x0b09,
+  0x0004, 0x0004, 0x0c09, 0x0d09, 0x0e09, 0x0f09, 0x1009, 0x1109,
+  0x0004, 0x0004, 0x1209, 0x1309, 0x1409, 0x0004, 0x0004, 0x0004,
+  0x0009, 0x0109, 0x0209, 0x0311, 0x0509, 0x0609, 0x0709, 0x0004,
+  0x0809, 0x0909, 0x0a09, 0x0b09, 0x0c09, 0x0d09, 0x0e09, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0004, 0x0000, 0x0000, 0x0004, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0004, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0609, 0x0709,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0609, 0x0709,
+  0x0809, 0x0909, 0x0a09, 0x0b09, 0x0c09, 0x0d09, 0x0e09, 0x0f09,
+  0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0609, 0x0709,
+  0x0809, 0x0909, 0x0a09, 0x0b09, 0x0c09, 0x0d09, 0x0e09, 0x0f09,
+  0x1009, 0x1109, 0x1209, 0x1309, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0000,
+  0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0609, 0x0709,
+  0x0809, 0x0909, 0x0a09, 0x0004, 0x0b09, 0x0c09, 0x0d09, 0x0e09,
+  0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0609, 0x0709,
+  0x0809, 0x0909, 0x0a09, 0x0004, 0x0b09, 0x0c09, 0x0d09, 0x0e09,
+  0x0f09, 0x1009, 0x1109, 0x0004, 0x1209, 0x1309, 0x0004, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0004, 0x0000, 0x0000, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0004, 0x0509,
+  0x0609, 0x0709, 0x0809, 0x0909, 0x0a09, 0x0b09, 0x0c09, 0x0d09,
+  0x0e09, 0x0f09, 0x1009, 0x1109, 0x1209, 0x1309, 0x1409, 0x1509,
+  0x1609, 0x1709, 0x1809, 0x1909, 0x1a09, 0x1b09, 0x1c09, 0x1d09,
+  0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0609, 0x0709,
+  0x0809, 0x0909, 0x0a09, 0x0b09, 0x0c09, 0x0d09, 0x0e09, 0x0f09,
+  0x1009, 0x0004, 0x1109, 0x1209, 0x1309, 0x1409, 0x1509, 0x1609,
+  0x1709, 0x1809, 0x1909, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004,
+  0x0000, 0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0000,
+  0x0000, 0x0004, 0x0004, 0x0004, 0x0000, 0x0004, 0x0004, 0x0000,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0004, 0x0000, 0x0000, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0004, 0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0000, 0x0000, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0000, 0x0000, 0x0000,
+  0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0004, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004,
+  0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0609, 0x0709,
+  0x0809, 0x0909, 0x0a09, 0x0b09, 0x0c09, 0x0d09, 0x0e09, 0x0f09,
+  0x1009, 0x1109, 0x1209, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0004, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004,
+  0x0000, 0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0004, 0x0000, 0x0000, 0x0004, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0000,
+  0x0000, 0x0004, 0x0004, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004,
+  0x0000, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0000,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004,
+  0x0004, 0x0000, 0x0004, 0x0004, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0000, 0x0000, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0000,
+  0x0000, 0x0004, 0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0004, 0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0004, 0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004,
+  0x0000, 0x0000, 0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004,
+  0x0004, 0x0004, 0x0000, 0x0004, 0x0000, 0x0000, 0x0004, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0000,
+  0x0000, 0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004,
+  0x0000, 0x0000, 0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0000, 0x0000,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0004, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0004, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0000, 0x0000, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0000, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0000, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0004, 0x0004, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004,
+  0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0011, 0x0211,
+  0x0019, 0x0319, 0x0619, 0x0919, 0x0c19, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0011, 0x0211, 0x0419, 0x0719, 0x0a19,
+  0x0019, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0609, 0x0709,
+  0x0809, 0x0909, 0x0a09, 0x0b09, 0x0c09, 0x0d09, 0x0e09, 0x0f09,
+  0x1009, 0x1109, 0x1209, 0x1309, 0x1409, 0x0004, 0x1509, 0x1609,
+  0x1709, 0x1809, 0x1909, 0x1a09, 0x1b09, 0x1c09, 0x1d09, 0x1e09,
+  0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0609, 0x0709,
+  0x0809, 0x0909, 0x0a09, 0x0b09, 0x0c09, 0x0d09, 0x0e09, 0x0f09,
+  0x1009, 0x1109, 0x1209, 0x1309, 0x1409, 0x1509, 0x1609, 0x1709,
+  0x1809, 0x1909, 0x1a09, 0x1b09, 0x1c09, 0x0004, 0x1d09, 0x1e09,
+  0x0004, 0x0004, 0x0009, 0x0004, 0x0004, 0x0109, 0x0209, 0x0004,
+  0x0004, 0x0309, 0x0409, 0x0509, 0x0609, 0x0004, 0x0709, 0x0809,
+  0x0909, 0x0a09, 0x0b09, 0x0c09, 0x0d09, 0x0e09, 0x0f09, 0x1009,
+  0x1109, 0x1209, 0x0004, 0x1309, 0x0004, 0x1409, 0x1509, 0x1609,
+  0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0004, 0x0609,
+  0x0709, 0x0809, 0x0909, 0x0004, 0x0004, 0x0a09, 0x0b09, 0x0c09,
+  0x0d09, 0x0e09, 0x0f09, 0x1009, 0x1109, 0x0004, 0x1209, 0x1309,
+  0x1409, 0x1509, 0x1609, 0x1709, 0x1809, 0x0004, 0x1909, 0x1a09,
+  0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0609, 0x0709,
+  0x0809, 0x0909, 0x0a09, 0x0b09, 0x0c09, 0x0d09, 0x0e09, 0x0f09,
+  0x1009, 0x1109, 0x1209, 0x1309, 0x1409, 0x1509, 0x1609, 0x1709,
+  0x1809, 0x1909, 0x0004, 0x1a09, 0x1b09, 0x1c09, 0x1d09, 0x0004,
+  0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0004, 0x0509, 0x0004,
+  0x0004, 0x0004, 0x0609, 0x0709, 0x0809, 0x0909, 0x0a09, 0x0b09,
+  0x0c09, 0x0004, 0x0d09, 0x0e09, 0x0f09, 0x1009, 0x1109, 0x1209,
+  0x1309, 0x1409, 0x1509, 0x1609, 0x1709, 0x1809, 0x1909, 0x1a09,
+  0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0004, 0x0004,
+  0x0609, 0x0709, 0x0809, 0x0909, 0x0a09, 0x0b09, 0x0c09, 0x0d09,
+  0x0e09, 0x0f09, 0x1009, 0x1109, 0x1209, 0x1309, 0x1409, 0x1509,
+  0x1609, 0x1709, 0x1809, 0x1909, 0x1a09, 0x1b09, 0x1c09, 0x1d09,
+  0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0609, 0x0709,
+  0x0809, 0x0909, 0x0a09, 0x0b09, 0x0c09, 0x0d09, 0x0e09, 0x0f09,
+  0x1009, 0x1109, 0x1209, 0x1309, 0x1309, 0x1409, 0x1509, 0x1609,
+  0x1709, 0x1809, 0x1909, 0x1a09, 0x1b09, 0x1c09, 0x1d09, 0x1e09,
+  0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0609, 0x0709,
+  0x0809, 0x0909, 0x0a09, 0x0b09, 0x0c09, 0x0d09, 0x0d09, 0x0e09,
+  0x0f09, 0x1009, 0x1109, 0x1209, 0x1309, 0x1409, 0x1509, 0x1609,
+  0x1709, 0x1809, 0x1909, 0x1a09, 0x1b09, 0x1c09, 0x1d09, 0x1e09,
+  0x0009, 0x0109, 0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0609,
+  0x0709, 0x0809, 0x0909, 0x0a09, 0x0b09, 0x0c09, 0x0d09, 0x0e09,
+  0x0f09, 0x1009, 0x1109, 0x1209, 0x1309, 0x1409, 0x1509, 0x1609,
+  0x1709, 0x1809, 0x1909, 0x1a09, 0x1b09, 0x1c09, 0x1d09, 0x1e09,
+  0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0609, 0x0709,
+  0x0809, 0x0909, 0x0a09, 0x0b09, 0x0c09, 0x0d09, 0x0e09, 0x0f09,
+  0x1009, 0x1109, 0x1209, 0x1309, 0x1409, 0x1509, 0x1609, 0x1709,
+  0x1809, 0x1909, 0x1a09, 0x1b09, 0x1b09, 0x1c09, 0x1d09, 0x1e09,
+  0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0609, 0x0709,
+  0x0809, 0x0909, 0x0a09, 0x0a09, 0x0004, 0x0004, 0x0b09, 0x0c09,
+  0x0d09, 0x0e09, 0x0f09, 0x1009, 0x1109, 0x1209, 0x1309, 0x1409,
+  0x1509, 0x1609, 0x1709, 0x1809, 0x1909, 0x1a09, 0x1b09, 0x1c09,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0004, 0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0004, 0x0000, 0x0000, 0x0004, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0609, 0x0709,
+  0x0809, 0x0909, 0x0a09, 0x0b09, 0x0c09, 0x0d09, 0x0e09, 0x0f09,
+  0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0609, 0x0709,
+  0x0809, 0x0909, 0x0a09, 0x0b09, 0x0c09, 0x0d09, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0000,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0004, 0x0000, 0x0000,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0000, 0x0000, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0009, 0x0109, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0004, 0x0000, 0x0000,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0009, 0x0109, 0x0004, 0x0209, 0x0004, 0x0004, 0x0309,
+  0x0004, 0x0409, 0x0509, 0x0609, 0x0709, 0x0809, 0x0909, 0x0a09,
+  0x0b09, 0x0c09, 0x0d09, 0x0004, 0x0e09, 0x0f09, 0x1009, 0x1109,
+  0x0004, 0x1209, 0x0004, 0x1309, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0009, 0x0004, 0x0004, 0x0004, 0x0004, 0x0109,
+  0x0004, 0x0209, 0x0004, 0x0309, 0x0004, 0x0409, 0x0509, 0x0609,
+  0x0004, 0x0709, 0x0809, 0x0004, 0x0909, 0x0004, 0x0004, 0x0a09,
+  0x0004, 0x0b09, 0x0004, 0x0c09, 0x0004, 0x0d09, 0x0004, 0x0e09,
+  0x0004, 0x0009, 0x0109, 0x0004, 0x0209, 0x0004, 0x0004, 0x0309,
+  0x0409, 0x0509, 0x0609, 0x0004, 0x0709, 0x0809, 0x0909, 0x0a09,
+  0x0b09, 0x0c09, 0x0d09, 0x0004, 0x0e09, 0x0f09, 0x1009, 0x1109,
+  0x0004, 0x1209, 0x1309, 0x1409, 0x1509, 0x0004, 0x1609, 0x0004,
+  0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0609, 0x0709,
+  0x0809, 0x0909, 0x0004, 0x0a09, 0x0b09, 0x0c09, 0x0d09, 0x0e09,
+  0x0f09, 0x1009, 0x1109, 0x1209, 0x1309, 0x1409, 0x1509, 0x1609,
+  0x1709, 0x1809, 0x1909, 0x1a09, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0009, 0x0109, 0x0209, 0x0004, 0x0309, 0x0409, 0x0509,
+  0x0609, 0x0709, 0x0004, 0x0809, 0x0909, 0x0a09, 0x0b09, 0x0c09,
+  0x0d09, 0x0e09, 0x0f09, 0x1009, 0x1109, 0x1209, 0x1309, 0x1409,
+  0x1509, 0x1609, 0x1709, 0x1809, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004,
+  0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0004, 0x0011, 0x0211, 0x0411, 0x0611, 0x0811, 0x0a11, 0x0c11,
+  0x0e11, 0x1011, 0x1211, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x1419, 0x1719, 0x1a19, 0x1d19, 0x2019, 0x2319, 0x2619, 0x2919,
+  0x2c19, 0x2f19, 0x3219, 0x3519, 0x3819, 0x3b19, 0x3e19, 0x4119,
+  0x0019, 0x0319, 0x0619, 0x0919, 0x0c19, 0x0f19, 0x1219, 0x1519,
+  0x1819, 0x1b19, 0x1e19, 0x2109, 0x2209, 0x2311, 0x2511, 0x0000,
+  0x2709, 0x2809, 0x2909, 0x2a09, 0x2b09, 0x2c09, 0x2d09, 0x2e09,
+  0x2f09, 0x3009, 0x3109, 0x3209, 0x3309, 0x3409, 0x3509, 0x3609,
+  0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0609, 0x0709,
+  0x0809, 0x0909, 0x0a11, 0x0c11, 0x0e11, 0x1011, 0x1219, 0x1511,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0011, 0x0211, 0x0411, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0011, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0011, 0x0211, 0x0409, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0509, 0x0609, 0x0709, 0x0809, 0x0909, 0x0a09, 0x0b09, 0x0c09,
+  0x0d09, 0x0e09, 0x0f09, 0x1009, 0x1109, 0x1209, 0x1309, 0x1409,
+  0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0609, 0x0709,
+  0x0809, 0x0909, 0x0a09, 0x0b09, 0x0c09, 0x0d09, 0x0e09, 0x0f09,
+  0x1009, 0x1109, 0x1209, 0x1309, 0x1409, 0x1509, 0x1609, 0x1709,
+  0x1809, 0x1909, 0x1a09, 0x1b09, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0019, 0x0319, 0x0619, 0x0919, 0x0c19, 0x0f19, 0x1219, 0x1519,
+  0x1819, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x1b09, 0x1c09, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0004, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0609, 0x0709,
+  0x0809, 0x0909, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0609, 0x0709,
+  0x0809, 0x0909, 0x0a09, 0x0b09, 0x0c09, 0x0d09, 0x0e09, 0x0f09,
+  0x1009, 0x1109, 0x1109, 0x1109, 0x1209, 0x1309, 0x1409, 0x1509,
+  0x1609, 0x1709, 0x1809, 0x1909, 0x1a09, 0x1b09, 0x1c09, 0x1d09,
+  0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0509, 0x0609,
+  0x0709, 0x0809, 0x0909, 0x0a09, 0x0b09, 0x0c09, 0x0d09, 0x0e09,
+  0x0f09, 0x1009, 0x1109, 0x1209, 0x1309, 0x1409, 0x1509, 0x1609,
+  0x1709, 0x1809, 0x1909, 0x1a09, 0x1b09, 0x1c09, 0x1d09, 0x1e09,
+  0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0609, 0x0709,
+  0x0004, 0x0809, 0x0909, 0x0909, 0x0a09, 0x0b09, 0x0c09, 0x0d09,
+  0x0e09, 0x0f09, 0x1009, 0x1109, 0x0004, 0x1209, 0x1309, 0x1409,
+  0x1509, 0x1609, 0x1709, 0x1809, 0x1909, 0x1a09, 0x1b09, 0x1c09,
+  0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0609, 0x0709,
+  0x0809, 0x0909, 0x0a09, 0x0b09, 0x0c09, 0x0d09, 0x0e09, 0x0f09,
+  0x1009, 0x1109, 0x1109, 0x1209, 0x1309, 0x1309, 0x1409, 0x1509,
+  0x1609, 0x1709, 0x1809, 0x1909, 0x1a09, 0x1b09, 0x1c09, 0x1d09,
+  0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0609, 0x0709,
+  0x0809, 0x0909, 0x0a09, 0x0b09, 0x0c09, 0x0d09, 0x0e09, 0x0f09,
+  0x1009, 0x1109, 0x1209, 0x1309, 0x1409, 0x1509, 0x1609, 0x1709,
+  0x1809, 0x1909, 0x1a09, 0x1b09, 0x1c09, 0x1d09, 0x1e09, 0x0004,
+  0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0609, 0x0709,
+  0x0809, 0x0909, 0x0a09, 0x0b09, 0x0c09, 0x0c09, 0x0d09, 0x0e09,
+  0x0f09, 0x1009, 0x1109, 0x1209, 0x1309, 0x1409, 0x1509, 0x1609,
+  0x1709, 0x1809, 0x1909, 0x1a09, 0x1b09, 0x1c09, 0x1d09, 0x1e09,
+  0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0609, 0x0609,
+  0x0709, 0x0809, 0x0909, 0x0a09, 0x0b09, 0x0c09, 0x0d09, 0x0e09,
+  0x0f09, 0x1009, 0x1109, 0x1209, 0x1309, 0x1409, 0x1509, 0x1609,
+  0x1709, 0x1809, 0x1909, 0x1a09, 0x1b09, 0x1c09, 0x1c09, 0x0004,
+  0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0609, 0x0709,
+  0x0809, 0x0909, 0x0a09, 0x0b09, 0x0c09, 0x0d09, 0x0e09, 0x0f09,
+  0x1009, 0x1109, 0x1209, 0x1309, 0x1409, 0x1509, 0x1609, 0x1709,
+  0x1809, 0x1909, 0x1a09, 0x1b09, 0x1c09, 0x1d09, 0x1e09, 0x1e09,
+  0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0609, 0x0709,
+  0x0809, 0x0909, 0x0a09, 0x0b09, 0x0c09, 0x0d09, 0x0e09, 0x0f09,
+  0x1009, 0x1109, 0x1209, 0x1309, 0x1409, 0x1509, 0x1609, 0x1709,
+  0x1809, 0x1909, 0x1a09, 0x1b09, 0x1c09, 0x1d09, 0x0004, 0x0004,
+};
+
+static const uint32_t url__idna_trie_high[][2] = {
+  {0x032400, 0x00000004}, {0x0e0100, 0x00000003}, {0x0e01f0, 0x00000004},
+};
+
+static const uint32_t url__idna_mappings[] = {
+  0x000061, 0x000062, 0x000063, 0x000064, 0x000065, 0x000066, 0x000067, 0x000068,
+  0x000069, 0x00006a, 0x00006b, 0x00006c, 0x00006d, 0x00006e, 0x00006f, 0x000070,
+  0x000071, 0x000072, 0x000073, 0x000074, 0x000075, 0x000076, 0x000077, 0x000078,
+  0x000079, 0x00007a, 0x000020, 0x000020, 0x000308, 0x000061, 0x000020, 0x000304,
+  0x000032, 0x000033, 0x000020, 0x000301, 0x0003bc, 0x000020, 0x000327, 0x000031,
+  0x00006f, 0x000031, 0x002044, 0x000034, 0x000031, 0x002044, 0x000032, 0x000033,
+  0x002044, 0x000034, 0x0000e0, 0x0000e1, 0x0000e2, 0x0000e3, 0x0000e4, 0x0000e5,
+  0x0000e6, 0x0000e7, 0x0000e8, 0x0000e9, 0x0000ea, 0x0000eb, 0x0000ec, 0x0000ed,
+  0x0000ee, 0x0000ef, 0x0000f0, 0x0000f1, 0x0000f2, 0x0000f3, 0x0000f4, 0x0000f5,
+  0x0000f6, 0x0000f8, 0x0000f9, 0x0000fa, 0x0000fb, 0x0000fc, 0x0000fd, 0x0000fe,
+  0x000101, 0x000103, 0x000105, 0x000107, 0x000109, 0x00010b, 0x00010d, 0x00010f,
+  0x000111, 0x000113, 0x000115, 0x000117, 0x000119, 0x00011b, 0x00011d, 0x00011f,
+  0x000121, 0x000123, 0x000125, 0x000127, 0x000129, 0x00012b, 0x00012d, 0x00012f,
+  0x000069, 0x000307, 0x000069, 0x00006a, 0x000135, 0x000137, 0x00013a, 0x00013c,
+  0x00013e, 0x00006c, 0x0000b7, 0x000142, 0x000144, 0x000146, 0x000148, 0x0002bc,
+  0x00006e, 0x00014b, 0x00014d, 0x00014f, 0x000151, 0x000153, 0x000155, 0x000157,
+  0x000159, 0x00015b, 0x00015d, 0x00015f, 0x000161, 0x000163, 0x000165, 0x000167,
+  0x000169, 0x00016b, 0x00016d, 0x00016f, 0x000171, 0x000173, 0x000175, 0x000177,
+  0x0000ff, 0x00017a, 0x00017c, 0x00017e, 0x000073, 0x000253, 0x000183, 0x000185,
+  0x000254, 0x000188, 0x000256, 0x000257, 0x00018c, 0x0001dd, 0x000259, 0x00025b,
+  0x000192, 0x000260, 0x000263, 0x000269, 0x000268, 0x000199, 0x00026f, 0x000272,
+  0x000275, 0x0001a1, 0x0001a3, 0x0001a5, 0x000280, 0x0001a8, 0x000283, 0x0001ad,
+  0x000288, 0x0001b0, 0x00028a, 0x00028b, 0x0001b4, 0x0001b6, 0x000292, 0x0001b9,
+  0x0001bd, 0x000064, 0x00017e, 0x00006c, 0x00006a, 0x00006e, 0x00006a, 0x0001ce,
+  0x0001d0, 0x0001d2, 0x0001d4, 0x0001d6, 0x0001d8, 0x0001da, 0x0001dc, 0x0001df,
+  0x0001e1, 0x0001e3, 0x0001e5, 0x0001e7, 0x0001e9, 0x0001eb, 0x0001ed, 0x0001ef,
+  0x000064, 0x00007a, 0x0001f5, 0x000195, 0x0001bf, 0x0001f9, 0x0001fb, 0x0001fd,
+  0x0001ff, 0x000201, 0x000203, 0x000205, 0x000207, 0x000209, 0x00020b, 0x00020d,
+  0x00020f, 0x000211, 0x000213, 0x000215, 0x000217, 0x000219, 0x00021b, 0x00021d,
+  0x00021f, 0x00019e, 0x000223, 0x000225, 0x000227, 0x000229, 0x00022b, 0x00022d,
+  0x00022f, 0x000231, 0x000233, 0x002c65, 0x00023c, 0x00019a, 0x002c66, 0x000242,
+  0x000180, 0x000289, 0x00028c, 0x000247, 0x000249, 0x00024b, 0x00024d, 0x00024f,
+  0x000068, 0x000266, 0x00006a, 0x000072, 0x000279, 0x00027b, 0x000281, 0x000077,
+  0x000079, 0x000020, 0x000306, 0x000020, 0x000307, 0x000020, 0x00030a, 0x000020,
+  0x000328, 0x000020, 0x000303, 0x000020, 0x00030b, 0x000263, 0x00006c, 0x000073,
+  0x000078, 0x000295, 0x000300, 0x000301, 0x000313, 0x000308, 0x000301, 0x0003b9,
+  0x000371, 0x000373, 0x0002b9, 0x000377, 0x000020, 0x0003b9, 0x00003b, 0x0003f3,
+  0x000020, 0x000301, 0x000020, 0x000308, 0x000301, 0x0003ac, 0x0000b7, 0x0003ad,
+  0x0003ae, 0x0003af, 0x0003cc, 0x0003cd, 0x0003ce, 0x0003b1, 0x0003b2, 0x0003b3,
+  0x0003b4, 0x0003b5, 0x0003b6, 0x0003b7, 0x0003b8, 0x0003b9, 0x0003ba, 0x0003bb,
+  0x0003bc, 0x0003bd, 0x0003be, 0x0003bf, 0x0003c0, 0x0003c1, 0x0003c3, 0x0003c4,
+  0x0003c5, 0x0003c6, 0x0003c7, 0x0003c8, 0x0003c9, 0x0003ca, 0x0003cb, 0x0003d7,
+  0x0003b2, 0x0003b8, 0x0003c5, 0x0003cd, 0x0003cb, 0x0003c6, 0x0003c0, 0x0003d9,
+  0x0003db, 0x0003dd, 0x0003df, 0x0003e1, 0x0003e3, 0x0003e5, 0x0003e7, 0x0003e9,
+  0x0003eb, 0x0003ed, 0x0003ef, 0x0003ba, 0x0003c1, 0x0003c3, 0x0003b8, 0x0003b5,
+  0x0003f8, 0x0003c3, 0x0003fb, 0x00037b, 0x00037c, 0x00037d, 0x000450, 0x000451,
+  0x000452, 0x000453, 0x000454, 0x000455, 0x000456, 0x000457, 0x000458, 0x000459,
+  0x00045a, 0x00045b, 0x00045c, 0x00045d, 0x00045e, 0x00045f, 0x000430, 0x000431,
+  0x000432, 0x000433, 0x000434, 0x000435, 0x000436, 0x000437, 0x000438, 0x000439,
+  0x00043a, 0x00043b, 0x00043c, 0x00043d, 0x00043e, 0x00043f, 0x000440, 0x000441,
+  0x000442, 0x000443, 0x000444, 0x000445, 0x000446, 0x000447, 0x000448, 0x000449,
+  0x00044a, 0x00044b, 0x00044c, 0x00044d, 0x00044e, 0x00044f, 0x000461, 0x000463,
+  0x000465, 0x000467, 0x000469, 0x00046b, 0x00046d, 0x00046f, 0x000471, 0x000473,
+  0x000475, 0x000477, 0x000479, 0x00047b, 0x00047d, 0x00047f, 0x000481, 0x00048b,
+  0x00048d, 0x00048f, 0x000491, 0x000493, 0x000495, 0x000497, 0x000499, 0x00049b,
+  0x00049d, 0x00049f, 0x0004a1, 0x0004a3, 0x0004a5, 0x0004a7, 0x0004a9, 0x0004ab,
+  0x0004ad, 0x0004af, 0x0004b1, 0x0004b3, 0x0004b5, 0x0004b7, 0x0004b9, 0x0004bb,
+  0x0004bd, 0x0004bf, 0x0004c2, 0x0004c4, 0x0004c6, 0x0004c8, 0x0004ca, 0x0004cc,
+  0x0004ce, 0x0004d1, 0x0004d3, 0x0004d5, 0x0004d7, 0x0004d9, 0x0004db, 0x0004dd,
+  0x0004df, 0x0004e1, 0x0004e3, 0x0004e5, 0x0004e7, 0x0004e9, 0x0004eb, 0x0004ed,
+  0x0004ef, 0x0004f1, 0x0004f3, 0x0004f5, 0x0004f7, 0x0004f9, 0x0004fb, 0x0004fd,
+  0x0004ff, 0x000501, 0x000503, 0x000505, 0x000507, 0x000509, 0x00050b, 0x00050d,
+  0x00050f, 0x000511, 0x000513, 0x000515, 0x000517, 0x000519, 0x00051b, 0x00051d,
+  0x00051f, 0x000521, 0x000523, 0x000525, 0x000527, 0x000529, 0x00052b, 0x00052d,
+  0x00052f, 0x000561, 0x000562, 0x000563, 0x000564, 0x000565, 0x000566, 0x000567,
+  0x000568, 0x000569, 0x00056a, 0x00056b, 0x00056c, 0x00056d, 0x00056e, 0x00056f,
+  0x000570, 0x000571, 0x000572, 0x000573, 0x000574, 0x000575, 0x000576, 0x000577,
+  0x000578, 0x000579, 0x00057a, 0x00057b, 0x00057c, 0x00057d, 0x00057e, 0x00057f,
+  0x000580, 0x000581, 0x000582, 0x000583, 0x000584, 0x000585, 0x000586, 0x000565,
+  0x000582, 0x000627, 0x000674, 0x000648, 0x000674, 0x0006c7, 0x000674, 0x00064a,
+  0x000674, 0x000915, 0x00093c, 0x000916, 0x00093c, 0x000917, 0x00093c, 0x00091c,
+  0x00093c, 0x000921, 0x00093c, 0x000922, 0x00093c, 0x00092b, 0x00093c, 0x00092f,
+  0x00093c, 0x0009a1, 0x0009bc, 0x0009a2, 0x0009bc, 0x0009af, 0x0009bc, 0x000a32,
+  0x000a3c, 0x000a38, 0x000a3c, 0x000a16, 0x000a3c, 0x000a17, 0x000a3c, 0x000a1c,
+  0x000a3c, 0x000a2b, 0x000a3c, 0x000b21, 0x000b3c, 0x000b22, 0x000b3c, 0x000e4d,
+  0x000e32, 0x000ecd, 0x000eb2, 0x000eab, 0x000e99, 0x000eab, 0x000ea1, 0x000f0b,
+  0x000f42, 0x000fb7, 0x000f4c, 0x000fb7, 0x000f51, 0x000fb7, 0x000f56, 0x000fb7,
+  0x000f5b, 0x000fb7, 0x000f40, 0x000fb5, 0x000f71, 0x000f72, 0x000f71, 0x000f74,
+  0x000fb2, 0x000f80, 0x000fb2, 0x000f71, 0x000f80, 0x000fb3, 0x000f80, 0x000fb3,
+  0x000f71, 0x000f80, 0x000f71, 0x000f80, 0x000f92, 0x000fb7, 0x000f9c, 0x000fb7,
+  0x000fa1, 0x000fb7, 0x000fa6, 0x000fb7, 0x000fab, 0x000fb7, 0x000f90, 0x000fb5,
+  0x002d27, 0x002d2d, 0x0010dc, 0x0013f0, 0x0013f1, 0x0013f2, 0x0013f3, 0x0013f4,
+  0x0013f5, 0x000432, 0x000434, 0x00043e, 0x000441, 0x000442, 0x00044a, 0x000463,
+  0x00a64b, 0x0010d0, 0x0010d1, 0x0010d2, 0x0010d3, 0x0010d4, 0x0010d5, 0x0010d6,
+  0x0010d7, 0x0010d8, 0x0010d9, 0x0010da, 0x0010db, 0x0010dc, 0x0010dd, 0x0010de,
+  0x0010df, 0x0010e0, 0x0010e1, 0x0010e2, 0x0010e3, 0x0010e4, 0x0010e5, 0x0010e6,
+  0x0010e7, 0x0010e8, 0x0010e9, 0x0010ea, 0x0010eb, 0x0010ec, 0x0010ed, 0x0010ee,
+  0x0010ef, 0x0010f0, 0x0010f1, 0x0010f2, 0x0010f3, 0x0010f4, 0x0010f5, 0x0010f6,
+  0x0010f7, 0x0010f8, 0x0010f9, 0x0010fa, 0x0010fd, 0x0010fe, 0x0010ff, 0x000061,
+  0x0000e6, 0x000062, 0x000064, 0x000065, 0x0001dd, 0x000067, 0x000068, 0x000069,
+  0x00006a, 0x00006b, 0x00006c, 0x00006d, 0x00006e, 0x00006f, 0x000223, 0x000070,
+  0x000072, 0x000074, 0x000075, 0x000077, 0x000061, 0x000250, 0x000251, 0x001d02,
+  0x000062, 0x000064, 0x000065, 0x000259, 0x00025b, 0x00025c, 0x000067, 0x00006b,
+  0x00006d, 0x00014b, 0x00006f, 0x000254, 0x001d16, 0x001d17, 0x000070, 0x000074,
+  0x000075, 0x001d1d, 0x00026f, 0x000076, 0x001d25, 0x0003b2, 0x0003b3, 0x0003b4,
+  0x0003c6, 0x0003c7, 0x000069, 0x000072, 0x000075, 0x000076, 0x0003b2, 0x0003b3,
+  0x0003c1, 0x0003c6, 0x0003c7, 0x00043d, 0x000252, 0x000063, 0x000255, 0x0000f0,
+  0x00025c, 0x000066, 0x00025f, 0x000261, 0x000265, 0x000268, 0x000269, 0x00026a,
+  0x001d7b, 0x00029d, 0x00026d, 0x001d85, 0x00029f, 0x000271, 0x000270, 0x000272,
+  0x000273, 0x000274, 0x000275, 0x000278, 0x000282, 0x000283, 0x0001ab, 0x000289,
+  0x00028a, 0x001d1c, 0x00028b, 0x00028c, 0x00007a, 0x000290, 0x000291, 0x000292,
+  0x0003b8, 0x001e01, 0x001e03, 0x001e05, 0x001e07, 0x001e09, 0x001e0b, 0x001e0d,
+  0x001e0f, 0x001e11, 0x001e13, 0x001e15, 0x001e17, 0x001e19, 0x001e1b, 0x001e1d,
+  0x001e1f, 0x001e21, 0x001e23, 0x001e25, 0x001e27, 0x001e29, 0x001e2b, 0x001e2d,
+  0x001e2f, 0x001e31, 0x001e33, 0x001e35, 0x001e37, 0x001e39, 0x001e3b, 0x001e3d,
+  0x001e3f, 0x001e41, 0x001e43, 0x001e45, 0x001e47, 0x001e49, 0x001e4b, 0x001e4d,
+  0x001e4f, 0x001e51, 0x001e53, 0x001e55, 0x001e57, 0x001e59, 0x001e5b, 0x001e5d,
+  0x001e5f, 0x001e61, 0x001e63, 0x001e65, 0x001e67, 0x001e69, 0x001e6b, 0x001e6d,
+  0x001e6f, 0x001e71, 0x001e73, 0x001e75, 0x001e77, 0x001e79, 0x001e7b, 0x001e7d,
+  0x001e7f, 0x001e81, 0x001e83, 0x001e85, 0x001e87, 0x001e89, 0x001e8b, 0x001e8d,
+  0x001e8f, 0x001e91, 0x001e93, 0x001e95, 0x000061, 0x0002be, 0x001e61, 0x0000df,
+  0x001ea1, 0x001ea3, 0x001ea5, 0x001ea7, 0x001ea9, 0x001eab, 0x001ead, 0x001eaf,
+  0x001eb1, 0x001eb3, 0x001eb5, 0x001eb7, 0x001eb9, 0x001ebb, 0x001ebd, 0x001ebf,
+  0x001ec1, 0x001ec3, 0x001ec5, 0x001ec7, 0x001ec9, 0x001ecb, 0x001ecd, 0x001ecf,
+  0x001ed1, 0x001ed3, 0x001ed5, 0x001ed7, 0x001ed9, 0x001edb, 0x001edd, 0x001edf,
+  0x001ee1, 0x001ee3, 0x001ee5, 0x001ee7, 0x001ee9, 0x001eeb, 0x001eed, 0x001eef,
+  0x001ef1, 0x001ef3, 0x001ef5, 0x001ef7, 0x001ef9, 0x001efb, 0x001efd, 0x001eff,
+  0x001f00, 0x001f01, 0x001f02, 0x001f03, 0x001f04, 0x001f05, 0x001f06, 0x001f07,
+  0x001f10, 0x001f11, 0x001f12, 0x001f13, 0x001f14, 0x001f15, 0x001f20, 0x001f21,
+  0x001f22, 0x001f23, 0x001f24, 0x001f25, 0x001f26, 0x001f27, 0x001f30, 0x001f31,
+  0x001f32, 0x001f33, 0x001f34, 0x001f35, 0x001f36, 0x001f37, 0x001f40, 0x001f41,
+  0x001f42, 0x001f43, 0x001f44, 0x001f45, 0x001f51, 0x001f53, 0x001f55, 0x001f57,
+  0x001f60, 0x001f61, 0x001f62, 0x001f63, 0x001f64, 0x001f65, 0x001f66, 0x001f67,
+  0x0003ac, 0x0003ad, 0x0003ae, 0x0003af, 0x0003cc, 0x0003cd, 0x0003ce, 0x001f00,
+  0x0003b9, 0x001f01, 0x0003b9, 0x001f02, 0x0003b9, 0x001f03, 0x0003b9, 0x001f04,
+  0x0003b9, 0x001f05, 0x0003b9, 0x001f06, 0x0003b9, 0x001f07, 0x0003b9, 0x001f00,
+  0x0003b9, 0x001f01, 0x0003b9, 0x001f02, 0x0003b9, 0x001f03, 0x0003b9, 0x001f04,
+  0x0003b9, 0x001f05, 0x0003b9, 0x001f06, 0x0003b9, 0x001f07, 0x0003b9, 0x001f20,
+  0x0003b9, 0x001f21, 0x0003b9, 0x001f22, 0x0003b9, 0x001f23, 0x0003b9, 0x001f24,
+  0x0003b9, 0x001f25, 0x0003b9, 0x001f26, 0x0003b9, 0x001f27, 0x0003b9, 0x001f20,
+  0x0003b9, 0x001f21, 0x0003b9, 0x001f22, 0x0003b9, 0x001f23, 0x0003b9, 0x001f24,
+  0x0003b9, 0x001f25, 0x0003b9, 0x001f26, 0x0003b9, 0x001f27, 0x0003b9, 0x001f60,
+  0x0003b9, 0x001f61, 0x0003b9, 0x001f62, 0x0003b9, 0x001f63, 0x0003b9, 0x001f64,
+  0x0003b9, 0x001f65, 0x0003b9, 0x001f66, 0x0003b9, 0x001f67, 0x0003b9, 0x001f60,
+  0x0003b9, 0x001f61, 0x0003b9, 0x001f62, 0x0003b9, 0x001f63, 0x0003b9, 0x001f64,
+  0x0003b9, 0x001f65, 0x0003b9, 0x001f66, 0x0003b9, 0x001f67, 0x0003b9, 0x001f70,
+  0x0003b9, 0x0003b1, 0x0003b9, 0x0003ac, 0x0003b9, 0x001fb6, 0x0003b9, 0x001fb0,
+  0x001fb1, 0x001f70, 0x0003ac, 0x0003b1, 0x0003b9, 0x000020, 0x000313, 0x0003b9,
+  0x000020, 0x000313, 0x000020, 0x000342, 0x000020, 0x000308, 0x000342, 0x001f74,
+  0x0003b9, 0x0003b7, 0x0003b9, 0x0003ae, 0x0003b9, 0x001fc6, 0x0003b9, 0x001f72,
+  0x0003ad, 0x001f74, 0x0003ae, 0x0003b7, 0x0003b9, 0x000020, 0x000313, 0x000300,
+  0x000020, 0x000313, 0x000301, 0x000020, 0x000313, 0x000342, 0x000390, 0x001fd0,
+  0x001fd1, 0x001f76, 0x0003af, 0x000020, 0x000314, 0x000300, 0x000020, 0x000314,
+  0x000301, 0x000020, 0x000314, 0x000342, 0x0003b0, 0x001fe0, 0x001fe1, 0x001f7a,
+  0x0003cd, 0x001fe5, 0x000020, 0x000308, 0x000300, 0x000020, 0x000308, 0x000301,
+  0x000060, 0x001f7c, 0x0003b9, 0x0003c9, 0x0003b9, 0x0003ce, 0x0003b9, 0x001ff6,
+  0x0003b9, 0x001f78, 0x0003cc, 0x001f7c, 0x0003ce, 0x0003c9, 0x0003b9, 0x000020,
+  0x000301, 0x000020, 0x000314, 0x000020, 0x002010, 0x000020, 0x000333, 0x000020,
+  0x002032, 0x002032, 0x002032, 0x002032, 0x002032, 0x002035, 0x002035, 0x002035,
+  0x002035, 0x002035, 0x000021, 0x000021, 0x000020, 0x000305, 0x00003f, 0x00003f,
+  0x00003f, 0x000021, 0x000021, 0x00003f, 0x002032, 0x002032, 0x002032, 0x002032,
+  0x000020, 0x000030, 0x000069, 0x000034, 0x000035, 0x000036, 0x000037, 0x000038,
+  0x000039, 0x00002b, 0x002212, 0x00003d, 0x000028, 0x000029, 0x00006e, 0x000030,
+  0x000031, 0x000032, 0x000033, 0x000034, 0x000035, 0x000036, 0x000037, 0x000038,
+  0x000039, 0x00002b, 0x002212, 0x00003d, 0x000028, 0x000029, 0x000061, 0x000065,
+  0x00006f, 0x000078, 0x000259, 0x000068, 0x00006b, 0x00006c, 0x00006d, 0x00006e,
+  0x000070, 0x000073, 0x000074, 0x000072, 0x000073, 0x000061, 0x00002f, 0x000063,
+  0x000061, 0x00002f, 0x000073, 0x000063, 0x0000b0, 0x000063, 0x000063, 0x00002f,
+  0x00006f, 0x000063, 0x00002f, 0x000075, 0x00025b, 0x0000b0, 0x000066, 0x000067,
+  0x000068, 0x000127, 0x000069, 0x00006c, 0x00006e, 0x00006e, 0x00006f, 0x000070,
+  0x000071, 0x000072, 0x000073, 0x00006d, 0x000074, 0x000065, 0x00006c, 0x000074,
+  0x00006d, 0x00007a, 0x0003c9, 0x00007a, 0x00006b, 0x0000e5, 0x000062, 0x000063,
+  0x000065, 0x000066, 0x00006d, 0x00006f, 0x0005d0, 0x0005d1, 0x0005d2, 0x0005d3,
+  0x000069, 0x000066, 0x000061, 0x000078, 0x0003c0, 0x0003b3, 0x0003c0, 0x002211,
+  0x000064, 0x000065, 0x000069, 0x00006a, 0x000031, 0x002044, 0x000037, 0x000031,
+  0x002044, 0x000039, 0x000031, 0x002044, 0x000031, 0x000030, 0x000031, 0x002044,
+  0x000033, 0x000032, 0x002044, 0x000033, 0x000031, 0x002044, 0x000035, 0x000032,
+  0x002044, 0x000035, 0x000033, 0x002044, 0x000035, 0x000034, 0x002044, 0x000035,
+  0x000031, 0x002044, 0x000036, 0x000035, 0x002044, 0x000036, 0x000031, 0x002044,
+  0x000038, 0x000033, 0x002044, 0x000038, 0x000035, 0x002044, 0x000038, 0x000037,
+  0x002044, 0x000038, 0x000031, 0x002044, 0x000069, 0x000069, 0x000069, 0x000069,
+  0x000069, 0x000069, 0x000069, 0x000076, 0x000076, 0x000076, 0x000069, 0x000076,
+  0x000069, 0x000069, 0x000076, 0x000069, 0x000069, 0x000069, 0x000069, 0x000078,
+  0x000078, 0x000078, 0x000069, 0x000078, 0x000069, 0x000069, 0x00006c, 0x000063,
+  0x000064, 0x00006d, 0x000069, 0x000069, 0x000069, 0x000069, 0x000069, 0x000069,
+  0x000069, 0x000076, 0x000076, 0x000076, 0x000069, 0x000076, 0x000069, 0x000069,
+  0x000076, 0x000069, 0x000069, 0x000069, 0x000069, 0x000078, 0x000078, 0x000078,
+  0x000069, 0x000078, 0x000069, 0x000069, 0x00006c, 0x000063, 0x000064, 0x00006d,
+  0x000030, 0x002044, 0x000033, 0x00222b, 0x00222b, 0x00222b, 0x00222b, 0x00222b,
+  0x00222e, 0x00222e, 0x00222e, 0x00222e, 0x00222e, 0x003008, 0x003009, 0x000031,
+  0x000032, 0x000033, 0x000034, 0x000035, 0x000036, 0x000037, 0x000038, 0x000039,
+  0x000031, 0x000030, 0x000031, 0x000031, 0x000031, 0x000032, 0x000031, 0x000033,
+  0x000031, 0x000034, 0x000031, 0x000035, 0x000031, 0x000036, 0x000031, 0x000037,
+  0x000031, 0x000038, 0x000031, 0x000039, 0x000032, 0x000030, 0x000028, 0x000031,
+  0x000029, 0x000028, 0x000032, 0x000029, 0x000028, 0x000033, 0x000029, 0x000028,
+  0x000034, 0x000029, 0x000028, 0x000035, 0x000029, 0x000028, 0x000036, 0x000029,
+  0x000028, 0x000037, 0x000029, 0x000028, 0x000038, 0x000029, 0x000028, 0x000039,
+  0x000029, 0x000028, 0x000031, 0x000030, 0x000029, 0x000028, 0x000031, 0x000031,
+  0x000029, 0x000028, 0x000031, 0x000032, 0x000029, 0x000028, 0x000031, 0x000033,
+  0x000029, 0x000028, 0x000031, 0x000034, 0x000029, 0x000028, 0x000031, 0x000035,
+  0x000029, 0x000028, 0x000031, 0x000036, 0x000029, 0x000028, 0x000031, 0x000037,
+  0x000029, 0x000028, 0x000031, 0x000038, 0x000029, 0x000028, 0x000031, 0x000039,
+  0x000029, 0x000028, 0x000032, 0x000030, 0x000029, 0x000028, 0x000061, 0x000029,
+  0x000028, 0x000062, 0x000029, 0x000028, 0x000063, 0x000029, 0x000028, 0x000064,
+  0x000029, 0x000028, 0x000065, 0x000029, 0x000028, 0x000066, 0x000029, 0x000028,
+  0x000067, 0x000029, 0x000028, 0x000068, 0x000029, 0x000028, 0x000069, 0x000029,
+  0x000028, 0x00006a, 0x000029, 0x000028, 0x00006b, 0x000029, 0x000028, 0x00006c,
+  0x000029, 0x000028, 0x00006d, 0x000029, 0x000028, 0x00006e, 0x000029, 0x000028,
+  0x00006f, 0x000029, 0x000028, 0x000070, 0x000029, 0x000028, 0x000071, 0x000029,
+  0x000028, 0x000072, 0x000029, 0x000028, 0x000073, 0x000029, 0x000028, 0x000074,
+  0x000029, 0x000028, 0x000075, 0x000029, 0x000028, 0x000076, 0x000029, 0x000028,
+  0x000077, 0x000029, 0x000028, 0x000078, 0x000029, 0x000028, 0x000079, 0x000029,
+  0x000028, 0x00007a, 0x000029, 0x000061, 0x000062, 0x000063, 0x000064, 0x000065,
+  0x000066, 0x000067, 0x000068, 0x000069, 0x00006a, 0x00006b, 0x00006c, 0x00006d,
+  0x00006e, 0x00006f, 0x000070, 0x000071, 0x000072, 0x000073, 0x000074, 0x000075,
+  0x000076, 0x000077, 0x000078, 0x000079, 0x00007a, 0x000061, 0x000062, 0x000063,
+  0x000064, 0x000065, 0x000066, 0x000067, 0x000068, 0x000069, 0x00006a, 0x00006b,
+  0x00006c, 0x00006d, 0x00006e, 0x00006f, 0x000070, 0x000071, 0x000072, 0x000073,
+  0x000074, 0x000075, 0x000076, 0x000077, 0x000078, 0x000079, 0x00007a, 0x000030,
+  0x00222b, 0x00222b, 0x00222b, 0x00222b, 0x00003a, 0x00003a, 0x00003d, 0x00003d,
+  0x00003d, 0x00003d, 0x00003d, 0x00003d, 0x002add, 0x000338, 0x002c30, 0x002c31,
+  0x002c32, 0x002c33, 0x002c34, 0x002c35, 0x002c36, 0x002c37, 0x002c38, 0x002c39,
+  0x002c3a, 0x002c3b, 0x002c3c, 0x002c3d, 0x002c3e, 0x002c3f, 0x002c40, 0x002c41,
+  0x002c42, 0x002c43, 0x002c44, 0x002c45, 0x002c46, 0x002c47, 0x002c48, 0x002c49,
+  0x002c4a, 0x002c4b, 0x002c4c, 0x002c4d, 0x002c4e, 0x002c4f, 0x002c50, 0x002c51,
+  0x002c52, 0x002c53, 0x002c54, 0x002c55, 0x002c56, 0x002c57, 0x002c58, 0x002c59,
+  0x002c5a, 0x002c5b, 0x002c5c, 0x002c5d, 0x002c5e, 0x002c5f, 0x002c61, 0x00026b,
+  0x001d7d, 0x00027d, 0x002c68, 0x002c6a, 0x002c6c, 0x000251, 0x000271, 0x000250,
+  0x000252, 0x002c73, 0x002c76, 0x00006a, 0x000076, 0x00023f, 0x000240, 0x002c81,
+  0x002c83, 0x002c85, 0x002c87, 0x002c89, 0x002c8b, 0x002c8d, 0x002c8f, 0x002c91,
+  0x002c93, 0x002c95, 0x002c97, 0x002c99, 0x002c9b, 0x002c9d, 0x002c9f, 0x002ca1,
+  0x002ca3, 0x002ca5, 0x002ca7, 0x002ca9, 0x002cab, 0x002cad, 0x002caf, 0x002cb1,
+  0x002cb3, 0x002cb5, 0x002cb7, 0x002cb9, 0x002cbb, 0x002cbd, 0x002cbf, 0x002cc1,
+  0x002cc3, 0x002cc5, 0x002cc7, 0x002cc9, 0x002ccb, 0x002ccd, 0x002ccf, 0x002cd1,
+  0x002cd3, 0x002cd5, 0x002cd7, 0x002cd9, 0x002cdb, 0x002cdd, 0x002cdf, 0x002ce1,
+  0x002ce3, 0x002cec, 0x002cee, 0x002cf3, 0x002d61, 0x006bcd, 0x009f9f, 0x004e00,
+  0x004e28, 0x004e36, 0x004e3f, 0x004e59, 0x004e85, 0x004e8c, 0x004ea0, 0x004eba,
+  0x00513f, 0x005165, 0x00516b, 0x005182, 0x005196, 0x0051ab, 0x0051e0, 0x0051f5,
+  0x005200, 0x00529b, 0x0052f9, 0x005315, 0x00531a, 0x005338, 0x005341, 0x00535c,
+  0x005369, 0x005382, 0x0053b6, 0x0053c8, 0x0053e3, 0x0056d7, 0x00571f, 0x0058eb,
+  0x005902, 0x00590a, 0x005915, 0x005927, 0x005973, 0x005b50, 0x005b80, 0x005bf8,
+  0x005c0f, 0x005c22, 0x005c38, 0x005c6e, 0x005c71, 0x005ddb, 0x005de5, 0x005df1,
+  0x005dfe, 0x005e72, 0x005e7a, 0x005e7f, 0x005ef4, 0x005efe, 0x005f0b, 0x005f13,
+  0x005f50, 0x005f61, 0x005f73, 0x005fc3, 0x006208, 0x006236, 0x00624b, 0x00652f,
+  0x006534, 0x006587, 0x006597, 0x0065a4, 0x0065b9, 0x0065e0, 0x0065e5, 0x0066f0,
+  0x006708, 0x006728, 0x006b20, 0x006b62, 0x006b79, 0x006bb3, 0x006bcb, 0x006bd4,
+  0x006bdb, 0x006c0f, 0x006c14, 0x006c34, 0x00706b, 0x00722a, 0x007236, 0x00723b,
+  0x00723f, 0x007247, 0x007259, 0x00725b, 0x0072ac, 0x007384, 0x007389, 0x0074dc,
+  0x0074e6, 0x007518, 0x00751f, 0x007528, 0x007530, 0x00758b, 0x007592, 0x007676,
+  0x00767d, 0x0076ae, 0x0076bf, 0x0076ee, 0x0077db, 0x0077e2, 0x0077f3, 0x00793a,
+  0x0079b8, 0x0079be, 0x007a74, 0x007acb, 0x007af9, 0x007c73, 0x007cf8, 0x007f36,
+  0x007f51, 0x007f8a, 0x007fbd, 0x008001, 0x00800c, 0x008012, 0x008033, 0x00807f,
+  0x008089, 0x0081e3, 0x0081ea, 0x0081f3, 0x0081fc, 0x00820c, 0x00821b, 0x00821f,
+  0x00826e, 0x008272, 0x008278, 0x00864d, 0x00866b, 0x008840, 0x00884c, 0x008863,
+  0x00897e, 0x00898b, 0x0089d2, 0x008a00, 0x008c37, 0x008c46, 0x008c55, 0x008c78,
+  0x008c9d, 0x008d64, 0x008d70, 0x008db3, 0x008eab, 0x008eca, 0x008f9b, 0x008fb0,
+  0x008fb5, 0x009091, 0x009149, 0x0091c6, 0x0091cc, 0x0091d1, 0x009577, 0x009580,
+  0x00961c, 0x0096b6, 0x0096b9, 0x0096e8, 0x009751, 0x00975e, 0x009762, 0x009769,
+  0x0097cb, 0x0097ed, 0x0097f3, 0x009801, 0x0098a8, 0x0098db, 0x0098df, 0x009996,
+  0x009999, 0x0099ac, 0x009aa8, 0x009ad8, 0x009adf, 0x009b25, 0x009b2f, 0x009b32,
+  0x009b3c, 0x009b5a, 0x009ce5, 0x009e75, 0x009e7f, 0x009ea5, 0x009ebb, 0x009ec3,
+  0x009ecd, 0x009ed1, 0x009ef9, 0x009efd, 0x009f0e, 0x009f13, 0x009f20, 0x009f3b,
+  0x009f4a, 0x009f52, 0x009f8d, 0x009f9c, 0x009fa0, 0x000020, 0x00002e, 0x003012,
+  0x005341, 0x005344, 0x005345, 0x000020, 0x003099, 0x000020, 0x00309a, 0x003088,
+  0x00308a, 0x0030b3, 0x0030c8, 0x001100, 0x001101, 0x0011aa, 0x001102, 0x0011ac,
+  0x0011ad, 0x001103, 0x001104, 0x001105, 0x0011b0, 0x0011b1, 0x0011b2, 0x0011b3,
+  0x0011b4, 0x0011b5, 0x00111a, 0x001106, 0x001107, 0x001108, 0x001121, 0x001109,
+  0x00110a, 0x00110b, 0x00110c, 0x00110d, 0x00110e, 0x00110f, 0x001110, 0x001111,
+  0x001112, 0x001161, 0x001162, 0x001163, 0x001164, 0x001165, 0x001166, 0x001167,
+  0x001168, 0x001169, 0x00116a, 0x00116b, 0x00116c, 0x00116d, 0x00116e, 0x00116f,
+  0x001170, 0x001171, 0x001172, 0x001173, 0x001174, 0x001175, 0x001114, 0x001115,
+  0x0011c7, 0x0011c8, 0x0011cc, 0x0011ce, 0x0011d3, 0x0011d7, 0x0011d9, 0x00111c,
+  0x0011dd, 0x0011df, 0x00111d, 0x00111e, 0x001120, 0x001122, 0x001123, 0x001127,
+  0x001129, 0x00112b, 0x00112c, 0x00112d, 0x00112e, 0x00112f, 0x001132, 0x001136,
+  0x001140, 0x001147, 0x00114c, 0x0011f1, 0x0011f2, 0x001157, 0x001158, 0x001159,
+  0x001184, 0x001185, 0x001188, 0x001191, 0x001192, 0x001194, 0x00119e, 0x0011a1,
+  0x004e00, 0x004e8c, 0x004e09, 0x0056db, 0x004e0a, 0x004e2d, 0x004e0b, 0x007532,
+  0x004e59, 0x004e19, 0x004e01, 0x005929, 0x005730, 0x004eba, 0x000028, 0x001100,
+  0x000029, 0x000028, 0x001102, 0x000029, 0x000028, 0x001103, 0x000029, 0x000028,
+  0x001105, 0x000029, 0x000028, 0x001106, 0x000029, 0x000028, 0x001107, 0x000029,
+  0x000028, 0x001109, 0x000029, 0x000028, 0x00110b, 0x000029, 0x000028, 0x00110c,
+  0x000029, 0x000028, 0x00110e, 0x000029, 0x000028, 0x00110f, 0x000029, 0x000028,
+  0x001110, 0x000029, 0x000028, 0x001111, 0x000029, 0x000028, 0x001112, 0x000029,
+  0x000028, 0x00ac00, 0x000029, 0x000028, 0x00b098, 0x000029, 0x000028, 0x00b2e4,
+  0x000029, 0x000028, 0x00b77c, 0x000029, 0x000028, 0x00b9c8, 0x000029, 0x000028,
+  0x00bc14, 0x000029, 0x000028, 0x00c0ac, 0x000029, 0x000028, 0x00c544, 0x000029,
+  0x000028, 0x00c790, 0x000029, 0x000028, 0x00cc28, 0x000029, 0x000028, 0x00ce74,
+  0x000029, 0x000028, 0x00d0c0, 0x000029, 0x000028, 0x00d30c, 0x000029, 0x000028,
+  0x00d558, 0x000029, 0x000028, 0x00c8fc, 0x000029, 0x000028, 0x00c624, 0x00c804,
+  0x000029, 0x000028, 0x00c624, 0x00d6c4, 0x000029, 0x000028, 0x004e00, 0x000029,
+  0x000028, 0x004e8c, 0x000029, 0x000028, 0x004e09, 0x000029, 0x000028, 0x0056db,
+  0x000029, 0x000028, 0x004e94, 0x000029, 0x000028, 0x00516d, 0x000029, 0x000028,
+  0x004e03, 0x000029, 0x000028, 0x00516b, 0x000029, 0x000028, 0x004e5d, 0x000029,
+  0x000028, 0x005341, 0x000029, 0x000028, 0x006708, 0x000029, 0x000028, 0x00706b,
+  0x000029, 0x000028, 0x006c34, 0x000029, 0x000028, 0x006728, 0x000029, 0x000028,
+  0x0091d1, 0x000029, 0x000028, 0x00571f, 0x000029, 0x000028, 0x0065e5, 0x000029,
+  0x000028, 0x00682a, 0x000029, 0x000028, 0x006709, 0x000029, 0x000028, 0x00793e,
+  0x000029, 0x000028, 0x00540d, 0x000029, 0x000028, 0x007279, 0x000029, 0x000028,
+  0x008ca1, 0x000029, 0x000028, 0x00795d, 0x000029, 0x000028, 0x0052b4, 0x000029,
+  0x000028, 0x004ee3, 0x000029, 0x000028, 0x00547c, 0x000029, 0x000028, 0x005b66,
+  0x000029, 0x000028, 0x0076e3, 0x000029, 0x000028, 0x004f01, 0x000029, 0x000028,
+  0x008cc7, 0x000029, 0x000028, 0x005354, 0x000029, 0x000028, 0x00796d, 0x000029,
+  0x000028, 0x004f11, 0x000029, 0x000028, 0x0081ea, 0x000029, 0x000028, 0x0081f3,
+  0x000029, 0x00554f, 0x005e7c, 0x006587, 0x007b8f, 0x000070, 0x000074, 0x000065,
+  0x000032, 0x000031, 0x000032, 0x000032, 0x000032, 0x000033, 0x000032, 0x000034,
+  0x000032, 0x000035, 0x000032, 0x000036, 0x000032, 0x000037, 0x000032, 0x000038,
+  0x000032, 0x000039, 0x000033, 0x000030, 0x000033, 0x000031, 0x000033, 0x000032,
+  0x000033, 0x000033, 0x000033, 0x000034, 0x000033, 0x000035, 0x001100, 0x001102,
+  0x001103, 0x001105, 0x001106, 0x001107, 0x001109, 0x00110b, 0x00110c, 0x00110e,
+  0x00110f, 0x001110, 0x001111, 0x001112, 0x00ac00, 0x00b098, 0x00b2e4, 0x00b77c,
+  0x00b9c8, 0x00bc14, 0x00c0ac, 0x00c544, 0x00c790, 0x00cc28, 0x00ce74, 0x00d0c0,
+  0x00d30c, 0x00d558, 0x00cc38, 0x00ace0, 0x00c8fc, 0x00c758, 0x00c6b0, 0x004e00,
+  0x004e8c, 0x004e09, 0x0056db, 0x004e94, 0x00516d, 0x004e03, 0x00516b, 0x004e5d,
+  0x005341, 0x006708, 0x00706b, 0x006c34, 0x006728, 0x0091d1, 0x00571f, 0x0065e5,
+  0x00682a, 0x006709, 0x00793e, 0x00540d, 0x007279, 0x008ca1, 0x00795d, 0x0052b4,
+  0x0079d8, 0x007537, 0x005973, 0x009069, 0x00512a, 0x005370, 0x006ce8, 0x009805,
+  0x004f11, 0x005199, 0x006b63, 0x004e0a, 0x004e2d, 0x004e0b, 0x005de6, 0x0053f3,
+  0x00533b, 0x005b97, 0x005b66, 0x0076e3, 0x004f01, 0x008cc7, 0x005354, 0x00591c,
+  0x000033, 0x000036, 0x000033, 0x000037, 0x000033, 0x000038, 0x000033, 0x000039,
+  0x000034, 0x000030, 0x000034, 0x000031, 0x000034, 0x000032, 0x000034, 0x000033,
+  0x000034, 0x000034, 0x000034, 0x000035, 0x000034, 0x000036, 0x000034, 0x000037,
+  0x000034, 0x000038, 0x000034, 0x000039, 0x000035, 0x000030, 0x000031, 0x006708,
+  0x000032, 0x006708, 0x000033, 0x006708, 0x000034, 0x006708, 0x000035, 0x006708,
+  0x000036, 0x006708, 0x000037, 0x006708, 0x000038, 0x006708, 0x000039, 0x006708,
+  0x000031, 0x000030, 0x006708, 0x000031, 0x000031, 0x006708, 0x000031, 0x000032,
+  0x006708, 0x000068, 0x000067, 0x000065, 0x000072, 0x000067, 0x000065, 0x000076,
+  0x00006c, 0x000074, 0x000064, 0x0030a2, 0x0030a4, 0x0030a6, 0x0030a8, 0x0030aa,
+  0x0030ab, 0x0030ad, 0x0030af, 0x0030b1, 0x0030b3, 0x0030b5, 0x0030b7, 0x0030b9,
+  0x0030bb, 0x0030bd, 0x0030bf, 0x0030c1, 0x0030c4, 0x0030c6, 0x0030c8, 0x0030ca,
+  0x0030cb, 0x0030cc, 0x0030cd, 0x0030ce, 0x0030cf, 0x0030d2, 0x0030d5, 0x0030d8,
+  0x0030db, 0x0030de, 0x0030df, 0x0030e0, 0x0030e1, 0x0030e2, 0x0030e4, 0x0030e6,
+  0x0030e8, 0x0030e9, 0x0030ea, 0x0030eb, 0x0030ec, 0x0030ed, 0x0030ef, 0x0030f0,
+  0x0030f1, 0x0030f2, 0x004ee4, 0x00548c, 0x0030a2, 0x0030d1, 0x0030fc, 0x0030c8,
+  0x0030a2, 0x0030eb, 0x0030d5, 0x0030a1, 0x0030a2, 0x0030f3, 0x0030da, 0x0030a2,
+  0x0030a2, 0x0030fc, 0x0030eb, 0x0030a4, 0x0030cb, 0x0030f3, 0x0030b0, 0x0030a4,
+  0x0030f3, 0x0030c1, 0x0030a6, 0x0030a9, 0x0030f3, 0x0030a8, 0x0030b9, 0x0030af,
+  0x0030fc, 0x0030c9, 0x0030a8, 0x0030fc, 0x0030ab, 0x0030fc, 0x0030aa, 0x0030f3,
+  0x0030b9, 0x0030aa, 0x0030fc, 0x0030e0, 0x0030ab, 0x0030a4, 0x0030ea, 0x0030ab,
+  0x0030e9, 0x0030c3, 0x0030c8, 0x0030ab, 0x0030ed, 0x0030ea, 0x0030fc, 0x0030ac,
+  0x0030ed, 0x0030f3, 0x0030ac, 0x0030f3, 0x0030de, 0x0030ae, 0x0030ac, 0x0030ae,
+  0x0030cb, 0x0030fc, 0x0030ad, 0x0030e5, 0x0030ea, 0x0030fc, 0x0030ae, 0x0030eb,
+  0x0030c0, 0x0030fc, 0x0030ad, 0x0030ed, 0x0030ad, 0x0030ed, 0x0030b0, 0x0030e9,
+  0x0030e0, 0x0030ad, 0x0030ed, 0x0030e1, 0x0030fc, 0x0030c8, 0x0030eb, 0x0030ad,
+  0x0030ed, 0x0030ef, 0x0030c3, 0x0030c8, 0x0030b0, 0x0030e9, 0x0030e0, 0x0030b0,
+  0x0030e9, 0x0030e0, 0x0030c8, 0x0030f3, 0x0030af, 0x0030eb, 0x0030bc, 0x0030a4,
+  0x0030ed, 0x0030af, 0x0030ed, 0x0030fc, 0x0030cd, 0x0030b1, 0x0030fc, 0x0030b9,
+  0x0030b3, 0x0030eb, 0x0030ca, 0x0030b3, 0x0030fc, 0x0030dd, 0x0030b5, 0x0030a4,
+  0x0030af, 0x0030eb, 0x0030b5, 0x0030f3, 0x0030c1, 0x0030fc, 0x0030e0, 0x0030b7,
+  0x0030ea, 0x0030f3, 0x0030b0, 0x0030bb, 0x0030f3, 0x0030c1, 0x0030bb, 0x0030f3,
+  0x0030c8, 0x0030c0, 0x0030fc, 0x0030b9, 0x0030c7, 0x0030b7, 0x0030c9, 0x0030eb,
+  0x0030c8, 0x0030f3, 0x0030ca, 0x0030ce, 0x0030ce, 0x0030c3, 0x0030c8, 0x0030cf,
+  0x0030a4, 0x0030c4, 0x0030d1, 0x0030fc, 0x0030bb, 0x0030f3, 0x0030c8, 0x0030d1,
+  0x0030fc, 0x0030c4, 0x0030d0, 0x0030fc, 0x0030ec, 0x0030eb, 0x0030d4, 0x0030a2,
+  0x0030b9, 0x0030c8, 0x0030eb, 0x0030d4, 0x0030af, 0x0030eb, 0x0030d4, 0x0030b3,
+  0x0030d3, 0x0030eb, 0x0030d5, 0x0030a1, 0x0030e9, 0x0030c3, 0x0030c9, 0x0030d5,
+  0x0030a3, 0x0030fc, 0x0030c8, 0x0030d6, 0x0030c3, 0x0030b7, 0x0030a7, 0x0030eb,
+  0x0030d5, 0x0030e9, 0x0030f3, 0x0030d8, 0x0030af, 0x0030bf, 0x0030fc, 0x0030eb,
+  0x0030da, 0x0030bd, 0x0030da, 0x0030cb, 0x0030d2, 0x0030d8, 0x0030eb, 0x0030c4,
+  0x0030da, 0x0030f3, 0x0030b9, 0x0030da, 0x0030fc, 0x0030b8, 0x0030d9, 0x0030fc,
+  0x0030bf, 0x0030dd, 0x0030a4, 0x0030f3, 0x0030c8, 0x0030dc, 0x0030eb, 0x0030c8,
+  0x0030db, 0x0030f3, 0x0030dd, 0x0030f3, 0x0030c9, 0x0030db, 0x0030fc, 0x0030eb,
+  0x0030db, 0x0030fc, 0x0030f3, 0x0030de, 0x0030a4, 0x0030af, 0x0030ed, 0x0030de,
+  0x0030a4, 0x0030eb, 0x0030de, 0x0030c3, 0x0030cf, 0x0030de, 0x0030eb, 0x0030af,
+  0x0030de, 0x0030f3, 0x0030b7, 0x0030e7, 0x0030f3, 0x0030df, 0x0030af, 0x0030ed,
+  0x0030f3, 0x0030df, 0x0030ea, 0x0030df, 0x0030ea, 0x0030d0, 0x0030fc, 0x0030eb,
+  0x0030e1, 0x0030ac, 0x0030e1, 0x0030ac, 0x0030c8, 0x0030f3, 0x0030e1, 0x0030fc,
+  0x0030c8, 0x0030eb, 0x0030e4, 0x0030fc, 0x0030c9, 0x0030e4, 0x0030fc, 0x0030eb,
+  0x0030e6, 0x0030a2, 0x0030f3, 0x0030ea, 0x0030c3, 0x0030c8, 0x0030eb, 0x0030ea,
+  0x0030e9, 0x0030eb, 0x0030d4, 0x0030fc, 0x0030eb, 0x0030fc, 0x0030d6, 0x0030eb,
+  0x0030ec, 0x0030e0, 0x0030ec, 0x0030f3, 0x0030c8, 0x0030b2, 0x0030f3, 0x0030ef,
+  0x0030c3, 0x0030c8, 0x000030, 0x0070b9, 0x000031, 0x0070b9, 0x000032, 0x0070b9,
+  0x000033, 0x0070b9, 0x000034, 0x0070b9, 0x000035, 0x0070b9, 0x000036, 0x0070b9,
+  0x000037, 0x0070b9, 0x000038, 0x0070b9, 0x000039, 0x0070b9, 0x000031, 0x000030,
+  0x0070b9, 0x000031, 0x000031, 0x0070b9, 0x000031, 0x000032, 0x0070b9, 0x000031,
+  0x000033, 0x0070b9, 0x000031, 0x000034, 0x0070b9, 0x000031, 0x000035, 0x0070b9,
+  0x000031, 0x000036, 0x0070b9, 0x000031, 0x000037, 0x0070b9, 0x000031, 0x000038,
+  0x0070b9, 0x000031, 0x000039, 0x0070b9, 0x000032, 0x000030, 0x0070b9, 0x000032,
+  0x000031, 0x0070b9, 0x000032, 0x000032, 0x0070b9, 0x000032, 0x000033, 0x0070b9,
+  0x000032, 0x000034, 0x0070b9, 0x000068, 0x000070, 0x000061, 0x000064, 0x000061,
+  0x000061, 0x000075, 0x000062, 0x000061, 0x000072, 0x00006f, 0x000076, 0x000070,
+  0x000063, 0x000064, 0x00006d, 0x000064, 0x00006d, 0x000032, 0x000064, 0x00006d,
+  0x000033, 0x000069, 0x000075, 0x005e73, 0x006210, 0x00662d, 0x00548c, 0x005927,
+  0x006b63, 0x00660e, 0x006cbb, 0x00682a, 0x005f0f, 0x004f1a, 0x00793e, 0x000070,
+  0x000061, 0x00006e, 0x000061, 0x0003bc, 0x000061, 0x00006d, 0x000061, 0x00006b,
+  0x000061, 0x00006b, 0x000062, 0x00006d, 0x000062, 0x000067, 0x000062, 0x000063,
+  0x000061, 0x00006c, 0x00006b, 0x000063, 0x000061, 0x00006c, 0x000070, 0x000066,
+  0x00006e, 0x000066, 0x0003bc, 0x000066, 0x0003bc, 0x000067, 0x00006d, 0x000067,
+  0x00006b, 0x000067, 0x000068, 0x00007a, 0x00006b, 0x000068, 0x00007a, 0x00006d,
+  0x000068, 0x00007a, 0x000067, 0x000068, 0x00007a, 0x000074, 0x000068, 0x00007a,
+  0x0003bc, 0x00006c, 0x00006d, 0x00006c, 0x000064, 0x00006c, 0x00006b, 0x00006c,
+  0x000066, 0x00006d, 0x00006e, 0x00006d, 0x0003bc, 0x00006d, 0x00006d, 0x00006d,
+  0x000063, 0x00006d, 0x00006b, 0x00006d, 0x00006d, 0x00006d, 0x000032, 0x000063,
+  0x00006d, 0x000032, 0x00006d, 0x000032, 0x00006b, 0x00006d, 0x000032, 0x00006d,
+  0x00006d, 0x000033, 0x000063, 0x00006d, 0x000033, 0x00006d, 0x000033, 0x00006b,
+  0x00006d, 0x000033, 0x00006d, 0x002215, 0x000073, 0x00006d, 0x002215, 0x000073,
+  0x000032, 0x000070, 0x000061, 0x00006b, 0x000070, 0x000061, 0x00006d, 0x000070,
+  0x000061, 0x000067, 0x000070, 0x000061, 0x000072, 0x000061, 0x000064, 0x000072,
+  0x000061, 0x000064, 0x002215, 0x000073, 0x000072, 0x000061, 0x000064, 0x002215,
+  0x000073, 0x000032, 0x000070, 0x000073, 0x00006e, 0x000073, 0x0003bc, 0x000073,
+  0x00006d, 0x000073, 0x000070, 0x000076, 0x00006e, 0x000076, 0x0003bc, 0x000076,
+  0x00006d, 0x000076, 0x00006b, 0x000076, 0x00006d, 0x000076, 0x000070, 0x000077,
+  0x00006e, 0x000077, 0x0003bc, 0x000077, 0x00006d, 0x000077, 0x00006b, 0x000077,
+  0x00006d, 0x000077, 0x00006b, 0x0003c9, 0x00006d, 0x0003c9, 0x000062, 0x000071,
+  0x000063, 0x000063, 0x000063, 0x000064, 0x000063, 0x002215, 0x00006b, 0x000067,
+  0x000064, 0x000062, 0x000067, 0x000079, 0x000068, 0x000061, 0x000068, 0x000070,
+  0x000069, 0x00006e, 0x00006b, 0x00006b, 0x00006b, 0x00006d, 0x00006b, 0x000074,
+  0x00006c, 0x00006d, 0x00006c, 0x00006e, 0x00006c, 0x00006f, 0x000067, 0x00006c,
+  0x000078, 0x00006d, 0x000062, 0x00006d, 0x000069, 0x00006c, 0x00006d, 0x00006f,
+  0x00006c, 0x000070, 0x000068, 0x000070, 0x000070, 0x00006d, 0x000070, 0x000072,
+  0x000073, 0x000072, 0x000073, 0x000076, 0x000077, 0x000062, 0x000076, 0x002215,
+  0x00006d, 0x000061, 0x002215, 0x00006d, 0x000031, 0x0065e5, 0x000032, 0x0065e5,
+  0x000033, 0x0065e5, 0x000034, 0x0065e5, 0x000035, 0x0065e5, 0x000036, 0x0065e5,
+  0x000037, 0x0065e5, 0x000038, 0x0065e5, 0x000039, 0x0065e5, 0x000031, 0x000030,
+  0x0065e5, 0x000031, 0x000031, 0x0065e5, 0x000031, 0x000032, 0x0065e5, 0x000031,
+  0x000033, 0x0065e5, 0x000031, 0x000034, 0x0065e5, 0x000031, 0x000035, 0x0065e5,
+  0x000031, 0x000036, 0x0065e5, 0x000031, 0x000037, 0x0065e5, 0x000031, 0x000038,
+  0x0065e5, 0x000031, 0x000039, 0x0065e5, 0x000032, 0x000030, 0x0065e5, 0x000032,
+  0x000031, 0x0065e5, 0x000032, 0x000032, 0x0065e5, 0x000032, 0x000033, 0x0065e5,
+  0x000032, 0x000034, 0x0065e5, 0x000032, 0x000035, 0x0065e5, 0x000032, 0x000036,
+  0x0065e5, 0x000032, 0x000037, 0x0065e5, 0x000032, 0x000038, 0x0065e5, 0x000032,
+  0x000039, 0x0065e5, 0x000033, 0x000030, 0x0065e5, 0x000033, 0x000031, 0x0065e5,
+  0x000067, 0x000061, 0x00006c, 0x00a641, 0x00a643, 0x00a645, 0x00a647, 0x00a649,
+  0x00a64b, 0x00a64d, 0x00a64f, 0x00a651, 0x00a653, 0x00a655, 0x00a657, 0x00a659,
+  0x00a65b, 0x00a65d, 0x00a65f, 0x00a661, 0x00a663, 0x00a665, 0x00a667, 0x00a669,
+  0x00a66b, 0x00a66d, 0x00a681, 0x00a683, 0x00a685, 0x00a687, 0x00a689, 0x00a68b,
+  0x00a68d, 0x00a68f, 0x00a691, 0x00a693, 0x00a695, 0x00a697, 0x00a699, 0x00a69b,
+  0x00044a, 0x00044c, 0x00a723, 0x00a725, 0x00a727, 0x00a729, 0x00a72b, 0x00a72d,
+  0x00a72f, 0x00a733, 0x00a735, 0x00a737, 0x00a739, 0x00a73b, 0x00a73d, 0x00a73f,
+  0x00a741, 0x00a743, 0x00a745, 0x00a747, 0x00a749, 0x00a74b, 0x00a74d, 0x00a74f,
+  0x00a751, 0x00a753, 0x00a755, 0x00a757, 0x00a759, 0x00a75b, 0x00a75d, 0x00a75f,
+  0x00a761, 0x00a763, 0x00a765, 0x00a767, 0x00a769, 0x00a76b, 0x00a76d, 0x00a76f,
+  0x00a76f, 0x00a77a, 0x00a77c, 0x001d79, 0x00a77f, 0x00a781, 0x00a783, 0x00a785,
+  0x00a787, 0x00a78c, 0x000265, 0x00a791, 0x00a793, 0x00a797, 0x00a799, 0x00a79b,
+  0x00a79d, 0x00a79f, 0x00a7a1, 0x00a7a3, 0x00a7a5, 0x00a7a7, 0x00a7a9, 0x000266,
+  0x00025c, 0x000261, 0x00026c, 0x00026a, 0x00029e, 0x000287, 0x00029d, 0x00ab53,
+  0x00a7b5, 0x00a7b7, 0x00a7b9, 0x00a7bb, 0x00a7bd, 0x00a7bf, 0x00a7c1, 0x00a7c3,
+  0x00a794, 0x000282, 0x001d8e, 0x00a7c8, 0x00a7ca, 0x00a7d1, 0x00a7d7, 0x00a7d9,
+  0x000063, 0x000066, 0x000071, 0x00a7f6, 0x000127, 0x000153, 0x00a727, 0x00ab37,
+  0x00026b, 0x00ab52, 0x00028d, 0x0013a0, 0x0013a1, 0x0013a2, 0x0013a3, 0x0013a4,
+  0x0013a5, 0x0013a6, 0x0013a7, 0x0013a8, 0x0013a9, 0x0013aa, 0x0013ab, 0x0013ac,
+  0x0013ad, 0x0013ae, 0x0013af, 0x0013b0, 0x0013b1, 0x0013b2, 0x0013b3, 0x0013b4,
+  0x0013b5, 0x0013b6, 0x0013b7, 0x0013b8, 0x0013b9, 0x0013ba, 0x0013bb, 0x0013bc,
+  0x0013bd, 0x0013be, 0x0013bf, 0x0013c0, 0x0013c1, 0x0013c2, 0x0013c3, 0x0013c4,
+  0x0013c5, 0x0013c6, 0x0013c7, 0x0013c8, 0x0013c9, 0x0013ca, 0x0013cb, 0x0013cc,
+  0x0013cd, 0x0013ce, 0x0013cf, 0x0013d0, 0x0013d1, 0x0013d2, 0x0013d3, 0x0013d4,
+  0x0013d5, 0x0013d6, 0x0013d7, 0x0013d8, 0x0013d9, 0x0013da, 0x0013db, 0x0013dc,
+  0x0013dd, 0x0013de, 0x0013df, 0x0013e0, 0x0013e1, 0x0013e2, 0x0013e3, 0x0013e4,
+  0x0013e5, 0x0013e6, 0x0013e7, 0x0013e8, 0x0013e9, 0x0013ea, 0x0013eb, 0x0013ec,
+  0x0013ed, 0x0013ee, 0x0013ef, 0x008c48, 0x0066f4, 0x008eca, 0x008cc8, 0x006ed1,
+  0x004e32, 0x0053e5, 0x009f9c, 0x005951, 0x0091d1, 0x005587, 0x005948, 0x0061f6,
+  0x007669, 0x007f85, 0x00863f, 0x0087ba, 0x0088f8, 0x00908f, 0x006a02, 0x006d1b,
+  0x0070d9, 0x0073de, 0x00843d, 0x00916a, 0x0099f1, 0x004e82, 0x005375, 0x006b04,
+  0x00721b, 0x00862d, 0x009e1e, 0x005d50, 0x006feb, 0x0085cd, 0x008964, 0x0062c9,
+  0x0081d8, 0x00881f, 0x005eca, 0x006717, 0x006d6a, 0x0072fc, 0x0090ce, 0x004f86,
+  0x0051b7, 0x0052de, 0x0064c4, 0x006ad3, 0x007210, 0x0076e7, 0x008001, 0x008606,
+  0x00865c, 0x008def, 0x009732, 0x009b6f, 0x009dfa, 0x00788c, 0x00797f, 0x007da0,
+  0x0083c9, 0x009304, 0x009e7f, 0x008ad6, 0x0058df, 0x005f04, 0x007c60, 0x00807e,
+  0x007262, 0x0078ca, 0x008cc2, 0x0096f7, 0x0058d8, 0x005c62, 0x006a13, 0x006dda,
+  0x006f0f, 0x007d2f, 0x007e37, 0x00964b, 0x0052d2, 0x00808b, 0x0051dc, 0x0051cc,
+  0x007a1c, 0x007dbe, 0x0083f1, 0x009675, 0x008b80, 0x0062cf, 0x006a02, 0x008afe,
+  0x004e39, 0x005be7, 0x006012, 0x007387, 0x007570, 0x005317, 0x0078fb, 0x004fbf,
+  0x005fa9, 0x004e0d, 0x006ccc, 0x006578, 0x007d22, 0x0053c3, 0x00585e, 0x007701,
+  0x008449, 0x008aaa, 0x006bba, 0x008fb0, 0x006c88, 0x0062fe, 0x0082e5, 0x0063a0,
+  0x007565, 0x004eae, 0x005169, 0x0051c9, 0x006881, 0x007ce7, 0x00826f, 0x008ad2,
+  0x0091cf, 0x0052f5, 0x005442, 0x005973, 0x005eec, 0x0065c5, 0x006ffe, 0x00792a,
+  0x0095ad, 0x009a6a, 0x009e97, 0x009ece, 0x00529b, 0x0066c6, 0x006b77, 0x008f62,
+  0x005e74, 0x006190, 0x006200, 0x00649a, 0x006f23, 0x007149, 0x007489, 0x0079ca,
+  0x007df4, 0x00806f, 0x008f26, 0x0084ee, 0x009023, 0x00934a, 0x005217, 0x0052a3,
+  0x0054bd, 0x0070c8, 0x0088c2, 0x008aaa, 0x005ec9, 0x005ff5, 0x00637b, 0x006bae,
+  0x007c3e, 0x007375, 0x004ee4, 0x0056f9, 0x005be7, 0x005dba, 0x00601c, 0x0073b2,
+  0x007469, 0x007f9a, 0x008046, 0x009234, 0x0096f6, 0x009748, 0x009818, 0x004f8b,
+  0x0079ae, 0x0091b4, 0x0096b8, 0x0060e1, 0x004e86, 0x0050da, 0x005bee, 0x005c3f,
+  0x006599, 0x006a02, 0x0071ce, 0x007642, 0x0084fc, 0x00907c, 0x009f8d, 0x006688,
+  0x00962e, 0x005289, 0x00677b, 0x0067f3, 0x006d41, 0x006e9c, 0x007409, 0x007559,
+  0x00786b, 0x007d10, 0x00985e, 0x00516d, 0x00622e, 0x009678, 0x00502b, 0x005d19,
+  0x006dea, 0x008f2a, 0x005f8b, 0x006144, 0x006817, 0x007387, 0x009686, 0x005229,
+  0x00540f, 0x005c65, 0x006613, 0x00674e, 0x0068a8, 0x006ce5, 0x007406, 0x0075e2,
+  0x007f79, 0x0088cf, 0x0088e1, 0x0091cc, 0x0096e2, 0x00533f, 0x006eba, 0x00541d,
+  0x0071d0, 0x007498, 0x0085fa, 0x0096a3, 0x009c57, 0x009e9f, 0x006797, 0x006dcb,
+  0x0081e8, 0x007acb, 0x007b20, 0x007c92, 0x0072c0, 0x007099, 0x008b58, 0x004ec0,
+  0x008336, 0x00523a, 0x005207, 0x005ea6, 0x0062d3, 0x007cd6, 0x005b85, 0x006d1e,
+  0x0066b4, 0x008f3b, 0x00884c, 0x00964d, 0x00898b, 0x005ed3, 0x005140, 0x0055c0,
+  0x00585a, 0x006674, 0x0051de, 0x00732a, 0x0076ca, 0x00793c, 0x00795e, 0x007965,
+  0x00798f, 0x009756, 0x007cbe, 0x007fbd, 0x008612, 0x008af8, 0x009038, 0x0090fd,
+  0x0098ef, 0x0098fc, 0x009928, 0x009db4, 0x0090de, 0x0096b7, 0x004fae, 0x0050e7,
+  0x00514d, 0x0052c9, 0x0052e4, 0x005351, 0x00559d, 0x005606, 0x005668, 0x005840,
+  0x0058a8, 0x005c64, 0x005c6e, 0x006094, 0x006168, 0x00618e, 0x0061f2, 0x00654f,
+  0x0065e2, 0x006691, 0x006885, 0x006d77, 0x006e1a, 0x006f22, 0x00716e, 0x00722b,
+  0x007422, 0x007891, 0x00793e, 0x007949, 0x007948, 0x007950, 0x007956, 0x00795d,
+  0x00798d, 0x00798e, 0x007a40, 0x007a81, 0x007bc0, 0x007df4, 0x007e09, 0x007e41,
+  0x007f72, 0x008005, 0x0081ed, 0x008279, 0x008457, 0x008910, 0x008996, 0x008b01,
+  0x008b39, 0x008cd3, 0x008d08, 0x008fb6, 0x009038, 0x0096e3, 0x0097ff, 0x00983b,
+  0x006075, 0x0242ee, 0x008218, 0x004e26, 0x0051b5, 0x005168, 0x004f80, 0x005145,
+  0x005180, 0x0052c7, 0x0052fa, 0x00559d, 0x005555, 0x005599, 0x0055e2, 0x00585a,
+  0x0058b3, 0x005944, 0x005954, 0x005a62, 0x005b28, 0x005ed2, 0x005ed9, 0x005f69,
+  0x005fad, 0x0060d8, 0x00614e, 0x006108, 0x00618e, 0x006160, 0x0061f2, 0x006234,
+  0x0063c4, 0x00641c, 0x006452, 0x006556, 0x006674, 0x006717, 0x00671b, 0x006756,
+  0x006b79, 0x006bba, 0x006d41, 0x006edb, 0x006ecb, 0x006f22, 0x00701e, 0x00716e,
+  0x0077a7, 0x007235, 0x0072af, 0x00732a, 0x007471, 0x007506, 0x00753b, 0x00761d,
+  0x00761f, 0x0076ca, 0x0076db, 0x0076f4, 0x00774a, 0x007740, 0x0078cc, 0x007ab1,
+  0x007bc0, 0x007c7b, 0x007d5b, 0x007df4, 0x007f3e, 0x008005, 0x008352, 0x0083ef,
+  0x008779, 0x008941, 0x008986, 0x008996, 0x008abf, 0x008af8, 0x008acb, 0x008b01,
+  0x008afe, 0x008aed, 0x008b39, 0x008b8a, 0x008d08, 0x008f38, 0x009072, 0x009199,
+  0x009276, 0x00967c, 0x0096e3, 0x009756, 0x0097db, 0x0097ff, 0x00980b, 0x00983b,
+  0x009b12, 0x009f9c, 0x02284a, 0x022844, 0x0233d5, 0x003b9d, 0x004018, 0x004039,
+  0x025249, 0x025cd0, 0x027ed3, 0x009f43, 0x009f8e, 0x000066, 0x000066, 0x000066,
+  0x000069, 0x000066, 0x00006c, 0x000066, 0x000066, 0x000069, 0x000066, 0x000066,
+  0x00006c, 0x000073, 0x000074, 0x000574, 0x000576, 0x000574, 0x000565, 0x000574,
+  0x00056b, 0x00057e, 0x000576, 0x000574, 0x00056d, 0x0005d9, 0x0005b4, 0x0005f2,
+  0x0005b7, 0x0005e2, 0x0005d0, 0x0005d3, 0x0005d4, 0x0005db, 0x0005dc, 0x0005dd,
+  0x0005e8, 0x0005ea, 0x00002b, 0x0005e9, 0x0005c1, 0x0005e9, 0x0005c2, 0x0005e9,
+  0x0005bc, 0x0005c1, 0x0005e9, 0x0005bc, 0x0005c2, 0x0005d0, 0x0005b7, 0x0005d0,
+  0x0005b8, 0x0005d0, 0x0005bc, 0x0005d1, 0x0005bc, 0x0005d2, 0x0005bc, 0x0005d3,
+  0x0005bc, 0x0005d4, 0x0005bc, 0x0005d5, 0x0005bc, 0x0005d6, 0x0005bc, 0x0005d8,
+  0x0005bc, 0x0005d9, 0x0005bc, 0x0005da, 0x0005bc, 0x0005db, 0x0005bc, 0x0005dc,
+  0x0005bc, 0x0005de, 0x0005bc, 0x0005e0, 0x0005bc, 0x0005e1, 0x0005bc, 0x0005e3,
+  0x0005bc, 0x0005e4, 0x0005bc, 0x0005e6, 0x0005bc, 0x0005e7, 0x0005bc, 0x0005e8,
+  0x0005bc, 0x0005e9, 0x0005bc, 0x0005ea, 0x0005bc, 0x0005d5, 0x0005b9, 0x0005d1,
+  0x0005bf, 0x0005db, 0x0005bf, 0x0005e4, 0x0005bf, 0x0005d0, 0x0005dc, 0x000671,
+  0x00067b, 0x00067e, 0x000680, 0x00067a, 0x00067f, 0x000679, 0x0006a4, 0x0006a6,
+  0x000684, 0x000683, 0x000686, 0x000687, 0x00068d, 0x00068c, 0x00068e, 0x000688,
+  0x000698, 0x000691, 0x0006a9, 0x0006af, 0x0006b3, 0x0006b1, 0x0006ba, 0x0006bb,
+  0x0006c0, 0x0006c1, 0x0006be, 0x0006d2, 0x0006d3, 0x0006ad, 0x0006c7, 0x0006c6,
+  0x0006c8, 0x0006c7, 0x000674, 0x0006cb, 0x0006c5, 0x0006c9, 0x0006d0, 0x000649,
+  0x000626, 0x000627, 0x000626, 0x0006d5, 0x000626, 0x000648, 0x000626, 0x0006c7,
+  0x000626, 0x0006c6, 0x000626, 0x0006c8, 0x000626, 0x0006d0, 0x000626, 0x000649,
+  0x0006cc, 0x000626, 0x00062c, 0x000626, 0x00062d, 0x000626, 0x000645, 0x000626,
+  0x000649, 0x000626, 0x00064a, 0x000628, 0x00062c, 0x000628, 0x00062d, 0x000628,
+  0x00062e, 0x000628, 0x000645, 0x000628, 0x000649, 0x000628, 0x00064a, 0x00062a,
+  0x00062c, 0x00062a, 0x00062d, 0x00062a, 0x00062e, 0x00062a, 0x000645, 0x00062a,
+  0x000649, 0x00062a, 0x00064a, 0x00062b, 0x00062c, 0x00062b, 0x000645, 0x00062b,
+  0x000649, 0x00062b, 0x00064a, 0x00062c, 0x00062d, 0x00062c, 0x000645, 0x00062d,
+  0x00062c, 0x00062d, 0x000645, 0x00062e, 0x00062c, 0x00062e, 0x00062d, 0x00062e,
+  0x000645, 0x000633, 0x00062c, 0x000633, 0x00062d, 0x000633, 0x00062e, 0x000633,
+  0x000645, 0x000635, 0x00062d, 0x000635, 0x000645, 0x000636, 0x00062c, 0x000636,
+  0x00062d, 0x000636, 0x00062e, 0x000636, 0x000645, 0x000637, 0x00062d, 0x000637,
+  0x000645, 0x000638, 0x000645, 0x000639, 0x00062c, 0x000639, 0x000645, 0x00063a,
+  0x00062c, 0x00063a, 0x000645, 0x000641, 0x00062c, 0x000641, 0x00062d, 0x000641,
+  0x00062e, 0x000641, 0x000645, 0x000641, 0x000649, 0x000641, 0x00064a, 0x000642,
+  0x00062d, 0x000642, 0x000645, 0x000642, 0x000649, 0x000642, 0x00064a, 0x000643,
+  0x000627, 0x000643, 0x00062c, 0x000643, 0x00062d, 0x000643, 0x00062e, 0x000643,
+  0x000644, 0x000643, 0x000645, 0x000643, 0x000649, 0x000643, 0x00064a, 0x000644,
+  0x00062c, 0x000644, 0x00062d, 0x000644, 0x00062e, 0x000644, 0x000645, 0x000644,
+  0x000649, 0x000644, 0x00064a, 0x000645, 0x00062c, 0x000645, 0x00062d, 0x000645,
+  0x00062e, 0x000645, 0x000645, 0x000645, 0x000649, 0x000645, 0x00064a, 0x000646,
+  0x00062c, 0x000646, 0x00062d, 0x000646, 0x00062e, 0x000646, 0x000645, 0x000646,
+  0x000649, 0x000646, 0x00064a, 0x000647, 0x00062c, 0x000647, 0x000645, 0x000647,
+  0x000649, 0x000647, 0x00064a, 0x00064a, 0x00062c, 0x00064a, 0x00062d, 0x00064a,
+  0x00062e, 0x00064a, 0x000645, 0x00064a, 0x000649, 0x00064a, 0x00064a, 0x000630,
+  0x000670, 0x000631, 0x000670, 0x000649, 0x000670, 0x000020, 0x00064c, 0x000651,
+  0x000020, 0x00064d, 0x000651, 0x000020, 0x00064e, 0x000651, 0x000020, 0x00064f,
+  0x000651, 0x000020, 0x000650, 0x000651, 0x000020, 0x000651, 0x000670, 0x000626,
+  0x000631, 0x000626, 0x000632, 0x000626, 0x000645, 0x000626, 0x000646, 0x000626,
+  0x000649, 0x000626, 0x00064a, 0x000628, 0x000631, 0x000628, 0x000632, 0x000628,
+  0x000645, 0x000628, 0x000646, 0x000628, 0x000649, 0x000628, 0x00064a, 0x00062a,
+  0x000631, 0x00062a, 0x000632, 0x00062a, 0x000645, 0x00062a, 0x000646, 0x00062a,
+  0x000649, 0x00062a, 0x00064a, 0x00062b, 0x000631, 0x00062b, 0x000632, 0x00062b,
+  0x000645, 0x00062b, 0x000646, 0x00062b, 0x000649, 0x00062b, 0x00064a, 0x000641,
+  0x000649, 0x000641, 0x00064a, 0x000642, 0x000649, 0x000642, 0x00064a, 0x000643,
+  0x000627, 0x000643, 0x000644, 0x000643, 0x000645, 0x000643, 0x000649, 0x000643,
+  0x00064a, 0x000644, 0x000645, 0x000644, 0x000649, 0x000644, 0x00064a, 0x000645,
+  0x000627, 0x000645, 0x000645, 0x000646, 0x000631, 0x000646, 0x000632, 0x000646,
+  0x000645, 0x000646, 0x000646, 0x000646, 0x000649, 0x000646, 0x00064a, 0x000649,
+  0x000670, 0x00064a, 0x000631, 0x00064a, 0x000632, 0x00064a, 0x000645, 0x00064a,
+  0x000646, 0x00064a, 0x000649, 0x00064a, 0x00064a, 0x000626, 0x00062c, 0x000626,
+  0x00062d, 0x000626, 0x00062e, 0x000626, 0x000645, 0x000626, 0x000647, 0x000628,
+  0x00062c, 0x000628, 0x00062d, 0x000628, 0x00062e, 0x000628, 0x000645, 0x000628,
+  0x000647, 0x00062a, 0x00062c, 0x00062a, 0x00062d, 0x00062a, 0x00062e, 0x00062a,
+  0x000645, 0x00062a, 0x000647, 0x00062b, 0x000645, 0x00062c, 0x00062d, 0x00062c,
+  0x000645, 0x00062d, 0x00062c, 0x00062d, 0x000645, 0x00062e, 0x00062c, 0x00062e,
+  0x000645, 0x000633, 0x00062c, 0x000633, 0x00062d, 0x000633, 0x00062e, 0x000633,
+  0x000645, 0x000635, 0x00062d, 0x000635, 0x00062e, 0x000635, 0x000645, 0x000636,
+  0x00062c, 0x000636, 0x00062d, 0x000636, 0x00062e, 0x000636, 0x000645, 0x000637,
+  0x00062d, 0x000638, 0x000645, 0x000639, 0x00062c, 0x000639, 0x000645, 0x00063a,
+  0x00062c, 0x00063a, 0x000645, 0x000641, 0x00062c, 0x000641, 0x00062d, 0x000641,
+  0x00062e, 0x000641, 0x000645, 0x000642, 0x00062d, 0x000642, 0x000645, 0x000643,
+  0x00062c, 0x000643, 0x00062d, 0x000643, 0x00062e, 0x000643, 0x000644, 0x000643,
+  0x000645, 0x000644, 0x00062c, 0x000644, 0x00062d, 0x000644, 0x00062e, 0x000644,
+  0x000645, 0x000644, 0x000647, 0x000645, 0x00062c, 0x000645, 0x00062d, 0x000645,
+  0x00062e, 0x000645, 0x000645, 0x000646, 0x00062c, 0x000646, 0x00062d, 0x000646,
+  0x00062e, 0x000646, 0x000645, 0x000646, 0x000647, 0x000647, 0x00062c, 0x000647,
+  0x000645, 0x000647, 0x000670, 0x00064a, 0x00062c, 0x00064a, 0x00062d, 0x00064a,
+  0x00062e, 0x00064a, 0x000645, 0x00064a, 0x000647, 0x000626, 0x000645, 0x000626,
+  0x000647, 0x000628, 0x000645, 0x000628, 0x000647, 0x00062a, 0x000645, 0x00062a,
+  0x000647, 0x00062b, 0x000645, 0x00062b, 0x000647, 0x000633, 0x000645, 0x000633,
+  0x000647, 0x000634, 0x000645, 0x000634, 0x000647, 0x000643, 0x000644, 0x000643,
+  0x000645, 0x000644, 0x000645, 0x000646, 0x000645, 0x000646, 0x000647, 0x00064a,
+  0x000645, 0x00064a, 0x000647, 0x000640, 0x00064e, 0x000651, 0x000640, 0x00064f,
+  0x000651, 0x000640, 0x000650, 0x000651, 0x000637, 0x000649, 0x000637, 0x00064a,
+  0x000639, 0x000649, 0x000639, 0x00064a, 0x00063a, 0x000649, 0x00063a, 0x00064a,
+  0x000633, 0x000649, 0x000633, 0x00064a, 0x000634, 0x000649, 0x000634, 0x00064a,
+  0x00062d, 0x000649, 0x00062d, 0x00064a, 0x00062c, 0x000649, 0x00062c, 0x00064a,
+  0x00062e, 0x000649, 0x00062e, 0x00064a, 0x000635, 0x000649, 0x000635, 0x00064a,
+  0x000636, 0x000649, 0x000636, 0x00064a, 0x000634, 0x00062c, 0x000634, 0x00062d,
+  0x000634, 0x00062e, 0x000634, 0x000645, 0x000634, 0x000631, 0x000633, 0x000631,
+  0x000635, 0x000631, 0x000636, 0x000631, 0x000637, 0x000649, 0x000637, 0x00064a,
+  0x000639, 0x000649, 0x000639, 0x00064a, 0x00063a, 0x000649, 0x00063a, 0x00064a,
+  0x000633, 0x000649, 0x000633, 0x00064a, 0x000634, 0x000649, 0x000634, 0x00064a,
+  0x00062d, 0x000649, 0x00062d, 0x00064a, 0x00062c, 0x000649, 0x00062c, 0x00064a,
+  0x00062e, 0x000649, 0x00062e, 0x00064a, 0x000635, 0x000649, 0x000635, 0x00064a,
+  0x000636, 0x000649, 0x000636, 0x00064a, 0x000634, 0x00062c, 0x000634, 0x00062d,
+  0x000634, 0x00062e, 0x000634, 0x000645, 0x000634, 0x000631, 0x000633, 0x000631,
+  0x000635, 0x000631, 0x000636, 0x000631, 0x000634, 0x00062c, 0x000634, 0x00062d,
+  0x000634, 0x00062e, 0x000634, 0x000645, 0x000633, 0x000647, 0x000634, 0x000647,
+  0x000637, 0x000645, 0x000633, 0x00062c, 0x000633, 0x00062d, 0x000633, 0x00062e,
+  0x000634, 0x00062c, 0x000634, 0x00062d, 0x000634, 0x00062e, 0x000637, 0x000645,
+  0x000638, 0x000645, 0x000627, 0x00064b, 0x00062a, 0x00062c, 0x000645, 0x00062a,
+  0x00062d, 0x00062c, 0x00062a, 0x00062d, 0x000645, 0x00062a, 0x00062e, 0x000645,
+  0x00062a, 0x000645, 0x00062c, 0x00062a, 0x000645, 0x00062d, 0x00062a, 0x000645,
+  0x00062e, 0x00062c, 0x000645, 0x00062d, 0x00062d, 0x000645, 0x00064a, 0x00062d,
+  0x000645, 0x000649, 0x000633, 0x00062d, 0x00062c, 0x000633, 0x00062c, 0x00062d,
+  0x000633, 0x00062c, 0x000649, 0x000633, 0x000645, 0x00062d, 0x000633, 0x000645,
+  0x00062c, 0x000633, 0x000645, 0x000645, 0x000635, 0x00062d, 0x00062d, 0x000635,
+  0x000645, 0x000645, 0x000634, 0x00062d, 0x000645, 0x000634, 0x00062c, 0x00064a,
+  0x000634, 0x000645, 0x00062e, 0x000634, 0x000645, 0x000645, 0x000636, 0x00062d,
+  0x000649, 0x000636, 0x00062e, 0x000645, 0x000637, 0x000645, 0x00062d, 0x000637,
+  0x000645, 0x000645, 0x000637, 0x000645, 0x00064a, 0x000639, 0x00062c, 0x000645,
+  0x000639, 0x000645, 0x000645, 0x000639, 0x000645, 0x000649, 0x00063a, 0x000645,
+  0x000645, 0x00063a, 0x000645, 0x00064a, 0x00063a, 0x000645, 0x000649, 0x000641,
+  0x00062e, 0x000645, 0x000642, 0x000645, 0x00062d, 0x000642, 0x000645, 0x000645,
+  0x000644, 0x00062d, 0x000645, 0x000644, 0x00062d, 0x00064a, 0x000644, 0x00062d,
+  0x000649, 0x000644, 0x00062c, 0x00062c, 0x000644, 0x00062e, 0x000645, 0x000644,
+  0x000645, 0x00062d, 0x000645, 0x00062d, 0x00062c, 0x000645, 0x00062d, 0x000645,
+  0x000645, 0x00062d, 0x00064a, 0x000645, 0x00062c, 0x00062d, 0x000645, 0x00062c,
+  0x000645, 0x000645, 0x00062e, 0x00062c, 0x000645, 0x00062e, 0x000645, 0x000645,
+  0x00062c, 0x00062e, 0x000647, 0x000645, 0x00062c, 0x000647, 0x000645, 0x000645,
+  0x000646, 0x00062d, 0x000645, 0x000646, 0x00062d, 0x000649, 0x000646, 0x00062c,
+  0x000645, 0x000646, 0x00062c, 0x000649, 0x000646, 0x000645, 0x00064a, 0x000646,
+  0x000645, 0x000649, 0x00064a, 0x000645, 0x000645, 0x000628, 0x00062e, 0x00064a,
+  0x00062a, 0x00062c, 0x00064a, 0x00062a, 0x00062c, 0x000649, 0x00062a, 0x00062e,
+  0x00064a, 0x00062a, 0x00062e, 0x000649, 0x00062a, 0x000645, 0x00064a, 0x00062a,
+  0x000645, 0x000649, 0x00062c, 0x000645, 0x00064a, 0x00062c, 0x00062d, 0x000649,
+  0x00062c, 0x000645, 0x000649, 0x000633, 0x00062e, 0x000649, 0x000635, 0x00062d,
+  0x00064a, 0x000634, 0x00062d, 0x00064a, 0x000636, 0x00062d, 0x00064a, 0x000644,
+  0x00062c, 0x00064a, 0x000644, 0x000645, 0x00064a, 0x00064a, 0x00062d, 0x00064a,
+  0x00064a, 0x00062c, 0x00064a, 0x00064a, 0x000645, 0x00064a, 0x000645, 0x000645,
+  0x00064a, 0x000642, 0x000645, 0x00064a, 0x000646, 0x00062d, 0x00064a, 0x000642,
+  0x000645, 0x00062d, 0x000644, 0x00062d, 0x000645, 0x000639, 0x000645, 0x00064a,
+  0x000643, 0x000645, 0x00064a, 0x000646, 0x00062c, 0x00062d, 0x000645, 0x00062e,
+  0x00064a, 0x000644, 0x00062c, 0x000645, 0x000643, 0x000645, 0x000645, 0x000644,
+  0x00062c, 0x000645, 0x000646, 0x00062c, 0x00062d, 0x00062c, 0x00062d, 0x00064a,
+  0x00062d, 0x00062c, 0x00064a, 0x000645, 0x00062c, 0x00064a, 0x000641, 0x000645,
+  0x00064a, 0x000628, 0x00062d, 0x00064a, 0x000643, 0x000645, 0x000645, 0x000639,
+  0x00062c, 0x000645, 0x000635, 0x000645, 0x000645, 0x000633, 0x00062e, 0x00064a,
+  0x000646, 0x00062c, 0x00064a, 0x000635, 0x000644, 0x0006d2, 0x000642, 0x000644,
+  0x0006d2, 0x000627, 0x000644, 0x000644, 0x000647, 0x000627, 0x000643, 0x000628,
+  0x000631, 0x000645, 0x00062d, 0x000645, 0x00062f, 0x000635, 0x000644, 0x000639,
+  0x000645, 0x000631, 0x000633, 0x000648, 0x000644, 0x000639, 0x000644, 0x00064a,
+  0x000647, 0x000648, 0x000633, 0x000644, 0x000645, 0x000635, 0x000644, 0x000649,
+  0x000635, 0x000644, 0x000649, 0x000020, 0x000627, 0x000644, 0x000644, 0x000647,
+  0x000020, 0x000639, 0x000644, 0x00064a, 0x000647, 0x000020, 0x000648, 0x000633,
+  0x000644, 0x000645, 0x00062c, 0x000644, 0x000020, 0x00062c, 0x000644, 0x000627,
+  0x000644, 0x000647, 0x000631, 0x0006cc, 0x000627, 0x000644, 0x00002c, 0x003001,
+  0x00003a, 0x00003b, 0x000021, 0x00003f, 0x003016, 0x003017, 0x002014, 0x002013,
+  0x00005f, 0x000028, 0x000029, 0x00007b, 0x00007d, 0x003014, 0x003015, 0x003010,
+  0x003011, 0x00300a, 0x00300b, 0x003008, 0x003009, 0x00300c, 0x00300d, 0x00300e,
+  0x00300f, 0x00005b, 0x00005d, 0x000020, 0x000305, 0x00005f, 0x00002c, 0x003001,
+  0x00003b, 0x00003a, 0x00003f, 0x000021, 0x002014, 0x000028, 0x000029, 0x00007b,
+  0x00007d, 0x003014, 0x003015, 0x000023, 0x000026, 0x00002a, 0x00002b, 0x00002d,
+  0x00003c, 0x00003e, 0x00003d, 0x00005c, 0x000024, 0x000025, 0x000040, 0x000020,
+  0x00064b, 0x000640, 0x00064b, 0x000020, 0x00064c, 0x000020, 0x00064d, 0x000020,
+  0x00064e, 0x000640, 0x00064e, 0x000020, 0x00064f, 0x000640, 0x00064f, 0x000020,
+  0x000650, 0x000640, 0x000650, 0x000020, 0x000651, 0x000640, 0x000651, 0x000020,
+  0x000652, 0x000640, 0x000652, 0x000621, 0x000622, 0x000623, 0x000624, 0x000625,
+  0x000626, 0x000627, 0x000628, 0x000629, 0x00062a, 0x00062b, 0x00062c, 0x00062d,
+  0x00062e, 0x00062f, 0x000630, 0x000631, 0x000632, 0x000633, 0x000634, 0x000635,
+  0x000636, 0x000637, 0x000638, 0x000639, 0x00063a, 0x000641, 0x000642, 0x000643,
+  0x000644, 0x000645, 0x000646, 0x000647, 0x000648, 0x000649, 0x00064a, 0x000644,
+  0x000622, 0x000644, 0x000623, 0x000644, 0x000625, 0x000644, 0x000627, 0x000021,
+  0x000022, 0x000023, 0x000024, 0x000025, 0x000026, 0x000027, 0x000028, 0x000029,
+  0x00002a, 0x00002b, 0x00002c, 0x00002d, 0x00002e, 0x00002f, 0x000030, 0x000031,
+  0x000032, 0x000033, 0x000034, 0x000035, 0x000036, 0x000037, 0x000038, 0x000039,
+  0x00003a, 0x00003b, 0x00003c, 0x00003d, 0x00003e, 0x00003f, 0x000040, 0x000061,
+  0x000062, 0x000063, 0x000064, 0x000065, 0x000066, 0x000067, 0x000068, 0x000069,
+  0x00006a, 0x00006b, 0x00006c, 0x00006d, 0x00006e, 0x00006f, 0x000070, 0x000071,
+  0x000072, 0x000073, 0x000074, 0x000075, 0x000076, 0x000077, 0x000078, 0x000079,
+  0x00007a, 0x00005b, 0x00005c, 0x00005d, 0x00005e, 0x00005f, 0x000060, 0x000061,
+  0x000062, 0x000063, 0x000064, 0x000065, 0x000066, 0x000067, 0x000068, 0x000069,
+  0x00006a, 0x00006b, 0x00006c, 0x00006d, 0x00006e, 0x00006f, 0x000070, 0x000071,
+  0x000072, 0x000073, 0x000074, 0x000075, 0x000076, 0x000077, 0x000078, 0x000079,
+  0x00007a, 0x00007b, 0x00007c, 0x00007d, 0x00007e, 0x002985, 0x002986, 0x00002e,
+  0x00300c, 0x00300d, 0x003001, 0x0030fb, 0x0030f2, 0x0030a1, 0x0030a3, 0x0030a5,
+  0x0030a7, 0x0030a9, 0x0030e3, 0x0030e5, 0x0030e7, 0x0030c3, 0x0030fc, 0x0030a2,
+  0x0030a4, 0x0030a6, 0x0030a8, 0x0030aa, 0x0030ab, 0x0030ad, 0x0030af, 0x0030b1,
+  0x0030b3, 0x0030b5, 0x0030b7, 0x0030b9, 0x0030bb, 0x0030bd, 0x0030bf, 0x0030c1,
+  0x0030c4, 0x0030c6, 0x0030c8, 0x0030ca, 0x0030cb, 0x0030cc, 0x0030cd, 0x0030ce,
+  0x0030cf, 0x0030d2, 0x0030d5, 0x0030d8, 0x0030db, 0x0030de, 0x0030df, 0x0030e0,
+  0x0030e1, 0x0030e2, 0x0030e4, 0x0030e6, 0x0030e8, 0x0030e9, 0x0030ea, 0x0030eb,
+  0x0030ec, 0x0030ed, 0x0030ef, 0x0030f3, 0x003099, 0x00309a, 0x001100, 0x001101,
+  0x0011aa, 0x001102, 0x0011ac, 0x0011ad, 0x001103, 0x001104, 0x001105, 0x0011b0,
+  0x0011b1, 0x0011b2, 0x0011b3, 0x0011b4, 0x0011b5, 0x00111a, 0x001106, 0x001107,
+  0x001108, 0x001121, 0x001109, 0x00110a, 0x00110b, 0x00110c, 0x00110d, 0x00110e,
+  0x00110f, 0x001110, 0x001111, 0x001112, 0x001161, 0x001162, 0x001163, 0x001164,
+  0x001165, 0x001166, 0x001167, 0x001168, 0x001169, 0x00116a, 0x00116b, 0x00116c,
+  0x00116d, 0x00116e, 0x00116f, 0x001170, 0x001171, 0x001172, 0x001173, 0x001174,
+  0x001175, 0x0000a2, 0x0000a3, 0x0000ac, 0x000020, 0x000304, 0x0000a6, 0x0000a5,
+  0x0020a9, 0x002502, 0x002190, 0x002191, 0x002192, 0x002193, 0x0025a0, 0x0025cb,
+  0x010428, 0x010429, 0x01042a, 0x01042b, 0x01042c, 0x01042d, 0x01042e, 0x01042f,
+  0x010430, 0x010431, 0x010432, 0x010433, 0x010434, 0x010435, 0x010436, 0x010437,
+  0x010438, 0x010439, 0x01043a, 0x01043b, 0x01043c, 0x01043d, 0x01043e, 0x01043f,
+  0x010440, 0x010441, 0x010442, 0x010443, 0x010444, 0x010445, 0x010446, 0x010447,
+  0x010448, 0x010449, 0x01044a, 0x01044b, 0x01044c, 0x01044d, 0x01044e, 0x01044f,
+  0x0104d8, 0x0104d9, 0x0104da, 0x0104db, 0x0104dc, 0x0104dd, 0x0104de, 0x0104df,
+  0x0104e0, 0x0104e1, 0x0104e2, 0x0104e3, 0x0104e4, 0x0104e5, 0x0104e6, 0x0104e7,
+  0x0104e8, 0x0104e9, 0x0104ea, 0x0104eb, 0x0104ec, 0x0104ed, 0x0104ee, 0x0104ef,
+  0x0104f0, 0x0104f1, 0x0104f2, 0x0104f3, 0x0104f4, 0x0104f5, 0x0104f6, 0x0104f7,
+  0x0104f8, 0x0104f9, 0x0104fa, 0x0104fb, 0x010597, 0x010598, 0x010599, 0x01059a,
+  0x01059b, 0x01059c, 0x01059d, 0x01059e, 0x01059f, 0x0105a0, 0x0105a1, 0x0105a3,
+  0x0105a4, 0x0105a5, 0x0105a6, 0x0105a7, 0x0105a8, 0x0105a9, 0x0105aa, 0x0105ab,
+  0x0105ac, 0x0105ad, 0x0105ae, 0x0105af, 0x0105b0, 0x0105b1, 0x0105b3, 0x0105b4,
+  0x0105b5, 0x0105b6, 0x0105b7, 0x0105b8, 0x0105b9, 0x0105bb, 0x0105bc, 0x0002d0,
+  0x0002d1, 0x0000e6, 0x000299, 0x000253, 0x0002a3, 0x00ab66, 0x0002a5, 0x0002a4,
+  0x000256, 0x000257, 0x001d91, 0x000258, 0x00025e, 0x0002a9, 0x000264, 0x000262,
+  0x000260, 0x00029b, 0x000127, 0x00029c, 0x000267, 0x000284, 0x0002aa, 0x0002ab,
+  0x00026c, 0x01df04, 0x00a78e, 0x00026e, 0x01df05, 0x00028e, 0x01df06, 0x0000f8,
+  0x000276, 0x000277, 0x000071, 0x00027a, 0x01df08, 0x00027d, 0x00027e, 0x000280,
+  0x0002a8, 0x0002a6, 0x00ab67, 0x0002a7, 0x000288, 0x002c71, 0x00028f, 0x0002a1,
+  0x0002a2, 0x000298, 0x0001c0, 0x0001c1, 0x0001c2, 0x01df0a, 0x01df1e, 0x010cc0,
+  0x010cc1, 0x010cc2, 0x010cc3, 0x010cc4, 0x010cc5, 0x010cc6, 0x010cc7, 0x010cc8,
+  0x010cc9, 0x010cca, 0x010ccb, 0x010ccc, 0x010ccd, 0x010cce, 0x010ccf, 0x010cd0,
+  0x010cd1, 0x010cd2, 0x010cd3, 0x010cd4, 0x010cd5, 0x010cd6, 0x010cd7, 0x010cd8,
+  0x010cd9, 0x010cda, 0x010cdb, 0x010cdc, 0x010cdd, 0x010cde, 0x010cdf, 0x010ce0,
+  0x010ce1, 0x010ce2, 0x010ce3, 0x010ce4, 0x010ce5, 0x010ce6, 0x010ce7, 0x010ce8,
+  0x010ce9, 0x010cea, 0x010ceb, 0x010cec, 0x010ced, 0x010cee, 0x010cef, 0x010cf0,
+  0x010cf1, 0x010cf2, 0x0118c0, 0x0118c1, 0x0118c2, 0x0118c3, 0x0118c4, 0x0118c5,
+  0x0118c6, 0x0118c7, 0x0118c8, 0x0118c9, 0x0118ca, 0x0118cb, 0x0118cc, 0x0118cd,
+  0x0118ce, 0x0118cf, 0x0118d0, 0x0118d1, 0x0118d2, 0x0118d3, 0x0118d4, 0x0118d5,
+  0x0118d6, 0x0118d7, 0x0118d8, 0x0118d9, 0x0118da, 0x0118db, 0x0118dc, 0x0118dd,
+  0x0118de, 0x0118df, 0x016e60, 0x016e61, 0x016e62, 0x016e63, 0x016e64, 0x016e65,
+  0x016e66, 0x016e67, 0x016e68, 0x016e69, 0x016e6a, 0x016e6b, 0x016e6c, 0x016e6d,
+  0x016e6e, 0x016e6f, 0x016e70, 0x016e71, 0x016e72, 0x016e73, 0x016e74, 0x016e75,
+  0x016e76, 0x016e77, 0x016e78, 0x016e79, 0x016e7a, 0x016e7b, 0x016e7c, 0x016e7d,
+  0x016e7e, 0x016e7f, 0x01d157, 0x01d165, 0x01d158, 0x01d165, 0x01d158, 0x01d165,
+  0x01d16e, 0x01d158, 0x01d165, 0x01d16f, 0x01d158, 0x01d165, 0x01d170, 0x01d158,
+  0x01d165, 0x01d171, 0x01d158, 0x01d165, 0x01d172, 0x01d1b9, 0x01d165, 0x01d1ba,
+  0x01d165, 0x01d1b9, 0x01d165, 0x01d16e, 0x01d1ba, 0x01d165, 0x01d16e, 0x01d1b9,
+  0x01d165, 0x01d16f, 0x01d1ba, 0x01d165, 0x01d16f, 0x000061, 0x000062, 0x000063,
+  0x000064, 0x000065, 0x000066, 0x000067, 0x000068, 0x000069, 0x00006a, 0x00006b,
+  0x00006c, 0x00006d, 0x00006e, 0x00006f, 0x000070, 0x000071, 0x000072, 0x000073,
+  0x000074, 0x000075, 0x000076, 0x000077, 0x000078, 0x000079, 0x00007a, 0x000061,
+  0x000062, 0x000063, 0x000064, 0x000065, 0x000066, 0x000067, 0x000068, 0x000069,
+  0x00006a, 0x00006b, 0x00006c, 0x00006d, 0x00006e, 0x00006f, 0x000070, 0x000071,
+  0x000072, 0x000073, 0x000074, 0x000075, 0x000076, 0x000077, 0x000078, 0x000079,
+  0x00007a, 0x000061, 0x000062, 0x000063, 0x000064, 0x000065, 0x000066, 0x000067,
+  0x000068, 0x000069, 0x00006a, 0x00006b, 0x00006c, 0x00006d, 0x00006e, 0x00006f,
+  0x000070, 0x000071, 0x000072, 0x000073, 0x000074, 0x000075, 0x000076, 0x000077,
+  0x000078, 0x000079, 0x00007a, 0x000061, 0x000062, 0x000063, 0x000064, 0x000065,
+  0x000066, 0x000067, 0x000069, 0x00006a, 0x00006b, 0x00006c, 0x00006d, 0x00006e,
+  0x00006f, 0x000070, 0x000071, 0x000072, 0x000073, 0x000074, 0x000075, 0x000076,
+  0x000077, 0x000078, 0x000079, 0x00007a, 0x000061, 0x000062, 0x000063, 0x000064,
+  0x000065, 0x000066, 0x000067, 0x000068, 0x000069, 0x00006a, 0x00006b, 0x00006c,
+  0x00006d, 0x00006e, 0x00006f, 0x000070, 0x000071, 0x000072, 0x000073, 0x000074,
+  0x000075, 0x000076, 0x000077, 0x000078, 0x000079, 0x00007a, 0x000061, 0x000062,
+  0x000063, 0x000064, 0x000065, 0x000066, 0x000067, 0x000068, 0x000069, 0x00006a,
+  0x00006b, 0x00006c, 0x00006d, 0x00006e, 0x00006f, 0x000070, 0x000071, 0x000072,
+  0x000073, 0x000074, 0x000075, 0x000076, 0x000077, 0x000078, 0x000079, 0x00007a,
+  0x000061, 0x000063, 0x000064, 0x000067, 0x00006a, 0x00006b, 0x00006e, 0x00006f,
+  0x000070, 0x000071, 0x000073, 0x000074, 0x000075, 0x000076, 0x000077, 0x000078,
+  0x000079, 0x00007a, 0x000061, 0x000062, 0x000063, 0x000064, 0x000066, 0x000068,
+  0x000069, 0x00006a, 0x00006b, 0x00006c, 0x00006d, 0x00006e, 0x000070, 0x000071,
+  0x000072, 0x000073, 0x000074, 0x000075, 0x000076, 0x000077, 0x000078, 0x000079,
+  0x00007a, 0x000061, 0x000062, 0x000063, 0x000064, 0x000065, 0x000066, 0x000067,
+  0x000068, 0x000069, 0x00006a, 0x00006b, 0x00006c, 0x00006d, 0x00006e, 0x00006f,
+  0x000070, 0x000071, 0x000072, 0x000073, 0x000074, 0x000075, 0x000076, 0x000077,
+  0x000078, 0x000079, 0x00007a, 0x000061, 0x000062, 0x000063, 0x000064, 0x000065,
+  0x000066, 0x000067, 0x000068, 0x000069, 0x00006a, 0x00006b, 0x00006c, 0x00006d,
+  0x00006e, 0x00006f, 0x000070, 0x000071, 0x000072, 0x000073, 0x000074, 0x000075,
+  0x000076, 0x000077, 0x000078, 0x000079, 0x00007a, 0x000061, 0x000062, 0x000064,
+  0x000065, 0x000066, 0x000067, 0x00006a, 0x00006b, 0x00006c, 0x00006d, 0x00006e,
+  0x00006f, 0x000070, 0x000071, 0x000073, 0x000074, 0x000075, 0x000076, 0x000077,
+  0x000078, 0x000079, 0x000061, 0x000062, 0x000063, 0x000064, 0x000065, 0x000066,
+  0x000067, 0x000068, 0x000069, 0x00006a, 0x00006b, 0x00006c, 0x00006d, 0x00006e,
+  0x00006f, 0x000070, 0x000071, 0x000072, 0x000073, 0x000074, 0x000075, 0x000076,
+  0x000077, 0x000078, 0x000079, 0x00007a, 0x000061, 0x000062, 0x000064, 0x000065,
+  0x000066, 0x000067, 0x000069, 0x00006a, 0x00006b, 0x00006c, 0x00006d, 0x00006f,
+  0x000073, 0x000074, 0x000075, 0x000076, 0x000077, 0x000078, 0x000079, 0x000061,
+  0x000062, 0x000063, 0x000064, 0x000065, 0x000066, 0x000067, 0x000068, 0x000069,
+  0x00006a, 0x00006b, 0x00006c, 0x00006d, 0x00006e, 0x00006f, 0x000070, 0x000071,
+  0x000072, 0x000073, 0x000074, 0x000075, 0x000076, 0x000077, 0x000078, 0x000079,
+  0x00007a, 0x000061, 0x000062, 0x000063, 0x000064, 0x000065, 0x000066, 0x000067,
+  0x000068, 0x000069, 0x00006a, 0x00006b, 0x00006c, 0x00006d, 0x00006e, 0x00006f,
+  0x000070, 0x000071, 0x000072, 0x000073, 0x000074, 0x000075, 0x000076, 0x000077,
+  0x000078, 0x000079, 0x00007a, 0x000061, 0x000062, 0x000063, 0x000064, 0x000065,
+  0x000066, 0x000067, 0x000068, 0x000069, 0x00006a, 0x00006b, 0x00006c, 0x00006d,
+  0x00006e, 0x00006f, 0x000070, 0x000071, 0x000072, 0x000073, 0x000074, 0x000075,
+  0x000076, 0x000077, 0x000078, 0x000079, 0x00007a, 0x000061, 0x000062, 0x000063,
+  0x000064, 0x000065, 0x000066, 0x000067, 0x000068, 0x000069, 0x00006a, 0x00006b,
+  0x00006c, 0x00006d, 0x00006e, 0x00006f, 0x000070, 0x000071, 0x000072, 0x000073,
+  0x000074, 0x000075, 0x000076, 0x000077, 0x000078, 0x000079, 0x00007a, 0x000061,
+  0x000062, 0x000063, 0x000064, 0x000065, 0x000066, 0x000067, 0x000068, 0x000069,
+  0x00006a, 0x00006b, 0x00006c, 0x00006d, 0x00006e, 0x00006f, 0x000070, 0x000071,
+  0x000072, 0x000073, 0x000074, 0x000075, 0x000076, 0x000077, 0x000078, 0x000079,
+  0x00007a, 0x000061, 0x000062, 0x000063, 0x000064, 0x000065, 0x000066, 0x000067,
+  0x000068, 0x000069, 0x00006a, 0x00006b, 0x00006c, 0x00006d, 0x00006e, 0x00006f,
+  0x000070, 0x000071, 0x000072, 0x000073, 0x000074, 0x000075, 0x000076, 0x000077,
+  0x000078, 0x000079, 0x00007a, 0x000061, 0x000062, 0x000063, 0x000064, 0x000065,
+  0x000066, 0x000067, 0x000068, 0x000069, 0x00006a, 0x00006b, 0x00006c, 0x00006d,
+  0x00006e, 0x00006f, 0x000070, 0x000071, 0x000072, 0x000073, 0x000074, 0x000075,
+  0x000076, 0x000077, 0x000078, 0x000079, 0x00007a, 0x000061, 0x000062, 0x000063,
+  0x000064, 0x000065, 0x000066, 0x000067, 0x000068, 0x000069, 0x00006a, 0x00006b,
+  0x00006c, 0x00006d, 0x00006e, 0x00006f, 0x000070, 0x000071, 0x000072, 0x000073,
+  0x000074, 0x000075, 0x000076, 0x000077, 0x000078, 0x000079, 0x00007a, 0x000061,
+  0x000062, 0x000063, 0x000064, 0x000065, 0x000066, 0x000067, 0x000068, 0x000069,
+  0x00006a, 0x00006b, 0x00006c, 0x00006d, 0x00006e, 0x00006f, 0x000070, 0x000071,
+  0x000072, 0x000073, 0x000074, 0x000075, 0x000076, 0x000077, 0x000078, 0x000079,
+  0x00007a, 0x000061, 0x000062, 0x000063, 0x000064, 0x000065, 0x000066, 0x000067,
+  0x000068, 0x000069, 0x00006a, 0x00006b, 0x00006c, 0x00006d, 0x00006e, 0x00006f,
+  0x000070, 0x000071, 0x000072, 0x000073, 0x000074, 0x000075, 0x000076, 0x000077,
+  0x000078, 0x000079, 0x00007a, 0x000061, 0x000062, 0x000063, 0x000064, 0x000065,
+  0x000066, 0x000067, 0x000068, 0x000069, 0x00006a, 0x00006b, 0x00006c, 0x00006d,
+  0x00006e, 0x00006f, 0x000070, 0x000071, 0x000072, 0x000073, 0x000074, 0x000075,
+  0x000076, 0x000077, 0x000078, 0x000079, 0x00007a, 0x000061, 0x000062, 0x000063,
+  0x000064, 0x000065, 0x000066, 0x000067, 0x000068, 0x000069, 0x00006a, 0x00006b,
+  0x00006c, 0x00006d, 0x00006e, 0x00006f, 0x000070, 0x000071, 0x000072, 0x000073,
+  0x000074, 0x000075, 0x000076, 0x000077, 0x000078, 0x000079, 0x00007a, 0x000061,
+  0x000062, 0x000063, 0x000064, 0x000065, 0x000066, 0x000067, 0x000068, 0x000069,
+  0x00006a, 0x00006b, 0x00006c, 0x00006d, 0x00006e, 0x00006f, 0x000070, 0x000071,
+  0x000072, 0x000073, 0x000074, 0x000075, 0x000076, 0x000077, 0x000078, 0x000079,
+  0x00007a, 0x000131, 0x000237, 0x0003b1, 0x0003b2, 0x0003b3, 0x0003b4, 0x0003b5,
+  0x0003b6, 0x0003b7, 0x0003b8, 0x0003b9, 0x0003ba, 0x0003bb, 0x0003bc, 0x0003bd,
+  0x0003be, 0x0003bf, 0x0003c0, 0x0003c1, 0x0003b8, 0x0003c3, 0x0003c4, 0x0003c5,
+  0x0003c6, 0x0003c7, 0x0003c8, 0x0003c9, 0x002207, 0x0003b1, 0x0003b2, 0x0003b3,
+  0x0003b4, 0x0003b5, 0x0003b6, 0x0003b7, 0x0003b8, 0x0003b9, 0x0003ba, 0x0003bb,
+  0x0003bc, 0x0003bd, 0x0003be, 0x0003bf, 0x0003c0, 0x0003c1, 0x0003c3, 0x0003c4,
+  0x0003c5, 0x0003c6, 0x0003c7, 0x0003c8, 0x0003c9, 0x002202, 0x0003b5, 0x0003b8,
+  0x0003ba, 0x0003c6, 0x0003c1, 0x0003c0, 0x0003b1, 0x0003b2, 0x0003b3, 0x0003b4,
+  0x0003b5, 0x0003b6, 0x0003b7, 0x0003b8, 0x0003b9, 0x0003ba, 0x0003bb, 0x0003bc,
+  0x0003bd, 0x0003be, 0x0003bf, 0x0003c0, 0x0003c1, 0x0003b8, 0x0003c3, 0x0003c4,
+  0x0003c5, 0x0003c6, 0x0003c7, 0x0003c8, 0x0003c9, 0x002207, 0x0003b1, 0x0003b2,
+  0x0003b3, 0x0003b4, 0x0003b5, 0x0003b6, 0x0003b7, 0x0003b8, 0x0003b9, 0x0003ba,
+  0x0003bb, 0x0003bc, 0x0003bd, 0x0003be, 0x0003bf, 0x0003c0, 0x0003c1, 0x0003c3,
+  0x0003c4, 0x0003c5, 0x0003c6, 0x0003c7, 0x0003c8, 0x0003c9, 0x002202, 0x0003b5,
+  0x0003b8, 0x0003ba, 0x0003c6, 0x0003c1, 0x0003c0, 0x0003b1, 0x0003b2, 0x0003b3,
+  0x0003b4, 0x0003b5, 0x0003b6, 0x0003b7, 0x0003b8, 0x0003b9, 0x0003ba, 0x0003bb,
+  0x0003bc, 0x0003bd, 0x0003be, 0x0003bf, 0x0003c0, 0x0003c1, 0x0003b8, 0x0003c3,
+  0x0003c4, 0x0003c5, 0x0003c6, 0x0003c7, 0x0003c8, 0x0003c9, 0x002207, 0x0003b1,
+  0x0003b2, 0x0003b3, 0x0003b4, 0x0003b5, 0x0003b6, 0x0003b7, 0x0003b8, 0x0003b9,
+  0x0003ba, 0x0003bb, 0x0003bc, 0x0003bd, 0x0003be, 0x0003bf, 0x0003c0, 0x0003c1,
+  0x0003c3, 0x0003c4, 0x0003c5, 0x0003c6, 0x0003c7, 0x0003c8, 0x0003c9, 0x002202,
+  0x0003b5, 0x0003b8, 0x0003ba, 0x0003c6, 0x0003c1, 0x0003c0, 0x0003b1, 0x0003b2,
+  0x0003b3, 0x0003b4, 0x0003b5, 0x0003b6, 0x0003b7, 0x0003b8, 0x0003b9, 0x0003ba,
+  0x0003bb, 0x0003bc, 0x0003bd, 0x0003be, 0x0003bf, 0x0003c0, 0x0003c1, 0x0003b8,
+  0x0003c3, 0x0003c4, 0x0003c5, 0x0003c6, 0x0003c7, 0x0003c8, 0x0003c9, 0x002207,
+  0x0003b1, 0x0003b2, 0x0003b3, 0x0003b4, 0x0003b5, 0x0003b6, 0x0003b7, 0x0003b8,
+  0x0003b9, 0x0003ba, 0x0003bb, 0x0003bc, 0x0003bd, 0x0003be, 0x0003bf, 0x0003c0,
+  0x0003c1, 0x0003c3, 0x0003c4, 0x0003c5, 0x0003c6, 0x0003c7, 0x0003c8, 0x0003c9,
+  0x002202, 0x0003b5, 0x0003b8, 0x0003ba, 0x0003c6, 0x0003c1, 0x0003c0, 0x0003b1,
+  0x0003b2, 0x0003b3, 0x0003b4, 0x0003b5, 0x0003b6, 0x0003b7, 0x0003b8, 0x0003b9,
+  0x0003ba, 0x0003bb, 0x0003bc, 0x0003bd, 0x0003be, 0x0003bf, 0x0003c0, 0x0003c1,
+  0x0003b8, 0x0003c3, 0x0003c4, 0x0003c5, 0x0003c6, 0x0003c7, 0x0003c8, 0x0003c9,
+  0x002207, 0x0003b1, 0x0003b2, 0x0003b3, 0x0003b4, 0x0003b5, 0x0003b6, 0x0003b7,
+  0x0003b8, 0x0003b9, 0x0003ba, 0x0003bb, 0x0003bc, 0x0003bd, 0x0003be, 0x0003bf,
+  0x0003c0, 0x0003c1, 0x0003c3, 0x0003c4, 0x0003c5, 0x0003c6, 0x0003c7, 0x0003c8,
+  0x0003c9, 0x002202, 0x0003b5, 0x0003b8, 0x0003ba, 0x0003c6, 0x0003c1, 0x0003c0,
+  0x0003dd, 0x000030, 0x000031, 0x000032, 0x000033, 0x000034, 0x000035, 0x000036,
+  0x000037, 0x000038, 0x000039, 0x000030, 0x000031, 0x000032, 0x000033, 0x000034,
+  0x000035, 0x000036, 0x000037, 0x000038, 0x000039, 0x000030, 0x000031, 0x000032,
+  0x000033, 0x000034, 0x000035, 0x000036, 0x000037, 0x000038, 0x000039, 0x000030,
+  0x000031, 0x000032, 0x000033, 0x000034, 0x000035, 0x000036, 0x000037, 0x000038,
+  0x000039, 0x000030, 0x000031, 0x000032, 0x000033, 0x000034, 0x000035, 0x000036,
+  0x000037, 0x000038, 0x000039, 0x000430, 0x000431, 0x000432, 0x000433, 0x000434,
+  0x000435, 0x000436, 0x000437, 0x000438, 0x00043a, 0x00043b, 0x00043c, 0x00043e,
+  0x00043f, 0x000440, 0x000441, 0x000442, 0x000443, 0x000444, 0x000445, 0x000446,
+  0x000447, 0x000448, 0x00044b, 0x00044d, 0x00044e, 0x00a689, 0x0004d9, 0x000456,
+  0x000458, 0x0004e9, 0x0004af, 0x0004cf, 0x000430, 0x000431, 0x000432, 0x000433,
+  0x000434, 0x000435, 0x000436, 0x000437, 0x000438, 0x00043a, 0x00043b, 0x00043e,
+  0x00043f, 0x000441, 0x000443, 0x000444, 0x000445, 0x000446, 0x000447, 0x000448,
+  0x00044a, 0x00044b, 0x000491, 0x000456, 0x000455, 0x00045f, 0x0004ab, 0x00a651,
+  0x0004b1, 0x01e922, 0x01e923, 0x01e924, 0x01e925, 0x01e926, 0x01e927, 0x01e928,
+  0x01e929, 0x01e92a, 0x01e92b, 0x01e92c, 0x01e92d, 0x01e92e, 0x01e92f, 0x01e930,
+  0x01e931, 0x01e932, 0x01e933, 0x01e934, 0x01e935, 0x01e936, 0x01e937, 0x01e938,
+  0x01e939, 0x01e93a, 0x01e93b, 0x01e93c, 0x01e93d, 0x01e93e, 0x01e93f, 0x01e940,
+  0x01e941, 0x01e942, 0x01e943, 0x000627, 0x000628, 0x00062c, 0x00062f, 0x000648,
+  0x000632, 0x00062d, 0x000637, 0x00064a, 0x000643, 0x000644, 0x000645, 0x000646,
+  0x000633, 0x000639, 0x000641, 0x000635, 0x000642, 0x000631, 0x000634, 0x00062a,
+  0x00062b, 0x00062e, 0x000630, 0x000636, 0x000638, 0x00063a, 0x00066e, 0x0006ba,
+  0x0006a1, 0x00066f, 0x000628, 0x00062c, 0x000647, 0x00062d, 0x00064a, 0x000643,
+  0x000644, 0x000645, 0x000646, 0x000633, 0x000639, 0x000641, 0x000635, 0x000642,
+  0x000634, 0x00062a, 0x00062b, 0x00062e, 0x000636, 0x00063a, 0x00062c, 0x00062d,
+  0x00064a, 0x000644, 0x000646, 0x000633, 0x000639, 0x000635, 0x000642, 0x000634,
+  0x00062e, 0x000636, 0x00063a, 0x0006ba, 0x00066f, 0x000628, 0x00062c, 0x000647,
+  0x00062d, 0x000637, 0x00064a, 0x000643, 0x000645, 0x000646, 0x000633, 0x000639,
+  0x000641, 0x000635, 0x000642, 0x000634, 0x00062a, 0x00062b, 0x00062e, 0x000636,
+  0x000638, 0x00063a, 0x00066e, 0x0006a1, 0x000627, 0x000628, 0x00062c, 0x00062f,
+  0x000647, 0x000648, 0x000632, 0x00062d, 0x000637, 0x00064a, 0x000644, 0x000645,
+  0x000646, 0x000633, 0x000639, 0x000641, 0x000635, 0x000642, 0x000631, 0x000634,
+  0x00062a, 0x00062b, 0x00062e, 0x000630, 0x000636, 0x000638, 0x00063a, 0x000628,
+  0x00062c, 0x00062f, 0x000648, 0x000632, 0x00062d, 0x000637, 0x00064a, 0x000644,
+  0x000645, 0x000646, 0x000633, 0x000639, 0x000641, 0x000635, 0x000642, 0x000631,
+  0x000634, 0x00062a, 0x00062b, 0x00062e, 0x000630, 0x000636, 0x000638, 0x00063a,
+  0x000030, 0x00002c, 0x000031, 0x00002c, 0x000032, 0x00002c, 0x000033, 0x00002c,
+  0x000034, 0x00002c, 0x000035, 0x00002c, 0x000036, 0x00002c, 0x000037, 0x00002c,
+  0x000038, 0x00002c, 0x000039, 0x00002c, 0x000028, 0x000061, 0x000029, 0x000028,
+  0x000062, 0x000029, 0x000028, 0x000063, 0x000029, 0x000028, 0x000064, 0x000029,
+  0x000028, 0x000065, 0x000029, 0x000028, 0x000066, 0x000029, 0x000028, 0x000067,
+  0x000029, 0x000028, 0x000068, 0x000029, 0x000028, 0x000069, 0x000029, 0x000028,
+  0x00006a, 0x000029, 0x000028, 0x00006b, 0x000029, 0x000028, 0x00006c, 0x000029,
+  0x000028, 0x00006d, 0x000029, 0x000028, 0x00006e, 0x000029, 0x000028, 0x00006f,
+  0x000029, 0x000028, 0x000070, 0x000029, 0x000028, 0x000071, 0x000029, 0x000028,
+  0x000072, 0x000029, 0x000028, 0x000073, 0x000029, 0x000028, 0x000074, 0x000029,
+  0x000028, 0x000075, 0x000029, 0x000028, 0x000076, 0x000029, 0x000028, 0x000077,
+  0x000029, 0x000028, 0x000078, 0x000029, 0x000028, 0x000079, 0x000029, 0x000028,
+  0x00007a, 0x000029, 0x003014, 0x000073, 0x003015, 0x000063, 0x000072, 0x000063,
+  0x000064, 0x000077, 0x00007a, 0x000061, 0x000062, 0x000063, 0x000064, 0x000065,
+  0x000066, 0x000067, 0x000068, 0x000069, 0x00006a, 0x00006b, 0x00006c, 0x00006d,
+  0x00006e, 0x00006f, 0x000070, 0x000071, 0x000072, 0x000073, 0x000074, 0x000075,
+  0x000076, 0x000077, 0x000078, 0x000079, 0x00007a, 0x000068, 0x000076, 0x00006d,
+  0x000076, 0x000073, 0x000064, 0x000073, 0x000073, 0x000070, 0x000070, 0x000076,
+  0x000077, 0x000063, 0x00006d, 0x000063, 0x00006d, 0x000064, 0x00006d, 0x000072,
+  0x000064, 0x00006a, 0x00307b, 0x00304b, 0x0030b3, 0x0030b3, 0x0030b5, 0x00624b,
+  0x005b57, 0x0053cc, 0x0030c7, 0x004e8c, 0x00591a, 0x0089e3, 0x005929, 0x004ea4,
+  0x006620, 0x007121, 0x006599, 0x00524d, 0x005f8c, 0x00518d, 0x0065b0, 0x00521d,
+  0x007d42, 0x00751f, 0x008ca9, 0x0058f0, 0x005439, 0x006f14, 0x006295, 0x006355,
+  0x004e00, 0x004e09, 0x00904a, 0x005de6, 0x004e2d, 0x0053f3, 0x006307, 0x008d70,
+  0x006253, 0x007981, 0x007a7a, 0x005408, 0x006e80, 0x006709, 0x006708, 0x007533,
+  0x005272, 0x0055b6, 0x00914d, 0x003014, 0x00672c, 0x003015, 0x003014, 0x004e09,
+  0x003015, 0x003014, 0x004e8c, 0x003015, 0x003014, 0x005b89, 0x003015, 0x003014,
+  0x0070b9, 0x003015, 0x003014, 0x006253, 0x003015, 0x003014, 0x0076d7, 0x003015,
+  0x003014, 0x0052dd, 0x003015, 0x003014, 0x006557, 0x003015, 0x005f97, 0x0053ef,
+  0x000030, 0x000031, 0x000032, 0x000033, 0x000034, 0x000035, 0x000036, 0x000037,
+  0x000038, 0x000039, 0x004e3d, 0x004e38, 0x004e41, 0x020122, 0x004f60, 0x004fae,
+  0x004fbb, 0x005002, 0x00507a, 0x005099, 0x0050e7, 0x0050cf, 0x00349e, 0x02063a,
+  0x00514d, 0x005154, 0x005164, 0x005177, 0x02051c, 0x0034b9, 0x005167, 0x00518d,
+  0x02054b, 0x005197, 0x0051a4, 0x004ecc, 0x0051ac, 0x0051b5, 0x0291df, 0x0051f5,
+  0x005203, 0x0034df, 0x00523b, 0x005246, 0x005272, 0x005277, 0x003515, 0x0052c7,
+  0x0052c9, 0x0052e4, 0x0052fa, 0x005305, 0x005306, 0x005317, 0x005349, 0x005351,
+  0x00535a, 0x005373, 0x00537d, 0x00537f, 0x020a2c, 0x007070, 0x0053ca, 0x0053df,
+  0x020b63, 0x0053eb, 0x0053f1, 0x005406, 0x00549e, 0x005438, 0x005448, 0x005468,
+  0x0054a2, 0x0054f6, 0x005510, 0x005553, 0x005563, 0x005584, 0x005599, 0x0055ab,
+  0x0055b3, 0x0055c2, 0x005716, 0x005606, 0x005717, 0x005651, 0x005674, 0x005207,
+  0x0058ee, 0x0057ce, 0x0057f4, 0x00580d, 0x00578b, 0x005832, 0x005831, 0x0058ac,
+  0x0214e4, 0x0058f2, 0x0058f7, 0x005906, 0x00591a, 0x005922, 0x005962, 0x0216a8,
+  0x0216ea, 0x0059ec, 0x005a1b, 0x005a27, 0x0059d8, 0x005a66, 0x0036ee, 0x005b08,
+  0x005b3e, 0x0219c8, 0x005bc3, 0x005bd8, 0x005be7, 0x005bf3, 0x021b18, 0x005bff,
+  0x005c06, 0x005c22, 0x003781, 0x005c60, 0x005c6e, 0x005cc0, 0x005c8d, 0x021de4,
+  0x005d43, 0x021de6, 0x005d6e, 0x005d6b, 0x005d7c, 0x005de1, 0x005de2, 0x00382f,
+  0x005dfd, 0x005e28, 0x005e3d, 0x005e69, 0x003862, 0x022183, 0x00387c, 0x005eb0,
+  0x005eb3, 0x005eb6, 0x005eca, 0x02a392, 0x005efe, 0x022331, 0x008201, 0x005f22,
+  0x0038c7, 0x0232b8, 0x0261da, 0x005f62, 0x005f6b, 0x0038e3, 0x005f9a, 0x005fcd,
+  0x005fd7, 0x005ff9, 0x006081, 0x00393a, 0x00391c, 0x006094, 0x0226d4, 0x0060c7,
+  0x006148, 0x00614c, 0x00614e, 0x00614c, 0x00617a, 0x00618e, 0x0061b2, 0x0061a4,
+  0x0061af, 0x0061de, 0x0061f2, 0x0061f6, 0x006210, 0x00621b, 0x00625d, 0x0062b1,
+  0x0062d4, 0x006350, 0x022b0c, 0x00633d, 0x0062fc, 0x006368, 0x006383, 0x0063e4,
+  0x022bf1, 0x006422, 0x0063c5, 0x0063a9, 0x003a2e, 0x006469, 0x00647e, 0x00649d,
+  0x006477, 0x003a6c, 0x00654f, 0x00656c, 0x02300a, 0x0065e3, 0x0066f8, 0x006649,
+  0x003b19, 0x006691, 0x003b08, 0x003ae4, 0x005192, 0x005195, 0x006700, 0x00669c,
+  0x0080ad, 0x0043d9, 0x006717, 0x00671b, 0x006721, 0x00675e, 0x006753, 0x0233c3,
+  0x003b49, 0x0067fa, 0x006785, 0x006852, 0x006885, 0x02346d, 0x00688e, 0x00681f,
+  0x006914, 0x003b9d, 0x006942, 0x0069a3, 0x0069ea, 0x006aa8, 0x0236a3, 0x006adb,
+  0x003c18, 0x006b21, 0x0238a7, 0x006b54, 0x003c4e, 0x006b72, 0x006b9f, 0x006bba,
+  0x006bbb, 0x023a8d, 0x021d0b, 0x023afa, 0x006c4e, 0x023cbc, 0x006cbf, 0x006ccd,
+  0x006c67, 0x006d16, 0x006d3e, 0x006d77, 0x006d41, 0x006d69, 0x006d78, 0x006d85,
+  0x023d1e, 0x006d34, 0x006e2f, 0x006e6e, 0x003d33, 0x006ecb, 0x006ec7, 0x023ed1,
+  0x006df9, 0x006f6e, 0x023f5e, 0x023f8e, 0x006fc6, 0x007039, 0x00701e, 0x00701b,
+  0x003d96, 0x00704a, 0x00707d, 0x007077, 0x0070ad, 0x020525, 0x007145, 0x024263,
+  0x00719c, 0x007228, 0x007235, 0x007250, 0x024608, 0x007280, 0x007295, 0x024735,
+  0x024814, 0x00737a, 0x00738b, 0x003eac, 0x0073a5, 0x003eb8, 0x007447, 0x00745c,
+  0x007471, 0x007485, 0x0074ca, 0x003f1b, 0x007524, 0x024c36, 0x00753e, 0x024c92,
+  0x007570, 0x02219f, 0x007610, 0x024fa1, 0x024fb8, 0x025044, 0x003ffc, 0x004008,
+  0x0076f4, 0x0250f3, 0x0250f2, 0x025119, 0x025133, 0x00771e, 0x00771f, 0x00774a,
+  0x004039, 0x00778b, 0x004046, 0x004096, 0x02541d, 0x00784e, 0x00788c, 0x0078cc,
+  0x0040e3, 0x025626, 0x007956, 0x02569a, 0x0256c5, 0x00798f, 0x0079eb, 0x00412f,
+  0x007a40, 0x007a4a, 0x007a4f, 0x02597c, 0x025aa7, 0x004202, 0x025bab, 0x007bc6,
+  0x007bc9, 0x004227, 0x025c80, 0x007cd2, 0x0042a0, 0x007ce8, 0x007ce3, 0x007d00,
+  0x025f86, 0x007d63, 0x004301, 0x007dc7, 0x007e02, 0x007e45, 0x004334, 0x026228,
+  0x026247, 0x004359, 0x0262d9, 0x007f7a, 0x02633e, 0x007f95, 0x007ffa, 0x008005,
+  0x0264da, 0x026523, 0x008060, 0x0265a8, 0x008070, 0x02335f, 0x0043d5, 0x0080b2,
+  0x008103, 0x00440b, 0x00813e, 0x005ab5, 0x0267a7, 0x0267b5, 0x023393, 0x02339c,
+  0x008201, 0x008204, 0x008f9e, 0x00446b, 0x008291, 0x00828b, 0x00829d, 0x0052b3,
+  0x0082b1, 0x0082b3, 0x0082bd, 0x0082e6, 0x026b3c, 0x0082e5, 0x00831d, 0x008363,
+  0x0083ad, 0x008323, 0x0083bd, 0x0083e7, 0x008457, 0x008353, 0x0083ca, 0x0083cc,
+  0x0083dc, 0x026c36, 0x026d6b, 0x026cd5, 0x00452b, 0x0084f1, 0x0084f3, 0x008516,
+  0x0273ca, 0x008564, 0x026f2c, 0x00455d, 0x004561, 0x026fb1, 0x0270d2, 0x00456b,
+  0x008650, 0x00865c, 0x008667, 0x008669, 0x0086a9, 0x008688, 0x00870e, 0x0086e2,
+  0x008779, 0x008728, 0x00876b, 0x008786, 0x0087e1, 0x008801, 0x0045f9, 0x008860,
+  0x008863, 0x027667, 0x0088d7, 0x0088de, 0x004635, 0x0088fa, 0x0034bb, 0x0278ae,
+  0x027966, 0x0046be, 0x0046c7, 0x008aa0, 0x008aed, 0x008b8a, 0x008c55, 0x027ca8,
+  0x008cab, 0x008cc1, 0x008d1b, 0x008d77, 0x027f2f, 0x020804, 0x008dcb, 0x008dbc,
+  0x008df0, 0x0208de, 0x008ed4, 0x008f38, 0x0285d2, 0x0285ed, 0x009094, 0x0090f1,
+  0x009111, 0x02872e, 0x00911b, 0x009238, 0x0092d7, 0x0092d8, 0x00927c, 0x0093f9,
+  0x009415, 0x028bfa, 0x00958b, 0x004995, 0x0095b7, 0x028d77, 0x0049e6, 0x0096c3,
+  0x005db2, 0x009723, 0x029145, 0x02921a, 0x004a6e, 0x004a76, 0x0097e0, 0x02940a,
+  0x004ab2, 0x029496, 0x00980b, 0x009829, 0x0295b6, 0x0098e2, 0x004b33, 0x009929,
+  0x0099a7, 0x0099c2, 0x0099fe, 0x004bce, 0x029b30, 0x009b12, 0x009c40, 0x009cfd,
+  0x004cce, 0x004ced, 0x009d67, 0x02a0ce, 0x004cf8, 0x02a105, 0x02a20e, 0x02a291,
+  0x009ebb, 0x004d56, 0x009ef9, 0x009efe, 0x009f05, 0x009f0f, 0x009f16, 0x009f3b,
+  0x02a600,
+};
+
+// Properties used by the UTS #46 validity criteria and normalization, as the
+// canonical combining class, bidi class << 8, joining type << 12, mark << 15,
+// decomposition length << 16 and decomposition offset << 19. Stage 1 entries
+// are the stage 2 index of the block and the base decomposition offset of the
+// block << 16.
+static const uint32_t url__unicode_property_trie_stage1[] = {
+  0x00000000, 0x00000020, 0x00000040, 0x00000060, 0x00000080, 0x000000a0, 0x000000c0, 0x003400e0,
+  0x006a0100, 0x00a60120, 0x00d80140, 0x01080160, 0x00000180, 0x014201a0, 0x014a01c0, 0x017801e0,
+  0x01b00200, 0x01ec0220, 0x00000180, 0x00000180, 0x00000180, 0x00000240, 0x00000260, 0x00000280,
+  0x000002a0, 0x000002c0, 0x020e02e0, 0x02130300, 0x02150320, 0x02290340, 0x02380360, 0x00000380,
+  0x024603a0, 0x025603c0, 0x025803e0, 0x02660400, 0x00000420, 0x00000180, 0x026a0440, 0x02860460,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000480, 0x000004a0, 0x000004c0, 0x000004e0,
+  0x00000500, 0x02ae0520, 0x00000540, 0x00000560, 0x00000580, 0x000005a0, 0x02b805c0, 0x000005e0,
+  0x00000600, 0x00000620, 0x00000640, 0x00000660, 0x00000680, 0x000006a0, 0x000006c0, 0x000006e0,
+  0x00000700, 0x00000720, 0x00000740, 0x00000760, 0x00000780, 0x000007a0, 0x000007c0, 0x000007e0,
+  0x00000800, 0x02be0820, 0x02c40840, 0x00000860, 0x00000880, 0x000008a0, 0x02d408c0, 0x000008e0,
+  0x00000900, 0x02de0920, 0x02e20940, 0x00000960, 0x00000900, 0x000008a0, 0x00000980, 0x000009a0,
+  0x00000880, 0x000009c0, 0x02ea09e0, 0x00000860, 0x02f40a00, 0x00000a20, 0x02f60a40, 0x00000a60,
+  0x00000a80, 0x00000aa0, 0x02fc0ac0, 0x00000ae0, 0x00000880, 0x00000b00, 0x02fe0b20, 0x00000b40,
+  0x00000b60, 0x00000b80, 0x03090ba0, 0x00000860, 0x00000880, 0x00000180, 0x030f0bc0, 0x00000be0,
+  0x00000180, 0x00000c00, 0x00000c20, 0x00000180, 0x00000180, 0x00000c40, 0x00000c60, 0x00000180,
+  0x00000c80, 0x00000ca0, 0x03180cc0, 0x03220ce0, 0x032c0d00, 0x03320d20, 0x00000d40, 0x00000180,
+  0x00000180, 0x033a0d60, 0x00000d80, 0x00000da0, 0x00000dc0, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000de0, 0x00000180, 0x00000e00, 0x00000180, 0x00000180, 0x00000180,
+  0x00000e20, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000e40, 0x00000180, 0x00000180, 0x00000180,
+  0x00000e60, 0x00000e80, 0x00000ea0, 0x00000ea0, 0x00000180, 0x00000ec0, 0x00000ee0, 0x00000e00,
+  0x00000f00, 0x00000f20, 0x00000f20, 0x00000f40, 0x00000f60, 0x00000f80, 0x00000180, 0x00000180,
+  0x00000180, 0x00000fa0, 0x00000fc0, 0x00000180, 0x00000180, 0x00000180, 0x00000fe0, 0x00001000,
+  0x00001020, 0x00000180, 0x00001040, 0x00001060, 0x00000180, 0x00001080, 0x000010a0, 0x00000180,
+  0x033c10c0, 0x034810e0, 0x034c1100, 0x00001120, 0x00001140, 0x00001160, 0x00000180, 0x00001180,
+  0x00000180, 0x000011a0, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x000011c0, 0x000011e0,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00001200, 0x00001220,
+  0x03521240, 0x039a1260, 0x03de1280, 0x042812a0, 0x047212c0, 0x04a812e0, 0x04fe1300, 0x05561320,
+  0x05981340, 0x05e41360, 0x063c1380, 0x067d13a0, 0x06c513c0, 0x073d13e0, 0x07951400, 0x07d11420,
+  0x080b1440, 0x00001460, 0x00001480, 0x000014a0, 0x000014c0, 0x000014e0, 0x00001500, 0x00001520,
+  0x00001540, 0x080d1560, 0x00001580, 0x00000180, 0x081115a0, 0x081515c0, 0x081715e0, 0x00001000,
+  0x081d1600, 0x08231620, 0x08271640, 0x082f1660, 0x08451680, 0x085116a0, 0x00001000, 0x085916c0,
+  0x00001000, 0x086916e0, 0x00000180, 0x00001700, 0x00001720, 0x00001000, 0x00001000, 0x00001000,
+  0x00001000, 0x00001740, 0x00001760, 0x00001000, 0x00001780, 0x00000180, 0x00000180, 0x000017a0,
+  0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000,
+  0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x000017c0, 0x00001000, 0x00001000,
+  0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000,
+  0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x086b17e0, 0x00001000,
+  0x00001000, 0x00001000, 0x00001000, 0x00001800, 0x00001820, 0x00001000, 0x00001000, 0x00001000,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00001840,
+  0x00000180, 0x00000180, 0x00000180, 0x00001860, 0x00000180, 0x00000180, 0x00000180, 0x00001880,
+  0x00001000, 0x00001000, 0x000018a0, 0x00000180, 0x000018c0, 0x00001000, 0x00001000, 0x000018e0,
+  0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001900, 0x00001920,
+  0x00001940, 0x00001960, 0x086d1980, 0x088119a0, 0x089f19c0, 0x08a319e0, 0x08b719a0, 0x08d51a00,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00001000, 0x00001a20,
+  0x00001a40, 0x00000180, 0x00001920, 0x00001a60, 0x00000180, 0x00001a80, 0x00001aa0, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00001ac0, 0x00000180, 0x00000180, 0x00000fe0, 0x00001ae0,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00001000, 0x00001000,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00001920, 0x00001000, 0x00001740, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00001b00, 0x00000180, 0x00000180, 0x00001b20, 0x00001b40, 0x00000180, 0x00000180, 0x00001b60,
+  0x00001000, 0x00001b80, 0x00000180, 0x00000180, 0x00001ba0, 0x00000180, 0x00000180, 0x00000180,
+  0x00001bc0, 0x00001be0, 0x00000f20, 0x00001c00, 0x00001c20, 0x00001c40, 0x00001c60, 0x00001c80,
+  0x00000180, 0x00001ca0, 0x00001cc0, 0x00000180, 0x00000800, 0x00001ce0, 0x00001d00, 0x00001d20,
+  0x00000180, 0x00001d40, 0x00001d60, 0x00001d80, 0x00000180, 0x00001da0, 0x00001dc0, 0x00001de0,
+  0x00000180, 0x00000180, 0x00000180, 0x00001e00, 0x00000180, 0x00000180, 0x00000180, 0x00001e20,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x08e11e40, 0x09011e40, 0x09211e40, 0x09411e40, 0x09611e40, 0x09811e40, 0x09a11e40, 0x09c11e40,
+  0x09e11e60, 0x09fb1e80, 0x0a151e40, 0x0a351ea0, 0x0a531e40, 0x0a731e40, 0x0a931ec0, 0x00000180,
+  0x0aad1ee0, 0x0ab11f00, 0x0ad91f20, 0x00000680, 0x00000680, 0x00000680, 0x00001f40, 0x00000680,
+  0x00000680, 0x00000680, 0x00000680, 0x00000680, 0x00000680, 0x00000680, 0x00000680, 0x00000680,
+  0x00000680, 0x00001f60, 0x00001f80, 0x00000680, 0x00001fa0, 0x00000680, 0x00001fc0, 0x00001fe0,
+  0x00002000, 0x00002020, 0x00002040, 0x00002060, 0x00000680, 0x00000680, 0x00000680, 0x00002080,
+  0x000020a0, 0x00000040, 0x00000040, 0x000020c0, 0x00000180, 0x00000180, 0x00000180, 0x000020e0,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00002100, 0x00000180, 0x00001000, 0x00001000, 0x00002120, 0x00000e20, 0x00000180, 0x00002140,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00002160,
+  0x00000180, 0x00000180, 0x00000180, 0x00002180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x000021a0, 0x000021c0, 0x000021e0, 0x00002200, 0x00002220, 0x00002240, 0x00000180, 0x00002260,
+  0x00002280, 0x000022a0, 0x00000180, 0x00000180, 0x00002200, 0x000022c0, 0x000022e0, 0x00002200,
+  0x00002300, 0x00002320, 0x00002340, 0x00002200, 0x00002200, 0x00000180, 0x00002360, 0x00002380,
+  0x00002200, 0x000023a0, 0x000023c0, 0x000023e0, 0x00002400, 0x00002420, 0x00000180, 0x00000180,
+  0x00002200, 0x00002200, 0x00002440, 0x00000180, 0x00002200, 0x00002460, 0x00002200, 0x00002480,
+  0x000024a0, 0x000024c0, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x000024e0, 0x00002200, 0x00002500, 0x00000180, 0x00002520,
+  0x00002200, 0x00002540, 0x00002560, 0x00002580, 0x000025a0, 0x000025c0, 0x000025e0, 0x00002600,
+  0x00002620, 0x00002640, 0x00002660, 0x00002680, 0x0af326a0, 0x0af726c0, 0x000026e0, 0x00000180,
+  0x00002700, 0x0af92720, 0x00002740, 0x00002760, 0x00001140, 0x00002780, 0x000027a0, 0x00000180,
+  0x00000180, 0x000027c0, 0x000027e0, 0x00000180, 0x00000180, 0x00000180, 0x00002800, 0x00002820,
+  0x00000b60, 0x00002840, 0x0afd2860, 0x00002880, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x000028a0, 0x000028c0, 0x00000180, 0x00000180, 0x0b0128e0, 0x00002900, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x0b072920, 0x00002940, 0x00000180,
+  0x00000180, 0x00002960, 0x00002980, 0x000029a0, 0x00000180, 0x000029c0, 0x00000180, 0x00000180,
+  0x000029e0, 0x00002a00, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00002a20, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x0b0b2a40, 0x00002a60, 0x00000180, 0x00000180, 0x00000180, 0x00002a80, 0x00002aa0,
+  0x00002ac0, 0x00002ae0, 0x00002b00, 0x00000180, 0x00002b20, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00002b40, 0x00000180, 0x00000180, 0x00002b60, 0x00002b80, 0x00000180, 0x00000180,
+  0x00000180, 0x00002ba0, 0x00002bc0, 0x00000180, 0x00002be0, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00002c00,
+  0x00002c20, 0x00002c40, 0x00002c60, 0x00000180, 0x00000180, 0x00000180, 0x00002c80, 0x00002ca0,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00002cc0, 0x00002ce0, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00002d00,
+  0x00000180, 0x00002d20, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00002d40, 0x00002d60, 0x00002d80, 0x00000180, 0x00000180, 0x00002da0,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00002dc0, 0x00002de0, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00002e00, 0x00002e20, 0x00002e40, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x0b0d2e60, 0x0b112e80, 0x00002ea0, 0x0b202ec0, 0x0b2d2ee0, 0x00002f00,
+  0x00001000, 0x00001000, 0x00002f20, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00001000, 0x00001000, 0x00002f40, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00002f60, 0x00000180,
+  0x00002f80, 0x00000180, 0x00002fa0, 0x00000180, 0x00002fc0, 0x00000180, 0x00002fe0, 0x00003000,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00002e00, 0x00003020, 0x00002e00, 0x00003040, 0x00003060, 0x00003080, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x000030a0, 0x000030c0, 0x00000180, 0x00000180, 0x000030e0, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00002d20, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00003100, 0x00000180, 0x00003120,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00003140,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00002200, 0x00002200, 0x00002200, 0x00002200, 0x00002200, 0x00002200, 0x00003160, 0x00000180,
+  0x00003180, 0x00003180, 0x000031a0, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x000031c0, 0x00000680, 0x000031e0, 0x00000180, 0x00000180,
+  0x00003200, 0x00003220, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00003240, 0x00003260, 0x00003280, 0x000032a0, 0x000032c0, 0x000032e0, 0x00000180, 0x00003300,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00001000, 0x00003320, 0x00001000, 0x00001000, 0x000018e0, 0x00003340, 0x00003360, 0x00001900,
+  0x00003380, 0x00002fa0, 0x00000180, 0x000033a0, 0x00000180, 0x000033c0, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x000020c0, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000,
+  0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000,
+  0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000,
+  0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x000033e0, 0x00002120,
+  0x00001000, 0x00001000, 0x00001000, 0x00003400, 0x00001000, 0x00001000, 0x00003420, 0x00003440,
+  0x00003320, 0x00001000, 0x00003460, 0x00001000, 0x00003480, 0x000034a0, 0x00000180, 0x00000180,
+  0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000,
+  0x00001000, 0x00001000, 0x000018e0, 0x000034c0, 0x000034e0, 0x00003500, 0x00003520, 0x00003540,
+  0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00003560, 0x00001000, 0x00001760, 0x00003580,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x0b301e40, 0x0b501e40, 0x0b701e40, 0x0b901e40, 0x0bb01e40, 0x0bd01e40, 0x0bf01e40, 0x0c101e40,
+  0x0c301e40, 0x0c501e40, 0x0c701e40, 0x0c901e40, 0x0cb01e40, 0x0cd01e40, 0x0cf01e40, 0x0d101e40,
+  0x0d3035a0, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+  0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180, 0x00000180,
+};
+
+static const uint32_t url__unicode_property_trie_stage2[] = {
+  0x00000900, 0x00000900, 0x00000900, 0x00000900, 0x00000900, 0x00000900, 0x00000900, 0x00000900,
+  0x00000900, 0x00000b00, 0x00000b00, 0x00000b00, 0x00000b00, 0x00000b00, 0x00000900, 0x00000900,
+  0x00000900, 0x00000900, 0x00000900, 0x00000900, 0x00000900, 0x00000900, 0x00000900, 0x00000900,
+  0x00000900, 0x00000900, 0x00000900, 0x00000900, 0x00000b00, 0x00000b00, 0x00000b00, 0x00000b00,
+  0x00000b00, 0x00000800, 0x00000800, 0x00000700, 0x00000700, 0x00000700, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000500, 0x00000600, 0x00000500, 0x00000600, 0x00000600,
+  0x00000400, 0x00000400, 0x00000400, 0x00000400, 0x00000400, 0x00000400, 0x00000400, 0x00000400,
+  0x00000400, 0x00000400, 0x00000600, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000900,
+  0x00000900, 0x00000900, 0x00000900, 0x00000900, 0x00000900, 0x00000b00, 0x00000900, 0x00000900,
+  0x00000900, 0x00000900, 0x00000900, 0x00000900, 0x00000900, 0x00000900, 0x00000900, 0x00000900,
+  0x00000900, 0x00000900, 0x00000900, 0x00000900, 0x00000900, 0x00000900, 0x00000900, 0x00000900,
+  0x00000900, 0x00000900, 0x00000900, 0x00000900, 0x00000900, 0x00000900, 0x00000900, 0x00000900,
+  0x00000600, 0x00000800, 0x00000700, 0x00000700, 0x00000700, 0x00000700, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000000, 0x00000800, 0x00000800, 0x00004900, 0x00000800, 0x00000800,
+  0x00000700, 0x00000700, 0x00000400, 0x00000400, 0x00000800, 0x00000000, 0x00000800, 0x00000800,
+  0x00000800, 0x00000400, 0x00000000, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00020000, 0x00120000, 0x00220000, 0x00320000, 0x00420000, 0x00520000, 0x00000000, 0x00620000,
+  0x00720000, 0x00820000, 0x00920000, 0x00a20000, 0x00b20000, 0x00c20000, 0x00d20000, 0x00e20000,
+  0x00000000, 0x00f20000, 0x01020000, 0x01120000, 0x01220000, 0x01320000, 0x01420000, 0x00000800,
+  0x00000000, 0x01520000, 0x01620000, 0x01720000, 0x01820000, 0x01920000, 0x00000000, 0x00000000,
+  0x00020000, 0x00120000, 0x00220000, 0x00320000, 0x00420000, 0x00520000, 0x00000000, 0x00620000,
+  0x00720000, 0x00820000, 0x00920000, 0x00a20000, 0x00b20000, 0x00c20000, 0x00d20000, 0x00e20000,
+  0x00000000, 0x00f20000, 0x01020000, 0x01120000, 0x01220000, 0x01320000, 0x01420000, 0x00000800,
+  0x00000000, 0x01520000, 0x01620000, 0x01720000, 0x01820000, 0x01920000, 0x00000000, 0x01a20000,
+  0x00020000, 0x00120000, 0x00220000, 0x00320000, 0x00420000, 0x00520000, 0x00620000, 0x00720000,
+  0x00820000, 0x00920000, 0x00a20000, 0x00b20000, 0x00c20000, 0x00d20000, 0x00e20000, 0x00f20000,
+  0x00000000, 0x00000000, 0x01020000, 0x01120000, 0x01220000, 0x01320000, 0x01420000, 0x01520000,
+  0x01620000, 0x01720000, 0x01820000, 0x01920000, 0x01a20000, 0x01b20000, 0x01c20000, 0x01d20000,
+  0x00020000, 0x00120000, 0x00220000, 0x00320000, 0x00420000, 0x00520000, 0x00000000, 0x00000000,
+  0x00620000, 0x00720000, 0x00820000, 0x00920000, 0x00a20000, 0x00b20000, 0x00c20000, 0x00d20000,
+  0x00e20000, 0x00000000, 0x00000000, 0x00000000, 0x00f20000, 0x01020000, 0x01120000, 0x01220000,
+  0x00000000, 0x01320000, 0x01420000, 0x01520000, 0x01620000, 0x01720000, 0x01820000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00020000, 0x00120000, 0x00220000, 0x00320000, 0x00420000,
+  0x00520000, 0x00000000, 0x00000000, 0x00000000, 0x00620000, 0x00720000, 0x00820000, 0x00920000,
+  0x00a20000, 0x00b20000, 0x00000000, 0x00000000, 0x00c20000, 0x00d20000, 0x00e20000, 0x00f20000,
+  0x01020000, 0x01120000, 0x01220000, 0x01320000, 0x01420000, 0x01520000, 0x01620000, 0x01720000,
+  0x00020000, 0x00120000, 0x00220000, 0x00320000, 0x00420000, 0x00520000, 0x00000000, 0x00000000,
+  0x00620000, 0x00720000, 0x00820000, 0x00920000, 0x00a20000, 0x00b20000, 0x00c20000, 0x00d20000,
+  0x00e20000, 0x00f20000, 0x01020000, 0x01120000, 0x01220000, 0x01320000, 0x01420000, 0x01520000,
+  0x01620000, 0x01720000, 0x01820000, 0x01920000, 0x01a20000, 0x01b20000, 0x01c20000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00020000, 0x00120000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00220000,
+  0x00320000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00020000, 0x00120000, 0x00220000,
+  0x00320000, 0x00420000, 0x00520000, 0x00620000, 0x00720000, 0x00830000, 0x009b0000, 0x00b30000,
+  0x00cb0000, 0x00e30000, 0x00fb0000, 0x01130000, 0x012b0000, 0x00000000, 0x01430000, 0x015b0000,
+  0x00030000, 0x001b0000, 0x00320000, 0x00420000, 0x00000000, 0x00000000, 0x00520000, 0x00620000,
+  0x00720000, 0x00820000, 0x00920000, 0x00a20000, 0x00b30000, 0x00cb0000, 0x00e20000, 0x00f20000,
+  0x01020000, 0x00000000, 0x00000000, 0x00000000, 0x01120000, 0x01220000, 0x00000000, 0x00000000,
+  0x01320000, 0x01420000, 0x01530000, 0x016b0000, 0x01820000, 0x01920000, 0x01a20000, 0x01b20000,
+  0x00020000, 0x00120000, 0x00220000, 0x00320000, 0x00420000, 0x00520000, 0x00620000, 0x00720000,
+  0x00820000, 0x00920000, 0x00a20000, 0x00b20000, 0x00c20000, 0x00d20000, 0x00e20000, 0x00f20000,
+  0x01020000, 0x01120000, 0x01220000, 0x01320000, 0x01420000, 0x01520000, 0x01620000, 0x01720000,
+  0x01820000, 0x01920000, 0x01a20000, 0x01b20000, 0x00000000, 0x00000000, 0x01c20000, 0x01d20000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00020000, 0x00120000,
+  0x00220000, 0x00320000, 0x00430000, 0x005b0000, 0x00730000, 0x008b0000, 0x00a20000, 0x00b20000,
+  0x00c30000, 0x00db0000, 0x00f20000, 0x01020000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000800, 0x00000800, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000000, 0x00000000, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000000, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6,
+  0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6,
+  0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae8, 0x0000cadc, 0x0000cadc,
+  0x0000cadc, 0x0000cadc, 0x0000cae8, 0x0000cad8, 0x0000cadc, 0x0000cadc, 0x0000cadc, 0x0000cadc,
+  0x0000cadc, 0x0000caca, 0x0000caca, 0x0000cadc, 0x0000cadc, 0x0000cadc, 0x0000cadc, 0x0000caca,
+  0x0000caca, 0x0000cadc, 0x0000cadc, 0x0000cadc, 0x0000cadc, 0x0000cadc, 0x0000cadc, 0x0000cadc,
+  0x0000cadc, 0x0000cadc, 0x0000cadc, 0x0000cadc, 0x0000ca01, 0x0000ca01, 0x0000ca01, 0x0000ca01,
+  0x0000ca01, 0x0000cadc, 0x0000cadc, 0x0000cadc, 0x0000cadc, 0x0000cae6, 0x0000cae6, 0x0000cae6,
+  0x0001cae6, 0x0009cae6, 0x0000cae6, 0x0011cae6, 0x001acae6, 0x0000caf0, 0x0000cae6, 0x0000cadc,
+  0x0000cadc, 0x0000cadc, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cadc, 0x0000cadc, 0x0000ca00,
+  0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cadc, 0x0000cadc, 0x0000cadc, 0x0000cadc, 0x0000cae6,
+  0x0000cae8, 0x0000cadc, 0x0000cadc, 0x0000cae6, 0x0000cae9, 0x0000caea, 0x0000caea, 0x0000cae9,
+  0x0000caea, 0x0000caea, 0x0000cae9, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6,
+  0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00010800, 0x00000800, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00090800, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000800, 0x00020800, 0x00120000, 0x00210800,
+  0x002a0000, 0x003a0000, 0x004a0000, 0x00000000, 0x005a0000, 0x00000000, 0x006a0000, 0x007a0000,
+  0x008b0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00020000, 0x00120000, 0x00220000, 0x00320000, 0x00420000, 0x00520000,
+  0x00630000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00020000, 0x00120000, 0x00220000, 0x00320000, 0x00420000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00520000, 0x00620000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000800, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00020000, 0x00120000, 0x00000000, 0x00220000, 0x00000000, 0x00000000, 0x00000000, 0x00320000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00420000, 0x00520000, 0x00620000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00720000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00020000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00020000, 0x00120000, 0x00000000, 0x00220000, 0x00000000, 0x00000000, 0x00000000, 0x00320000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00420000, 0x00520000, 0x00620000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00020000, 0x00120000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6,
+  0x0000ca00, 0x0000ca00, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00020000, 0x00120000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00220000, 0x00320000, 0x00420000, 0x00520000, 0x00000000, 0x00000000, 0x00620000, 0x00720000,
+  0x00000000, 0x00000000, 0x00820000, 0x00920000, 0x00a20000, 0x00b20000, 0x00c20000, 0x00d20000,
+  0x00000000, 0x00000000, 0x00020000, 0x00120000, 0x00220000, 0x00320000, 0x00420000, 0x00520000,
+  0x00000000, 0x00000000, 0x00620000, 0x00720000, 0x00820000, 0x00920000, 0x00a20000, 0x00b20000,
+  0x00c20000, 0x00d20000, 0x00e20000, 0x00f20000, 0x01020000, 0x01120000, 0x00000000, 0x00000000,
+  0x01220000, 0x01320000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000800, 0x00000000, 0x00000000, 0x00000800, 0x00000800, 0x00000700,
+  0x00000000, 0x0000cadc, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cadc, 0x0000cae6,
+  0x0000cae6, 0x0000cae6, 0x0000cade, 0x0000cadc, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6,
+  0x0000cae6, 0x0000cae6, 0x0000cadc, 0x0000cadc, 0x0000cadc, 0x0000cadc, 0x0000cadc, 0x0000cadc,
+  0x0000cae6, 0x0000cae6, 0x0000cadc, 0x0000cae6, 0x0000cae6, 0x0000cade, 0x0000cae4, 0x0000cae6,
+  0x0000ca0a, 0x0000ca0b, 0x0000ca0c, 0x0000ca0d, 0x0000ca0e, 0x0000ca0f, 0x0000ca10, 0x0000ca11,
+  0x0000ca12, 0x0000ca13, 0x0000ca13, 0x0000ca14, 0x0000ca15, 0x0000ca16, 0x00000100, 0x0000ca17,
+  0x00000100, 0x0000ca18, 0x0000ca19, 0x00000100, 0x0000cae6, 0x0000cadc, 0x00000100, 0x0000ca12,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100,
+  0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100,
+  0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100,
+  0x00000100, 0x00000100, 0x00000100, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000100,
+  0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000300, 0x00000300, 0x00000300, 0x00000300, 0x00000300, 0x00000300, 0x00000800, 0x00000800,
+  0x00000200, 0x00000700, 0x00000700, 0x00000200, 0x00000600, 0x00000200, 0x00000800, 0x00000800,
+  0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6,
+  0x0000ca1e, 0x0000ca1f, 0x0000ca20, 0x00000200, 0x00004200, 0x00000200, 0x00000200, 0x00000200,
+  0x00001200, 0x00000200, 0x00023200, 0x00123200, 0x00223200, 0x00323200, 0x00421200, 0x00003200,
+  0x00001200, 0x00003200, 0x00001200, 0x00001200, 0x00001200, 0x00001200, 0x00001200, 0x00003200,
+  0x00003200, 0x00003200, 0x00003200, 0x00001200, 0x00001200, 0x00001200, 0x00001200, 0x00001200,
+  0x00001200, 0x00001200, 0x00001200, 0x00001200, 0x00001200, 0x00001200, 0x00001200, 0x00001200,
+  0x00005200, 0x00001200, 0x00001200, 0x00001200, 0x00001200, 0x00001200, 0x00001200, 0x00001200,
+  0x00003200, 0x00001200, 0x00001200, 0x0000ca1b, 0x0000ca1c, 0x0000ca1d, 0x0000ca1e, 0x0000ca1f,
+  0x0000ca20, 0x0000ca21, 0x0000ca22, 0x0000cae6, 0x0000cae6, 0x0000cadc, 0x0000cadc, 0x0000cae6,
+  0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cadc, 0x0000cae6, 0x0000cae6, 0x0000cadc,
+  0x00000300, 0x00000300, 0x00000300, 0x00000300, 0x00000300, 0x00000300, 0x00000300, 0x00000300,
+  0x00000300, 0x00000300, 0x00000700, 0x00000300, 0x00000300, 0x00000200, 0x00001200, 0x00001200,
+  0x0000ca23, 0x00003200, 0x00003200, 0x00003200, 0x00000200, 0x00003200, 0x00003200, 0x00003200,
+  0x00001200, 0x00001200, 0x00001200, 0x00001200, 0x00001200, 0x00001200, 0x00001200, 0x00001200,
+  0x00001200, 0x00001200, 0x00001200, 0x00001200, 0x00001200, 0x00001200, 0x00001200, 0x00001200,
+  0x00003200, 0x00003200, 0x00003200, 0x00003200, 0x00003200, 0x00003200, 0x00003200, 0x00003200,
+  0x00003200, 0x00003200, 0x00003200, 0x00003200, 0x00003200, 0x00003200, 0x00003200, 0x00003200,
+  0x00003200, 0x00003200, 0x00001200, 0x00001200, 0x00001200, 0x00001200, 0x00001200, 0x00001200,
+  0x00001200, 0x00001200, 0x00001200, 0x00001200, 0x00001200, 0x00001200, 0x00001200, 0x00001200,
+  0x00001200, 0x00001200, 0x00001200, 0x00001200, 0x00001200, 0x00001200, 0x00001200, 0x00001200,
+  0x00001200, 0x00001200, 0x00001200, 0x00001200, 0x00001200, 0x00001200, 0x00001200, 0x00001200,
+  0x00001200, 0x00001200, 0x00001200, 0x00001200, 0x00001200, 0x00001200, 0x00001200, 0x00001200,
+  0x00023200, 0x00001200, 0x00121200, 0x00003200, 0x00003200, 0x00003200, 0x00003200, 0x00003200,
+  0x00003200, 0x00003200, 0x00003200, 0x00003200, 0x00001200, 0x00003200, 0x00001200, 0x00003200,
+  0x00001200, 0x00001200, 0x00003200, 0x00223200, 0x00000200, 0x00003200, 0x0000cae6, 0x0000cae6,
+  0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x00000300, 0x00000800, 0x0000cae6,
+  0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cadc, 0x0000cae6, 0x00000200, 0x00000200, 0x0000cae6,
+  0x0000cae6, 0x00000800, 0x0000cadc, 0x0000cae6, 0x0000cae6, 0x0000cadc, 0x00003200, 0x00003200,
+  0x00000400, 0x00000400, 0x00000400, 0x00000400, 0x00000400, 0x00000400, 0x00000400, 0x00000400,
+  0x00000400, 0x00000400, 0x00001200, 0x00001200, 0x00001200, 0x00000200, 0x00000200, 0x00001200,
+  0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200,
+  0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000000, 0x00004200,
+  0x00003200, 0x0000ca24, 0x00001200, 0x00001200, 0x00001200, 0x00003200, 0x00003200, 0x00003200,
+  0x00003200, 0x00003200, 0x00001200, 0x00001200, 0x00001200, 0x00001200, 0x00003200, 0x00001200,
+  0x00001200, 0x00001200, 0x00001200, 0x00001200, 0x00001200, 0x00001200, 0x00001200, 0x00001200,
+  0x00003200, 0x00001200, 0x00003200, 0x00001200, 0x00003200, 0x00001200, 0x00001200, 0x00003200,
+  0x0000cae6, 0x0000cadc, 0x0000cae6, 0x0000cae6, 0x0000cadc, 0x0000cae6, 0x0000cae6, 0x0000cadc,
+  0x0000cadc, 0x0000cadc, 0x0000cae6, 0x0000cadc, 0x0000cadc, 0x0000cae6, 0x0000cadc, 0x0000cae6,
+  0x0000cae6, 0x0000cae6, 0x0000cadc, 0x0000cae6, 0x0000cadc, 0x0000cae6, 0x0000cadc, 0x0000cae6,
+  0x0000cadc, 0x0000cae6, 0x0000cae6, 0x00000000, 0x00000000, 0x00003200, 0x00001200, 0x00001200,
+  0x00001200, 0x00001200, 0x00001200, 0x00001200, 0x00001200, 0x00001200, 0x00001200, 0x00001200,
+  0x00001200, 0x00003200, 0x00003200, 0x00003200, 0x00001200, 0x00001200, 0x00001200, 0x00001200,
+  0x00001200, 0x00001200, 0x00001200, 0x00001200, 0x00001200, 0x00001200, 0x00001200, 0x00001200,
+  0x00001200, 0x00001200, 0x00001200, 0x00003200, 0x00003200, 0x00001200, 0x00001200, 0x00001200,
+  0x00001200, 0x00003200, 0x00001200, 0x00003200, 0x00003200, 0x00001200, 0x00001200, 0x00001200,
+  0x00003200, 0x00003200, 0x00001200, 0x00001200, 0x00001200, 0x00001200, 0x00001200, 0x00001200,
+  0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200,
+  0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200,
+  0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200,
+  0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200,
+  0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x0000ca00, 0x0000ca00,
+  0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00,
+  0x0000ca00, 0x00000200, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100,
+  0x00000100, 0x00000100, 0x00001100, 0x00001100, 0x00001100, 0x00001100, 0x00001100, 0x00001100,
+  0x00001100, 0x00001100, 0x00001100, 0x00001100, 0x00001100, 0x00001100, 0x00001100, 0x00001100,
+  0x00001100, 0x00001100, 0x00001100, 0x00001100, 0x00001100, 0x00001100, 0x00001100, 0x00001100,
+  0x00001100, 0x00001100, 0x00001100, 0x00001100, 0x00001100, 0x00001100, 0x00001100, 0x00001100,
+  0x00001100, 0x00001100, 0x00001100, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6,
+  0x0000cae6, 0x0000cae6, 0x0000cadc, 0x0000cae6, 0x00000100, 0x00000100, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00005100, 0x00000000, 0x00000000, 0x0000cadc, 0x00000100, 0x00000100,
+  0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100,
+  0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100,
+  0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x0000cae6, 0x0000cae6,
+  0x0000cae6, 0x0000cae6, 0x00000100, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6,
+  0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x00000100, 0x0000cae6, 0x0000cae6, 0x0000cae6,
+  0x00000100, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x00000000, 0x00000000,
+  0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100,
+  0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000000,
+  0x00003100, 0x00001100, 0x00001100, 0x00001100, 0x00001100, 0x00001100, 0x00003100, 0x00003100,
+  0x00001100, 0x00003100, 0x00001100, 0x00001100, 0x00001100, 0x00001100, 0x00001100, 0x00001100,
+  0x00001100, 0x00001100, 0x00001100, 0x00001100, 0x00003100, 0x00001100, 0x00003100, 0x00003100,
+  0x00003100, 0x0000cadc, 0x0000cadc, 0x0000cadc, 0x00000000, 0x00000000, 0x00000100, 0x00000000,
+  0x00001200, 0x00000200, 0x00001200, 0x00001200, 0x00001200, 0x00001200, 0x00000200, 0x00003200,
+  0x00001200, 0x00003200, 0x00003200, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00003200, 0x00003200, 0x00003200, 0x00003200, 0x00003200, 0x00003200, 0x00003200, 0x00003200,
+  0x00003200, 0x00003200, 0x00003200, 0x00003200, 0x00003200, 0x00003200, 0x00003200, 0x00003200,
+  0x00003200, 0x00003200, 0x00003200, 0x00005200, 0x00005200, 0x00005200, 0x00001200, 0x00000200,
+  0x00000200, 0x00001200, 0x00001200, 0x00001200, 0x00001200, 0x00001200, 0x00003200, 0x00000000,
+  0x00000300, 0x00000300, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x0000cae6, 0x0000cadc, 0x0000cadc, 0x0000cadc, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6,
+  0x00001200, 0x00001200, 0x00001200, 0x00001200, 0x00001200, 0x00001200, 0x00001200, 0x00001200,
+  0x00001200, 0x00001200, 0x00003200, 0x00003200, 0x00003200, 0x00000200, 0x00003200, 0x00001200,
+  0x00001200, 0x00003200, 0x00003200, 0x00001200, 0x00001200, 0x00001200, 0x00001200, 0x00001200,
+  0x00001200, 0x00003200, 0x00001200, 0x00001200, 0x00001200, 0x00001200, 0x00001200, 0x00001200,
+  0x00001200, 0x00001200, 0x00001200, 0x00001200, 0x00001200, 0x00001200, 0x00001200, 0x00001200,
+  0x00001200, 0x00000200, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cadc,
+  0x0000cadc, 0x0000cadc, 0x0000cadc, 0x0000cadc, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6,
+  0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6,
+  0x0000cae6, 0x0000cae6, 0x00000300, 0x0000cadc, 0x0000cae6, 0x0000cae6, 0x0000cadc, 0x0000cae6,
+  0x0000cae6, 0x0000cadc, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cadc, 0x0000cadc, 0x0000cadc,
+  0x0000ca1b, 0x0000ca1c, 0x0000ca1d, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cadc, 0x0000cae6,
+  0x0000cae6, 0x0000cadc, 0x0000cadc, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6,
+  0x0000ca00, 0x0000ca00, 0x0000ca00, 0x00008000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00020000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00120000, 0x00000000, 0x00000000, 0x00220000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x0000ca00, 0x00008000, 0x0000ca07, 0x00000000, 0x00008000, 0x00008000,
+  0x00008000, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00,
+  0x0000ca00, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x0000ca09, 0x00008000, 0x00008000,
+  0x00000000, 0x0000cae6, 0x0000cadc, 0x0000cae6, 0x0000cae6, 0x0000ca00, 0x0000ca00, 0x0000ca00,
+  0x00020000, 0x00120000, 0x00220000, 0x00320000, 0x00420000, 0x00520000, 0x00620000, 0x00720000,
+  0x00000000, 0x00000000, 0x0000ca00, 0x0000ca00, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x0000ca00, 0x00008000, 0x00008000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000ca07, 0x00000000, 0x00008000, 0x00008000,
+  0x00008000, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x00000000, 0x00000000, 0x00008000,
+  0x00008000, 0x00000000, 0x00000000, 0x00028000, 0x00128000, 0x0000ca09, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00008000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00220000, 0x00320000, 0x00000000, 0x00420000,
+  0x00000000, 0x00000000, 0x0000ca00, 0x0000ca00, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000700, 0x00000700, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000700, 0x00000000, 0x00000000, 0x0000cae6, 0x00000000,
+  0x00000000, 0x0000ca00, 0x0000ca00, 0x00008000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00020000, 0x00000000, 0x00000000, 0x00120000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000ca07, 0x00000000, 0x00008000, 0x00008000,
+  0x00008000, 0x0000ca00, 0x0000ca00, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000ca00,
+  0x0000ca00, 0x00000000, 0x00000000, 0x0000ca00, 0x0000ca00, 0x0000ca09, 0x00000000, 0x00000000,
+  0x00000000, 0x0000ca00, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00020000, 0x00120000, 0x00220000, 0x00000000, 0x00000000, 0x00320000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x0000ca00, 0x0000ca00, 0x00000000, 0x00000000, 0x00000000, 0x0000ca00, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00008000, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x00000000, 0x0000ca00,
+  0x0000ca00, 0x00008000, 0x00000000, 0x00008000, 0x00008000, 0x0000ca09, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x0000ca00, 0x0000ca00, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000700, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000ca07, 0x00000000, 0x00008000, 0x0000ca00,
+  0x00008000, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x00000000, 0x00000000, 0x00008000,
+  0x00028000, 0x00000000, 0x00000000, 0x00128000, 0x00228000, 0x0000ca09, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000ca00, 0x0000ca00, 0x00008000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00320000, 0x00420000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x0000ca00, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00020000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00008000, 0x00008000,
+  0x0000ca00, 0x00008000, 0x00008000, 0x00000000, 0x00000000, 0x00000000, 0x00008000, 0x00008000,
+  0x00008000, 0x00000000, 0x00028000, 0x00128000, 0x00228000, 0x0000ca09, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00008000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000700, 0x00000800, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x0000ca00, 0x00008000, 0x00008000, 0x00008000, 0x0000ca00, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000ca07, 0x00000000, 0x0000ca00, 0x0000ca00,
+  0x0000ca00, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00000000, 0x0000ca00, 0x0000ca00,
+  0x0002ca00, 0x00000000, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca09, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000ca54, 0x0000ca5b, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x0000ca00, 0x0000ca00, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000ca07, 0x00000000, 0x00008000, 0x0000c000,
+  0x00028000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00000000, 0x0000c000, 0x00128000,
+  0x00228000, 0x00000000, 0x00328000, 0x00438000, 0x0000ca00, 0x0000ca09, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00008000, 0x00008000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x0000ca00, 0x0000ca00, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00008000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x0000ca00, 0x0000ca00, 0x00008000, 0x00008000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x0000ca09, 0x0000ca09, 0x00000000, 0x00008000, 0x00008000,
+  0x00008000, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x00000000, 0x00008000, 0x00008000,
+  0x00008000, 0x00000000, 0x00028000, 0x00128000, 0x00228000, 0x0000ca09, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00008000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x0000ca09, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00008000,
+  0x00008000, 0x00008000, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x00000000, 0x0000ca00, 0x00000000,
+  0x00008000, 0x00008000, 0x00028000, 0x00008000, 0x00128000, 0x00238000, 0x003a8000, 0x00008000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00008000, 0x00008000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x0000ca00, 0x00000000, 0x00000000, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00,
+  0x0000ca67, 0x0000ca67, 0x0000ca09, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000700,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000ca00,
+  0x0000ca6b, 0x0000ca6b, 0x0000ca6b, 0x0000ca6b, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x0000ca00, 0x00000000, 0x00000000, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00,
+  0x0000ca76, 0x0000ca76, 0x0000ca09, 0x0000ca00, 0x0000ca00, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x0000ca7a, 0x0000ca7a, 0x0000ca7a, 0x0000ca7a, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x0000cadc, 0x0000cadc, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000cadc, 0x00000000, 0x0000cadc,
+  0x00000000, 0x0000cad8, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00008000, 0x00008000,
+  0x00000000, 0x00000000, 0x00000000, 0x00020000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00120000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00220000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00320000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00420000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00020000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x0000ca81, 0x0000ca82, 0x0012ca00, 0x0000ca84, 0x0022ca00, 0x0032ca00, 0x0000ca00,
+  0x0042ca00, 0x0000ca00, 0x0000ca82, 0x0000ca82, 0x0000ca82, 0x0000ca82, 0x0000ca00, 0x00008000,
+  0x0000ca82, 0x0002ca00, 0x0000cae6, 0x0000cae6, 0x0000ca09, 0x00000000, 0x0000cae6, 0x0000cae6,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000ca00, 0x0000ca00, 0x0000ca00,
+  0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0012ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00,
+  0x00000000, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0022ca00, 0x0000ca00, 0x0000ca00,
+  0x0000ca00, 0x0000ca00, 0x0002ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0012ca00,
+  0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0022ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00,
+  0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00,
+  0x0000ca00, 0x0032ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000cadc, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00020000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00008000, 0x00008000, 0x0000ca00, 0x0000ca00, 0x0000ca00,
+  0x0000ca00, 0x00008000, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca07,
+  0x00008000, 0x0000ca09, 0x0000ca09, 0x00008000, 0x00008000, 0x0000ca00, 0x0000ca00, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00008000, 0x00008000,
+  0x0000ca00, 0x0000ca00, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000ca00, 0x0000ca00,
+  0x0000ca00, 0x00000000, 0x00008000, 0x00008000, 0x00008000, 0x00000000, 0x00000000, 0x00008000,
+  0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00000000, 0x00000000,
+  0x00000000, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x0000ca00, 0x00008000, 0x00008000, 0x0000ca00, 0x0000ca00, 0x00008000,
+  0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x0000cadc, 0x00000000, 0x00008000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00008000, 0x00008000, 0x00008000, 0x0000ca00, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000cae6, 0x0000cae6, 0x0000cae6,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000800, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000b00, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000800, 0x00000800, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x0000ca00, 0x0000ca00, 0x0000ca09, 0x00008009, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x0000ca00, 0x0000ca00, 0x00008009, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x0000ca00, 0x0000ca00, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000ca00, 0x0000ca00, 0x00008000, 0x0000ca00,
+  0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x00008000, 0x00008000,
+  0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x0000ca00, 0x00008000,
+  0x00008000, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00,
+  0x0000ca00, 0x0000ca00, 0x0000ca09, 0x0000ca00, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000700, 0x00000000, 0x0000cae6, 0x00000000, 0x00000000,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00001800,
+  0x00000800, 0x00000800, 0x00005800, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x00000900, 0x0000ca00,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000,
+  0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000,
+  0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000,
+  0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000,
+  0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000,
+  0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000,
+  0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000,
+  0x00001000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000ca00, 0x0000ca00, 0x00001000,
+  0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000,
+  0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000,
+  0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000,
+  0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000,
+  0x00001000, 0x0000cae4, 0x00001000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x0000ca00, 0x0000ca00, 0x0000ca00, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x0000ca00,
+  0x0000ca00, 0x00008000, 0x00008000, 0x00008000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00008000, 0x00008000, 0x0000ca00, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000,
+  0x00008000, 0x0000cade, 0x0000cae6, 0x0000cadc, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000800, 0x00000000, 0x00000000, 0x00000000, 0x00000800, 0x00000800, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000cae6,
+  0x0000cadc, 0x00008000, 0x00008000, 0x0000ca00, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00008000, 0x0000ca00, 0x00008000,
+  0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x00000000,
+  0x0000ca09, 0x00008000, 0x0000ca00, 0x00008000, 0x00008000, 0x0000ca00, 0x0000ca00, 0x0000ca00,
+  0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x00008000, 0x00008000, 0x00008000,
+  0x00008000, 0x00008000, 0x00008000, 0x0000ca00, 0x0000ca00, 0x0000cae6, 0x0000cae6, 0x0000cae6,
+  0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x00000000, 0x00000000, 0x0000cadc,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cadc, 0x0000cadc, 0x0000cadc,
+  0x0000cadc, 0x0000cadc, 0x0000cadc, 0x0000cae6, 0x0000cae6, 0x0000cadc, 0x0000ca00, 0x0000cadc,
+  0x0000cadc, 0x0000cae6, 0x0000cae6, 0x0000cadc, 0x0000cadc, 0x0000cae6, 0x0000cae6, 0x0000cae6,
+  0x0000cae6, 0x0000cae6, 0x0000cadc, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x00008000, 0x00000000, 0x00020000, 0x00000000,
+  0x00120000, 0x00000000, 0x00220000, 0x00000000, 0x00320000, 0x00000000, 0x00420000, 0x00000000,
+  0x00000000, 0x00000000, 0x00520000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000ca07, 0x00008000, 0x0000ca00, 0x0000ca00,
+  0x0000ca00, 0x0000ca00, 0x0000ca00, 0x00028000, 0x0000ca00, 0x00128000, 0x00008000, 0x00008000,
+  0x00028000, 0x00128000, 0x0000ca00, 0x00228000, 0x00008009, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x0000cae6, 0x0000cadc, 0x0000cae6, 0x0000cae6, 0x0000cae6,
+  0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x0000ca00, 0x0000ca00, 0x00008000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00008000, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x00008000, 0x00008000,
+  0x0000ca00, 0x0000ca00, 0x00008009, 0x0000ca09, 0x0000ca00, 0x0000ca00, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000ca07, 0x00008000,
+  0x0000ca00, 0x0000ca00, 0x00008000, 0x00008000, 0x00008000, 0x0000ca00, 0x00008000, 0x0000ca00,
+  0x0000ca00, 0x0000ca00, 0x00008009, 0x00008009, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00008000, 0x00008000, 0x00008000, 0x00008000,
+  0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00,
+  0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x00008000, 0x00008000, 0x0000ca00, 0x0000ca07,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x0000cae6, 0x0000cae6, 0x0000cae6, 0x00000000, 0x0000ca01, 0x0000cadc, 0x0000cadc, 0x0000cadc,
+  0x0000cadc, 0x0000cadc, 0x0000cae6, 0x0000cae6, 0x0000cadc, 0x0000cadc, 0x0000cadc, 0x0000cadc,
+  0x0000cae6, 0x00008000, 0x0000ca01, 0x0000ca01, 0x0000ca01, 0x0000ca01, 0x0000ca01, 0x0000ca01,
+  0x0000ca01, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000cadc, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000cae6, 0x00000000, 0x00000000, 0x00008000,
+  0x0000cae6, 0x0000cae6, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x0000cae6, 0x0000cae6, 0x0000cadc, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6,
+  0x0000cae6, 0x0000cae6, 0x0000cadc, 0x0000cae6, 0x0000cae6, 0x0000caea, 0x0000cad6, 0x0000cadc,
+  0x0000caca, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6,
+  0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6,
+  0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6,
+  0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6,
+  0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae8, 0x0000cae4,
+  0x0000cae4, 0x0000cadc, 0x0000cada, 0x0000cae6, 0x0000cae9, 0x0000cadc, 0x0000cae6, 0x0000cadc,
+  0x00020000, 0x00120000, 0x00220000, 0x00320000, 0x00420000, 0x00520000, 0x00620000, 0x00720000,
+  0x00830000, 0x009b0000, 0x00b20000, 0x00c20000, 0x00d20000, 0x00e20000, 0x00f20000, 0x01020000,
+  0x01120000, 0x01220000, 0x01320000, 0x01420000, 0x01530000, 0x016b0000, 0x01830000, 0x019b0000,
+  0x01b20000, 0x01c20000, 0x01d20000, 0x01e20000, 0x01f30000, 0x020b0000, 0x02220000, 0x02320000,
+  0x00020000, 0x00120000, 0x00220000, 0x00320000, 0x00420000, 0x00520000, 0x00620000, 0x00720000,
+  0x00820000, 0x00920000, 0x00a20000, 0x00b20000, 0x00c20000, 0x00d20000, 0x00e30000, 0x00fb0000,
+  0x01120000, 0x01220000, 0x01320000, 0x01420000, 0x01520000, 0x01620000, 0x01720000, 0x01820000,
+  0x01930000, 0x01ab0000, 0x01c20000, 0x01d20000, 0x01e20000, 0x01f20000, 0x02020000, 0x02120000,
+  0x00020000, 0x00120000, 0x00220000, 0x00320000, 0x00420000, 0x00520000, 0x00620000, 0x00720000,
+  0x00820000, 0x00920000, 0x00a20000, 0x00b20000, 0x00c30000, 0x00db0000, 0x00f30000, 0x010b0000,
+  0x01230000, 0x013b0000, 0x01530000, 0x016b0000, 0x01820000, 0x01920000, 0x01a20000, 0x01b20000,
+  0x01c20000, 0x01d20000, 0x01e20000, 0x01f20000, 0x02030000, 0x021b0000, 0x02320000, 0x02420000,
+  0x00020000, 0x00120000, 0x00220000, 0x00320000, 0x00430000, 0x005b0000, 0x00730000, 0x008b0000,
+  0x00a30000, 0x00bb0000, 0x00d20000, 0x00e20000, 0x00f20000, 0x01020000, 0x01120000, 0x01220000,
+  0x01320000, 0x01420000, 0x01520000, 0x01620000, 0x01720000, 0x01820000, 0x01920000, 0x01a20000,
+  0x01b30000, 0x01cb0000, 0x01e30000, 0x01fb0000, 0x02120000, 0x02220000, 0x02320000, 0x02420000,
+  0x00020000, 0x00120000, 0x00220000, 0x00320000, 0x00420000, 0x00520000, 0x00620000, 0x00720000,
+  0x00820000, 0x00920000, 0x00a20000, 0x00b20000, 0x00c20000, 0x00d20000, 0x00e20000, 0x00f20000,
+  0x01020000, 0x01120000, 0x01220000, 0x01320000, 0x01420000, 0x01520000, 0x01620000, 0x01720000,
+  0x01820000, 0x01920000, 0x00000000, 0x01a20000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00020000, 0x00120000, 0x00220000, 0x00320000, 0x00430000, 0x005b0000, 0x00730000, 0x008b0000,
+  0x00a30000, 0x00bb0000, 0x00d30000, 0x00eb0000, 0x01030000, 0x011b0000, 0x01330000, 0x014b0000,
+  0x01630000, 0x017b0000, 0x01930000, 0x01ab0000, 0x01c30000, 0x01db0000, 0x01f30000, 0x020b0000,
+  0x02220000, 0x02320000, 0x02420000, 0x02520000, 0x02620000, 0x02720000, 0x02830000, 0x029b0000,
+  0x00030000, 0x001b0000, 0x00330000, 0x004b0000, 0x00630000, 0x007b0000, 0x00930000, 0x00ab0000,
+  0x00c20000, 0x00d20000, 0x00e20000, 0x00f20000, 0x01020000, 0x01120000, 0x01220000, 0x01320000,
+  0x01430000, 0x015b0000, 0x01730000, 0x018b0000, 0x01a30000, 0x01bb0000, 0x01d30000, 0x01eb0000,
+  0x02030000, 0x021b0000, 0x02330000, 0x024b0000, 0x02630000, 0x027b0000, 0x02930000, 0x02ab0000,
+  0x00030000, 0x001b0000, 0x00330000, 0x004b0000, 0x00620000, 0x00720000, 0x00820000, 0x00920000,
+  0x00a30000, 0x00bb0000, 0x00d30000, 0x00eb0000, 0x01030000, 0x011b0000, 0x01330000, 0x014b0000,
+  0x01630000, 0x017b0000, 0x01920000, 0x01a20000, 0x01b20000, 0x01c20000, 0x01d20000, 0x01e20000,
+  0x01f20000, 0x02020000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00020000, 0x00120000, 0x00230000, 0x003b0000, 0x00530000, 0x006b0000, 0x00830000, 0x009b0000,
+  0x00b20000, 0x00c20000, 0x00d30000, 0x00eb0000, 0x01030000, 0x011b0000, 0x01330000, 0x014b0000,
+  0x01620000, 0x01720000, 0x01830000, 0x019b0000, 0x01b30000, 0x01cb0000, 0x00000000, 0x00000000,
+  0x01e20000, 0x01f20000, 0x02030000, 0x021b0000, 0x02330000, 0x024b0000, 0x00000000, 0x00000000,
+  0x00020000, 0x00120000, 0x00230000, 0x003b0000, 0x00530000, 0x006b0000, 0x00830000, 0x009b0000,
+  0x00b20000, 0x00c20000, 0x00d30000, 0x00eb0000, 0x01030000, 0x011b0000, 0x01330000, 0x014b0000,
+  0x01620000, 0x01720000, 0x01830000, 0x019b0000, 0x01b30000, 0x01cb0000, 0x01e30000, 0x01fb0000,
+  0x02120000, 0x02220000, 0x02330000, 0x024b0000, 0x02630000, 0x027b0000, 0x02930000, 0x02ab0000,
+  0x00020000, 0x00120000, 0x00230000, 0x003b0000, 0x00530000, 0x006b0000, 0x00000000, 0x00000000,
+  0x00820000, 0x00920000, 0x00a30000, 0x00bb0000, 0x00d30000, 0x00eb0000, 0x00000000, 0x00000000,
+  0x01020000, 0x01120000, 0x01230000, 0x013b0000, 0x01530000, 0x016b0000, 0x01830000, 0x019b0000,
+  0x00000000, 0x01b20000, 0x00000000, 0x01c30000, 0x00000000, 0x01db0000, 0x00000000, 0x01f30000,
+  0x00020000, 0x00120000, 0x00230000, 0x003b0000, 0x00530000, 0x006b0000, 0x00830000, 0x009b0000,
+  0x00b20000, 0x00c20000, 0x00d30000, 0x00eb0000, 0x01030000, 0x011b0000, 0x01330000, 0x014b0000,
+  0x01620000, 0x01720000, 0x01820000, 0x01920000, 0x01a20000, 0x01b20000, 0x01c20000, 0x01d20000,
+  0x01e20000, 0x01f20000, 0x02020000, 0x02120000, 0x02220000, 0x02320000, 0x00000000, 0x00000000,
+  0x00030000, 0x001b0000, 0x00340000, 0x00540000, 0x00740000, 0x00940000, 0x00b40000, 0x00d40000,
+  0x00f30000, 0x010b0000, 0x01240000, 0x01440000, 0x01640000, 0x01840000, 0x01a40000, 0x01c40000,
+  0x01e30000, 0x01fb0000, 0x02140000, 0x02340000, 0x02540000, 0x02740000, 0x02940000, 0x02b40000,
+  0x02d30000, 0x02eb0000, 0x03040000, 0x03240000, 0x03440000, 0x03640000, 0x03840000, 0x03a40000,
+  0x00030000, 0x001b0000, 0x00340000, 0x00540000, 0x00740000, 0x00940000, 0x00b40000, 0x00d40000,
+  0x00f30000, 0x010b0000, 0x01240000, 0x01440000, 0x01640000, 0x01840000, 0x01a40000, 0x01c40000,
+  0x01e20000, 0x01f20000, 0x02030000, 0x021a0000, 0x022b0000, 0x00000000, 0x02420000, 0x02530000,
+  0x026a0000, 0x027a0000, 0x028a0000, 0x029a0000, 0x02aa0000, 0x00000800, 0x02b90000, 0x00000800,
+  0x00000800, 0x00020800, 0x00130000, 0x002a0000, 0x003b0000, 0x00000000, 0x00520000, 0x00630000,
+  0x007a0000, 0x008a0000, 0x009a0000, 0x00aa0000, 0x00ba0000, 0x00ca0800, 0x00da0800, 0x00ea0800,
+  0x00fa0000, 0x010a0000, 0x011b0000, 0x01330000, 0x00000000, 0x00000000, 0x014a0000, 0x015b0000,
+  0x01720000, 0x01820000, 0x01920000, 0x01a20000, 0x00000000, 0x01b20800, 0x01c20800, 0x01d20800,
+  0x00020000, 0x00120000, 0x00230000, 0x003b0000, 0x00520000, 0x00620000, 0x00720000, 0x00830000,
+  0x009a0000, 0x00aa0000, 0x00ba0000, 0x00ca0000, 0x00da0000, 0x00ea0800, 0x00fa0800, 0x01090800,
+  0x00000000, 0x00000000, 0x01130000, 0x012a0000, 0x013b0000, 0x00000000, 0x01520000, 0x01630000,
+  0x017a0000, 0x018a0000, 0x019a0000, 0x01aa0000, 0x01ba0000, 0x01c90800, 0x00000800, 0x00000000,
+  0x00010b00, 0x00090b00, 0x00000b00, 0x00000b00, 0x00000b00, 0x00000b00, 0x00000b00, 0x00000b00,
+  0x00000b00, 0x00000b00, 0x00000b00, 0x00004900, 0x00000900, 0x00005900, 0x00004000, 0x00004100,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000b00, 0x00000b00, 0x00004b00, 0x00004b00, 0x00004b00, 0x00004b00, 0x00004b00, 0x00000600,
+  0x00000700, 0x00000700, 0x00000700, 0x00000700, 0x00000700, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000600, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000b00,
+  0x00004900, 0x00004900, 0x00004900, 0x00004900, 0x00004900, 0x00000000, 0x00000b00, 0x00000b00,
+  0x00000b00, 0x00000b00, 0x00004900, 0x00004900, 0x00004900, 0x00004900, 0x00004900, 0x00004900,
+  0x00000400, 0x00000000, 0x00000000, 0x00000000, 0x00000400, 0x00000400, 0x00000400, 0x00000400,
+  0x00000400, 0x00000400, 0x00000500, 0x00000500, 0x00000800, 0x00000800, 0x00000800, 0x00000000,
+  0x00000400, 0x00000400, 0x00000400, 0x00000400, 0x00000400, 0x00000400, 0x00000400, 0x00000400,
+  0x00000400, 0x00000400, 0x00000500, 0x00000500, 0x00000800, 0x00000800, 0x00000800, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000700, 0x00000700, 0x00000700, 0x00000700, 0x00000700, 0x00000700, 0x00000700, 0x00000700,
+  0x00000700, 0x00000700, 0x00000700, 0x00000700, 0x00000700, 0x00000700, 0x00000700, 0x00000700,
+  0x00000700, 0x00000700, 0x00000700, 0x00000700, 0x00000700, 0x00000700, 0x00000700, 0x00000700,
+  0x00000700, 0x00000700, 0x00000700, 0x00000700, 0x00000700, 0x00000700, 0x00000700, 0x00000700,
+  0x00000700, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x0000cae6, 0x0000cae6, 0x0000ca01, 0x0000ca01, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6,
+  0x0000ca01, 0x0000ca01, 0x0000ca01, 0x0000cae6, 0x0000cae6, 0x0000ca00, 0x0000ca00, 0x0000ca00,
+  0x0000ca00, 0x0000cae6, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca01, 0x0000ca01, 0x0000cae6,
+  0x0000cadc, 0x0000cae6, 0x0000ca01, 0x0000ca01, 0x0000cadc, 0x0000cadc, 0x0000cadc, 0x0000cadc,
+  0x0000cae6, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000800, 0x00000800, 0x00000000, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000000,
+  0x00000800, 0x00000800, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000800, 0x00000000, 0x00000800, 0x00000800,
+  0x00000800, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000000, 0x00000800, 0x00010000, 0x00000800,
+  0x00000000, 0x00000800, 0x00090000, 0x00120000, 0x00000000, 0x00000000, 0x00000700, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000800, 0x00000800, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000000, 0x00000000,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000800, 0x00000800, 0x00000800, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00020800, 0x00120800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00020800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00020800, 0x00120800, 0x00220800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00020800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00120800, 0x00000800, 0x00000800, 0x00220800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000500, 0x00000700, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00020800, 0x00000800, 0x00120800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00020800, 0x00000800, 0x00000800, 0x00120800, 0x00000800, 0x00000800, 0x00220800,
+  0x00000800, 0x00320800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00020800, 0x00000800, 0x00120800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00220800, 0x00320800, 0x00420800,
+  0x00520800, 0x00620800, 0x00000800, 0x00000800, 0x00720800, 0x00820800, 0x00000800, 0x00000800,
+  0x00920800, 0x00a20800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00020800, 0x00120800, 0x00000800, 0x00000800, 0x00220800, 0x00320800, 0x00000800, 0x00000800,
+  0x00420800, 0x00520800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00020800, 0x00120800, 0x00220800, 0x00320800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00020800, 0x00120800, 0x00220800, 0x00320800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00420800, 0x00520800, 0x00620800, 0x00720800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00010800, 0x00090800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000000, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000400, 0x00000400, 0x00000400, 0x00000400, 0x00000400, 0x00000400, 0x00000400, 0x00000400,
+  0x00000400, 0x00000400, 0x00000400, 0x00000400, 0x00000400, 0x00000400, 0x00000400, 0x00000400,
+  0x00000400, 0x00000400, 0x00000400, 0x00000400, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000000, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00020800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000000, 0x00000000, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000000, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000cae6,
+  0x0000cae6, 0x0000cae6, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000ca09,
+  0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6,
+  0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6,
+  0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6,
+  0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000000, 0x00000000,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000000, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000b00, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000000, 0x00000000, 0x00000000,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x0000cada, 0x0000cae4, 0x0000cae8, 0x0000cade, 0x000080e0, 0x000080e0,
+  0x00000800, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000800, 0x00000800,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000800, 0x00000800, 0x00000800,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00020000, 0x00000000, 0x00120000, 0x00000000,
+  0x00220000, 0x00000000, 0x00320000, 0x00000000, 0x00420000, 0x00000000, 0x00520000, 0x00000000,
+  0x00620000, 0x00000000, 0x00720000, 0x00000000, 0x00820000, 0x00000000, 0x00920000, 0x00000000,
+  0x00020000, 0x00000000, 0x00120000, 0x00000000, 0x00000000, 0x00220000, 0x00000000, 0x00320000,
+  0x00000000, 0x00420000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00520000, 0x00620000, 0x00000000, 0x00720000, 0x00820000, 0x00000000, 0x00920000, 0x00a20000,
+  0x00000000, 0x00b20000, 0x00c20000, 0x00000000, 0x00d20000, 0x00e20000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00020000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x0000ca08, 0x0000ca08, 0x00000800, 0x00000800, 0x00000000, 0x00120000, 0x00000000,
+  0x00000800, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00020000, 0x00000000, 0x00120000, 0x00000000,
+  0x00220000, 0x00000000, 0x00320000, 0x00000000, 0x00420000, 0x00000000, 0x00520000, 0x00000000,
+  0x00620000, 0x00000000, 0x00720000, 0x00000000, 0x00820000, 0x00000000, 0x00920000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00020000, 0x00000000, 0x00000000, 0x00120000,
+  0x00220000, 0x00320000, 0x00420000, 0x00000800, 0x00000000, 0x00000000, 0x00520000, 0x00000000,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000800,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000800, 0x00000800, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000800, 0x00000800, 0x00000800, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000800,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000800, 0x00000800, 0x00000800,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000cae6,
+  0x0000ca00, 0x0000ca00, 0x0000ca00, 0x00000800, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6,
+  0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x00000800, 0x00000800,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000cae6, 0x0000cae6,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x0000cae6, 0x0000cae6, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000800, 0x00000800, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000800, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x0000ca00, 0x00000000, 0x00000000, 0x00000000, 0x0000ca09, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x0000ca00, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00008000, 0x00008000, 0x0000ca00, 0x0000ca00, 0x00008000,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x0000ca09, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000700, 0x00000700, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000,
+  0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000, 0x00001000,
+  0x00001000, 0x00001000, 0x00002000, 0x00000000, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00008000, 0x00008000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00008000, 0x00008000, 0x00008000, 0x00008000,
+  0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000,
+  0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x0000ca09, 0x0000ca00, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6,
+  0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6,
+  0x0000cae6, 0x0000cae6, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000ca00,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000ca00, 0x0000ca00,
+  0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000cadc, 0x0000cadc, 0x0000cadc, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000ca00,
+  0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00,
+  0x0000ca00, 0x0000ca00, 0x00008000, 0x00008009, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x0000ca07, 0x00008000, 0x00008000, 0x0000ca00, 0x0000ca00,
+  0x0000ca00, 0x0000ca00, 0x00008000, 0x00008000, 0x0000ca00, 0x0000ca00, 0x00008000, 0x00008000,
+  0x00008009, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000ca00, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x00008000,
+  0x00008000, 0x0000ca00, 0x0000ca00, 0x00008000, 0x00008000, 0x0000ca00, 0x0000ca00, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x0000ca00, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000ca00, 0x00008000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00008000, 0x0000ca00, 0x00008000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x0000cae6, 0x00000000, 0x0000cae6, 0x0000cae6, 0x0000cadc, 0x00000000, 0x00000000, 0x0000cae6,
+  0x0000cae6, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000cae6, 0x0000cae6,
+  0x00000000, 0x0000cae6, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00008000, 0x0000ca00, 0x0000ca00, 0x00008000, 0x00008000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00008000, 0x0000ca09, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000800, 0x00000800, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00008000, 0x00008000, 0x0000ca00, 0x00008000, 0x00008000,
+  0x0000ca00, 0x00008000, 0x00008000, 0x00000000, 0x00008000, 0x0000ca09, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00010000, 0x00090000, 0x00110000, 0x00190000, 0x00210000, 0x00290000, 0x00310000, 0x00390000,
+  0x00410000, 0x00490000, 0x00510000, 0x00590000, 0x00610000, 0x00690000, 0x00710000, 0x00790000,
+  0x00810000, 0x00890000, 0x00910000, 0x00990000, 0x00a10000, 0x00a90000, 0x00b10000, 0x00b90000,
+  0x00c10000, 0x00c90000, 0x00d10000, 0x00d90000, 0x00e10000, 0x00e90000, 0x00f10000, 0x00f90000,
+  0x00010000, 0x00090000, 0x00110000, 0x00190000, 0x00210000, 0x00290000, 0x00310000, 0x00390000,
+  0x00410000, 0x00490000, 0x00510000, 0x00590000, 0x00610000, 0x00690000, 0x00000000, 0x00000000,
+  0x00710000, 0x00000000, 0x00790000, 0x00000000, 0x00000000, 0x00810000, 0x00890000, 0x00910000,
+  0x00990000, 0x00a10000, 0x00a90000, 0x00b10000, 0x00b90000, 0x00c10000, 0x00c90000, 0x00000000,
+  0x00010000, 0x00000000, 0x00090000, 0x00000000, 0x00000000, 0x00110000, 0x00190000, 0x00000000,
+  0x00000000, 0x00000000, 0x00210000, 0x00290000, 0x00310000, 0x00390000, 0x00410000, 0x00490000,
+  0x00510000, 0x00590000, 0x00610000, 0x00690000, 0x00710000, 0x00790000, 0x00810000, 0x00890000,
+  0x00910000, 0x00990000, 0x00a10000, 0x00a90000, 0x00b10000, 0x00b90000, 0x00c10000, 0x00c90000,
+  0x00010000, 0x00090000, 0x00110000, 0x00190000, 0x00210000, 0x00290000, 0x00310000, 0x00390000,
+  0x00410000, 0x00490000, 0x00510000, 0x00590000, 0x00610000, 0x00690000, 0x00000000, 0x00000000,
+  0x00710000, 0x00790000, 0x00810000, 0x00890000, 0x00910000, 0x00990000, 0x00a10000, 0x00a90000,
+  0x00b10000, 0x00b90000, 0x00c10000, 0x00c90000, 0x00d10000, 0x00d90000, 0x00e10000, 0x00e90000,
+  0x00010000, 0x00090000, 0x00110000, 0x00190000, 0x00210000, 0x00290000, 0x00310000, 0x00390000,
+  0x00410000, 0x00490000, 0x00510000, 0x00590000, 0x00610000, 0x00690000, 0x00710000, 0x00790000,
+  0x00810000, 0x00890000, 0x00910000, 0x00990000, 0x00a10000, 0x00a90000, 0x00b10000, 0x00b90000,
+  0x00c10000, 0x00c90000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00020100, 0x0000ca1a, 0x00120100,
+  0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100,
+  0x00000100, 0x00000500, 0x00020100, 0x00120100, 0x00230100, 0x003b0100, 0x00520100, 0x00620100,
+  0x00720100, 0x00820100, 0x00920100, 0x00a20100, 0x00b20100, 0x00c20100, 0x00d20100, 0x00000000,
+  0x00e20100, 0x00f20100, 0x01020100, 0x01120100, 0x01220100, 0x00000000, 0x01320100, 0x00000000,
+  0x00020100, 0x00120100, 0x00000000, 0x00220100, 0x00320100, 0x00000000, 0x00420100, 0x00520100,
+  0x00620100, 0x00720100, 0x00820100, 0x00920100, 0x00a20100, 0x00b20100, 0x00c20100, 0x00000100,
+  0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200,
+  0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200,
+  0x00000200, 0x00000200, 0x00000200, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200,
+  0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200,
+  0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200,
+  0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200,
+  0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200,
+  0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200,
+  0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200,
+  0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200,
+  0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200,
+  0x00000000, 0x00000000, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200,
+  0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200,
+  0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000800,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200,
+  0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000800, 0x00000800, 0x00000800,
+  0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00,
+  0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cadc,
+  0x0000cadc, 0x0000cadc, 0x0000cadc, 0x0000cadc, 0x0000cadc, 0x0000cadc, 0x0000cae6, 0x0000cae6,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000600, 0x00000800, 0x00000600, 0x00000000, 0x00000800, 0x00000600, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000700,
+  0x00000800, 0x00000800, 0x00000500, 0x00000500, 0x00000800, 0x00000800, 0x00000800, 0x00000000,
+  0x00000800, 0x00000700, 0x00000700, 0x00000800, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000000, 0x00000200, 0x00000200,
+  0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200,
+  0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200,
+  0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200,
+  0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200,
+  0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000000, 0x00000000, 0x00004900,
+  0x00000000, 0x00000800, 0x00000800, 0x00000700, 0x00000700, 0x00000700, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000500, 0x00000600, 0x00000500, 0x00000600, 0x00000600,
+  0x00000400, 0x00000400, 0x00000400, 0x00000400, 0x00000400, 0x00000400, 0x00000400, 0x00000400,
+  0x00000400, 0x00000400, 0x00000600, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000700, 0x00000700, 0x00000800, 0x00000800, 0x00000800, 0x00000700, 0x00000700, 0x00000000,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00004800, 0x00004800, 0x00004800, 0x00000800, 0x00000800, 0x00000000, 0x00000000,
+  0x00000000, 0x00000800, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000000, 0x00000000, 0x00000000,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000cadc, 0x00000000, 0x00000000,
+  0x0000cadc, 0x00000400, 0x00000400, 0x00000400, 0x00000400, 0x00000400, 0x00000400, 0x00000400,
+  0x00000400, 0x00000400, 0x00000400, 0x00000400, 0x00000400, 0x00000400, 0x00000400, 0x00000400,
+  0x00000400, 0x00000400, 0x00000400, 0x00000400, 0x00000400, 0x00000400, 0x00000400, 0x00000400,
+  0x00000400, 0x00000400, 0x00000400, 0x00000400, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000cae6, 0x0000cae6,
+  0x0000cae6, 0x0000cae6, 0x0000cae6, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000000, 0x00000000,
+  0x00000100, 0x00000000, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100,
+  0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100,
+  0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100,
+  0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100,
+  0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100,
+  0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000000, 0x00000100,
+  0x00000100, 0x00000000, 0x00000000, 0x00000000, 0x00000100, 0x00000000, 0x00000000, 0x00000100,
+  0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100,
+  0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100,
+  0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000000, 0x00000100,
+  0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100,
+  0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100,
+  0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100,
+  0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100,
+  0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100,
+  0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100,
+  0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100,
+  0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100,
+  0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000100,
+  0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100,
+  0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100,
+  0x00000100, 0x00000100, 0x00000100, 0x00000000, 0x00000100, 0x00000100, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100,
+  0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100,
+  0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100,
+  0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100,
+  0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000000, 0x00000000, 0x00000000, 0x00000800,
+  0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100,
+  0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100,
+  0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100,
+  0x00000100, 0x00000100, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000100,
+  0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100,
+  0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100,
+  0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000100, 0x00000100, 0x00000100, 0x00000100,
+  0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100,
+  0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100,
+  0x00000000, 0x00000000, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100,
+  0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100,
+  0x00000100, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x00000000, 0x0000ca00, 0x0000ca00, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000ca00, 0x0000cadc, 0x0000ca00, 0x0000cae6,
+  0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000000, 0x00000100, 0x00000100, 0x00000100,
+  0x00000000, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100,
+  0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100,
+  0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100,
+  0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000000, 0x00000000,
+  0x0000cae6, 0x0000ca01, 0x0000cadc, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000ca09,
+  0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100,
+  0x00000100, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100,
+  0x00000100, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00001100, 0x00001100, 0x00001100, 0x00001100, 0x00001100, 0x00003100, 0x00000100, 0x00003100,
+  0x00000100, 0x00003100, 0x00003100, 0x00000100, 0x00000100, 0x00002100, 0x00003100, 0x00003100,
+  0x00003100, 0x00003100, 0x00003100, 0x00001100, 0x00001100, 0x00001100, 0x00001100, 0x00002100,
+  0x00001100, 0x00001100, 0x00001100, 0x00001100, 0x00001100, 0x00003100, 0x00001100, 0x00001100,
+  0x00001100, 0x00003100, 0x00000100, 0x00000100, 0x00003100, 0x0000cae6, 0x0000cadc, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00001100, 0x00001100, 0x00001100, 0x00001100, 0x00003100,
+  0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100,
+  0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100,
+  0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000000, 0x00000000,
+  0x00000000, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100,
+  0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100,
+  0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000000, 0x00000000,
+  0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100,
+  0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100,
+  0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100,
+  0x00000100, 0x00000100, 0x00000100, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100,
+  0x00001100, 0x00003100, 0x00001100, 0x00003100, 0x00003100, 0x00003100, 0x00001100, 0x00001100,
+  0x00001100, 0x00003100, 0x00001100, 0x00001100, 0x00003100, 0x00001100, 0x00003100, 0x00003100,
+  0x00001100, 0x00003100, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00003100, 0x00003100, 0x00003100, 0x00003100, 0x00001100, 0x00001100, 0x00000100,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100,
+  0x00000100, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100,
+  0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100,
+  0x00000100, 0x00000100, 0x00000100, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100,
+  0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100,
+  0x00000100, 0x00000100, 0x00000100, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100,
+  0x00002200, 0x00001200, 0x00001200, 0x00001200, 0x00001200, 0x00001200, 0x00001200, 0x00001200,
+  0x00001200, 0x00001200, 0x00001200, 0x00001200, 0x00001200, 0x00001200, 0x00001200, 0x00001200,
+  0x00001200, 0x00001200, 0x00001200, 0x00001200, 0x00001200, 0x00001200, 0x00001200, 0x00001200,
+  0x00001200, 0x00001200, 0x00001200, 0x00001200, 0x00001200, 0x00001200, 0x00001200, 0x00001200,
+  0x00001200, 0x00001200, 0x00003200, 0x00001200, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000300, 0x00000300, 0x00000300, 0x00000300, 0x00000300, 0x00000300, 0x00000300, 0x00000300,
+  0x00000300, 0x00000300, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000300, 0x00000300, 0x00000300, 0x00000300, 0x00000300, 0x00000300, 0x00000300, 0x00000300,
+  0x00000300, 0x00000300, 0x00000300, 0x00000300, 0x00000300, 0x00000300, 0x00000300, 0x00000300,
+  0x00000300, 0x00000300, 0x00000300, 0x00000300, 0x00000300, 0x00000300, 0x00000300, 0x00000300,
+  0x00000300, 0x00000300, 0x00000300, 0x00000300, 0x00000300, 0x00000300, 0x00000300, 0x00000000,
+  0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100,
+  0x00000100, 0x00000100, 0x00000000, 0x0000cae6, 0x0000cae6, 0x00000100, 0x00000000, 0x00000000,
+  0x00000100, 0x00000100, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000cadc, 0x0000cadc, 0x0000cadc,
+  0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00001200, 0x00001200, 0x00001200, 0x00003200, 0x00001200, 0x00001200, 0x00001200, 0x00001200,
+  0x00001200, 0x00001200, 0x00001200, 0x00001200, 0x00001200, 0x00001200, 0x00001200, 0x00001200,
+  0x00001200, 0x00001200, 0x00001200, 0x00001200, 0x00001200, 0x00000200, 0x0000cadc, 0x0000cadc,
+  0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cadc, 0x0000cae6, 0x0000cadc, 0x0000cadc, 0x0000cadc,
+  0x0000cadc, 0x00001200, 0x00001200, 0x00001200, 0x00003200, 0x00000200, 0x00000200, 0x00000200,
+  0x00000200, 0x00000200, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00001100, 0x00001100, 0x00001100, 0x00001100, 0x00003100, 0x00003100, 0x00001100, 0x00001100,
+  0x00001100, 0x00001100, 0x00001100, 0x00001100, 0x00001100, 0x00001100, 0x00001100, 0x00001100,
+  0x00001100, 0x00001100, 0x0000cae6, 0x0000cadc, 0x0000cae6, 0x0000cadc, 0x00000100, 0x00000100,
+  0x00000100, 0x00000100, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00001100, 0x00000100, 0x00001100, 0x00001100, 0x00003100, 0x00003100, 0x00003100, 0x00000100,
+  0x00001100, 0x00003100, 0x00003100, 0x00001100, 0x00001100, 0x00003100, 0x00001100, 0x00001100,
+  0x00000100, 0x00001100, 0x00003100, 0x00003100, 0x00001100, 0x00000100, 0x00000100, 0x00000100,
+  0x00000100, 0x00003100, 0x00001100, 0x00002100, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100,
+  0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100,
+  0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00008000, 0x0000ca00, 0x00008000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00,
+  0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca09, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x0000ca09, 0x00000000, 0x00000000, 0x0000ca00, 0x0000ca00, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000ca09,
+  0x0000ca00, 0x0000ca00, 0x00008000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00020000, 0x00000000, 0x00120000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00020000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00008000, 0x00008000, 0x00008000, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x00008000,
+  0x00008000, 0x0000ca09, 0x0000ca07, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x0000ca00, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x0000cae6, 0x0000cae6, 0x0000cae6, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000ca00,
+  0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x00008000, 0x0000ca00, 0x0002ca00, 0x0012ca00,
+  0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca09, 0x0000ca09, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00008000, 0x00008000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x0000ca07, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00008000, 0x00008000, 0x00008000, 0x0000ca00, 0x0000ca00,
+  0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x00008000,
+  0x00008009, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x0000ca00, 0x0000ca07, 0x0000ca00, 0x0000ca00, 0x00000000, 0x00008000, 0x0000ca00,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00008000, 0x00008000, 0x00008000, 0x0000ca00,
+  0x0000ca00, 0x0000ca00, 0x00008000, 0x00008000, 0x0000ca00, 0x00008009, 0x0000ca07, 0x0000ca00,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000ca00, 0x00000000,
+  0x00000000, 0x0000ca00, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000ca00,
+  0x00008000, 0x00008000, 0x00008000, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00,
+  0x0000ca00, 0x0000ca07, 0x0000ca09, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x0000ca07, 0x0000ca07, 0x00000000, 0x00008000, 0x00008000,
+  0x0000ca00, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00000000, 0x00000000, 0x00008000,
+  0x00008000, 0x00000000, 0x00000000, 0x00028000, 0x00128000, 0x00008009, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00008000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00008000, 0x00008000, 0x00000000, 0x00000000, 0x0000cae6, 0x0000cae6,
+  0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x00000000, 0x00000000, 0x00000000,
+  0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00008000, 0x00008000, 0x00008000,
+  0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00,
+  0x00008000, 0x00008000, 0x0000ca09, 0x0000ca00, 0x0000ca00, 0x00008000, 0x0000ca07, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000cae6, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00008000, 0x00008000, 0x00008000, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00,
+  0x0000ca00, 0x00008000, 0x0000ca00, 0x00028000, 0x00128000, 0x00008000, 0x00228000, 0x0000ca00,
+  0x0000ca00, 0x00008000, 0x0000ca09, 0x0000ca07, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00008000,
+  0x00008000, 0x00008000, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x00000000, 0x00000000,
+  0x00008000, 0x00008000, 0x00028000, 0x00128000, 0x0000ca00, 0x0000ca00, 0x00008000, 0x0000ca09,
+  0x0000ca07, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000ca00, 0x0000ca00, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00008000, 0x00008000, 0x00008000, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00,
+  0x0000ca00, 0x0000ca00, 0x0000ca00, 0x00008000, 0x00008000, 0x0000ca00, 0x00008000, 0x0000ca09,
+  0x0000ca00, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x0000ca00, 0x00008000, 0x0000ca00, 0x00008000, 0x00008000,
+  0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x00008009, 0x0000ca07,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000ca00, 0x0000ca00, 0x0000ca00,
+  0x00008000, 0x00008000, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x00008000, 0x0000ca00,
+  0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca09, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00008000, 0x00008000, 0x00008000, 0x0000ca00,
+  0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00,
+  0x00008000, 0x0000ca09, 0x0000ca07, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00000000, 0x00008000,
+  0x00028000, 0x00000000, 0x00000000, 0x0000ca00, 0x0000ca00, 0x00008009, 0x0000ca09, 0x00000000,
+  0x00008000, 0x00000000, 0x00008000, 0x0000ca07, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00008000, 0x00008000, 0x00008000, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00,
+  0x00000000, 0x00000000, 0x0000ca00, 0x0000ca00, 0x00008000, 0x00008000, 0x00008000, 0x00008000,
+  0x0000ca09, 0x00000000, 0x00000000, 0x00000000, 0x00008000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000c000,
+  0x0000c000, 0x0000ca00, 0x0000ca00, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x0000ca00, 0x0000ca09, 0x0000ca00, 0x0000ca00, 0x0000ca00,
+  0x0000ca00, 0x00008000, 0x00000000, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000ca09,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x00008000,
+  0x00008000, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00,
+  0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x00008000,
+  0x0000ca00, 0x0000ca09, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00008000,
+  0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x00000000,
+  0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x00008000, 0x0000c009,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00,
+  0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00,
+  0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00,
+  0x00000000, 0x00008000, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00,
+  0x0000ca00, 0x00008000, 0x0000ca00, 0x0000ca00, 0x00008000, 0x0000ca00, 0x0000ca00, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x00000000,
+  0x00000000, 0x00000000, 0x0000ca00, 0x00000000, 0x0000ca00, 0x0000ca00, 0x00000000, 0x0000ca00,
+  0x0000ca00, 0x0000ca00, 0x0000ca07, 0x0000ca00, 0x0000ca09, 0x0000ca09, 0x00000000, 0x0000ca00,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00000000,
+  0x0000ca00, 0x0000ca00, 0x00000000, 0x00008000, 0x00008000, 0x0000ca00, 0x00008000, 0x0000ca09,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x0000ca00, 0x0000ca00, 0x00008000, 0x00008000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x0000ca00, 0x0000ca00, 0x00000000, 0x00008000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00008000, 0x00008000, 0x0000ca00, 0x0000ca00,
+  0x0000ca00, 0x0000ca00, 0x0000ca00, 0x00000000, 0x00000000, 0x00000000, 0x00008000, 0x00008000,
+  0x0000ca00, 0x00008009, 0x0000ca09, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000700, 0x00000700, 0x00000700,
+  0x00000700, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00004000, 0x00004000, 0x00004000, 0x00004000, 0x00004000, 0x00004000, 0x00004000, 0x00004000,
+  0x00004000, 0x00004000, 0x00004000, 0x00004000, 0x00004000, 0x00004000, 0x00004000, 0x00004000,
+  0x0000ca00, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000ca00,
+  0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00,
+  0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x0000ca01, 0x0000ca01, 0x0000ca01, 0x0000ca01, 0x0000ca01, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000ca00,
+  0x00000000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000,
+  0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000,
+  0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000,
+  0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000,
+  0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000,
+  0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000,
+  0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000ca00,
+  0x0000ca00, 0x0000ca00, 0x0000ca00, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000800, 0x00000000, 0x0000ca00, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00008006, 0x00008006, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000ca00, 0x0000ca01, 0x00000000,
+  0x00004900, 0x00004900, 0x00004900, 0x00004900, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00,
+  0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00,
+  0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00,
+  0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00,
+  0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00,
+  0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x00000000, 0x00000000,
+  0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00,
+  0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00,
+  0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00020000, 0x00120000,
+  0x00030000, 0x001b0000, 0x00330000, 0x004b0000, 0x00630000, 0x000080d8, 0x000080d8, 0x0000ca01,
+  0x0000ca01, 0x0000ca01, 0x00000000, 0x00000000, 0x00000000, 0x000080e2, 0x000080d8, 0x000080d8,
+  0x000080d8, 0x000080d8, 0x000080d8, 0x00004900, 0x00004900, 0x00004900, 0x00004900, 0x00004900,
+  0x00004900, 0x00004900, 0x00004900, 0x0000cadc, 0x0000cadc, 0x0000cadc, 0x0000cadc, 0x0000cadc,
+  0x0000cadc, 0x0000cadc, 0x0000cadc, 0x00000000, 0x00000000, 0x0000cae6, 0x0000cae6, 0x0000cae6,
+  0x0000cae6, 0x0000cae6, 0x0000cadc, 0x0000cadc, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00020000, 0x00120000, 0x00230000, 0x003b0000, 0x00530000,
+  0x00030000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000800, 0x00000800, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000800, 0x00000800, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x00000800, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000800, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000800, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000800,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000800, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000800, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000400, 0x00000400,
+  0x00000400, 0x00000400, 0x00000400, 0x00000400, 0x00000400, 0x00000400, 0x00000400, 0x00000400,
+  0x00000400, 0x00000400, 0x00000400, 0x00000400, 0x00000400, 0x00000400, 0x00000400, 0x00000400,
+  0x00000400, 0x00000400, 0x00000400, 0x00000400, 0x00000400, 0x00000400, 0x00000400, 0x00000400,
+  0x00000400, 0x00000400, 0x00000400, 0x00000400, 0x00000400, 0x00000400, 0x00000400, 0x00000400,
+  0x00000400, 0x00000400, 0x00000400, 0x00000400, 0x00000400, 0x00000400, 0x00000400, 0x00000400,
+  0x00000400, 0x00000400, 0x00000400, 0x00000400, 0x00000400, 0x00000400, 0x00000400, 0x00000400,
+  0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00,
+  0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00,
+  0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00,
+  0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00,
+  0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000ca00, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000ca00, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00,
+  0x00000000, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00,
+  0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00, 0x0000ca00,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x00000000,
+  0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6,
+  0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6,
+  0x0000cae6, 0x00000000, 0x00000000, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6,
+  0x0000cae6, 0x0000cae6, 0x00000000, 0x0000cae6, 0x0000cae6, 0x00000000, 0x0000cae6, 0x0000cae6,
+  0x0000cae6, 0x0000cae6, 0x0000cae6, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000cae6,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000cae6, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000700,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000cae8, 0x0000cae8, 0x0000cadc, 0x0000cae6,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000000, 0x00000000, 0x00000100,
+  0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100,
+  0x0000cadc, 0x0000cadc, 0x0000cadc, 0x0000cadc, 0x0000cadc, 0x0000cadc, 0x0000cadc, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00001100, 0x00001100, 0x00001100, 0x00001100, 0x00001100, 0x00001100, 0x00001100, 0x00001100,
+  0x00001100, 0x00001100, 0x00001100, 0x00001100, 0x00001100, 0x00001100, 0x00001100, 0x00001100,
+  0x00001100, 0x00001100, 0x00001100, 0x00001100, 0x00001100, 0x00001100, 0x00001100, 0x00001100,
+  0x00001100, 0x00001100, 0x00001100, 0x00001100, 0x00001100, 0x00001100, 0x00001100, 0x00001100,
+  0x00001100, 0x00001100, 0x00001100, 0x00001100, 0x0000cae6, 0x0000cae6, 0x0000cae6, 0x0000cae6,
+  0x0000cae6, 0x0000cae6, 0x0000ca07, 0x00004100, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100, 0x00000100,
+  0x00000100, 0x00000100, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000100, 0x00000100,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200,
+  0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200,
+  0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200,
+  0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200,
+  0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200,
+  0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200,
+  0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200,
+  0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200,
+  0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200,
+  0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200,
+  0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200,
+  0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000000, 0x00000000,
+  0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000000, 0x00000200, 0x00000200, 0x00000200,
+  0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200,
+  0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200,
+  0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200,
+  0x00000000, 0x00000200, 0x00000200, 0x00000000, 0x00000200, 0x00000000, 0x00000000, 0x00000200,
+  0x00000000, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200,
+  0x00000200, 0x00000200, 0x00000200, 0x00000000, 0x00000200, 0x00000200, 0x00000200, 0x00000200,
+  0x00000000, 0x00000200, 0x00000000, 0x00000200, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000200, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000200,
+  0x00000000, 0x00000200, 0x00000000, 0x00000200, 0x00000000, 0x00000200, 0x00000200, 0x00000200,
+  0x00000000, 0x00000200, 0x00000200, 0x00000000, 0x00000200, 0x00000000, 0x00000000, 0x00000200,
+  0x00000000, 0x00000200, 0x00000000, 0x00000200, 0x00000000, 0x00000200, 0x00000000, 0x00000200,
+  0x00000000, 0x00000200, 0x00000200, 0x00000000, 0x00000200, 0x00000000, 0x00000000, 0x00000200,
+  0x00000200, 0x00000200, 0x00000200, 0x00000000, 0x00000200, 0x00000200, 0x00000200, 0x00000200,
+  0x00000200, 0x00000200, 0x00000200, 0x00000000, 0x00000200, 0x00000200, 0x00000200, 0x00000200,
+  0x00000000, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000000, 0x00000200, 0x00000000,
+  0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200,
+  0x00000200, 0x00000200, 0x00000000, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200,
+  0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200,
+  0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000200, 0x00000200, 0x00000200, 0x00000000, 0x00000200, 0x00000200, 0x00000200,
+  0x00000200, 0x00000200, 0x00000000, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200,
+  0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000200,
+  0x00000200, 0x00000200, 0x00000200, 0x00000200, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000800, 0x00000800, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000000,
+  0x00000000, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000000, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000000, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000400, 0x00000400, 0x00000400, 0x00000400, 0x00000400, 0x00000400, 0x00000400, 0x00000400,
+  0x00000400, 0x00000400, 0x00000400, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000800, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000800, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000000, 0x00000000,
+  0x00000800, 0x00000800, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000000, 0x00000000,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000000, 0x00000000, 0x00000000,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000000, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000000, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800, 0x00000800,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000400, 0x00000400, 0x00000400, 0x00000400, 0x00000400, 0x00000400, 0x00000400, 0x00000400,
+  0x00000400, 0x00000400, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00010000, 0x00090000, 0x00110000, 0x00190000, 0x00210000, 0x00290000, 0x00310000, 0x00390000,
+  0x00410000, 0x00490000, 0x00510000, 0x00590000, 0x00610000, 0x00690000, 0x00710000, 0x00790000,
+  0x00810000, 0x00890000, 0x00910000, 0x00990000, 0x00a10000, 0x00a90000, 0x00b10000, 0x00b90000,
+  0x00c10000, 0x00c90000, 0x00d10000, 0x00d90000, 0x00e10000, 0x00e90000, 0x00000000, 0x00000000,
+};
+
+static const uint32_t url__unicode_property_trie_high[][2] = {
+  {0x032400, 0x00000000}, {0x0e0001, 0x00004900}, {0x0e0002, 0x00000000}, {0x0e0020, 0x00004900},
+  {0x0e0080, 0x00000000}, {0x0e0100, 0x0000ca00}, {0x0e01f0, 0x00000000},
+};
+
+// Full canonical decompositions, excluding Hangul syllables.
+static const uint32_t url__unicode_decompositions[] = {
+  0x000041, 0x000300, 0x000041, 0x000301, 0x000041, 0x000302, 0x000041, 0x000303,
+  0x000041, 0x000308, 0x000041, 0x00030a, 0x000043, 0x000327, 0x000045, 0x000300,
+  0x000045, 0x000301, 0x000045, 0x000302, 0x000045, 0x000308, 0x000049, 0x000300,
+  0x000049, 0x000301, 0x000049, 0x000302, 0x000049, 0x000308, 0x00004e, 0x000303,
+  0x00004f, 0x000300, 0x00004f, 0x000301, 0x00004f, 0x000302, 0x00004f, 0x000303,
+  0x00004f, 0x000308, 0x000055, 0x000300, 0x000055, 0x000301, 0x000055, 0x000302,
+  0x000055, 0x000308, 0x000059, 0x000301, 0x000061, 0x000300, 0x000061, 0x000301,
+  0x000061, 0x000302, 0x000061, 0x000303, 0x000061, 0x000308, 0x000061, 0x00030a,
+  0x000063, 0x000327, 0x000065, 0x000300, 0x000065, 0x000301, 0x000065, 0x000302,
+  0x000065, 0x000308, 0x000069, 0x000300, 0x000069, 0x000301, 0x000069, 0x000302,
+  0x000069, 0x000308, 0x00006e, 0x000303, 0x00006f, 0x000300, 0x00006f, 0x000301,
+  0x00006f, 0x000302, 0x00006f, 0x000303, 0x00006f, 0x000308, 0x000075, 0x000300,
+  0x000075, 0x000301, 0x000075, 0x000302, 0x000075, 0x000308, 0x000079, 0x000301,
+  0x000079, 0x000308, 0x000041, 0x000304, 0x000061, 0x000304, 0x000041, 0x000306,
+  0x000061, 0x000306, 0x000041, 0x000328, 0x000061, 0x000328, 0x000043, 0x000301,
+  0x000063, 0x000301, 0x000043, 0x000302, 0x000063, 0x000302, 0x000043, 0x000307,
+  0x000063, 0x000307, 0x000043, 0x00030c, 0x000063, 0x00030c, 0x000044, 0x00030c,
+  0x000064, 0x00030c, 0x000045, 0x000304, 0x000065, 0x000304, 0x000045, 0x000306,
+  0x000065, 0x000306, 0x000045, 0x000307, 0x000065, 0x000307, 0x000045, 0x000328,
+  0x000065, 0x000328, 0x000045, 0x00030c, 0x000065, 0x00030c, 0x000047, 0x000302,
+  0x000067, 0x000302, 0x000047, 0x000306, 0x000067, 0x000306, 0x000047, 0x000307,
+  0x000067, 0x000307, 0x000047, 0x000327, 0x000067, 0x000327, 0x000048, 0x000302,
+  0x000068, 0x000302, 0x000049, 0x000303, 0x000069, 0x000303, 0x000049, 0x000304,
+  0x000069, 0x000304, 0x000049, 0x000306, 0x000069, 0x000306, 0x000049, 0x000328,
+  0x000069, 0x000328, 0x000049, 0x000307, 0x00004a, 0x000302, 0x00006a, 0x000302,
+  0x00004b, 0x000327, 0x00006b, 0x000327, 0x00004c, 0x000301, 0x00006c, 0x000301,
+  0x00004c, 0x000327, 0x00006c, 0x000327, 0x00004c, 0x00030c, 0x00006c, 0x00030c,
+  0x00004e, 0x000301, 0x00006e, 0x000301, 0x00004e, 0x000327, 0x00006e, 0x000327,
+  0x00004e, 0x00030c, 0x00006e, 0x00030c, 0x00004f, 0x000304, 0x00006f, 0x000304,
+  0x00004f, 0x000306, 0x00006f, 0x000306, 0x00004f, 0x00030b, 0x00006f, 0x00030b,
+  0x000052, 0x000301, 0x000072, 0x000301, 0x000052, 0x000327, 0x000072, 0x000327,
+  0x000052, 0x00030c, 0x000072, 0x00030c, 0x000053, 0x000301, 0x000073, 0x000301,
+  0x000053, 0x000302, 0x000073, 0x000302, 0x000053, 0x000327, 0x000073, 0x000327,
+  0x000053, 0x00030c, 0x000073, 0x00030c, 0x000054, 0x000327, 0x000074, 0x000327,
+  0x000054, 0x00030c, 0x000074, 0x00030c, 0x000055, 0x000303, 0x000075, 0x000303,
+  0x000055, 0x000304, 0x000075, 0x000304, 0x000055, 0x000306, 0x000075, 0x000306,
+  0x000055, 0x00030a, 0x000075, 0x00030a, 0x000055, 0x00030b, 0x000075, 0x00030b,
+  0x000055, 0x000328, 0x000075, 0x000328, 0x000057, 0x000302, 0x000077, 0x000302,
+  0x000059, 0x000302, 0x000079, 0x000302, 0x000059, 0x000308, 0x00005a, 0x000301,
+  0x00007a, 0x000301, 0x00005a, 0x000307, 0x00007a, 0x000307, 0x00005a, 0x00030c,
+  0x00007a, 0x00030c, 0x00004f, 0x00031b, 0x00006f, 0x00031b, 0x000055, 0x00031b,
+  0x000075, 0x00031b, 0x000041, 0x00030c, 0x000061, 0x00030c, 0x000049, 0x00030c,
+  0x000069, 0x00030c, 0x00004f, 0x00030c, 0x00006f, 0x00030c, 0x000055, 0x00030c,
+  0x000075, 0x00030c, 0x000055, 0x000308, 0x000304, 0x000075, 0x000308, 0x000304,
+  0x000055, 0x000308, 0x000301, 0x000075, 0x000308, 0x000301, 0x000055, 0x000308,
+  0x00030c, 0x000075, 0x000308, 0x00030c, 0x000055, 0x000308, 0x000300, 0x000075,
+  0x000308, 0x000300, 0x000041, 0x000308, 0x000304, 0x000061, 0x000308, 0x000304,
+  0x000041, 0x000307, 0x000304, 0x000061, 0x000307, 0x000304, 0x0000c6, 0x000304,
+  0x0000e6, 0x000304, 0x000047, 0x00030c, 0x000067, 0x00030c, 0x00004b, 0x00030c,
+  0x00006b, 0x00030c, 0x00004f, 0x000328, 0x00006f, 0x000328, 0x00004f, 0x000328,
+  0x000304, 0x00006f, 0x000328, 0x000304, 0x0001b7, 0x00030c, 0x000292, 0x00030c,
+  0x00006a, 0x00030c, 0x000047, 0x000301, 0x000067, 0x000301, 0x00004e, 0x000300,
+  0x00006e, 0x000300, 0x000041, 0x00030a, 0x000301, 0x000061, 0x00030a, 0x000301,
+  0x0000c6, 0x000301, 0x0000e6, 0x000301, 0x0000d8, 0x000301, 0x0000f8, 0x000301,
+  0x000041, 0x00030f, 0x000061, 0x00030f, 0x000041, 0x000311, 0x000061, 0x000311,
+  0x000045, 0x00030f, 0x000065, 0x00030f, 0x000045, 0x000311, 0x000065, 0x000311,
+  0x000049, 0x00030f, 0x000069, 0x00030f, 0x000049, 0x000311, 0x000069, 0x000311,
+  0x00004f, 0x00030f, 0x00006f, 0x00030f, 0x00004f, 0x000311, 0x00006f, 0x000311,
+  0x000052, 0x00030f, 0x000072, 0x00030f, 0x000052, 0x000311, 0x000072, 0x000311,
+  0x000055, 0x00030f, 0x000075, 0x00030f, 0x000055, 0x000311, 0x000075, 0x000311,
+  0x000053, 0x000326, 0x000073, 0x000326, 0x000054, 0x000326, 0x000074, 0x000326,
+  0x000048, 0x00030c, 0x000068, 0x00030c, 0x000041, 0x000307, 0x000061, 0x000307,
+  0x000045, 0x000327, 0x000065, 0x000327, 0x00004f, 0x000308, 0x000304, 0x00006f,
+  0x000308, 0x000304, 0x00004f, 0x000303, 0x000304, 0x00006f, 0x000303, 0x000304,
+  0x00004f, 0x000307, 0x00006f, 0x000307, 0x00004f, 0x000307, 0x000304, 0x00006f,
+  0x000307, 0x000304, 0x000059, 0x000304, 0x000079, 0x000304, 0x000300, 0x000301,
+  0x000313, 0x000308, 0x000301, 0x0002b9, 0x00003b, 0x0000a8, 0x000301, 0x000391,
+  0x000301, 0x0000b7, 0x000395, 0x000301, 0x000397, 0x000301, 0x000399, 0x000301,
+  0x00039f, 0x000301, 0x0003a5, 0x000301, 0x0003a9, 0x000301, 0x0003b9, 0x000308,
+  0x000301, 0x000399, 0x000308, 0x0003a5, 0x000308, 0x0003b1, 0x000301, 0x0003b5,
+  0x000301, 0x0003b7, 0x000301, 0x0003b9, 0x000301, 0x0003c5, 0x000308, 0x000301,
+  0x0003b9, 0x000308, 0x0003c5, 0x000308, 0x0003bf, 0x000301, 0x0003c5, 0x000301,
+  0x0003c9, 0x000301, 0x0003d2, 0x000301, 0x0003d2, 0x000308, 0x000415, 0x000300,
+  0x000415, 0x000308, 0x000413, 0x000301, 0x000406, 0x000308, 0x00041a, 0x000301,
+  0x000418, 0x000300, 0x000423, 0x000306, 0x000418, 0x000306, 0x000438, 0x000306,
+  0x000435, 0x000300, 0x000435, 0x000308, 0x000433, 0x000301, 0x000456, 0x000308,
+  0x00043a, 0x000301, 0x000438, 0x000300, 0x000443, 0x000306, 0x000474, 0x00030f,
+  0x000475, 0x00030f, 0x000416, 0x000306, 0x000436, 0x000306, 0x000410, 0x000306,
+  0x000430, 0x000306, 0x000410, 0x000308, 0x000430, 0x000308, 0x000415, 0x000306,
+  0x000435, 0x000306, 0x0004d8, 0x000308, 0x0004d9, 0x000308, 0x000416, 0x000308,
+  0x000436, 0x000308, 0x000417, 0x000308, 0x000437, 0x000308, 0x000418, 0x000304,
+  0x000438, 0x000304, 0x000418, 0x000308, 0x000438, 0x000308, 0x00041e, 0x000308,
+  0x00043e, 0x000308, 0x0004e8, 0x000308, 0x0004e9, 0x000308, 0x00042d, 0x000308,
+  0x00044d, 0x000308, 0x000423, 0x000304, 0x000443, 0x000304, 0x000423, 0x000308,
+  0x000443, 0x000308, 0x000423, 0x00030b, 0x000443, 0x00030b, 0x000427, 0x000308,
+  0x000447, 0x000308, 0x00042b, 0x000308, 0x00044b, 0x000308, 0x000627, 0x000653,
+  0x000627, 0x000654, 0x000648, 0x000654, 0x000627, 0x000655, 0x00064a, 0x000654,
+  0x0006d5, 0x000654, 0x0006c1, 0x000654, 0x0006d2, 0x000654, 0x000928, 0x00093c,
+  0x000930, 0x00093c, 0x000933, 0x00093c, 0x000915, 0x00093c, 0x000916, 0x00093c,
+  0x000917, 0x00093c, 0x00091c, 0x00093c, 0x000921, 0x00093c, 0x000922, 0x00093c,
+  0x00092b, 0x00093c, 0x00092f, 0x00093c, 0x0009c7, 0x0009be, 0x0009c7, 0x0009d7,
+  0x0009a1, 0x0009bc, 0x0009a2, 0x0009bc, 0x0009af, 0x0009bc, 0x000a32, 0x000a3c,
+  0x000a38, 0x000a3c, 0x000a16, 0x000a3c, 0x000a17, 0x000a3c, 0x000a1c, 0x000a3c,
+  0x000a2b, 0x000a3c, 0x000b47, 0x000b56, 0x000b47, 0x000b3e, 0x000b47, 0x000b57,
+  0x000b21, 0x000b3c, 0x000b22, 0x000b3c, 0x000b92, 0x000bd7, 0x000bc6, 0x000bbe,
+  0x000bc7, 0x000bbe, 0x000bc6, 0x000bd7, 0x000c46, 0x000c56, 0x000cbf, 0x000cd5,
+  0x000cc6, 0x000cd5, 0x000cc6, 0x000cd6, 0x000cc6, 0x000cc2, 0x000cc6, 0x000cc2,
+  0x000cd5, 0x000d46, 0x000d3e, 0x000d47, 0x000d3e, 0x000d46, 0x000d57, 0x000dd9,
+  0x000dca, 0x000dd9, 0x000dcf, 0x000dd9, 0x000dcf, 0x000dca, 0x000dd9, 0x000ddf,
+  0x000f42, 0x000fb7, 0x000f4c, 0x000fb7, 0x000f51, 0x000fb7, 0x000f56, 0x000fb7,
+  0x000f5b, 0x000fb7, 0x000f40, 0x000fb5, 0x000f71, 0x000f72, 0x000f71, 0x000f74,
+  0x000fb2, 0x000f80, 0x000fb3, 0x000f80, 0x000f71, 0x000f80, 0x000f92, 0x000fb7,
+  0x000f9c, 0x000fb7, 0x000fa1, 0x000fb7, 0x000fa6, 0x000fb7, 0x000fab, 0x000fb7,
+  0x000f90, 0x000fb5, 0x001025, 0x00102e, 0x001b05, 0x001b35, 0x001b07, 0x001b35,
+  0x001b09, 0x001b35, 0x001b0b, 0x001b35, 0x001b0d, 0x001b35, 0x001b11, 0x001b35,
+  0x001b3a, 0x001b35, 0x001b3c, 0x001b35, 0x001b3e, 0x001b35, 0x001b3f, 0x001b35,
+  0x001b42, 0x001b35, 0x000041, 0x000325, 0x000061, 0x000325, 0x000042, 0x000307,
+  0x000062, 0x000307, 0x000042, 0x000323, 0x000062, 0x000323, 0x000042, 0x000331,
+  0x000062, 0x000331, 0x000043, 0x000327, 0x000301, 0x000063, 0x000327, 0x000301,
+  0x000044, 0x000307, 0x000064, 0x000307, 0x000044, 0x000323, 0x000064, 0x000323,
+  0x000044, 0x000331, 0x000064, 0x000331, 0x000044, 0x000327, 0x000064, 0x000327,
+  0x000044, 0x00032d, 0x000064, 0x00032d, 0x000045, 0x000304, 0x000300, 0x000065,
+  0x000304, 0x000300, 0x000045, 0x000304, 0x000301, 0x000065, 0x000304, 0x000301,
+  0x000045, 0x00032d, 0x000065, 0x00032d, 0x000045, 0x000330, 0x000065, 0x000330,
+  0x000045, 0x000327, 0x000306, 0x000065, 0x000327, 0x000306, 0x000046, 0x000307,
+  0x000066, 0x000307, 0x000047, 0x000304, 0x000067, 0x000304, 0x000048, 0x000307,
+  0x000068, 0x000307, 0x000048, 0x000323, 0x000068, 0x000323, 0x000048, 0x000308,
+  0x000068, 0x000308, 0x000048, 0x000327, 0x000068, 0x000327, 0x000048, 0x00032e,
+  0x000068, 0x00032e, 0x000049, 0x000330, 0x000069, 0x000330, 0x000049, 0x000308,
+  0x000301, 0x000069, 0x000308, 0x000301, 0x00004b, 0x000301, 0x00006b, 0x000301,
+  0x00004b, 0x000323, 0x00006b, 0x000323, 0x00004b, 0x000331, 0x00006b, 0x000331,
+  0x00004c, 0x000323, 0x00006c, 0x000323, 0x00004c, 0x000323, 0x000304, 0x00006c,
+  0x000323, 0x000304, 0x00004c, 0x000331, 0x00006c, 0x000331, 0x00004c, 0x00032d,
+  0x00006c, 0x00032d, 0x00004d, 0x000301, 0x00006d, 0x000301, 0x00004d, 0x000307,
+  0x00006d, 0x000307, 0x00004d, 0x000323, 0x00006d, 0x000323, 0x00004e, 0x000307,
+  0x00006e, 0x000307, 0x00004e, 0x000323, 0x00006e, 0x000323, 0x00004e, 0x000331,
+  0x00006e, 0x000331, 0x00004e, 0x00032d, 0x00006e, 0x00032d, 0x00004f, 0x000303,
+  0x000301, 0x00006f, 0x000303, 0x000301, 0x00004f, 0x000303, 0x000308, 0x00006f,
+  0x000303, 0x000308, 0x00004f, 0x000304, 0x000300, 0x00006f, 0x000304, 0x000300,
+  0x00004f, 0x000304, 0x000301, 0x00006f, 0x000304, 0x000301, 0x000050, 0x000301,
+  0x000070, 0x000301, 0x000050, 0x000307, 0x000070, 0x000307, 0x000052, 0x000307,
+  0x000072, 0x000307, 0x000052, 0x000323, 0x000072, 0x000323, 0x000052, 0x000323,
+  0x000304, 0x000072, 0x000323, 0x000304, 0x000052, 0x000331, 0x000072, 0x000331,
+  0x000053, 0x000307, 0x000073, 0x000307, 0x000053, 0x000323, 0x000073, 0x000323,
+  0x000053, 0x000301, 0x000307, 0x000073, 0x000301, 0x000307, 0x000053, 0x00030c,
+  0x000307, 0x000073, 0x00030c, 0x000307, 0x000053, 0x000323, 0x000307, 0x000073,
+  0x000323, 0x000307, 0x000054, 0x000307, 0x000074, 0x000307, 0x000054, 0x000323,
+  0x000074, 0x000323, 0x000054, 0x000331, 0x000074, 0x000331, 0x000054, 0x00032d,
+  0x000074, 0x00032d, 0x000055, 0x000324, 0x000075, 0x000324, 0x000055, 0x000330,
+  0x000075, 0x000330, 0x000055, 0x00032d, 0x000075, 0x00032d, 0x000055, 0x000303,
+  0x000301, 0x000075, 0x000303, 0x000301, 0x000055, 0x000304, 0x000308, 0x000075,
+  0x000304, 0x000308, 0x000056, 0x000303, 0x000076, 0x000303, 0x000056, 0x000323,
+  0x000076, 0x000323, 0x000057, 0x000300, 0x000077, 0x000300, 0x000057, 0x000301,
+  0x000077, 0x000301, 0x000057, 0x000308, 0x000077, 0x000308, 0x000057, 0x000307,
+  0x000077, 0x000307, 0x000057, 0x000323, 0x000077, 0x000323, 0x000058, 0x000307,
+  0x000078, 0x000307, 0x000058, 0x000308, 0x000078, 0x000308, 0x000059, 0x000307,
+  0x000079, 0x000307, 0x00005a, 0x000302, 0x00007a, 0x000302, 0x00005a, 0x000323,
+  0x00007a, 0x000323, 0x00005a, 0x000331, 0x00007a, 0x000331, 0x000068, 0x000331,
+  0x000074, 0x000308, 0x000077, 0x00030a, 0x000079, 0x00030a, 0x00017f, 0x000307,
+  0x000041, 0x000323, 0x000061, 0x000323, 0x000041, 0x000309, 0x000061, 0x000309,
+  0x000041, 0x000302, 0x000301, 0x000061, 0x000302, 0x000301, 0x000041, 0x000302,
+  0x000300, 0x000061, 0x000302, 0x000300, 0x000041, 0x000302, 0x000309, 0x000061,
+  0x000302, 0x000309, 0x000041, 0x000302, 0x000303, 0x000061, 0x000302, 0x000303,
+  0x000041, 0x000323, 0x000302, 0x000061, 0x000323, 0x000302, 0x000041, 0x000306,
+  0x000301, 0x000061, 0x000306, 0x000301, 0x000041, 0x000306, 0x000300, 0x000061,
+  0x000306, 0x000300, 0x000041, 0x000306, 0x000309, 0x000061, 0x000306, 0x000309,
+  0x000041, 0x000306, 0x000303, 0x000061, 0x000306, 0x000303, 0x000041, 0x000323,
+  0x000306, 0x000061, 0x000323, 0x000306, 0x000045, 0x000323, 0x000065, 0x000323,
+  0x000045, 0x000309, 0x000065, 0x000309, 0x000045, 0x000303, 0x000065, 0x000303,
+  0x000045, 0x000302, 0x000301, 0x000065, 0x000302, 0x000301, 0x000045, 0x000302,
+  0x000300, 0x000065, 0x000302, 0x000300, 0x000045, 0x000302, 0x000309, 0x000065,
+  0x000302, 0x000309, 0x000045, 0x000302, 0x000303, 0x000065, 0x000302, 0x000303,
+  0x000045, 0x000323, 0x000302, 0x000065, 0x000323, 0x000302, 0x000049, 0x000309,
+  0x000069, 0x000309, 0x000049, 0x000323, 0x000069, 0x000323, 0x00004f, 0x000323,
+  0x00006f, 0x000323, 0x00004f, 0x000309, 0x00006f, 0x000309, 0x00004f, 0x000302,
+  0x000301, 0x00006f, 0x000302, 0x000301, 0x00004f, 0x000302, 0x000300, 0x00006f,
+  0x000302, 0x000300, 0x00004f, 0x000302, 0x000309, 0x00006f, 0x000302, 0x000309,
+  0x00004f, 0x000302, 0x000303, 0x00006f, 0x000302, 0x000303, 0x00004f, 0x000323,
+  0x000302, 0x00006f, 0x000323, 0x000302, 0x00004f, 0x00031b, 0x000301, 0x00006f,
+  0x00031b, 0x000301, 0x00004f, 0x00031b, 0x000300, 0x00006f, 0x00031b, 0x000300,
+  0x00004f, 0x00031b, 0x000309, 0x00006f, 0x00031b, 0x000309, 0x00004f, 0x00031b,
+  0x000303, 0x00006f, 0x00031b, 0x000303, 0x00004f, 0x00031b, 0x000323, 0x00006f,
+  0x00031b, 0x000323, 0x000055, 0x000323, 0x000075, 0x000323, 0x000055, 0x000309,
+  0x000075, 0x000309, 0x000055, 0x00031b, 0x000301, 0x000075, 0x00031b, 0x000301,
+  0x000055, 0x00031b, 0x000300, 0x000075, 0x00031b, 0x000300, 0x000055, 0x00031b,
+  0x000309, 0x000075, 0x00031b, 0x000309, 0x000055, 0x00031b, 0x000303, 0x000075,
+  0x00031b, 0x000303, 0x000055, 0x00031b, 0x000323, 0x000075, 0x00031b, 0x000323,
+  0x000059, 0x000300, 0x000079, 0x000300, 0x000059, 0x000323, 0x000079, 0x000323,
+  0x000059, 0x000309, 0x000079, 0x000309, 0x000059, 0x000303, 0x000079, 0x000303,
+  0x0003b1, 0x000313, 0x0003b1, 0x000314, 0x0003b1, 0x000313, 0x000300, 0x0003b1,
+  0x000314, 0x000300, 0x0003b1, 0x000313, 0x000301, 0x0003b1, 0x000314, 0x000301,
+  0x0003b1, 0x000313, 0x000342, 0x0003b1, 0x000314, 0x000342, 0x000391, 0x000313,
+  0x000391, 0x000314, 0x000391, 0x000313, 0x000300, 0x000391, 0x000314, 0x000300,
+  0x000391, 0x000313, 0x000301, 0x000391, 0x000314, 0x000301, 0x000391, 0x000313,
+  0x000342, 0x000391, 0x000314, 0x000342, 0x0003b5, 0x000313, 0x0003b5, 0x000314,
+  0x0003b5, 0x000313, 0x000300, 0x0003b5, 0x000314, 0x000300, 0x0003b5, 0x000313,
+  0x000301, 0x0003b5, 0x000314, 0x000301, 0x000395, 0x000313, 0x000395, 0x000314,
+  0x000395, 0x000313, 0x000300, 0x000395, 0x000314, 0x000300, 0x000395, 0x000313,
+  0x000301, 0x000395, 0x000314, 0x000301, 0x0003b7, 0x000313, 0x0003b7, 0x000314,
+  0x0003b7, 0x000313, 0x000300, 0x0003b7, 0x000314, 0x000300, 0x0003b7, 0x000313,
+  0x000301, 0x0003b7, 0x000314, 0x000301, 0x0003b7, 0x000313, 0x000342, 0x0003b7,
+  0x000314, 0x000342, 0x000397, 0x000313, 0x000397, 0x000314, 0x000397, 0x000313,
+  0x000300, 0x000397, 0x000314, 0x000300, 0x000397, 0x000313, 0x000301, 0x000397,
+  0x000314, 0x000301, 0x000397, 0x000313, 0x000342, 0x000397, 0x000314, 0x000342,
+  0x0003b9, 0x000313, 0x0003b9, 0x000314, 0x0003b9, 0x000313, 0x000300, 0x0003b9,
+  0x000314, 0x000300, 0x0003b9, 0x000313, 0x000301, 0x0003b9, 0x000314, 0x000301,
+  0x0003b9, 0x000313, 0x000342, 0x0003b9, 0x000314, 0x000342, 0x000399, 0x000313,
+  0x000399, 0x000314, 0x000399, 0x000313, 0x000300, 0x000399, 0x000314, 0x000300,
+  0x000399, 0x000313, 0x000301, 0x000399, 0x000314, 0x000301, 0x000399, 0x000313,
+  0x000342, 0x000399, 0x000314, 0x000342, 0x0003bf, 0x000313, 0x0003bf, 0x000314,
+  0x0003bf, 0x000313, 0x000300, 0x0003bf, 0x000314, 0x000300, 0x0003bf, 0x000313,
+  0x000301, 0x0003bf, 0x000314, 0x000301, 0x00039f, 0x000313, 0x00039f, 0x000314,
+  0x00039f, 0x000313, 0x000300, 0x00039f, 0x000314, 0x000300, 0x00039f, 0x000313,
+  0x000301, 0x00039f, 0x000314, 0x000301, 0x0003c5, 0x000313, 0x0003c5, 0x000314,
+  0x0003c5, 0x000313, 0x000300, 0x0003c5, 0x000314, 0x000300, 0x0003c5, 0x000313,
+  0x000301, 0x0003c5, 0x000314, 0x000301, 0x0003c5, 0x000313, 0x000342, 0x0003c5,
+  0x000314, 0x000342, 0x0003a5, 0x000314, 0x0003a5, 0x000314, 0x000300, 0x0003a5,
+  0x000314, 0x000301, 0x0003a5, 0x000314, 0x000342, 0x0003c9, 0x000313, 0x0003c9,
+  0x000314, 0x0003c9, 0x000313, 0x000300, 0x0003c9, 0x000314, 0x000300, 0x0003c9,
+  0x000313, 0x000301, 0x0003c9, 0x000314, 0x000301, 0x0003c9, 0x000313, 0x000342,
+  0x0003c9, 0x000314, 0x000342, 0x0003a9, 0x000313, 0x0003a9, 0x000314, 0x0003a9,
+  0x000313, 0x000300, 0x0003a9, 0x000314, 0x000300, 0x0003a9, 0x000313, 0x000301,
+  0x0003a9, 0x000314, 0x000301, 0x0003a9, 0x000313, 0x000342, 0x0003a9, 0x000314,
+  0x000342, 0x0003b1, 0x000300, 0x0003b1, 0x000301, 0x0003b5, 0x000300, 0x0003b5,
+  0x000301, 0x0003b7, 0x000300, 0x0003b7, 0x000301, 0x0003b9, 0x000300, 0x0003b9,
+  0x000301, 0x0003bf, 0x000300, 0x0003bf, 0x000301, 0x0003c5, 0x000300, 0x0003c5,
+  0x000301, 0x0003c9, 0x000300, 0x0003c9, 0x000301, 0x0003b1, 0x000313, 0x000345,
+  0x0003b1, 0x000314, 0x000345, 0x0003b1, 0x000313, 0x000300, 0x000345, 0x0003b1,
+  0x000314, 0x000300, 0x000345, 0x0003b1, 0x000313, 0x000301, 0x000345, 0x0003b1,
+  0x000314, 0x000301, 0x000345, 0x0003b1, 0x000313, 0x000342, 0x000345, 0x0003b1,
+  0x000314, 0x000342, 0x000345, 0x000391, 0x000313, 0x000345, 0x000391, 0x000314,
+  0x000345, 0x000391, 0x000313, 0x000300, 0x000345, 0x000391, 0x000314, 0x000300,
+  0x000345, 0x000391, 0x000313, 0x000301, 0x000345, 0x000391, 0x000314, 0x000301,
+  0x000345, 0x000391, 0x000313, 0x000342, 0x000345, 0x000391, 0x000314, 0x000342,
+  0x000345, 0x0003b7, 0x000313, 0x000345, 0x0003b7, 0x000314, 0x000345, 0x0003b7,
+  0x000313, 0x000300, 0x000345, 0x0003b7, 0x000314, 0x000300, 0x000345, 0x0003b7,
+  0x000313, 0x000301, 0x000345, 0x0003b7, 0x000314, 0x000301, 0x000345, 0x0003b7,
+  0x000313, 0x000342, 0x000345, 0x0003b7, 0x000314, 0x000342, 0x000345, 0x000397,
+  0x000313, 0x000345, 0x000397, 0x000314, 0x000345, 0x000397, 0x000313, 0x000300,
+  0x000345, 0x000397, 0x000314, 0x000300, 0x000345, 0x000397, 0x000313, 0x000301,
+  0x000345, 0x000397, 0x000314, 0x000301, 0x000345, 0x000397, 0x000313, 0x000342,
+  0x000345, 0x000397, 0x000314, 0x000342, 0x000345, 0x0003c9, 0x000313, 0x000345,
+  0x0003c9, 0x000314, 0x000345, 0x0003c9, 0x000313, 0x000300, 0x000345, 0x0003c9,
+  0x000314, 0x000300, 0x000345, 0x0003c9, 0x000313, 0x000301, 0x000345, 0x0003c9,
+  0x000314, 0x000301, 0x000345, 0x0003c9, 0x000313, 0x000342, 0x000345, 0x0003c9,
+  0x000314, 0x000342, 0x000345, 0x0003a9, 0x000313, 0x000345, 0x0003a9, 0x000314,
+  0x000345, 0x0003a9, 0x000313, 0x000300, 0x000345, 0x0003a9, 0x000314, 0x000300,
+  0x000345, 0x0003a9, 0x000313, 0x000301, 0x000345, 0x0003a9, 0x000314, 0x000301,
+  0x000345, 0x0003a9, 0x000313, 0x000342, 0x000345, 0x0003a9, 0x000314, 0x000342,
+  0x000345, 0x0003b1, 0x000306, 0x0003b1, 0x000304, 0x0003b1, 0x000300, 0x000345,
+  0x0003b1, 0x000345, 0x0003b1, 0x000301, 0x000345, 0x0003b1, 0x000342, 0x0003b1,
+  0x000342, 0x000345, 0x000391, 0x000306, 0x000391, 0x000304, 0x000391, 0x000300,
+  0x000391, 0x000301, 0x000391, 0x000345, 0x0003b9, 0x0000a8, 0x000342, 0x0003b7,
+  0x000300, 0x000345, 0x0003b7, 0x000345, 0x0003b7, 0x000301, 0x000345, 0x0003b7,
+  0x000342, 0x0003b7, 0x000342, 0x000345, 0x000395, 0x000300, 0x000395, 0x000301,
+  0x000397, 0x000300, 0x000397, 0x000301, 0x000397, 0x000345, 0x001fbf, 0x000300,
+  0x001fbf, 0x000301, 0x001fbf, 0x000342, 0x0003b9, 0x000306, 0x0003b9, 0x000304,
+  0x0003b9, 0x000308, 0x000300, 0x0003b9, 0x000308, 0x000301, 0x0003b9, 0x000342,
+  0x0003b9, 0x000308, 0x000342, 0x000399, 0x000306, 0x000399, 0x000304, 0x000399,
+  0x000300, 0x000399, 0x000301, 0x001ffe, 0x000300, 0x001ffe, 0x000301, 0x001ffe,
+  0x000342, 0x0003c5, 0x000306, 0x0003c5, 0x000304, 0x0003c5, 0x000308, 0x000300,
+  0x0003c5, 0x000308, 0x000301, 0x0003c1, 0x000313, 0x0003c1, 0x000314, 0x0003c5,
+  0x000342, 0x0003c5, 0x000308, 0x000342, 0x0003a5, 0x000306, 0x0003a5, 0x000304,
+  0x0003a5, 0x000300, 0x0003a5, 0x000301, 0x0003a1, 0x000314, 0x0000a8, 0x000300,
+  0x0000a8, 0x000301, 0x000060, 0x0003c9, 0x000300, 0x000345, 0x0003c9, 0x000345,
+  0x0003c9, 0x000301, 0x000345, 0x0003c9, 0x000342, 0x0003c9, 0x000342, 0x000345,
+  0x00039f, 0x000300, 0x00039f, 0x000301, 0x0003a9, 0x000300, 0x0003a9, 0x000301,
+  0x0003a9, 0x000345, 0x0000b4, 0x002002, 0x002003, 0x0003a9, 0x00004b, 0x000041,
+  0x00030a, 0x002190, 0x000338, 0x002192, 0x000338, 0x002194, 0x000338, 0x0021d0,
+  0x000338, 0x0021d4, 0x000338, 0x0021d2, 0x000338, 0x002203, 0x000338, 0x002208,
+  0x000338, 0x00220b, 0x000338, 0x002223, 0x000338, 0x002225, 0x000338, 0x00223c,
+  0x000338, 0x002243, 0x000338, 0x002245, 0x000338, 0x002248, 0x000338, 0x00003d,
+  0x000338, 0x002261, 0x000338, 0x00224d, 0x000338, 0x00003c, 0x000338, 0x00003e,
+  0x000338, 0x002264, 0x000338, 0x002265, 0x000338, 0x002272, 0x000338, 0x002273,
+  0x000338, 0x002276, 0x000338, 0x002277, 0x000338, 0x00227a, 0x000338, 0x00227b,
+  0x000338, 0x002282, 0x000338, 0x002283, 0x000338, 0x002286, 0x000338, 0x002287,
+  0x000338, 0x0022a2, 0x000338, 0x0022a8, 0x000338, 0x0022a9, 0x000338, 0x0022ab,
+  0x000338, 0x00227c, 0x000338, 0x00227d, 0x000338, 0x002291, 0x000338, 0x002292,
+  0x000338, 0x0022b2, 0x000338, 0x0022b3, 0x000338, 0x0022b4, 0x000338, 0x0022b5,
+  0x000338, 0x003008, 0x003009, 0x002add, 0x000338, 0x00304b, 0x003099, 0x00304d,
+  0x003099, 0x00304f, 0x003099, 0x003051, 0x003099, 0x003053, 0x003099, 0x003055,
+  0x003099, 0x003057, 0x003099, 0x003059, 0x003099, 0x00305b, 0x003099, 0x00305d,
+  0x003099, 0x00305f, 0x003099, 0x003061, 0x003099, 0x003064, 0x003099, 0x003066,
+  0x003099, 0x003068, 0x003099, 0x00306f, 0x003099, 0x00306f, 0x00309a, 0x003072,
+  0x003099, 0x003072, 0x00309a, 0x003075, 0x003099, 0x003075, 0x00309a, 0x003078,
+  0x003099, 0x003078, 0x00309a, 0x00307b, 0x003099, 0x00307b, 0x00309a, 0x003046,
+  0x003099, 0x00309d, 0x003099, 0x0030ab, 0x003099, 0x0030ad, 0x003099, 0x0030af,
+  0x003099, 0x0030b1, 0x003099, 0x0030b3, 0x003099, 0x0030b5, 0x003099, 0x0030b7,
+  0x003099, 0x0030b9, 0x003099, 0x0030bb, 0x003099, 0x0030bd, 0x003099, 0x0030bf,
+  0x003099, 0x0030c1, 0x003099, 0x0030c4, 0x003099, 0x0030c6, 0x003099, 0x0030c8,
+  0x003099, 0x0030cf, 0x003099, 0x0030cf, 0x00309a, 0x0030d2, 0x003099, 0x0030d2,
+  0x00309a, 0x0030d5, 0x003099, 0x0030d5, 0x00309a, 0x0030d8, 0x003099, 0x0030d8,
+  0x00309a, 0x0030db, 0x003099, 0x0030db, 0x00309a, 0x0030a6, 0x003099, 0x0030ef,
+  0x003099, 0x0030f0, 0x003099, 0x0030f1, 0x003099, 0x0030f2, 0x003099, 0x0030fd,
+  0x003099, 0x008c48, 0x0066f4, 0x008eca, 0x008cc8, 0x006ed1, 0x004e32, 0x0053e5,
+  0x009f9c, 0x009f9c, 0x005951, 0x0091d1, 0x005587, 0x005948, 0x0061f6, 0x007669,
+  0x007f85, 0x00863f, 0x0087ba, 0x0088f8, 0x00908f, 0x006a02, 0x006d1b, 0x0070d9,
+  0x0073de, 0x00843d, 0x00916a, 0x0099f1, 0x004e82, 0x005375, 0x006b04, 0x00721b,
+  0x00862d, 0x009e1e, 0x005d50, 0x006feb, 0x0085cd, 0x008964, 0x0062c9, 0x0081d8,
+  0x00881f, 0x005eca, 0x006717, 0x006d6a, 0x0072fc, 0x0090ce, 0x004f86, 0x0051b7,
+  0x0052de, 0x0064c4, 0x006ad3, 0x007210, 0x0076e7, 0x008001, 0x008606, 0x00865c,
+  0x008def, 0x009732, 0x009b6f, 0x009dfa, 0x00788c, 0x00797f, 0x007da0, 0x0083c9,
+  0x009304, 0x009e7f, 0x008ad6, 0x0058df, 0x005f04, 0x007c60, 0x00807e, 0x007262,
+  0x0078ca, 0x008cc2, 0x0096f7, 0x0058d8, 0x005c62, 0x006a13, 0x006dda, 0x006f0f,
+  0x007d2f, 0x007e37, 0x00964b, 0x0052d2, 0x00808b, 0x0051dc, 0x0051cc, 0x007a1c,
+  0x007dbe, 0x0083f1, 0x009675, 0x008b80, 0x0062cf, 0x006a02, 0x008afe, 0x004e39,
+  0x005be7, 0x006012, 0x007387, 0x007570, 0x005317, 0x0078fb, 0x004fbf, 0x005fa9,
+  0x004e0d, 0x006ccc, 0x006578, 0x007d22, 0x0053c3, 0x00585e, 0x007701, 0x008449,
+  0x008aaa, 0x006bba, 0x008fb0, 0x006c88, 0x0062fe, 0x0082e5, 0x0063a0, 0x007565,
+  0x004eae, 0x005169, 0x0051c9, 0x006881, 0x007ce7, 0x00826f, 0x008ad2, 0x0091cf,
+  0x0052f5, 0x005442, 0x005973, 0x005eec, 0x0065c5, 0x006ffe, 0x00792a, 0x0095ad,
+  0x009a6a, 0x009e97, 0x009ece, 0x00529b, 0x0066c6, 0x006b77, 0x008f62, 0x005e74,
+  0x006190, 0x006200, 0x00649a, 0x006f23, 0x007149, 0x007489, 0x0079ca, 0x007df4,
+  0x00806f, 0x008f26, 0x0084ee, 0x009023, 0x00934a, 0x005217, 0x0052a3, 0x0054bd,
+  0x0070c8, 0x0088c2, 0x008aaa, 0x005ec9, 0x005ff5, 0x00637b, 0x006bae, 0x007c3e,
+  0x007375, 0x004ee4, 0x0056f9, 0x005be7, 0x005dba, 0x00601c, 0x0073b2, 0x007469,
+  0x007f9a, 0x008046, 0x009234, 0x0096f6, 0x009748, 0x009818, 0x004f8b, 0x0079ae,
+  0x0091b4, 0x0096b8, 0x0060e1, 0x004e86, 0x0050da, 0x005bee, 0x005c3f, 0x006599,
+  0x006a02, 0x0071ce, 0x007642, 0x0084fc, 0x00907c, 0x009f8d, 0x006688, 0x00962e,
+  0x005289, 0x00677b, 0x0067f3, 0x006d41, 0x006e9c, 0x007409, 0x007559, 0x00786b,
+  0x007d10, 0x00985e, 0x00516d, 0x00622e, 0x009678, 0x00502b, 0x005d19, 0x006dea,
+  0x008f2a, 0x005f8b, 0x006144, 0x006817, 0x007387, 0x009686, 0x005229, 0x00540f,
+  0x005c65, 0x006613, 0x00674e, 0x0068a8, 0x006ce5, 0x007406, 0x0075e2, 0x007f79,
+  0x0088cf, 0x0088e1, 0x0091cc, 0x0096e2, 0x00533f, 0x006eba, 0x00541d, 0x0071d0,
+  0x007498, 0x0085fa, 0x0096a3, 0x009c57, 0x009e9f, 0x006797, 0x006dcb, 0x0081e8,
+  0x007acb, 0x007b20, 0x007c92, 0x0072c0, 0x007099, 0x008b58, 0x004ec0, 0x008336,
+  0x00523a, 0x005207, 0x005ea6, 0x0062d3, 0x007cd6, 0x005b85, 0x006d1e, 0x0066b4,
+  0x008f3b, 0x00884c, 0x00964d, 0x00898b, 0x005ed3, 0x005140, 0x0055c0, 0x00585a,
+  0x006674, 0x0051de, 0x00732a, 0x0076ca, 0x00793c, 0x00795e, 0x007965, 0x00798f,
+  0x009756, 0x007cbe, 0x007fbd, 0x008612, 0x008af8, 0x009038, 0x0090fd, 0x0098ef,
+  0x0098fc, 0x009928, 0x009db4, 0x0090de, 0x0096b7, 0x004fae, 0x0050e7, 0x00514d,
+  0x0052c9, 0x0052e4, 0x005351, 0x00559d, 0x005606, 0x005668, 0x005840, 0x0058a8,
+  0x005c64, 0x005c6e, 0x006094, 0x006168, 0x00618e, 0x0061f2, 0x00654f, 0x0065e2,
+  0x006691, 0x006885, 0x006d77, 0x006e1a, 0x006f22, 0x00716e, 0x00722b, 0x007422,
+  0x007891, 0x00793e, 0x007949, 0x007948, 0x007950, 0x007956, 0x00795d, 0x00798d,
+  0x00798e, 0x007a40, 0x007a81, 0x007bc0, 0x007df4, 0x007e09, 0x007e41, 0x007f72,
+  0x008005, 0x0081ed, 0x008279, 0x008279, 0x008457, 0x008910, 0x008996, 0x008b01,
+  0x008b39, 0x008cd3, 0x008d08, 0x008fb6, 0x009038, 0x0096e3, 0x0097ff, 0x00983b,
+  0x006075, 0x0242ee, 0x008218, 0x004e26, 0x0051b5, 0x005168, 0x004f80, 0x005145,
+  0x005180, 0x0052c7, 0x0052fa, 0x00559d, 0x005555, 0x005599, 0x0055e2, 0x00585a,
+  0x0058b3, 0x005944, 0x005954, 0x005a62, 0x005b28, 0x005ed2, 0x005ed9, 0x005f69,
+  0x005fad, 0x0060d8, 0x00614e, 0x006108, 0x00618e, 0x006160, 0x0061f2, 0x006234,
+  0x0063c4, 0x00641c, 0x006452, 0x006556, 0x006674, 0x006717, 0x00671b, 0x006756,
+  0x006b79, 0x006bba, 0x006d41, 0x006edb, 0x006ecb, 0x006f22, 0x00701e, 0x00716e,
+  0x0077a7, 0x007235, 0x0072af, 0x00732a, 0x007471, 0x007506, 0x00753b, 0x00761d,
+  0x00761f, 0x0076ca, 0x0076db, 0x0076f4, 0x00774a, 0x007740, 0x0078cc, 0x007ab1,
+  0x007bc0, 0x007c7b, 0x007d5b, 0x007df4, 0x007f3e, 0x008005, 0x008352, 0x0083ef,
+  0x008779, 0x008941, 0x008986, 0x008996, 0x008abf, 0x008af8, 0x008acb, 0x008b01,
+  0x008afe, 0x008aed, 0x008b39, 0x008b8a, 0x008d08, 0x008f38, 0x009072, 0x009199,
+  0x009276, 0x00967c, 0x0096e3, 0x009756, 0x0097db, 0x0097ff, 0x00980b, 0x00983b,
+  0x009b12, 0x009f9c, 0x02284a, 0x022844, 0x0233d5, 0x003b9d, 0x004018, 0x004039,
+  0x025249, 0x025cd0, 0x027ed3, 0x009f43, 0x009f8e, 0x0005d9, 0x0005b4, 0x0005f2,
+  0x0005b7, 0x0005e9, 0x0005c1, 0x0005e9, 0x0005c2, 0x0005e9, 0x0005bc, 0x0005c1,
+  0x0005e9, 0x0005bc, 0x0005c2, 0x0005d0, 0x0005b7, 0x0005d0, 0x0005b8, 0x0005d0,
+  0x0005bc, 0x0005d1, 0x0005bc, 0x0005d2, 0x0005bc, 0x0005d3, 0x0005bc, 0x0005d4,
+  0x0005bc, 0x0005d5, 0x0005bc, 0x0005d6, 0x0005bc, 0x0005d8, 0x0005bc, 0x0005d9,
+  0x0005bc, 0x0005da, 0x0005bc, 0x0005db, 0x0005bc, 0x0005dc, 0x0005bc, 0x0005de,
+  0x0005bc, 0x0005e0, 0x0005bc, 0x0005e1, 0x0005bc, 0x0005e3, 0x0005bc, 0x0005e4,
+  0x0005bc, 0x0005e6, 0x0005bc, 0x0005e7, 0x0005bc, 0x0005e8, 0x0005bc, 0x0005e9,
+  0x0005bc, 0x0005ea, 0x0005bc, 0x0005d5, 0x0005b9, 0x0005d1, 0x0005bf, 0x0005db,
+  0x0005bf, 0x0005e4, 0x0005bf, 0x011099, 0x0110ba, 0x01109b, 0x0110ba, 0x0110a5,
+  0x0110ba, 0x011131, 0x011127, 0x011132, 0x011127, 0x011347, 0x01133e, 0x011347,
+  0x011357, 0x0114b9, 0x0114ba, 0x0114b9, 0x0114b0, 0x0114b9, 0x0114bd, 0x0115b8,
+  0x0115af, 0x0115b9, 0x0115af, 0x011935, 0x011930, 0x01d157, 0x01d165, 0x01d158,
+  0x01d165, 0x01d158, 0x01d165, 0x01d16e, 0x01d158, 0x01d165, 0x01d16f, 0x01d158,
+  0x01d165, 0x01d170, 0x01d158, 0x01d165, 0x01d171, 0x01d158, 0x01d165, 0x01d172,
+  0x01d1b9, 0x01d165, 0x01d1ba, 0x01d165, 0x01d1b9, 0x01d165, 0x01d16e, 0x01d1ba,
+  0x01d165, 0x01d16e, 0x01d1b9, 0x01d165, 0x01d16f, 0x01d1ba, 0x01d165, 0x01d16f,
+  0x004e3d, 0x004e38, 0x004e41, 0x020122, 0x004f60, 0x004fae, 0x004fbb, 0x005002,
+  0x00507a, 0x005099, 0x0050e7, 0x0050cf, 0x00349e, 0x02063a, 0x00514d, 0x005154,
+  0x005164, 0x005177, 0x02051c, 0x0034b9, 0x005167, 0x00518d, 0x02054b, 0x005197,
+  0x0051a4, 0x004ecc, 0x0051ac, 0x0051b5, 0x0291df, 0x0051f5, 0x005203, 0x0034df,
+  0x00523b, 0x005246, 0x005272, 0x005277, 0x003515, 0x0052c7, 0x0052c9, 0x0052e4,
+  0x0052fa, 0x005305, 0x005306, 0x005317, 0x005349, 0x005351, 0x00535a, 0x005373,
+  0x00537d, 0x00537f, 0x00537f, 0x00537f, 0x020a2c, 0x007070, 0x0053ca, 0x0053df,
+  0x020b63, 0x0053eb, 0x0053f1, 0x005406, 0x00549e, 0x005438, 0x005448, 0x005468,
+  0x0054a2, 0x0054f6, 0x005510, 0x005553, 0x005563, 0x005584, 0x005584, 0x005599,
+  0x0055ab, 0x0055b3, 0x0055c2, 0x005716, 0x005606, 0x005717, 0x005651, 0x005674,
+  0x005207, 0x0058ee, 0x0057ce, 0x0057f4, 0x00580d, 0x00578b, 0x005832, 0x005831,
+  0x0058ac, 0x0214e4, 0x0058f2, 0x0058f7, 0x005906, 0x00591a, 0x005922, 0x005962,
+  0x0216a8, 0x0216ea, 0x0059ec, 0x005a1b, 0x005a27, 0x0059d8, 0x005a66, 0x0036ee,
+  0x0036fc, 0x005b08, 0x005b3e, 0x005b3e, 0x0219c8, 0x005bc3, 0x005bd8, 0x005be7,
+  0x005bf3, 0x021b18, 0x005bff, 0x005c06, 0x005f53, 0x005c22, 0x003781, 0x005c60,
+  0x005c6e, 0x005cc0, 0x005c8d, 0x021de4, 0x005d43, 0x021de6, 0x005d6e, 0x005d6b,
+  0x005d7c, 0x005de1, 0x005de2, 0x00382f, 0x005dfd, 0x005e28, 0x005e3d, 0x005e69,
+  0x003862, 0x022183, 0x00387c, 0x005eb0, 0x005eb3, 0x005eb6, 0x005eca, 0x02a392,
+  0x005efe, 0x022331, 0x022331, 0x008201, 0x005f22, 0x005f22, 0x0038c7, 0x0232b8,
+  0x0261da, 0x005f62, 0x005f6b, 0x0038e3, 0x005f9a, 0x005fcd, 0x005fd7, 0x005ff9,
+  0x006081, 0x00393a, 0x00391c, 0x006094, 0x0226d4, 0x0060c7, 0x006148, 0x00614c,
+  0x00614e, 0x00614c, 0x00617a, 0x00618e, 0x0061b2, 0x0061a4, 0x0061af, 0x0061de,
+  0x0061f2, 0x0061f6, 0x006210, 0x00621b, 0x00625d, 0x0062b1, 0x0062d4, 0x006350,
+  0x022b0c, 0x00633d, 0x0062fc, 0x006368, 0x006383, 0x0063e4, 0x022bf1, 0x006422,
+  0x0063c5, 0x0063a9, 0x003a2e, 0x006469, 0x00647e, 0x00649d, 0x006477, 0x003a6c,
+  0x00654f, 0x00656c, 0x02300a, 0x0065e3, 0x0066f8, 0x006649, 0x003b19, 0x006691,
+  0x003b08, 0x003ae4, 0x005192, 0x005195, 0x006700, 0x00669c, 0x0080ad, 0x0043d9,
+  0x006717, 0x00671b, 0x006721, 0x00675e, 0x006753, 0x0233c3, 0x003b49, 0x0067fa,
+  0x006785, 0x006852, 0x006885, 0x02346d, 0x00688e, 0x00681f, 0x006914, 0x003b9d,
+  0x006942, 0x0069a3, 0x0069ea, 0x006aa8, 0x0236a3, 0x006adb, 0x003c18, 0x006b21,
+  0x0238a7, 0x006b54, 0x003c4e, 0x006b72, 0x006b9f, 0x006bba, 0x006bbb, 0x023a8d,
+  0x021d0b, 0x023afa, 0x006c4e, 0x023cbc, 0x006cbf, 0x006ccd, 0x006c67, 0x006d16,
+  0x006d3e, 0x006d77, 0x006d41, 0x006d69, 0x006d78, 0x006d85, 0x023d1e, 0x006d34,
+  0x006e2f, 0x006e6e, 0x003d33, 0x006ecb, 0x006ec7, 0x023ed1, 0x006df9, 0x006f6e,
+  0x023f5e, 0x023f8e, 0x006fc6, 0x007039, 0x00701e, 0x00701b, 0x003d96, 0x00704a,
+  0x00707d, 0x007077, 0x0070ad, 0x020525, 0x007145, 0x024263, 0x00719c, 0x0243ab,
+  0x007228, 0x007235, 0x007250, 0x024608, 0x007280, 0x007295, 0x024735, 0x024814,
+  0x00737a, 0x00738b, 0x003eac, 0x0073a5, 0x003eb8, 0x003eb8, 0x007447, 0x00745c,
+  0x007471, 0x007485, 0x0074ca, 0x003f1b, 0x007524, 0x024c36, 0x00753e, 0x024c92,
+  0x007570, 0x02219f, 0x007610, 0x024fa1, 0x024fb8, 0x025044, 0x003ffc, 0x004008,
+  0x0076f4, 0x0250f3, 0x0250f2, 0x025119, 0x025133, 0x00771e, 0x00771f, 0x00771f,
+  0x00774a, 0x004039, 0x00778b, 0x004046, 0x004096, 0x02541d, 0x00784e, 0x00788c,
+  0x0078cc, 0x0040e3, 0x025626, 0x007956, 0x02569a, 0x0256c5, 0x00798f, 0x0079eb,
+  0x00412f, 0x007a40, 0x007a4a, 0x007a4f, 0x02597c, 0x025aa7, 0x025aa7, 0x007aee,
+  0x004202, 0x025bab, 0x007bc6, 0x007bc9, 0x004227, 0x025c80, 0x007cd2, 0x0042a0,
+  0x007ce8, 0x007ce3, 0x007d00, 0x025f86, 0x007d63, 0x004301, 0x007dc7, 0x007e02,
+  0x007e45, 0x004334, 0x026228, 0x026247, 0x004359, 0x0262d9, 0x007f7a, 0x02633e,
+  0x007f95, 0x007ffa, 0x008005, 0x0264da, 0x026523, 0x008060, 0x0265a8, 0x008070,
+  0x02335f, 0x0043d5, 0x0080b2, 0x008103, 0x00440b, 0x00813e, 0x005ab5, 0x0267a7,
+  0x0267b5, 0x023393, 0x02339c, 0x008201, 0x008204, 0x008f9e, 0x00446b, 0x008291,
+  0x00828b, 0x00829d, 0x0052b3, 0x0082b1, 0x0082b3, 0x0082bd, 0x0082e6, 0x026b3c,
+  0x0082e5, 0x00831d, 0x008363, 0x0083ad, 0x008323, 0x0083bd, 0x0083e7, 0x008457,
+  0x008353, 0x0083ca, 0x0083cc, 0x0083dc, 0x026c36, 0x026d6b, 0x026cd5, 0x00452b,
+  0x0084f1, 0x0084f3, 0x008516, 0x0273ca, 0x008564, 0x026f2c, 0x00455d, 0x004561,
+  0x026fb1, 0x0270d2, 0x00456b, 0x008650, 0x00865c, 0x008667, 0x008669, 0x0086a9,
+  0x008688, 0x00870e, 0x0086e2, 0x008779, 0x008728, 0x00876b, 0x008786, 0x0045d7,
+  0x0087e1, 0x008801, 0x0045f9, 0x008860, 0x008863, 0x027667, 0x0088d7, 0x0088de,
+  0x004635, 0x0088fa, 0x0034bb, 0x0278ae, 0x027966, 0x0046be, 0x0046c7, 0x008aa0,
+  0x008aed, 0x008b8a, 0x008c55, 0x027ca8, 0x008cab, 0x008cc1, 0x008d1b, 0x008d77,
+  0x027f2f, 0x020804, 0x008dcb, 0x008dbc, 0x008df0, 0x0208de, 0x008ed4, 0x008f38,
+  0x0285d2, 0x0285ed, 0x009094, 0x0090f1, 0x009111, 0x02872e, 0x00911b, 0x009238,
+  0x0092d7, 0x0092d8, 0x00927c, 0x0093f9, 0x009415, 0x028bfa, 0x00958b, 0x004995,
+  0x0095b7, 0x028d77, 0x0049e6, 0x0096c3, 0x005db2, 0x009723, 0x029145, 0x02921a,
+  0x004a6e, 0x004a76, 0x0097e0, 0x02940a, 0x004ab2, 0x029496, 0x00980b, 0x00980b,
+  0x009829, 0x0295b6, 0x0098e2, 0x004b33, 0x009929, 0x0099a7, 0x0099c2, 0x0099fe,
+  0x004bce, 0x029b30, 0x009b12, 0x009c40, 0x009cfd, 0x004cce, 0x004ced, 0x009d67,
+  0x02a0ce, 0x004cf8, 0x02a105, 0x02a20e, 0x02a291, 0x009ebb, 0x004d56, 0x009ef9,
+  0x009efe, 0x009f05, 0x009f0f, 0x009f16, 0x009f3b, 0x02a600,
+};
+
+// Primary composites, excluding Hangul syllables, as the first code point
+// << 42, the second code point << 21 and the composite.
+static const uint64_t url__unicode_compositions[] = {
+  0x00013c0061201ece, 0x000124006500012e, 0x000ee40062801f31, 0x0000000000000000,
+  0x0000000000000000, 0x0001a40064601ecb, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x007c200060201f0c, 0x0000000000000000, 0x000ec40060c01fb0,
+  0x0000000000000000, 0x0000000000000000, 0x000e440062801f09, 0x00010c0060400108,
+  0x00015c0060e01e86, 0x007ff80060201fde, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x007ff80068401fdf, 0x0040940205c01026,
+  0x00018400610000e4, 0x0006800064601ee2, 0x0001680060401e90, 0x00c2ac06132030ac,
+  0x0001500065a01e70, 0x0000000000000000, 0x0001240060e00130, 0x000ee400602003af,
+  0x0000000000000000, 0x0001a00066201e96, 0x008640006700219a, 0x007c400060201f14,
+  0x000e7c0060001ff8, 0x007db40068a01fad, 0x0000000000000000, 0x0000000000000000,
+  0x000ec40062601f00, 0x0000000000000000, 0x0006c00060201ee9, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0444c82224e1112f, 0x0000000000000000, 0x00c30406132030c2,
+  0x007c8c0068a01f93, 0x0000000000000000, 0x0001640060001ef2, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x00105c00610004de, 0x00013c0064601ecc,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0001a40061201ec9, 0x0089f400670022e1, 0x0001d400600000f9, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x007c000068401f06, 0x0000000000000000,
+  0x0006840061201edf, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x008ad000670022ec, 0x0000000000000000, 0x00010400600000c0, 0x000f280068401fd7,
+  0x007d240060001f4b, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x000f2400602003ce, 0x0000000000000000, 0x00c36c06134030dd,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x00013c0061e0020c,
+  0x0001300065a01e3c, 0x007c200068401f0e, 0x00c2ec06132030bc, 0x0001bc0061e0020d,
+  0x007d440068401f57, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x00104000610004d2, 0x0000000000000000,
+  0x0000000000000000, 0x00011c006040011c, 0x0000000000000000, 0x0000000000000000,
+  0x0001c80062200213, 0x0001540061600170, 0x00c29806132030f4, 0x0000000000000000,
+  0x0000000000000000, 0x0003080060601eaa, 0x0000000000000000, 0x0000000000000000,
+  0x0001480061800158, 0x00089800608001e0, 0x0000000000000000, 0x003318019ac00cc8,
+  0x0005340060001e51, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0001a40066001e2d, 0x0000000000000000, 0x0000000000000000,
+  0x0001300060200139, 0x0000000000000000, 0x0089ec0067002281, 0x0000000000000000,
+  0x0000000000000000, 0x00376401b9e00ddc, 0x0000000000000000, 0x0000000000000000,
+  0x000f140060001f7a, 0x0000000000000000, 0x0005800060e01e66, 0x0001340064601e42,
+  0x0078dc0060801e39, 0x0000000000000000, 0x0000000000000000, 0x007c140068a01f85,
+  0x0000000000000000, 0x0000000000000000, 0x000e5c0068a01fcc, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x00c3c006132030f8,
+  0x007a840060401ead, 0x007c040068401f07, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0001d400604000fb, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x007c280068a01f8a, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0001040060c00102, 0x0000000000000000, 0x0000000000000000,
+  0x0005680060e01e64, 0x00890c0067002244, 0x008934006700226d, 0x0000000000000000,
+  0x0000000000000000, 0x000358006080022a, 0x00019c0064e00123, 0x0078d80060801e38,
+  0x0000000000000000, 0x0003d40061001e4f, 0x0000000000000000, 0x0001ac0064e00137,
+  0x0001b00064601e37, 0x00351801a7c00d4a, 0x0010e000610004e5, 0x0000000000000000,
+  0x0000000000000000, 0x00271c013ae009cc, 0x0001bc0061201ecf, 0x0004080060001eb0,
+  0x0001380060200143, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0001100066201e0e, 0x00189c00ca800623, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0089900067002270, 0x0001540061201ee6,
+  0x000e5c0062601f28, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0003080060201ea4, 0x00018400618001ce, 0x000ee40068401fd6, 0x0000000000000000,
+  0x0000000000000000, 0x00039000608001df, 0x0000000000000000, 0x0000000000000000,
+  0x008acc00670022eb, 0x000efc0062601f40, 0x0000000000000000, 0x0000000000000000,
+  0x002d1c0167c00b4b, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0001c00060201e55, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0001d00065a01e71, 0x0000000000000000,
+  0x0000000000000000, 0x007da00060001f6a, 0x002e48017ae00b94, 0x007ca00068a01f98,
+  0x0001dc0060e01e87, 0x008a4400670022e2, 0x0000000000000000, 0x0000000000000000,
+  0x0001640060800232, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0008b80060800230, 0x0001d4006080016b,
+  0x0000000000000000, 0x0000000000000000, 0x007c040060201f05, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x00037000602001d7, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0001040060800100,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0001b800606000f1,
+  0x0000000000000000, 0x0000000000000000, 0x0005ac0061001e7b, 0x0006bc0061201eec,
+  0x007c600060201f1c, 0x0000000000000000, 0x007d440060201f55, 0x0001140065000118,
+  0x0005300060001e50, 0x0000000000000000, 0x0000000000000000, 0x008648006700219b,
+  0x0000000000000000, 0x0001bc0061600151, 0x0000000000000000, 0x00013800606000d1,
+  0x0000000000000000, 0x0000000000000000, 0x0001880064601e05, 0x0000000000000000,
+  0x0000000000000000, 0x0013a400610004eb, 0x007fd80068a01ff7, 0x00011c0060c0011e,
+  0x007db80068a01fae, 0x0000000000000000, 0x0001540061e00214, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x00018400604000e2, 0x0000000000000000, 0x0000000000000000, 0x00104c0060200403,
+  0x00882c006700220c, 0x0001e40064601ef5, 0x00039800608001e3, 0x0001e80060401e91,
+  0x0001200065c01e2a, 0x007d8c0068a01fa3, 0x0000000000000000, 0x007c640060001f1b,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0001c00060e01e57, 0x00c33c06132030d0, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0001100060e01e0a,
+  0x000e5c0060001fca, 0x0000000000000000, 0x0000000000000000, 0x0001dc0060201e83,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x007ca00060001f2a, 0x00011400604000ca, 0x0010d40060000450,
+  0x0089f000670022e0, 0x007c1c0068a01f87, 0x00c12c061320304c, 0x0000000000000000,
+  0x0001a40061e00209, 0x0000000000000000, 0x0001d40060c0016d, 0x0000000000000000,
+  0x0001200060400124, 0x0001a00060e01e23, 0x0000000000000000, 0x0000000000000000,
+  0x007c100068a01f84, 0x0006840060601ee1, 0x0000000000000000, 0x00014c0064601e62,
+  0x0000000000000000, 0x00040c0060601eb5, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000f40067002260, 0x00012c0064601e32, 0x0000000000000000,
+  0x0010e8006020045c, 0x0001b80060200144, 0x007cc00068401f36, 0x0001940065000119,
+  0x0001e40061201ef7, 0x0002a00068401fc1, 0x044d1c226ae1134c, 0x0000000000000000,
+  0x0000000000000000, 0x0001ac0064601e33, 0x0001b00064e0013c, 0x00013c006220020e,
+  0x0001d40062200217, 0x0002a00060200385, 0x007b340060401ed9, 0x0000000000000000,
+  0x0000000000000000, 0x0011d40061e00477, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0001100065a01e12, 0x0010400060c004d0, 0x0001040062200202,
+  0x007d940068a01fa5, 0x0000000000000000, 0x00011c0060801e20, 0x0003a80060201ebf,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x00106000610004e4, 0x0000000000000000, 0x0000000000000000, 0x00018400600000e0,
+  0x0001640064601ef4, 0x000190006180010f, 0x00c1c80613403074, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0001e8006180017e, 0x0000000000000000,
+  0x0464d42326011938, 0x0000000000000000, 0x0000000000000000, 0x0003f000602001d8,
+  0x0011580061000457, 0x0000000000000000, 0x0456e422b5e115bb, 0x0000000000000000,
+  0x007da00068a01fa8, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x00033c0060201e2e, 0x0000000000000000,
+  0x00351801aae00d4c, 0x00019400604000ea, 0x00c1e0061340307a, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x00108c0060c0040e,
+  0x0000000000000000, 0x00011400600000c8, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0001a400602000ed, 0x0001bc0064601ecd,
+  0x003118018ac00c48, 0x0001d400610000fc, 0x000ed40062801f11, 0x00031c0060201e08,
+  0x0007a800608001ec, 0x0000000000000000, 0x0000000000000000, 0x0006840060201edb,
+  0x0000000000000000, 0x008aa400670022ae, 0x00c2e406132030ba, 0x00040c0060201eaf,
+  0x0000000000000000, 0x0000000000000000, 0x00192000ca800624, 0x007cb80068a01f9e,
+  0x007da40060001f6b, 0x0000000000000000, 0x008ac800670022ea, 0x0003280060601ec4,
+  0x0001b80060e01e45, 0x000e540062601f18, 0x00c274061320309e, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x007cc00060201f34,
+  0x0000000000000000, 0x0000000000000000, 0x000ed400602003ad, 0x0000000000000000,
+  0x007d840068401f67, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0001380060e01e44, 0x0000000000000000, 0x002f18017ae00bcc,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x000edc0062801f21,
+  0x0079680060801e5c, 0x0001d00061001e97, 0x0003a80060601ec5, 0x00018c0064e000e7,
+  0x007d900068a01fa4, 0x00c1ec061320307c, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0001840060c00103, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x007c840068a01f91, 0x00013c00604000d4,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x007ce00068401f3e,
+  0x0001a4006500012f, 0x00110c00616004f3, 0x008a1c0067002289, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0088200067002209,
+  0x0000000000000000, 0x0000000000000000, 0x0001040064601ea0, 0x0000000000000000,
+  0x00019400600000e8, 0x00031800608001e2, 0x0000000000000000, 0x0006bc0064601ef0,
+  0x0001480062200212, 0x006c440366a01b12, 0x00108c00608004ee, 0x0001140060c00114,
+  0x0000000000000000, 0x00012400610000cf, 0x000efc0060001f78, 0x007d000060001f42,
+  0x0000000000000000, 0x0001a40060600129, 0x0000000000000000, 0x0000000000000000,
+  0x000130006180013d, 0x0001d4006140016f, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x00014c0064e0015e, 0x0003540061001e4e, 0x00c13c0613203050, 0x0000000000000000,
+  0x0000000000000000, 0x000e640062601f38, 0x00012c0064e00136, 0x0001580060601e7c,
+  0x0000000000000000, 0x0001540064801e72, 0x0003280060201ebe, 0x007d200060001f4a,
+  0x0000000000000000, 0x0001cc006040015d, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0001500061800164,
+  0x0003500060201ed0, 0x0001300064e0013b, 0x0010e0006000045d, 0x0000000000000000,
+  0x007db00068a01fac, 0x0001bc006220020f, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x000e9400610003ab, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x000e440060001fba,
+  0x008aa000670022ad, 0x0000000000000000, 0x0001900066201e0f, 0x0001c80061e00211,
+  0x000e540060001fc8, 0x00106000608004e2, 0x00874000670021cd, 0x0003080061201ea8,
+  0x0001840060800101, 0x00c31806132030c7, 0x0000000000000000, 0x007d040060201f45,
+  0x0000000000000000, 0x04426c221741109c, 0x00013c00600000d2, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0001bc006080014d, 0x0452e42297a114be,
+  0x0000f0006700226e, 0x000e7c0062801f49, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x007cbc0068a01f9f, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x007c240068401f0f, 0x0000000000000000, 0x0001940060c00115,
+  0x0000000000000000, 0x0000000000000000, 0x0001840062200203, 0x00c1bc0613203070,
+  0x0000000000000000, 0x0000000000000000, 0x0001140060800112, 0x0001500064c0021a,
+  0x0010d40060c004d7, 0x0001600060e01e8a, 0x00c3c806132030fa, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0001d400618001d4, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x007da40068a01fa9, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0001c80066201e5f, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0001640061201ef6, 0x008a0c0067002285, 0x006cfc0366a01b41, 0x0001cc0061800161,
+  0x007efc0068401fcf, 0x0000000000000000, 0x0000000000000000, 0x0006800060001edc,
+  0x00056c0060e01e65, 0x007d840060201f65, 0x007efc0060201fce, 0x00013c00636001a0,
+  0x0003500060601ed6, 0x0010e00060c00439, 0x007dc00068a01fb2, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0010b400610004ec, 0x00c1d40613203076,
+  0x0000000000000000, 0x007ce40060001f3b, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x000e440060c01fb8, 0x0001d00061800165, 0x000e640060001fda,
+  0x003328019aa00ccb, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0001b40060201e3f, 0x0010600060c00419, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x007ce00060201f3c, 0x0000000000000000,
+  0x000ea40062801f69, 0x00013c0060c0014e, 0x0000000000000000, 0x0000000000000000,
+  0x0001a00064601e25, 0x0001bc0060c0014f, 0x0000000000000000, 0x007d880068a01fa2,
+  0x0001d40064601ee5, 0x0000000000000000, 0x0000000000000000, 0x000ec400602003ac,
+  0x00111c00610004f5, 0x0000000000000000, 0x0000000000000000, 0x000e440062601f08,
+  0x000f140062801f51, 0x0000000000000000, 0x0005fc0060e01e9b, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0001940060800113, 0x00019c0060e00121,
+  0x0010cc0060200453, 0x0000000000000000, 0x007c240060201f0d, 0x0000000000000000,
+  0x0000000000000000, 0x000ea4006020038f, 0x00012400618001cf, 0x0010d40061000451,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0001e00060e01e8b,
+  0x0000000000000000, 0x0000000000000000, 0x0003bc0060201e2f, 0x000a4800618001ef,
+  0x00039400602001fb, 0x007c440060201f15, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0001d00064c0021b, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0001940062200207,
+  0x00010c0064e000c7, 0x0000000000000000, 0x0001540065000172, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0001140062200206, 0x0001500066201e6e,
+  0x0001e400602000fd, 0x0001840064601ea1, 0x0003d4006080022d, 0x000f240062601f60,
+  0x0000000000000000, 0x0000000000000000, 0x0010e000608004e3, 0x0001300064601e36,
+  0x0001e80064601e93, 0x0008a00060c01e1c, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x000e440068a01fbc, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0001040061201ea2, 0x0000000000000000,
+  0x000e440060801fb9, 0x00011c00618001e6, 0x0003a80061201ec3, 0x0001400060e01e56,
+  0x007dac0068a01fab, 0x0000000000000000, 0x0089dc0067002279, 0x001060006000040d,
+  0x007c840060001f23, 0x0000000000000000, 0x0001180060e01e1e, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0013a000610004ea, 0x00013c006080014c,
+  0x0004480060201e16, 0x00c1980613203067, 0x0000000000000000, 0x0001bc00600000f2,
+  0x00c164061320305a, 0x007c0c0068a01f83, 0x0000000000000000, 0x0000000000000000,
+  0x0079880060e01e68, 0x007d640060001f5b, 0x0006dc00618001ee, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x00015400604000db, 0x0000000000000000, 0x0001040064a01e00,
+  0x0001b80064601e47, 0x00019c00602001f5, 0x008a080067002284, 0x0000000000000000,
+  0x007c880068a01f92, 0x00c1440613203052, 0x007c980068a01f96, 0x00011400610000cb,
+  0x0000000000000000, 0x00012400604000ce, 0x0000000000000000, 0x0000000000000000,
+  0x000eb80068a01fc4, 0x00112c00610004f9, 0x00089c00608001e1, 0x0001380064601e46,
+  0x0001d40066001e75, 0x0010180061000407, 0x00110c00608004ef, 0x0000000000000000,
+  0x00796c0060801e5d, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x000110006180010e, 0x00040c0061201eb3,
+  0x0000000000000000, 0x0000000000000000, 0x00011c0064e00122, 0x008a4800670022e3,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x00108c00616004f2,
+  0x0000000000000000, 0x0001e40060601ef9, 0x00044c0060201e17, 0x007f180068a01fc7,
+  0x0000000000000000, 0x007c800068401f26, 0x0000000000000000, 0x0001b00065a01e3d,
+  0x0000000000000000, 0x0001d400636001b0, 0x008a180067002288, 0x00c35406132030d6,
+  0x0001a00061001e27, 0x007c800060201f24, 0x00c14c0613203054, 0x00351c01a7c00d4b,
+  0x0000000000000000, 0x007c180068a01f86, 0x0000000000000000, 0x0001100064e01e10,
+  0x0024c00127800931, 0x0001040061e00200, 0x000e640060801fd9, 0x002f1c0177c00bcb,
+  0x007cc40060001f33, 0x0000000000000000, 0x0001400060201e54, 0x0001c80060200155,
+  0x0001680066201e94, 0x0000000000000000, 0x0001940064601eb9, 0x007dd00068a01fc2,
+  0x0000000000000000, 0x0006bc0060001eea, 0x0000000000000000, 0x00c2cc06132030b4,
+  0x0000000000000000, 0x0001140064601eb8, 0x000ee40062601f30, 0x000f240068a01ff3,
+  0x0000000000000000, 0x0001a00064e01e29, 0x0001bc00604000f4, 0x000ec40068401fb6,
+  0x0000000000000000, 0x0006840064601ee3, 0x007c940068a01f95, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x00376401bbe00dde, 0x0000000000000000,
+  0x000edc00602003ae, 0x0000000000000000, 0x00015c0060400174, 0x0000000000000000,
+  0x00015400600000d9, 0x000e5c0062801f29, 0x00c15c0613203058, 0x00019400610000eb,
+  0x0000000000000000, 0x0001080066201e06, 0x0001900060e01e0b, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0001cc0064e0015f, 0x0000000000000000,
+  0x00012400600000cc, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0001ac00618001e9, 0x00110c0060c0045e, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x00c2fc06132030c0, 0x0000000000000000,
+  0x0000000000000000, 0x00018c0060200107, 0x00c1a00613203069, 0x0000000000000000,
+  0x0001a800618001f0, 0x0000000000000000, 0x0001280060400134, 0x0000000000000000,
+  0x0001640060601ef8, 0x0003280061201ec2, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0005a00060201e78, 0x000f2c0060001fe2, 0x0000000000000000,
+  0x0000000000000000, 0x00c34806134030d4, 0x0000000000000000, 0x0003500061201ed4,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0024a00127800929, 0x0000000000000000, 0x0001d00066201e6f,
+  0x000e940060001fea, 0x0000000000000000, 0x0000000000000000, 0x007c000060001f02,
+  0x0000000000000000, 0x000e640060c01fd8, 0x007d800060201f64, 0x0000000000000000,
+  0x0000000000000000, 0x0001c80060e01e59, 0x0003880060201ea5, 0x000f280060001fd2,
+  0x0000000000000000, 0x0001b40060e01e41, 0x00798c0060e01e69, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x006c1c0366a01b08, 0x0000000000000000,
+  0x0000000000000000, 0x00013c00610000d6, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0001bc00618001d2, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0003d8006080022b, 0x00014c006020015a, 0x007c200060001f0a,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x00012c0060201e30, 0x00015c0060001e80, 0x0001540060c0016c, 0x007ff80060001fdd,
+  0x0001b80064e00146, 0x000edc0068401fc6, 0x008ad400670022ed, 0x0000000000000000,
+  0x0000000000000000, 0x0001840061201ea3, 0x0001480061e00210, 0x0000000000000000,
+  0x000f380068a01ff4, 0x000114006180011a, 0x0000000000000000, 0x0001240060c0012c,
+  0x001b0400ca8006c2, 0x007c080068a01f82, 0x0000000000000000, 0x007c400060001f12,
+  0x0000000000000000, 0x0001380064e00145, 0x0000000000000000, 0x0000000000000000,
+  0x007d400060201f54, 0x0000000000000000, 0x00376401b9400dda, 0x0006c00060001eeb,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x00018c0060e0010b, 0x0000000000000000, 0x0000000000000000, 0x0001a80060400135,
+  0x0003d00060001ed3, 0x000f140068401fe6, 0x0000000000000000, 0x00016400602000dd,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0001e40060e01e8f,
+  0x000f4800602003d3, 0x0001840064a01e01, 0x0089cc0067002275, 0x0000000000000000,
+  0x0001a400610000ef, 0x0001ac0066201e35, 0x0001b00066201e3b, 0x0000000000000000,
+  0x0000000000000000, 0x0001a0006180021f, 0x0001bc00636001a1, 0x0000000000000000,
+  0x007d800068401f66, 0x0000000000000000, 0x0000000000000000, 0x007ca40060201f2d,
+  0x0001100064601e0c, 0x0000000000000000, 0x0000000000000000, 0x00010400606000c3,
+  0x000e6400610003aa, 0x002d1c016ac00b48, 0x007d240060201f4d, 0x0000000000000000,
+  0x0000000000000000, 0x0001480066201e5e, 0x0003880060601eab, 0x0001940064e00229,
+  0x00377001b9400ddd, 0x00c36006132030d9, 0x000f240060001f7c, 0x0089c80067002274,
+  0x0000000000000000, 0x0000000000000000, 0x0001140064e00228, 0x0001500060e01e6a,
+  0x0033180198400cca, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0004080060601eb4, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x00014c0060e01e60, 0x00036000602001fe, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0001580064601e7e, 0x0000000000000000,
+  0x0000000000000000, 0x000154006080016a, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x000194006180011b, 0x0000000000000000, 0x0001840061e00201,
+  0x0000000000000000, 0x0000000000000000, 0x0001680060200179, 0x0000000000000000,
+  0x0001cc0064601e63, 0x000124006080012a, 0x0005340060201e53, 0x0001e80060e0017c,
+  0x000ee40060001f76, 0x000efc0062801f41, 0x007c380068a01f8e, 0x000e7c006020038c,
+  0x007d400068401f56, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x006ce80366a01b3b, 0x0001d80060601e7d, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0001540062200216, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0001640060e01e8e, 0x007b300060401ed8,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x00c2dc06132030b8,
+  0x0000000000000000, 0x007c040068a01f81, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0001d400602000fa, 0x0000000000000000, 0x007ca40068401f2f,
+  0x0001a00060400125, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x00037000608001d5, 0x000e940060801fe9, 0x0003540060201e4c, 0x0000000000000000,
+  0x0000000000000000, 0x00010400602000c1, 0x0000000000000000, 0x0000000000000000,
+  0x00c3bc06132030f7, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x000f040062601fe4, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x00c36c06132030dc,
+  0x0000000000000000, 0x007df00068a01ff2, 0x00013c00618001d1, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0001bc00610000f6, 0x0000000000000000,
+  0x0004080060201eae, 0x00013800600001f8, 0x0001d40065a01e77, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x00010c0060200106, 0x0000000000000000, 0x0000000000000000,
+  0x000154006140016e, 0x006c240366a01b0a, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0003080060001ea6, 0x007cac0068a01f9b, 0x0000000000000000,
+  0x0001680060e0017b, 0x0000000000000000, 0x0001140066001e1a, 0x00039800602001fd,
+  0x0000000000000000, 0x0001e8006020017a, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x000ec40062801f01, 0x007da00068401f6e,
+  0x00031400602001fa, 0x006cf80366a01b40, 0x00874800670021cf, 0x000f1400602003cd,
+  0x00c1900613203065, 0x00c33c06134030d1, 0x007da00060201f6c, 0x0001040065000104,
+  0x00136400610004db, 0x007dbc0068a01faf, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x000124006220020a, 0x0001600061001e8c, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0001a400618001d0, 0x0001e00061001e8d,
+  0x0001d40060600169, 0x0000000000000000, 0x0001200060e01e22, 0x007c040060001f03,
+  0x007c000068a01f80, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x000e940060c01fe8, 0x0000000000000000, 0x00271c0137c009cb, 0x0000000000000000,
+  0x0001040060e00226, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x006c340366a01b0e, 0x0001540064601ee4, 0x0001900064601e0d, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0006800061201ede, 0x0000000000000000, 0x007d440060001f53,
+  0x0005300060201e52, 0x0000000000000000, 0x0000000000000000, 0x007c200068a01f88,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x00189c00caa00625, 0x044d1c2267c1134b, 0x0000000000000000,
+  0x00010c0060e0010a, 0x00011c00602001f4, 0x0001d00060e01e6b, 0x00015400610000dc,
+  0x0000000000000000, 0x0000000000000000, 0x0001940066001e1b, 0x0000000000000000,
+  0x0000000000000000, 0x00018400606000e3, 0x0001480060200154, 0x0010c000610004d3,
+  0x007c9c0068a01f97, 0x003318019aa00cc7, 0x04429422174110ab, 0x000ee40060801fd1,
+  0x0000000000000000, 0x0000000000000000, 0x00c32006132030c9, 0x0001b0006180013e,
+  0x007c300068a01f8c, 0x0001380065a01e4a, 0x0003f000618001da, 0x007c640060201f1d,
+  0x007d9c0068a01fa7, 0x0000000000000000, 0x0000000000000000, 0x0010dc00610004df,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0001c80064601e5b, 0x0000000000000000, 0x007ca00068401f2e, 0x0001b40064601e43,
+  0x0001dc0060001e81, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0456e022b5e115ba, 0x0007ac00608001ed,
+  0x0000000000000000, 0x007c2c0068a01f8b, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x000ed40062601f10,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x00c2bc06132030b0, 0x00037000600001db, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x00015c0064601e88,
+  0x0000000000000000, 0x0003880061201ea9, 0x0001b800600001f9, 0x00c174061320305e,
+  0x0001e400610000ff, 0x0000000000000000, 0x0000000000000000, 0x007c600060001f1a,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0001240064601eca, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x00011c0060e00120, 0x00c1ec061340307d,
+  0x00015c0061001e84, 0x0003a80060001ec1, 0x00c16c061320305c, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x00018400602000e1, 0x0001480060e01e58, 0x00c1c80613203073, 0x0000000000000000,
+  0x0000000000000000, 0x000ee40060c01fd0, 0x0000000000000000, 0x0000000000000000,
+  0x007ae00060401ec6, 0x0000000000000000, 0x0000000000000000, 0x00110c00610004f1,
+  0x0011d00061e00476, 0x00c31006132030c5, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x00015400636001af,
+  0x000e5c0060200389, 0x00c1e00613203079, 0x0001940060601ebd, 0x0001dc0060400175,
+  0x007cb00068a01f9c, 0x00c1180613203094, 0x0000000000000000, 0x0000000000000000,
+  0x007ca00060201f2c, 0x0001140060601ebc, 0x0001500064601e6c, 0x0001080060e01e02,
+  0x0089e80067002280, 0x044264221741109a, 0x0000000000000000, 0x0001a400600000ec,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0001e80066201e95,
+  0x0000000000000000, 0x0005a80061001e7a, 0x0000000000000000, 0x0000000000000000,
+  0x007da40068401f6f, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x007da40060201f6d, 0x00875000670021ce,
+  0x0089d80067002278, 0x007a800060c01eb6, 0x0001900064e01e11, 0x00c2f406132030be,
+  0x0000000000000000, 0x0000000000000000, 0x0001cc0060e01e61, 0x0001e40061401e99,
+  0x0010ac00610004f8, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x007cc00060001f32, 0x0000000000000000, 0x0000000000000000, 0x0002a00060001fed,
+  0x0088940067002226, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0006c00064601ef1,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x00015400618001d3, 0x0000000000000000, 0x0001b80065a01e4b, 0x0000000000000000,
+  0x00192800ca800626, 0x0000000000000000, 0x0001840060e00227, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x000ee400610003ca, 0x0000000000000000, 0x002f180177c00bca, 0x0001a00065c01e2b,
+  0x0452e422974114bb, 0x0000000000000000, 0x0003f000600001dc, 0x0001380066201e48,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0008bc0060800231,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0001c80064e00157, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x00019400602000e9, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x00c1bc0613403071, 0x0000000000000000, 0x0000000000000000,
+  0x00011400602000c9, 0x00013c00650001ea, 0x007d000060201f44, 0x0000000000000000,
+  0x006d080366a01b43, 0x0000000000000000, 0x0001a400604000ee, 0x0010540060000400,
+  0x0001d40061201ee7, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0008a40060c01e1d, 0x0000000000000000, 0x00037000618001d9,
+  0x0006840060001edd, 0x0000000000000000, 0x0000000000000000, 0x00040c0060001eb1,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0003280060001ec0, 0x0001680064601e92,
+  0x000e540062801f19, 0x0001940065a01e19, 0x0001cc006020015b, 0x0032fc019aa00cc0,
+  0x0001840065000105, 0x0003d40060201e4d, 0x0006800060601ee0, 0x007d200060201f4c,
+  0x0001140065a01e18, 0x0000000000000000, 0x000ed40060001f72, 0x0000000000000000,
+  0x0000000000000000, 0x007c3c0068a01f8f, 0x0000000000000000, 0x0004080061201eb2,
+  0x00c1d40613403077, 0x007c900068a01f94, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0010d80060c004c2, 0x00189c00ca600622, 0x000e440060200386,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x007d980068a01fa6, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x000ea40062601f68, 0x00013c00606000d5,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x007c240068a01f89, 0x0000000000000000, 0x0000000000000000,
+  0x0001940060e00117, 0x00019c0060801e21, 0x006c140366a01b06, 0x0000000000000000,
+  0x0089200067002249, 0x0000000000000000, 0x0001500064e00162, 0x0001140060e00116,
+  0x0001240061201ec8, 0x0000000000000000, 0x000efc00602003cc, 0x0000000000000000,
+  0x0000000000000000, 0x0001a4006080012b, 0x0010540060c004d6, 0x0001d40061600171,
+  0x0000f8006700226f, 0x008a8800670022ac, 0x0000000000000000, 0x00c2c406132030b2,
+  0x0000000000000000, 0x0000000000000000, 0x0001d00064601e6d, 0x00039c0060201e09,
+  0x00014c0064c00218, 0x0444c42224e1112e, 0x0000000000000000, 0x0000000000000000,
+  0x000e640062801f39, 0x0000000000000000, 0x0003d00061201ed5, 0x007a800060401eac,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x000f240062801f61, 0x007d840060001f63,
+  0x0006800060201eda, 0x0000000000000000, 0x0000000000000000, 0x0003500060001ed2,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0001d80064601e7f, 0x0000000000000000, 0x0088f00067002241,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x00010400614000c5, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0010f800610004e7, 0x0001c80061800159, 0x0001540066001e74, 0x0001b80066201e49,
+  0x000e540060200388, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x007ce00060001f3a, 0x007d040060001f43,
+  0x0000000000000000, 0x00013c00602000d3, 0x0001240066001e2c, 0x007c840068401f27,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0003f000608001d6, 0x0000000000000000, 0x0000000000000000, 0x0001880066201e07,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x007d640068401f5f, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x000edc0068a01fc3, 0x00019c0060c0011f,
+  0x0001dc0061001e85, 0x001b4800ca8006d3, 0x001b5400ca8006c0, 0x007c240060001f0b,
+  0x00c17c0613203060, 0x0000000000000000, 0x0000000000000000, 0x0001240061e00208,
+  0x0000000000000000, 0x0000000000000000, 0x00c3c406132030f9, 0x0001a40060c0012d,
+  0x0001bc00650001eb, 0x0000000000000000, 0x007c440060001f13, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0005a40060201e79, 0x0006c00061201eed,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0024cc0127800934,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0001640061000178,
+  0x0001480064601e5a, 0x008aac00670022af, 0x0000000000000000, 0x0001e40060001ef3,
+  0x000f4800610003d4, 0x0000000000000000, 0x00109c00610004f4, 0x007c800068a01f90,
+  0x007efc0060001fcd, 0x0001a4006220020b, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x000120006180021e, 0x007c340068a01f8d, 0x00880c0067002204,
+  0x0000000000000000, 0x0000000000000000, 0x0001380061800147, 0x0000000000000000,
+  0x007ce40060201f3d, 0x0089940067002271, 0x006cf00366a01b3d, 0x00010400610000c4,
+  0x000e64006020038a, 0x00012c0066201e34, 0x000edc0062601f20, 0x0000000000000000,
+  0x0000000000000000, 0x0001340060201e3e, 0x0000000000000000, 0x0000000000000000,
+  0x007c840060201f25, 0x0000000000000000, 0x0001080064601e04, 0x007ed80068a01fb7,
+  0x0010c00060c004d1, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x00013c0060e0022e, 0x0004480060001e14, 0x0001200064e01e28, 0x0000000000000000,
+  0x0001bc0060e0022f, 0x0452e422960114bc, 0x0000000000000000, 0x0001d40064801e73,
+  0x0000000000000000, 0x0000000000000000, 0x000ec40060001f70, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x00012c00618001e8,
+  0x0000000000000000, 0x0000000000000000, 0x0001540060600168, 0x00107800610004e6,
+  0x0000000000000000, 0x0001dc0061401e98, 0x00031800602001fc, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x000ea40060001ffa, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0001ac0060201e31, 0x0001b0006020013a,
+  0x0001d40061e00215, 0x0000000000000000, 0x0000000000000000, 0x0003e000602001ff,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0001d00064e00163, 0x000f1400610003cb, 0x00c3f406132030fe, 0x00018c006180010d,
+  0x00136000610004da, 0x00c2b406132030ae, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0001e40060400177, 0x00044c0060001e15,
+  0x00888c0067002224, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x00c35406134030d7, 0x000f2c0068401fe7, 0x0000000000000000,
+  0x007ce40068401f3f, 0x007d840068a01fa1, 0x0000000000000000, 0x0000000000000000,
+  0x007d800068a01fa0, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0010d800610004dd, 0x00c1840613203062, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0001340060e01e40, 0x0000000000000000, 0x0000000000000000, 0x007ca80068a01f9a,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0001bc00602000f3,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x00014c0061800160, 0x007d640060201f5d, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x000f140062601f50, 0x0010580060c004c1,
+  0x00015400602000da, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0001940061201ebb, 0x00019c006040011d, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0001140061201eba,
+  0x0001cc0064c00219, 0x0001240060600128, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x001068006020040c, 0x0010540061000401, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x000e940062801f59,
+  0x000f140060c01fe0, 0x00018c0060400109, 0x00c1540613203056, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0003d00060601ed7, 0x00865000670021ae,
+  0x0001900065a01e13, 0x0001480064e00156, 0x0001540065a01e76, 0x0001b80061800148,
+  0x0000000000000000, 0x0001e40060800233, 0x000e840062801fec, 0x0089840067002262,
+  0x0000000000000000, 0x0000000000000000, 0x00c34806132030d3, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0001200061001e26, 0x007ca40068a01f99,
+  0x007c800060001f22, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x007cc40060201f35,
+  0x00010400618001cd, 0x007d800060001f62, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0003880060001ea7,
+  0x0000000000000000, 0x0000000000000000, 0x0001dc0064601e89, 0x000eb00068a01fb4,
+  0x0006bc0060201ee8, 0x00c2d406132030b6, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x00013c0061600150, 0x0001300066201e3a, 0x000f240068401ff6,
+  0x0001200064601e24, 0x000ec40068a01fb3, 0x0001bc00606000f5, 0x0000000000000000,
+  0x000e7c0062601f48, 0x0001d40065000173, 0x00014c006040015c, 0x00113400610004ed,
+  0x000ec40060801fb1, 0x0000000000000000, 0x0000000000000000, 0x0005840060e01e67,
+  0x00010c006180010c, 0x000edc0060001f74, 0x00015c0060201e82, 0x00105800610004dc,
+  0x007cb40068a01f9d, 0x0000000000000000, 0x0000000000000000, 0x0001940061e00205,
+  0x00019c00618001e7, 0x00018400614000e5, 0x000ea40068a01ffc, 0x0000000000000000,
+  0x000168006180017d, 0x0000000000000000, 0x0001140061e00204, 0x00012400602000cd,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x007d400060001f52, 0x0000000000000000, 0x0006c00060601eef,
+  0x0000000000000000, 0x0000000000000000, 0x000f140060801fe1, 0x0001880060e01e03,
+  0x0000000000000000, 0x0001980060e01e1f, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0003d00060201ed1, 0x007da80068a01faa, 0x0000000000000000,
+  0x0001640060400176, 0x00108c00610004f0, 0x0000000000000000, 0x0000000000000000,
+  0x007ae40060401ec7, 0x000f2c00602003b0, 0x00c134061320304e, 0x007a840060c01eb7,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x007cc40068401f37,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x000354006080022c,
+  0x000e94006020038e, 0x007ca40060001f2b, 0x007c000060201f04, 0x00010400604000c2,
+  0x002d1c016ae00b4c, 0x006c2c0366a01b0c, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x000f280060200390, 0x00031000608001de,
+  0x000f040062801fe5, 0x0089140067002247, 0x00c36006134030da, 0x0006bc0060601eee,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+};
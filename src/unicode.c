@@ -0,0 +1,166 @@
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "../include/url/unicode.h"
+#include "unicode-tables.h"
+
+#define url_unicode__countof(array) (sizeof(array) / sizeof(array[0]))
+
+// https://www.unicode.org/versions/latest/core-spec/chapter-3/#G56669
+#define url_unicode__s_base  0xac00
+#define url_unicode__l_base  0x1100
+#define url_unicode__v_base  0x1161
+#define url_unicode__t_base  0x11a7
+#define url_unicode__l_count 19
+#define url_unicode__v_count 21
+#define url_unicode__t_count 28
+#define url_unicode__n_count (url_unicode__v_count * url_unicode__t_count)
+#define url_unicode__s_count (url_unicode__l_count * url_unicode__n_count)
+
+/**
+ * Find the value of the range containing `code_point` in a table of ranges
+ * sorted by their first code point, the first of which starts at or before
+ * `code_point`.
+ */
+static inline uint32_t
+url_unicode__find_range (const uint32_t ranges[][2], size_t len, uint32_t code_point) {
+  size_t low = 0, high = len;
+
+  while (high - low > 1) {
+    size_t mid = low + (high - low) / 2;
+
+    if (ranges[mid][0] <= code_point) low = mid;
+    else high = mid;
+  }
+
+  return ranges[low][1];
+}
+
+/**
+ * Lookups below the trie limit read the stage 1 entry of the block, which
+ * holds the stage 2 index of the block and the base offset of its data, and
+ * then the value itself. The offset stored in the value is relative to the
+ * base, so adding the base in its place makes it absolute.
+ */
+static inline uint32_t
+url_unicode__properties (uint32_t code_point) {
+  if (code_point < url__unicode_trie_limit) {
+    uint32_t block = url__unicode_property_trie_stage1[code_point >> url__unicode_property_trie_shift];
+
+    uint32_t value = url__unicode_property_trie_stage2[(block & 0xffff) + (code_point & ((1 << url__unicode_property_trie_shift) - 1))];
+
+    return value + ((block >> 16) << 19);
+  }
+
+  if (code_point > 0x10ffff) return url_bidi_other << 8;
+
+  return url_unicode__find_range(url__unicode_property_trie_high, url_unicode__countof(url__unicode_property_trie_high), code_point);
+}
+
+url_idna_status_t
+url__unicode_idna_status (uint32_t code_point, const uint32_t **mapping, size_t *len) {
+  uint32_t value;
+
+  if (code_point < url__unicode_trie_limit) {
+    uint32_t block = url__idna_trie_stage1[code_point >> url__idna_trie_shift];
+
+    value = url__idna_trie_stage2[(block & 0xffff) + (code_point & ((1 << url__idna_trie_shift) - 1))];
+
+    value += (block >> 16) << 8;
+  } else if (code_point > 0x10ffff) {
+    return url_idna_disallowed;
+  } else {
+    value = url_unicode__find_range(url__idna_trie_high, url_unicode__countof(url__idna_trie_high), code_point);
+  }
+
+  url_idna_status_t status = (url_idna_status_t) (value & 0x7);
+
+  if (status == url_idna_mapped) {
+    *mapping = &url__idna_mappings[value >> 8];
+    *len = (value >> 3) & 0x1f;
+  }
+
+  return status;
+}
+
+uint8_t
+url__unicode_combining_class (uint32_t code_point) {
+  return url_unicode__properties(code_point) & 0xff;
+}
+
+url_bidi_class_t
+url__unicode_bidi_class (uint32_t code_point) {
+  return (url_bidi_class_t) ((url_unicode__properties(code_point) >> 8) & 0xf);
+}
+
+url_joining_type_t
+url__unicode_joining_type (uint32_t code_point) {
+  return (url_joining_type_t) ((url_unicode__properties(code_point) >> 12) & 0x7);
+}
+
+bool
+url__unicode_is_mark (uint32_t code_point) {
+  return (url_unicode__properties(code_point) & 0x8000) != 0;
+}
+
+size_t
+url__unicode_decompose (uint32_t code_point, uint32_t result[4]) {
+  if (code_point >= url_unicode__s_base && code_point < url_unicode__s_base + url_unicode__s_count) {
+    uint32_t s = code_point - url_unicode__s_base;
+
+    result[0] = url_unicode__l_base + s / url_unicode__n_count;
+    result[1] = url_unicode__v_base + (s % url_unicode__n_count) / url_unicode__t_count;
+
+    if (s % url_unicode__t_count == 0) return 2;
+
+    result[2] = url_unicode__t_base + s % url_unicode__t_count;
+
+    return 3;
+  }
+
+  uint32_t value = url_unicode__properties(code_point);
+
+  size_t len = (value >> 16) & 0x7;
+
+  for (size_t i = 0; i < len; i++) {
+    result[i] = url__unicode_decompositions[(value >> 19) + i];
+  }
+
+  return len;
+}
+
+uint32_t
+url__unicode_compose (uint32_t first, uint32_t second) {
+  if (first >= url_unicode__l_base && first < url_unicode__l_base + url_unicode__l_count) {
+    if (second >= url_unicode__v_base && second < url_unicode__v_base + url_unicode__v_count) {
+      return url_unicode__s_base + ((first - url_unicode__l_base) * url_unicode__v_count + second - url_unicode__v_base) * url_unicode__t_count;
+    }
+
+    return 0;
+  }
+
+  if (first >= url_unicode__s_base && first < url_unicode__s_base + url_unicode__s_count) {
+    if ((first - url_unicode__s_base) % url_unicode__t_count == 0 && second > url_unicode__t_base && second < url_unicode__t_base + url_unicode__t_count) {
+      return first + second - url_unicode__t_base;
+    }
+
+    return 0;
+  }
+
+  uint32_t hash = (first * 0x9e3779b1) ^ second;
+
+  hash = (hash ^ hash >> 15) * 0x85ebca6b;
+
+  size_t mask = (1 << url__unicode_composition_bits) - 1;
+
+  uint64_t key = (uint64_t) first << 42 | (uint64_t) second << 21;
+
+  for (size_t i = (hash ^ hash >> 13) >> (32 - url__unicode_composition_bits);; i = (i + 1) & mask) {
+    uint64_t slot = url__unicode_compositions[i];
+
+    if (slot == 0) return 0;
+
+    if ((slot & ~(uint64_t) 0x1fffff) == key) return slot & 0x1fffff;
+  }
+}
@@ -38,5 +38,26 @@ url_get_query (const url_t *url);
 extern utf8_string_view_t
 url_get_fragment (const url_t *url);
 
+extern url_host_type_t
+url_get_host_type (const url_t *url);
+
+extern const uint8_t *
+url_get_host_address (const url_t *url);
+
+extern int32_t
+url_get_port_number (const url_t *url);
+
 extern int
 url_parse (url_t *url, const utf8_t *input, size_t len, const url_t *base);
+
+extern int
+url_parse_with_idna_cache (url_t *url, const utf8_t *input, size_t len, const url_t *base, url_idna_cache_t *cache);
+
+extern int
+url_domains_to_unicode (const utf8_string_view_t *hosts, size_t len, utf8_string_t *arena, utf8_string_view_t *result);
+
+extern int
+url_encode_binary (const url_t *url, utf8_string_t *result);
+
+extern int
+url_decode_binary (url_t *url, const utf8_t *input, size_t len, int flags, size_t *read);
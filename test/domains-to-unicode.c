@@ -0,0 +1,70 @@
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+#include <utf.h>
+#include <utf/string.h>
+
+#include "../include/url.h"
+
+#define view(s) utf8_string_view_init((utf8_t *) (s), strlen(s))
+
+int
+main () {
+  int e;
+
+  const char *input[] = {
+    "example.com",
+    "xn--bcher-kva.example",
+    "www.xn--fiqs8s.xn--fiqz9s",
+    "a--b.example",
+    "xn--a.example",
+    "xn--ab-fsf.example",
+    "xn--mgbh0fb.xn--kgbechtv",
+    "xn--mgbh0fb.com",
+    "xn--mgbh0fb.1com",
+    "192.168.0.1",
+    "[::1]",
+    "",
+  };
+
+  const char *expected[] = {
+    "example.com",
+    "bücher.example",
+    "www.中国.中國",
+    "a--b.example",
+    "xn--a.example",
+    "a\xe0\xa5\x8d" "b.example",
+    "مثال.إختبار",
+    "مثال.com",
+    "xn--mgbh0fb.1com",
+    "192.168.0.1",
+    "[::1]",
+    "",
+  };
+
+  size_t len = sizeof(input) / sizeof(input[0]);
+
+  utf8_string_view_t hosts[sizeof(input) / sizeof(input[0])];
+
+  for (size_t i = 0; i < len; i++) hosts[i] = view(input[i]);
+
+  utf8_string_t arena;
+  utf8_string_init(&arena);
+
+  utf8_string_view_t result[sizeof(input) / sizeof(input[0])];
+
+  e = url_domains_to_unicode(hosts, len, &arena, result);
+  assert(e == 0);
+
+  for (size_t i = 0; i < len; i++) {
+    printf("%s -> %.*s\n", input[i], (int) result[i].len, result[i].data);
+
+    assert(utf8_string_view_compare(result[i], view(expected[i])) == 0);
+  }
+
+  // The hosts are back to back in the arena.
+  assert(result[0].data == arena.data);
+  assert(result[len - 1].data + result[len - 1].len == arena.data + arena.len);
+
+  utf8_string_destroy(&arena);
+}
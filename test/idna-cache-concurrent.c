@@ -0,0 +1,78 @@
+#include <assert.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+#include <utf.h>
+#include <utf/string.h>
+
+#include "../include/url.h"
+#include "../include/url/idna-cache.h"
+
+#define threads 8
+#define per_thread 20000
+#define hosts 100
+
+static url_idna_cache_t *cache;
+
+static void *
+on_thread (void *data) {
+  // Start each thread on a different host, so that they insert different
+  // hosts at the same time as well as the same ones.
+  int offset = *(int *) data * hosts / threads;
+
+  for (int i = 0; i < per_thread; i++) {
+    int host = (i + offset) % hosts;
+
+    char input[64];
+    snprintf(input, 64, "https://bücher-%d.example/", host);
+
+    char expected[64];
+    snprintf(expected, 64, "https://xn--bcher-%d-", host);
+
+    url_t url;
+    url_init(&url);
+
+    int e = url_parse_with_idna_cache(&url, (utf8_t *) input, -1, NULL, cache);
+    assert(e == 0);
+
+    utf8_string_view_t href = url_get_href(&url);
+    assert(utf8_string_view_compare(utf8_string_view_substring(href, 0, strlen(expected)), utf8_string_view_init((utf8_t *) expected, strlen(expected))) == 0);
+
+    url_destroy(&url);
+  }
+
+  return NULL;
+}
+
+int
+main () {
+  int e;
+
+  // Smaller than the number of hosts, so that threads race on evictions.
+  e = url_idna_cache_init(64, &cache);
+  assert(e == 0);
+
+  pthread_t thread[threads];
+  int index[threads];
+
+  for (int i = 0; i < threads; i++) {
+    index[i] = i;
+
+    e = pthread_create(&thread[i], NULL, on_thread, &index[i]);
+    assert(e == 0);
+  }
+
+  for (int i = 0; i < threads; i++) {
+    pthread_join(thread[i], NULL);
+  }
+
+  uint64_t hits = url_idna_cache_hits(cache);
+  uint64_t misses = url_idna_cache_misses(cache);
+
+  printf("hits = %llu, misses = %llu\n", (unsigned long long) hits, (unsigned long long) misses);
+
+  assert(hits + misses == threads * per_thread);
+  assert(url_idna_cache_size(cache) <= 64);
+
+  url_idna_cache_destroy(cache);
+}
@@ -0,0 +1,72 @@
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+#include <utf.h>
+#include <utf/string.h>
+
+#include "../include/url/idna-cache.h"
+
+#define view(s) utf8_string_view_init((utf8_t *) (s), strlen(s))
+
+int
+main () {
+  int e;
+
+  url_idna_cache_t *cache;
+  e = url_idna_cache_init(64, &cache);
+  assert(e == 0);
+
+  utf8_string_t result;
+  utf8_string_init(&result);
+
+  e = url_idna_cache_get(cache, view("bücher.example"), &result);
+  assert(e == 0);
+  assert(result.len == 0);
+
+  e = url_idna_cache_put(cache, view("bücher.example"), view("xn--bcher-kva.example"));
+  assert(e == 1);
+
+  e = url_idna_cache_put(cache, view("bücher.example"), view("xn--bcher-kva.example"));
+  assert(e == 0);
+
+  e = url_idna_cache_get(cache, view("bücher.example"), &result);
+  assert(e == 1);
+  assert(utf8_string_view_compare(utf8_string_view(&result), view("xn--bcher-kva.example")) == 0);
+
+  assert(url_idna_cache_size(cache) == 1);
+  assert(url_idna_cache_hits(cache) == 1);
+  assert(url_idna_cache_misses(cache) == 1);
+
+  // Keep one host referenced while filling the cache well past its capacity.
+  for (int i = 0; i < 1000; i++) {
+    char host[32];
+    snprintf(host, sizeof(host), "host-%d.example", i);
+
+    e = url_idna_cache_put(cache, view(host), view(host));
+    assert(e == 1);
+
+    utf8_string_clear(&result);
+
+    e = url_idna_cache_get(cache, view("bücher.example"), &result);
+    assert(e == 1);
+  }
+
+  size_t size = url_idna_cache_size(cache);
+
+  printf("size = %zu\n", size);
+
+  assert(size >= 64 && size <= 64 + 15);
+
+  utf8_string_clear(&result);
+
+  e = url_idna_cache_get(cache, view("host-0.example"), &result);
+  assert(e == 0);
+
+  e = url_idna_cache_get(cache, view("host-999.example"), &result);
+  assert(e == 1);
+  assert(utf8_string_view_compare(utf8_string_view(&result), view("host-999.example")) == 0);
+
+  utf8_string_destroy(&result);
+
+  url_idna_cache_destroy(cache);
+}
@@ -0,0 +1,68 @@
+#include <assert.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <utf.h>
+#include <utf/string.h>
+
+#include "../include/url.h"
+
+static void
+test_host (const char *input, const char *base_input, url_host_type_t type, const uint8_t address[16], int32_t port) {
+  int e;
+
+  url_t base;
+  url_init(&base);
+
+  if (base_input) {
+    e = url_parse(&base, (utf8_t *) base_input, -1, NULL);
+    assert(e == 0);
+  }
+
+  url_t url;
+  url_init(&url);
+
+  e = url_parse(&url, (utf8_t *) input, -1, base_input ? &base : NULL);
+  assert(e == 0);
+
+  utf8_string_view_t host = url_get_host(&url);
+  printf("%s: host = %.*s, type = %d, port = %d\n", input, (int) host.len, host.data, url_get_host_type(&url), url_get_port_number(&url));
+
+  assert(url_get_host_type(&url) == type);
+  assert(url_get_port_number(&url) == port);
+
+  static const uint8_t zero[16];
+
+  assert(memcmp(url_get_host_address(&url), address ? address : zero, 16) == 0);
+
+  url_destroy(&url);
+  url_destroy(&base);
+}
+
+int
+main () {
+  static const uint8_t localhost[16] = {127, 0, 0, 1};
+  static const uint8_t private[16] = {192, 168, 0, 1};
+  static const uint8_t documentation[16] = {0x20, 0x01, 0x0d, 0xb8, 0, 0, 0, 0, 0, 0, 0xff, 0x00, 0x00, 0x42, 0x83, 0x29};
+  static const uint8_t mapped[16] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0xff, 0xff, 192, 0, 2, 128};
+
+  test_host("https://example.com/", NULL, url_host_type_domain, NULL, 443);
+  test_host("http://example.com:8080/", NULL, url_host_type_domain, NULL, 8080);
+  test_host("http://127.0.0.1/", NULL, url_host_type_ipv4, localhost, 80);
+  test_host("http://0xC0.0250.1:1234/", NULL, url_host_type_ipv4, private, 1234);
+  test_host("http://127.0.0.1./", NULL, url_host_type_ipv4, localhost, 80);
+  test_host("http://192.168.0.1.:8080/", NULL, url_host_type_ipv4, private, 8080);
+  test_host("http://%31%32%37.0.0.1/", NULL, url_host_type_ipv4, localhost, 80);
+  test_host("http://%31%32%37.0.0.1./", NULL, url_host_type_ipv4, localhost, 80);
+  test_host("http://\xef\xbc\x91\xef\xbc\x92\xef\xbc\x97.0.0.1/", NULL, url_host_type_ipv4, localhost, 80);
+  test_host("ws://[2001:db8::ff00:42:8329]/", NULL, url_host_type_ipv6, documentation, 80);
+  test_host("wss://[::ffff:192.0.2.128]:9000/", NULL, url_host_type_ipv6, mapped, 9000);
+  test_host("custom://host/path", NULL, url_host_type_opaque, NULL, -1);
+  test_host("custom://[2001:db8::ff00:42:8329]:1/", NULL, url_host_type_ipv6, documentation, 1);
+  test_host("file:///etc/hosts", NULL, url_host_type_empty, NULL, -1);
+  test_host("mailto:someone@example.com", NULL, url_host_type_empty, NULL, -1);
+
+  // The host is copied from the base.
+  test_host("/foo", "http://127.0.0.1:8080/bar", url_host_type_ipv4, localhost, 8080);
+  test_host("?q", "https://[2001:db8::ff00:42:8329]/", url_host_type_ipv6, documentation, 443);
+}
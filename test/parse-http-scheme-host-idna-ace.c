@@ -0,0 +1,19 @@
+#include "../include/url.h"
+#include "helpers.h"
+
+int
+main () {
+  test_parse(url, "http://XN--BCHER-KVA.ｅｘａｍｐｌｅ/foo/bar", NULL);
+
+  test_get(url, href, "http://xn--bcher-kva.example/foo/bar");
+  test_get(url, scheme, "http");
+  test_get(url, username, "");
+  test_get(url, password, "");
+  test_get(url, host, "xn--bcher-kva.example");
+  test_get(url, port, "");
+  test_get(url, path, "/foo/bar");
+  test_get(url, query, "");
+  test_get(url, fragment, "");
+
+  url_destroy(&url);
+}
@@ -0,0 +1,54 @@
+#include <assert.h>
+#include <stdio.h>
+#include <utf.h>
+#include <utf/string.h>
+
+#include "../include/url.h"
+#include "../include/url/idna-cache.h"
+#include "helpers.h"
+
+int
+main () {
+  int e;
+
+  url_idna_cache_t *cache;
+  e = url_idna_cache_init(16, &cache);
+  assert(e == 0);
+
+  for (int i = 0; i < 3; i++) {
+    url_t url;
+    url_init(&url);
+
+    e = url_parse_with_idna_cache(&url, (utf8_t *) "http://Bücher.example/foo/bar", -1, NULL, cache);
+    assert(e == 0);
+
+    test_get(url, href, "http://xn--bcher-kva.example/foo/bar");
+    test_get(url, host, "xn--bcher-kva.example");
+    test_get(url, path, "/foo/bar");
+
+    url_destroy(&url);
+  }
+
+  // ASCII hosts take the fast path and never reach the cache.
+  test_parse(url, "http://example.com/", NULL);
+  url_destroy(&url);
+
+  // Failures aren't cached.
+  for (int i = 0; i < 2; i++) {
+    url_t url;
+    url_init(&url);
+
+    e = url_parse_with_idna_cache(&url, (utf8_t *) "http://a\xe2\x80\x8d.example/", -1, NULL, cache);
+    assert(e == -1);
+
+    url_destroy(&url);
+  }
+
+  printf("hits = %llu, misses = %llu\n", (unsigned long long) url_idna_cache_hits(cache), (unsigned long long) url_idna_cache_misses(cache));
+
+  assert(url_idna_cache_hits(cache) == 2);
+  assert(url_idna_cache_misses(cache) == 3);
+  assert(url_idna_cache_size(cache) == 1);
+
+  url_idna_cache_destroy(cache);
+}
@@ -0,0 +1,20 @@
+#include "../include/url.h"
+#include "helpers.h"
+
+int
+main () {
+  // Invalid Punycode
+  test_parse_fail("http://xn--a/foo/bar", NULL);
+
+  // Label starting with a combining mark
+  test_parse_fail("http://\xcc\x81" "a.example/foo/bar", NULL);
+
+  // Zero width non-joiner without joining context
+  test_parse_fail("http://a\xe2\x80\x8c" "b.example/foo/bar", NULL);
+
+  // Left-to-right label starting with a digit in a bidi domain
+  test_parse_fail("http://1.\xd8\xa7/foo/bar", NULL);
+
+  // Forbidden domain code point after percent-decoding
+  test_parse_fail("http://exa%2Fmple.com/foo/bar", NULL);
+}
@@ -0,0 +1,71 @@
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+#include <utf.h>
+#include <utf/string.h>
+
+#include "../include/url.h"
+
+#define label_len 1000
+
+int
+main () {
+  int e;
+
+  // A label of distinct ideographs in scrambled order, long enough for both
+  // encoding and decoding to take their path for long labels.
+  static char label[label_len * 3 + 1];
+
+  for (size_t i = 0; i < label_len; i++) {
+    uint32_t code_point = 0x4e00 + (uint32_t) (i * 7919 % 20000);
+
+    label[i * 3 + 0] = (char) (0xe0 | (code_point >> 12));
+    label[i * 3 + 1] = (char) (0x80 | ((code_point >> 6) & 0x3f));
+    label[i * 3 + 2] = (char) (0x80 | (code_point & 0x3f));
+  }
+
+  static char input[sizeof(label) + 32];
+
+  snprintf(input, sizeof(input), "http://%s.example/", label);
+
+  url_t url;
+  url_init(&url);
+
+  e = url_parse(&url, (utf8_t *) input, -1, NULL);
+  assert(e == 0);
+
+  utf8_string_view_t host = url_get_host(&url);
+
+  printf("%.*s\n", (int) host.len, host.data);
+
+  assert(host.len > 4 && memcmp(host.data, "xn--", 4) == 0);
+
+  // Parsing the ACE form decodes and validates the label before encoding it
+  // again, which must give the same host.
+  url_t ace;
+  url_init(&ace);
+
+  utf8_string_view_t href = url_get_href(&url);
+
+  e = url_parse(&ace, href.data, href.len, NULL);
+  assert(e == 0);
+
+  assert(utf8_string_view_compare(url_get_host(&ace), host) == 0);
+
+  // And converting it back to Unicode gives the original label.
+  utf8_string_t arena;
+  utf8_string_init(&arena);
+
+  utf8_string_view_t result;
+
+  e = url_domains_to_unicode(&host, 1, &arena, &result);
+  assert(e == 0);
+
+  assert(result.len == strlen(label) + strlen(".example"));
+  assert(memcmp(result.data, label, strlen(label)) == 0);
+
+  utf8_string_destroy(&arena);
+
+  url_destroy(&ace);
+  url_destroy(&url);
+}
@@ -0,0 +1,23 @@
+#include "../include/url.h"
+#include "helpers.h"
+
+int
+main () {
+  // Part out of range
+  test_parse_fail("http://192.168.0.256/foo/bar", NULL);
+
+  // Too many parts
+  test_parse_fail("http://192.168.0.1.1/foo/bar", NULL);
+
+  // Part out of range before a trailing dot
+  test_parse_fail("http://192.168.0.256./foo/bar", NULL);
+
+  // Too many parts before a trailing dot
+  test_parse_fail("http://192.168.0.1.1./foo/bar", NULL);
+
+  // Invalid octal digit
+  test_parse_fail("http://192.168.0.09/foo/bar", NULL);
+
+  // Shortened address out of range
+  test_parse_fail("http://192.16777216/foo/bar", NULL);
+}
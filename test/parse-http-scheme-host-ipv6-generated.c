@@ -0,0 +1,135 @@
+#include <assert.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "../include/url.h"
+
+// Parses generated addresses written in several forms and checks the
+// serialized host against a straightforward formatter.
+
+static uint32_t state = 1;
+
+static uint32_t
+next (void) {
+  state = state * 1664525 + 1013904223;
+
+  return state >> 8;
+}
+
+static uint16_t
+next_piece (void) {
+  switch (next() % 4) {
+  case 0:
+    return 0;
+  case 1:
+    return next() % 0x10;
+  case 2:
+    return next() % 0x100;
+  default:
+    return next() % 0x10000;
+  }
+}
+
+// Compresses the first longest run of 0 pieces, like url__serialize_ipv6(),
+// which also compresses a run of a single 0 piece.
+static void
+format_expected (const uint16_t address[8], char *result) {
+  int compress = -1, compress_length = 0;
+
+  for (int i = 0; i < 8; i++) {
+    int j = i;
+
+    while (j < 8 && address[j] == 0) j++;
+
+    if (j - i > compress_length) {
+      compress = i;
+      compress_length = j - i;
+    }
+  }
+
+  char *p = result;
+
+  *p++ = '[';
+
+  for (int i = 0; i < 8; i++) {
+    if (i == compress) {
+      p += sprintf(p, i == 0 ? "::" : ":");
+      i += compress_length - 1;
+      continue;
+    }
+
+    p += sprintf(p, i == 7 ? "%x" : "%x:", address[i]);
+  }
+
+  *p++ = ']';
+  *p = '\0';
+}
+
+static void
+check (const char *input, const char *expected) {
+  char href[128];
+  snprintf(href, sizeof(href), "http://[%s]/", input);
+
+  url_t url;
+  url_init(&url);
+
+  int e = url_parse(&url, (utf8_t *) href, -1, NULL);
+  if (e != 0) printf("%s failed\n", input);
+  assert(e == 0);
+
+  utf8_string_view_t host = url_get_host(&url);
+
+  if (utf8_string_view_compare_literal(host, (utf8_t *) expected, -1) != 0) {
+    printf("%s: expected %s, got %.*s\n", input, expected, (int) host.len, host.data);
+  }
+
+  assert(utf8_string_view_compare_literal(host, (utf8_t *) expected, -1) == 0);
+
+  url_destroy(&url);
+}
+
+int
+main () {
+  for (int n = 0; n < 20000; n++) {
+    uint16_t address[8];
+
+    for (int i = 0; i < 8; i++) address[i] = next_piece();
+
+    if (n % 3 == 0) {
+      int start = next() % 8, end = start + next() % (9 - start);
+
+      for (int i = start; i < end; i++) address[i] = 0;
+    }
+
+    char expected[64], input[64];
+    format_expected(address, expected);
+
+    // Serialized form, which must round trip.
+    snprintf(input, sizeof(input), "%.*s", (int) strlen(expected) - 2, &expected[1]);
+    check(input, expected);
+
+    // Full form with leading zeros.
+    char *p = input;
+
+    for (int i = 0; i < 8; i++) p += sprintf(p, i == 7 ? "%04x" : "%04x:", address[i]);
+
+    check(input, expected);
+
+    // Uppercase without leading zeros.
+    p = input;
+
+    for (int i = 0; i < 8; i++) p += sprintf(p, i == 7 ? "%X" : "%X:", address[i]);
+
+    check(input, expected);
+
+    // Embedded IPv4 address in the last two pieces.
+    p = input;
+
+    for (int i = 0; i < 6; i++) p += sprintf(p, "%x:", address[i]);
+
+    sprintf(p, "%d.%d.%d.%d", address[6] >> 8, address[6] & 0xff, address[7] >> 8, address[7] & 0xff);
+
+    check(input, expected);
+  }
+}
@@ -0,0 +1,32 @@
+#include "../include/url.h"
+#include "helpers.h"
+
+int
+main () {
+  // More than one compressed run
+  test_parse_fail("http://[1::2::3]/foo/bar", NULL);
+
+  // Compressed run followed by another colon
+  test_parse_fail("http://[1:::2]/foo/bar", NULL);
+
+  // Compressed run after seven pieces and before an eighth
+  test_parse_fail("http://[1:2:3:4:5:6:7::8]/foo/bar", NULL);
+
+  // Compressed run after eight pieces
+  test_parse_fail("http://[1:2:3:4:5:6:7:8::]/foo/bar", NULL);
+
+  // Too many pieces
+  test_parse_fail("http://[1:2:3:4:5:6:7:8:9]/foo/bar", NULL);
+
+  // Piece longer than four digits
+  test_parse_fail("http://[12345::]/foo/bar", NULL);
+
+  // Trailing colon
+  test_parse_fail("http://[1:2:3:4:5:6:7:]/foo/bar", NULL);
+
+  // Leading single colon
+  test_parse_fail("http://[:1:2:3:4:5:6:7]/foo/bar", NULL);
+
+  // Invalid embedded IPv4 address
+  test_parse_fail("http://[::1.2.3]/foo/bar", NULL);
+}
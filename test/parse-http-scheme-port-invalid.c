@@ -0,0 +1,14 @@
+#include "../include/url.h"
+#include "helpers.h"
+
+int
+main () {
+  // Out of range
+  test_parse_fail("http://example.com:65536/foo/bar", NULL);
+
+  // Out of range, wrapping around to the default port in 32 bits
+  test_parse_fail("http://example.com:4294967376/foo/bar", NULL);
+
+  // Not a digit
+  test_parse_fail("http://example.com:12a/foo/bar", NULL);
+}
@@ -0,0 +1,22 @@
+#include "../include/url.h"
+#include "helpers.h"
+
+int
+main () {
+  test_parse(url, "HTTPS://Example.COM:443/foo/bar", NULL);
+
+  test_get(url, href, "https://example.com/foo/bar");
+  test_get(url, scheme, "https");
+  test_get(url, username, "");
+  test_get(url, password, "");
+  test_get(url, host, "example.com");
+  test_get(url, port, "");
+  test_get(url, path, "/foo/bar");
+  test_get(url, query, "");
+  test_get(url, fragment, "");
+
+  assert(url.type == url_type_https);
+  assert(url_get_port_number(&url) == 443);
+
+  url_destroy(&url);
+}
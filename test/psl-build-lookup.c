@@ -0,0 +1,190 @@
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <utf.h>
+#include <utf/string.h>
+
+#include "../include/url.h"
+#include "../include/url/psl.h"
+
+static const char *list =
+  "// ===BEGIN ICANN DOMAINS===\n"
+  "\n"
+  "com\n"
+  "biz\n"
+  "uk\n"
+  "co.uk\n"
+  "\n"
+  "// ck : https://en.wikipedia.org/wiki/.ck\n"
+  "*.ck\n"
+  "!www.ck\n"
+  "\n"
+  "jp\n"
+  "ac.jp\n"
+  "kyoto.jp\n"
+  "*.kobe.jp\n"
+  "!city.kobe.jp\n"
+  "\n"
+  "// xn--fiqs8s (\"Zhongguo/China\", Chinese, Simplified)\n"
+  "中国\n"
+  "\n"
+  "// ===BEGIN PRIVATE DOMAINS===\n"
+  "github.io   \r\n"
+  "\t*.compute.example.com";
+
+static const struct {
+  const char *host;
+  const char *suffix;
+  const char *registrable_domain;
+} cases[] = {
+  {"com", "com", ""},
+  {"example.com", "com", "example.com"},
+  {"www.example.com", "com", "example.com"},
+  {"example", "example", ""},
+  {"b.example.example", "example", "example.example"},
+  {"example.co.uk", "co.uk", "example.co.uk"},
+  {"a.b.example.uk.com", "com", "uk.com"},
+  {"ck", "ck", ""},
+  {"test.ck", "test.ck", ""},
+  {"b.test.ck", "test.ck", "b.test.ck"},
+  {"www.ck", "ck", "www.ck"},
+  {"www.www.ck", "ck", "www.ck"},
+  {"kyoto.jp", "kyoto.jp", ""},
+  {"test.kyoto.jp", "kyoto.jp", "test.kyoto.jp"},
+  {"c.kobe.jp", "c.kobe.jp", ""},
+  {"b.c.kobe.jp", "c.kobe.jp", "b.c.kobe.jp"},
+  {"city.kobe.jp", "kobe.jp", "city.kobe.jp"},
+  {"www.city.kobe.jp", "kobe.jp", "city.kobe.jp"},
+  {"xn--85x722f.xn--fiqs8s", "xn--fiqs8s", "xn--85x722f.xn--fiqs8s"},
+  {"foo.github.io", "github.io", "foo.github.io"},
+  {"a.b.compute.example.com", "b.compute.example.com", "a.b.compute.example.com"},
+  {"example.com.", "com.", "example.com."},
+  {"com.", "com.", ""},
+  {"example.1a", "1a", "example.1a"},
+  {"example.0xg", "0xg", "example.0xg"},
+};
+
+static void
+test_psl (const url_psl_t *psl) {
+  int e;
+
+  utf8_string_view_t suffix, registrable_domain;
+
+  for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+    utf8_string_view_t host = utf8_string_view_init((utf8_t *) cases[i].host, strlen(cases[i].host));
+
+    e = url_psl_lookup(psl, host, &suffix, &registrable_domain);
+    assert(e == 0);
+
+    printf("%s: suffix = %.*s, registrable domain = %.*s\n", cases[i].host, (int) suffix.len, suffix.data, (int) registrable_domain.len, registrable_domain.data);
+
+    assert(utf8_string_view_compare_literal(suffix, (utf8_t *) cases[i].suffix, -1) == 0);
+    assert(utf8_string_view_compare_literal(registrable_domain, (utf8_t *) cases[i].registrable_domain, -1) == 0);
+
+    // The results are views into the host.
+    assert(suffix.data >= host.data && suffix.data + suffix.len == host.data + host.len);
+  }
+
+  const char *invalid[] = {"", "1.2.3.4", "0x7f.1", "1.0x1f", "example.0x", "[::1]", "."};
+
+  for (size_t i = 0; i < sizeof(invalid) / sizeof(invalid[0]); i++) {
+    e = url_psl_lookup(psl, utf8_string_view_init((utf8_t *) invalid[i], strlen(invalid[i])), &suffix, &registrable_domain);
+    assert(e == -1);
+  }
+
+  // Hosts straight from a parsed URL.
+  url_t url;
+  url_init(&url);
+
+  e = url_parse(&url, (utf8_t *) "https://user@WWW.Example.CO.UK:8080/path", -1, NULL);
+  assert(e == 0);
+
+  utf8_string_view_t host = url_get_host(&url);
+
+  e = url_psl_lookup(psl, host, &suffix, &registrable_domain);
+  assert(e == 0);
+
+  assert(utf8_string_view_compare_literal(registrable_domain, (utf8_t *) "example.co.uk", -1) == 0);
+  assert(registrable_domain.data >= url.href.data && registrable_domain.data < url.href.data + url.href.len);
+
+  url_destroy(&url);
+}
+
+int
+main () {
+  int e;
+
+  url_psl_builder_t *builder;
+  e = url_psl_builder_init(&builder);
+  assert(e == 0);
+
+  e = url_psl_builder_add_list(builder, (utf8_t *) list, strlen(list));
+  assert(e == 0);
+
+  e = url_psl_builder_add_rule(builder, (utf8_t *) "!", 1);
+  assert(e == -1);
+
+  e = url_psl_builder_add_rule(builder, (utf8_t *) "a..b", 4);
+  assert(e == -1);
+
+  utf8_string_t data;
+  utf8_string_init(&data);
+
+  e = url_psl_builder_serialize(builder, &data);
+  assert(e == 0);
+
+  url_psl_t *psl;
+  e = url_psl_init(data.data, data.len, &psl);
+  assert(e == 0);
+
+  test_psl(psl);
+
+  url_psl_close(psl);
+
+  e = url_psl_init(data.data, 16, &psl);
+  assert(e == -1);
+
+  e = url_psl_init(data.data, data.len - 1, &psl);
+  assert(e == -1);
+
+  data.data[0] = 'X';
+
+  e = url_psl_init(data.data, data.len, &psl);
+  assert(e == -1);
+
+  // A root that claims more children than there are nodes.
+  static const utf8_t malformed[64] = {
+    'U', 'R', 'L', 'P', 1, 0, 0, 0,
+    2, 0, 0, 0, 0, 0, 0, 0,  // Node count
+    32, 0, 0, 0, 0, 0, 0, 0, // Nodes offset
+    56, 0, 0, 0, 0, 0, 0, 0, // Labels offset
+    0, 0, 0, 0, 1, 0, 0, 0, 0xff, 0xff, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 1,
+    'z', 'z', 'z',
+  };
+
+  e = url_psl_init(malformed, sizeof(malformed), &psl);
+  assert(e == -1);
+
+  char path[256];
+  const char *tmp = getenv("TMPDIR");
+  if (tmp == NULL) tmp = getenv("TEMP");
+  if (tmp == NULL) tmp = "/tmp";
+  snprintf(path, sizeof(path), "%s/url-psl-build-lookup.urlp", tmp);
+
+  e = url_psl_builder_write(builder, path);
+  assert(e == 0);
+
+  e = url_psl_open(path, &psl);
+  assert(e == 0);
+
+  test_psl(psl);
+
+  url_psl_close(psl);
+
+  remove(path);
+
+  url_psl_builder_destroy(builder);
+  utf8_string_destroy(&data);
+}
@@ -0,0 +1,61 @@
+#include <assert.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <utf.h>
+#include <utf/string.h>
+
+#include "../include/url.h"
+#include "../include/url/ref.h"
+
+#define threads 8
+#define per_thread 100000
+
+static url_ref_t *ref;
+
+static void *
+on_thread (void *data) {
+  url_ref_t *own = data;
+
+  for (int i = 0; i < per_thread; i++) {
+    url_ref_t *copy = url_ref_retain(own);
+
+    assert(url_get_host(url_ref_get(copy)).len == 11);
+
+    url_ref_release(copy);
+  }
+
+  url_ref_release(own);
+
+  return NULL;
+}
+
+int
+main () {
+  int e;
+
+  url_t url;
+  url_init(&url);
+
+  e = url_parse(&url, (utf8_t *) "https://example.com/foo/bar", -1, NULL);
+  assert(e == 0);
+
+  e = url_ref_move(&url, &ref);
+  assert(e == 0);
+
+  pthread_t thread[threads];
+
+  for (int i = 0; i < threads; i++) {
+    e = pthread_create(&thread[i], NULL, on_thread, url_ref_retain(ref));
+    assert(e == 0);
+  }
+
+  for (int i = 0; i < threads; i++) {
+    pthread_join(thread[i], NULL);
+  }
+
+  printf("count = %zu\n", url_ref_count(ref));
+
+  assert(url_ref_count(ref) == 1);
+
+  url_ref_release(ref);
+}
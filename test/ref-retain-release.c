@@ -0,0 +1,81 @@
+#include <assert.h>
+#include <stdio.h>
+#include <utf.h>
+#include <utf/string.h>
+
+#include "../include/url.h"
+#include "../include/url/ref.h"
+
+int
+main () {
+  int e;
+
+  url_t url;
+  url_init(&url);
+
+  e = url_parse(&url, (utf8_t *) "https://user@example.com:8080/foo/bar?baz#quux", -1, NULL);
+  assert(e == 0);
+
+  url_ref_t *ref;
+  e = url_ref_init(&url, &ref);
+  assert(e == 0);
+
+  url_destroy(&url);
+
+  assert(url_ref_count(ref) == 1);
+
+  const url_t *shared = url_ref_get(ref);
+
+  utf8_string_view_t href = url_get_href(shared);
+  printf("%.*s\n", (int) href.len, href.data);
+
+  assert(utf8_string_view_compare_literal(href, (utf8_t *) "https://user@example.com:8080/foo/bar?baz#quux", -1) == 0);
+  assert(utf8_string_view_compare_literal(url_get_host(shared), (utf8_t *) "example.com", -1) == 0);
+  assert(url_get_port_number(shared) == 8080);
+
+  // Copies share the same URL.
+  url_ref_t *copy = url_ref_retain(ref);
+
+  assert(copy == ref);
+  assert(url_ref_count(ref) == 2);
+
+  // Unsharing while another reference is held clones the URL.
+  url_t cloned;
+
+  e = url_ref_unshare(copy, &cloned);
+  assert(e == 0);
+
+  assert(url_ref_count(ref) == 1);
+  assert(cloned.href.data != shared->href.data);
+  assert(cloned.href.cap == cloned.href.len + 1);
+  assert(utf8_string_view_compare(url_get_href(&cloned), href) == 0);
+  assert(utf8_string_view_compare_literal(url_get_path(&cloned), (utf8_t *) "/foo/bar", -1) == 0);
+
+  // Unsharing the last reference hands over the href without copying.
+  const utf8_t *data = shared->href.data;
+
+  url_t unshared;
+
+  e = url_ref_unshare(ref, &unshared);
+  assert(e == 0);
+
+  assert(unshared.href.data == data);
+  assert(utf8_string_view_compare(url_get_href(&unshared), url_get_href(&cloned)) == 0);
+
+  // The unshared URL may be modified, reusing the header space.
+  e = utf8_string_append_literal(&unshared.href, (utf8_t *) "-quuz", -1);
+  assert(e == 0);
+
+  assert(utf8_string_view_compare_literal(url_get_fragment(&unshared), (utf8_t *) "quux-quuz", -1) == 0);
+
+  // Moving takes over the href storage.
+  e = url_ref_move(&unshared, &ref);
+  assert(e == 0);
+
+  assert(unshared.href.data == NULL);
+  assert(utf8_string_view_compare_literal(url_get_fragment(url_ref_get(ref)), (utf8_t *) "quux-quuz", -1) == 0);
+
+  url_ref_release(ref);
+
+  url_destroy(&cloned);
+}
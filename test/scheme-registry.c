@@ -0,0 +1,120 @@
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+#include <utf.h>
+#include <utf/string.h>
+
+#include "../include/url.h"
+#include "../include/url/scheme.h"
+
+#define lookup(registry, name) \
+  url_scheme_registry_lookup(registry, utf8_string_view_init((const utf8_t *) name, strlen(name)))
+
+#define add(registry, name, port, data) \
+  url_scheme_registry_add(registry, (const utf8_t *) name, strlen(name), port, data)
+
+static int pear_data;
+static int hyper_data;
+
+int
+main () {
+  int e;
+
+  url_scheme_registry_t *registry;
+  e = url_scheme_registry_init(&registry);
+  assert(e == 0);
+
+  const url_scheme_t *scheme;
+
+  scheme = lookup(registry, "https");
+  assert(scheme && scheme->type == url_type_https && scheme->default_port == 443);
+
+  scheme = lookup(registry, "HTTPS");
+  assert(scheme && scheme->type == url_type_https);
+  assert(scheme->len == 5 && memcmp(scheme->name, "https", 5) == 0);
+
+  scheme = lookup(registry, "Ws");
+  assert(scheme && scheme->type == url_type_ws && scheme->default_port == 80);
+
+  scheme = lookup(registry, "ftp");
+  assert(scheme && scheme->type == url_type_ftp && scheme->default_port == 21);
+
+  scheme = lookup(registry, "file");
+  assert(scheme && scheme->type == url_type_file && scheme->default_port == -1);
+
+  assert(lookup(registry, "pear") == NULL);
+  assert(lookup(registry, "htt") == NULL);
+  assert(lookup(registry, "httpss") == NULL);
+  assert(lookup(registry, "") == NULL);
+
+  e = add(registry, "pear", -1, &pear_data);
+  assert(e == 0);
+
+  e = add(registry, "Hyper", 49737, &hyper_data);
+  assert(e == 0);
+
+  e = add(registry, "bare+ssh", 22, NULL);
+  assert(e == 0);
+
+  assert(url_scheme_registry_size(registry) == 3);
+
+  scheme = lookup(registry, "pear");
+  assert(scheme && scheme->type == url_type_opaque);
+  assert(scheme->default_port == -1 && scheme->data == &pear_data);
+
+  scheme = lookup(registry, "HYPER");
+  assert(scheme && scheme->default_port == 49737 && scheme->data == &hyper_data);
+  assert(scheme->len == 5 && memcmp(scheme->name, "hyper", 5) == 0);
+
+  scheme = lookup(registry, "bare+ssh");
+  assert(scheme && scheme->default_port == 22 && scheme->data == NULL);
+
+  assert(lookup(registry, "pea") == NULL);
+  assert(lookup(registry, "bare") == NULL);
+
+  // Duplicates, special schemes, invalid names and invalid ports
+  assert(add(registry, "pear", 1, NULL) == -1);
+  assert(add(registry, "PEAR", 1, NULL) == -1);
+  assert(add(registry, "http", 8080, NULL) == -1);
+  assert(add(registry, "FILE", -1, NULL) == -1);
+  assert(add(registry, "", -1, NULL) == -1);
+  assert(add(registry, "1pear", -1, NULL) == -1);
+  assert(add(registry, "pe ar", -1, NULL) == -1);
+  assert(add(registry, "pear:", -1, NULL) == -1);
+  assert(add(registry, "apple", -2, NULL) == -1);
+  assert(add(registry, "apple", 65536, NULL) == -1);
+
+  assert(url_scheme_registry_size(registry) == 3);
+
+  const url_scheme_t *pear = lookup(registry, "pear");
+
+  char names[512][16];
+
+  for (int i = 0; i < 512; i++) {
+    snprintf(names[i], sizeof(names[i]), "x-scheme%d", i);
+
+    e = add(registry, names[i], i, NULL);
+    assert(e == 0);
+  }
+
+  assert(url_scheme_registry_size(registry) == 515);
+
+  for (int i = 0; i < 512; i++) {
+    scheme = lookup(registry, names[i]);
+    assert(scheme && scheme->default_port == i);
+    assert(scheme->len == strlen(names[i]) && memcmp(scheme->name, names[i], scheme->len) == 0);
+  }
+
+  for (int i = 512; i < 4096; i++) {
+    char name[16];
+    snprintf(name, sizeof(name), "x-scheme%d", i);
+
+    assert(lookup(registry, name) == NULL);
+  }
+
+  // Pointers returned by lookups stay valid as more schemes are registered.
+  assert(lookup(registry, "pear") == pear);
+  assert(pear->data == &pear_data);
+
+  url_scheme_registry_destroy(registry);
+}
@@ -0,0 +1,69 @@
+#include <assert.h>
+#include <stdio.h>
+#include <utf.h>
+#include <utf/string.h>
+
+#include "../include/url.h"
+#include "../include/url/set.h"
+
+int
+main () {
+  int e;
+
+  url_set_t *set;
+  e = url_set_init(&set);
+  assert(e == 0);
+
+  utf8_string_view_t a = utf8_string_view_init((utf8_t *) "https://example.com/foo", 23);
+
+  assert(!url_set_has(set, a));
+
+  e = url_set_add(set, a);
+  assert(e == 1);
+
+  e = url_set_add(set, a);
+  assert(e == 0);
+
+  assert(url_set_has(set, a));
+  assert(url_set_size(set) == 1);
+
+  for (int i = 0; i < 10000; i++) {
+    char input[64];
+    snprintf(input, 64, "https://example.com/%d?q=%d", i % 5000, i % 5000);
+
+    url_t url;
+    url_init(&url);
+
+    e = url_parse(&url, (utf8_t *) input, -1, NULL);
+    assert(e == 0);
+
+    e = url_set_add(set, url_get_href(&url));
+    assert(e == (i < 5000 ? 1 : 0));
+
+    // Adding it again finds it without growing the set, even when the
+    // insertion left its shard at the load factor limit.
+    size_t memory = url_set_memory_usage(set);
+
+    e = url_set_add(set, url_get_href(&url));
+    assert(e == 0);
+
+    assert(url_set_memory_usage(set) == memory);
+
+    url_destroy(&url);
+  }
+
+  assert(url_set_size(set) == 5001);
+
+  utf8_string_view_t b = utf8_string_view_init((utf8_t *) "https://example.com/4999?q=4999", 31);
+
+  assert(url_set_has(set, b));
+
+  utf8_string_view_t c = utf8_string_view_init((utf8_t *) "https://example.com/5000?q=5000", 31);
+
+  assert(!url_set_has(set, c));
+
+  printf("size = %zu\n", url_set_size(set));
+  printf("memory = %zu\n", url_set_memory_usage(set));
+
+  url_set_destroy(set);
+}
@@ -0,0 +1,61 @@
+#include <assert.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <utf.h>
+#include <utf/string.h>
+
+#include "../include/url/set.h"
+
+#define threads 8
+#define per_thread 20000
+
+static url_set_t *set;
+
+static int inserted[threads];
+
+static void *
+on_thread (void *data) {
+  int *inserted = data;
+
+  for (int i = 0; i < per_thread; i++) {
+    char href[64];
+    int len = snprintf(href, 64, "https://example.com/%d", i);
+
+    int e = url_set_add(set, utf8_string_view_init((utf8_t *) href, len));
+    assert(e >= 0);
+
+    *inserted += e;
+  }
+
+  return NULL;
+}
+
+int
+main () {
+  int e;
+
+  e = url_set_init(&set);
+  assert(e == 0);
+
+  pthread_t thread[threads];
+
+  for (int i = 0; i < threads; i++) {
+    e = pthread_create(&thread[i], NULL, on_thread, &inserted[i]);
+    assert(e == 0);
+  }
+
+  int total = 0;
+
+  for (int i = 0; i < threads; i++) {
+    pthread_join(thread[i], NULL);
+
+    total += inserted[i];
+  }
+
+  printf("inserted = %d\n", total);
+
+  assert(total == per_thread);
+  assert(url_set_size(set) == per_thread);
+
+  url_set_destroy(set);
+}
@@ -0,0 +1,130 @@
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <utf.h>
+#include <utf/string.h>
+
+#include "../include/url.h"
+#include "../include/url/store.h"
+
+#define count 100
+
+int
+main () {
+  int e;
+
+  url_t urls[count];
+
+  for (int i = 0; i < count; i++) {
+    char input[64];
+    snprintf(input, 64, "https://example.com/%s/%03d?q=%d", i < 50 ? "a" : "b", i, i);
+
+    url_init(&urls[i]);
+
+    e = url_parse(&urls[i], (utf8_t *) input, -1, NULL);
+    assert(e == 0);
+  }
+
+  url_store_builder_t *builder;
+  e = url_store_builder_init(&builder);
+  assert(e == 0);
+
+  for (int i = 0; i < count; i++) {
+    e = url_store_builder_add(builder, &urls[i]);
+    assert(e == 0);
+  }
+
+  // Out of order and duplicate hrefs are rejected.
+  e = url_store_builder_add(builder, &urls[0]);
+  assert(e == -1);
+
+  e = url_store_builder_add(builder, &urls[count - 1]);
+  assert(e == -1);
+
+  url_store_t *store;
+  e = url_store_builder_finish(builder, &store);
+  assert(e == 0);
+
+  url_store_builder_destroy(builder);
+
+  assert(url_store_size(store) == count);
+
+  size_t raw = 0;
+
+  for (int i = 0; i < count; i++) raw += urls[i].href.len;
+
+  printf("raw = %zu, stored = %zu\n", raw, url_store_memory_usage(store));
+
+  assert(url_store_memory_usage(store) < raw);
+
+  for (int i = count - 1; i >= 0; i--) {
+    url_t url;
+    url_init(&url);
+
+    e = url_store_get(store, i, &url);
+    assert(e == 0);
+
+    assert(utf8_string_view_compare(url_get_href(&url), url_get_href(&urls[i])) == 0);
+    assert(memcmp(&url.components, &urls[i].components, sizeof(url.components)) == 0);
+    assert(url.type == urls[i].type);
+    assert(url.host_type == url_host_type_domain);
+
+    url_destroy(&url);
+
+    size_t ordinal;
+    e = url_store_find(store, url_get_href(&urls[i]), &ordinal);
+    assert(e == 1);
+    assert(ordinal == (size_t) i);
+  }
+
+  size_t ordinal;
+
+  e = url_store_find(store, utf8_string_view_init((utf8_t *) "a", 1), &ordinal);
+  assert(e == 0);
+  assert(ordinal == 0);
+
+  e = url_store_find(store, utf8_string_view_init((utf8_t *) "z", 1), &ordinal);
+  assert(e == 0);
+  assert(ordinal == count);
+
+  e = url_store_find(store, utf8_string_view_init((utf8_t *) "https://example.com/a/010?r", 27), &ordinal);
+  assert(e == 0);
+  assert(ordinal == 11);
+
+  size_t start, end;
+
+  url_store_prefix_range(store, utf8_string_view_init((utf8_t *) "https://example.com/b/", 22), &start, &end);
+  assert(start == 50);
+  assert(end == count);
+
+  url_store_prefix_range(store, utf8_string_view_init((utf8_t *) "https://example.com/a/01", 24), &start, &end);
+  assert(start == 10);
+  assert(end == 20);
+
+  url_store_prefix_range(store, utf8_string_view_init((utf8_t *) "https://example.org/", 20), &start, &end);
+  assert(start == end);
+
+  url_store_iterator_t iterator;
+  url_store_iterator_init(&iterator, store, 10, 40);
+
+  size_t i = 10;
+
+  url_t url;
+
+  while ((e = url_store_iterator_next(&iterator, &url)) == 1) {
+    assert(utf8_string_view_compare(url_get_href(&url), url_get_href(&urls[i])) == 0);
+    assert(utf8_string_view_compare(url_get_query(&url), url_get_query(&urls[i])) == 0);
+
+    i++;
+  }
+
+  assert(e == 0);
+  assert(i == 40);
+
+  url_store_iterator_destroy(&iterator);
+
+  url_store_destroy(store);
+
+  for (int i = 0; i < count; i++) url_destroy(&urls[i]);
+}
@@ -0,0 +1,76 @@
+#include <assert.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <utf.h>
+#include <utf/string.h>
+
+#include "../include/url.h"
+#include "../include/url/trace.h"
+
+static url_trace_t last;
+static int calls = 0;
+
+static void
+on_parse (const url_t *url, const url_trace_t *trace, void *data) {
+  assert(data == &calls);
+  assert(url_get_href(url).len > 0);
+
+  last = *trace;
+  calls++;
+}
+
+int
+main () {
+  int e;
+
+  url_trace_t trace;
+
+  url_trace_reset();
+  url_trace_get(&trace);
+  assert(trace.parses == 0 && trace.allocations == 0 && trace.slack == 0);
+
+  url_trace_on_parse(on_parse, &calls);
+
+  url_t url;
+  url_init(&url);
+
+  e = url_parse(&url, (utf8_t *) "https://example.com/a/b/../c?q=1 2#f", -1, NULL);
+  assert(e == 0);
+
+  uint64_t slack = url.href.cap - url.href.len - 1;
+
+#if defined(URL_TRACE)
+  url_trace_get(&trace);
+  assert(trace.parses == 1);
+  assert(trace.allocations >= 1);
+  assert(trace.bytes >= url.href.cap);
+  assert(trace.slack == slack);
+
+  assert(calls == 1);
+  assert(last.parses == 1);
+  assert(last.allocations == trace.allocations);
+  assert(last.reallocations == trace.reallocations);
+  assert(last.bytes == trace.bytes);
+  assert(last.slack == slack);
+#else
+  url_trace_get(&trace);
+  assert(trace.parses == 0);
+
+  url_trace_sample(&url);
+
+  url_trace_get(&trace);
+  assert(trace.parses == 1);
+  assert(trace.allocations == 0);
+  assert(trace.slack == slack);
+
+  assert(calls == 0);
+#endif
+
+  url_destroy(&url);
+
+  url_trace_on_parse(NULL, NULL);
+
+  url_trace_reset();
+  url_trace_get(&trace);
+  assert(trace.parses == 0 && trace.slack == 0);
+}
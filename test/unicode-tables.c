@@ -0,0 +1,346 @@
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../include/url/unicode.h"
+
+// Checks the generated tables against the Unicode data they are generated
+// from, for every code point.
+
+#define code_points 0x110000
+
+// Unlike assert(), evaluated and reported in release builds as well.
+#define check(condition) \
+  do { \
+    if (!(condition)) { \
+      fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+      exit(1); \
+    } \
+  } while (0)
+
+typedef struct {
+  char *fields[16];
+  size_t len;
+} line_t;
+
+static bool
+read_line (FILE *file, char *buffer, size_t size, line_t *line) {
+  while (fgets(buffer, (int) size, file)) {
+    char *comment = strchr(buffer, '#');
+    if (comment) *comment = '\0';
+
+    char *end = buffer + strlen(buffer);
+    while (end > buffer && (end[-1] == '\n' || end[-1] == ' ')) *--end = '\0';
+
+    if (*buffer == '\0') continue;
+
+    line->len = 0;
+
+    for (char *field = buffer; field; line->len++) {
+      char *next = strchr(field, ';');
+      if (next) *next++ = '\0';
+
+      while (*field == ' ') field++;
+
+      char *end = field + strlen(field);
+      while (end > field && end[-1] == ' ') *--end = '\0';
+
+      line->fields[line->len] = field;
+
+      field = next;
+    }
+
+    return true;
+  }
+
+  return false;
+}
+
+static FILE *
+open_data (const char *name) {
+  char path[256];
+  snprintf(path, sizeof(path), "data/unicode/%s", name);
+
+  FILE *file = fopen(path, "r");
+  check(file);
+
+  return file;
+}
+
+static void
+parse_range (const char *field, uint32_t *start, uint32_t *end) {
+  char *rest;
+
+  *start = *end = (uint32_t) strtoul(field, &rest, 16);
+
+  if (rest[0] == '.' && rest[1] == '.') *end = (uint32_t) strtoul(rest + 2, NULL, 16);
+}
+
+static size_t
+parse_code_points (const char *field, uint32_t *result) {
+  size_t len = 0;
+
+  for (char *rest; *field; field = rest) {
+    result[len++] = (uint32_t) strtoul(field, &rest, 16);
+
+    while (*rest == ' ') rest++;
+  }
+
+  return len;
+}
+
+static void
+test_idna (void) {
+  FILE *file = open_data("IdnaMappingTable.txt");
+
+  char buffer[512];
+  line_t line;
+
+  size_t count = 0;
+
+  while (read_line(file, buffer, sizeof(buffer), &line)) {
+    uint32_t start, end;
+    parse_range(line.fields[0], &start, &end);
+
+    const char *status = line.fields[1];
+
+    url_idna_status_t expected;
+    uint32_t mapping[32];
+    size_t mapping_len = 0;
+
+    if (strcmp(status, "valid") == 0 || strcmp(status, "disallowed_STD3_valid") == 0) {
+      expected = url_idna_valid;
+    } else if (strcmp(status, "mapped") == 0 || strcmp(status, "disallowed_STD3_mapped") == 0) {
+      expected = url_idna_mapped;
+      mapping_len = parse_code_points(line.fields[2], mapping);
+    } else if (strcmp(status, "deviation") == 0) {
+      expected = url_idna_deviation;
+    } else if (strcmp(status, "ignored") == 0) {
+      expected = url_idna_ignored;
+    } else {
+      check(strcmp(status, "disallowed") == 0);
+      expected = url_idna_disallowed;
+    }
+
+    for (uint32_t cp = start; cp <= end; cp++, count++) {
+      const uint32_t *actual_mapping;
+      size_t actual_len;
+
+      check(url__unicode_idna_status(cp, &actual_mapping, &actual_len) == expected);
+
+      if (expected == url_idna_mapped) {
+        check(actual_len == mapping_len);
+        check(memcmp(actual_mapping, mapping, mapping_len * sizeof(uint32_t)) == 0);
+      }
+    }
+  }
+
+  check(count == code_points);
+
+  fclose(file);
+}
+
+static void
+test_properties (void) {
+  static uint8_t combining_class[code_points];
+  static uint8_t bidi_class[code_points];
+  static uint8_t joining_type[code_points];
+  static bool mark[code_points];
+
+  memset(bidi_class, url_bidi_l, sizeof(bidi_class));
+  memset(joining_type, url_joining_u, sizeof(joining_type));
+
+  char buffer[512];
+  line_t line;
+  uint32_t start, end;
+
+  FILE *file = open_data("DerivedCombiningClass.txt");
+
+  while (read_line(file, buffer, sizeof(buffer), &line)) {
+    parse_range(line.fields[0], &start, &end);
+
+    for (uint32_t cp = start; cp <= end; cp++) combining_class[cp] = (uint8_t) atoi(line.fields[1]);
+  }
+
+  fclose(file);
+
+  static const char *bidi_names[] = {"L", "R", "AL", "AN", "EN", "ES", "CS", "ET", "ON", "BN", "NSM"};
+
+  file = open_data("DerivedBidiClass.txt");
+
+  while (read_line(file, buffer, sizeof(buffer), &line)) {
+    parse_range(line.fields[0], &start, &end);
+
+    uint8_t value = url_bidi_other;
+
+    for (uint8_t i = 0; i < sizeof(bidi_names) / sizeof(bidi_names[0]); i++) {
+      if (strcmp(line.fields[1], bidi_names[i]) == 0) value = i;
+    }
+
+    for (uint32_t cp = start; cp <= end; cp++) bidi_class[cp] = value;
+  }
+
+  fclose(file);
+
+  static const char *joining_names[] = {"U", "D", "L", "R", "T", "C"};
+
+  file = open_data("DerivedJoiningType.txt");
+
+  while (read_line(file, buffer, sizeof(buffer), &line)) {
+    parse_range(line.fields[0], &start, &end);
+
+    uint8_t value = 0xff;
+
+    for (uint8_t i = 0; i < sizeof(joining_names) / sizeof(joining_names[0]); i++) {
+      if (strcmp(line.fields[1], joining_names[i]) == 0) value = i;
+    }
+
+    check(value != 0xff);
+
+    for (uint32_t cp = start; cp <= end; cp++) joining_type[cp] = value;
+  }
+
+  fclose(file);
+
+  file = open_data("DerivedGeneralCategory.txt");
+
+  while (read_line(file, buffer, sizeof(buffer), &line)) {
+    parse_range(line.fields[0], &start, &end);
+
+    for (uint32_t cp = start; cp <= end; cp++) mark[cp] = line.fields[1][0] == 'M';
+  }
+
+  fclose(file);
+
+  for (uint32_t cp = 0; cp < code_points; cp++) {
+    check(url__unicode_combining_class(cp) == combining_class[cp]);
+    check(url__unicode_bidi_class(cp) == (url_bidi_class_t) bidi_class[cp]);
+    check(url__unicode_joining_type(cp) == (url_joining_type_t) joining_type[cp]);
+    check(url__unicode_is_mark(cp) == mark[cp]);
+  }
+}
+
+typedef struct {
+  uint32_t cp;
+  uint32_t mapping[2];
+  size_t len;
+} decomposition_t;
+
+// UnicodeData.txt is sorted by code point.
+static decomposition_t decompositions[4096];
+static size_t decompositions_len = 0;
+
+static const decomposition_t *
+find_decomposition (uint32_t cp) {
+  size_t low = 0, high = decompositions_len;
+
+  while (low < high) {
+    size_t mid = low + (high - low) / 2;
+
+    if (decompositions[mid].cp == cp) return &decompositions[mid];
+
+    if (decompositions[mid].cp < cp) low = mid + 1;
+    else high = mid;
+  }
+
+  return NULL;
+}
+
+static size_t
+decompose (uint32_t cp, uint32_t *result) {
+  const decomposition_t *decomposition = find_decomposition(cp);
+
+  if (decomposition == NULL) {
+    result[0] = cp;
+
+    return 1;
+  }
+
+  size_t len = 0;
+
+  for (size_t i = 0; i < decomposition->len; i++) {
+    len += decompose(decomposition->mapping[i], &result[len]);
+  }
+
+  return len;
+}
+
+static void
+test_normalization (void) {
+  char buffer[512];
+  line_t line;
+
+  FILE *file = open_data("UnicodeData.txt");
+
+  while (read_line(file, buffer, sizeof(buffer), &line)) {
+    const char *mapping = line.fields[5];
+
+    if (mapping[0] == '\0' || mapping[0] == '<') continue;
+
+    check(decompositions_len < sizeof(decompositions) / sizeof(decompositions[0]));
+
+    decomposition_t *decomposition = &decompositions[decompositions_len++];
+
+    decomposition->cp = (uint32_t) strtoul(line.fields[0], NULL, 16);
+    decomposition->len = parse_code_points(mapping, decomposition->mapping);
+  }
+
+  fclose(file);
+
+  static bool excluded[code_points];
+
+  file = open_data("CompositionExclusions.txt");
+
+  while (read_line(file, buffer, sizeof(buffer), &line)) {
+    excluded[strtoul(line.fields[0], NULL, 16)] = true;
+  }
+
+  fclose(file);
+
+  size_t compositions = 0;
+
+  for (uint32_t cp = 0; cp < code_points; cp++) {
+    uint32_t expected[8], actual[4];
+
+    // Hangul syllables are decomposed algorithmically.
+    if (cp >= 0xac00 && cp <= 0xd7a3) continue;
+
+    const decomposition_t *decomposition = find_decomposition(cp);
+
+    size_t len = decomposition == NULL ? 0 : decompose(cp, expected);
+
+    check(url__unicode_decompose(cp, actual) == len);
+    check(memcmp(actual, expected, len * sizeof(uint32_t)) == 0);
+
+    if (decomposition == NULL || decomposition->len != 2) continue;
+
+    uint32_t first = decomposition->mapping[0];
+    uint32_t second = decomposition->mapping[1];
+
+    bool primary = !excluded[cp] && url__unicode_combining_class(cp) == 0 && url__unicode_combining_class(first) == 0;
+
+    check(url__unicode_compose(first, second) == (primary ? cp : 0));
+
+    if (primary) compositions++;
+  }
+
+  check(compositions > 0);
+
+  uint32_t result[4];
+
+  check(url__unicode_decompose(0xac01, result) == 3);
+  check(result[0] == 0x1100 && result[1] == 0x1161 && result[2] == 0x11a8);
+
+  check(url__unicode_compose(0x1100, 0x1161) == 0xac00);
+  check(url__unicode_compose(0xac00, 0x11a8) == 0xac01);
+  check(url__unicode_compose(0x61, 0x62) == 0);
+}
+
+int
+main () {
+  test_idna();
+  test_properties();
+  test_normalization();
+}